@@ -46,7 +46,9 @@ postconstr = '''
 self.version = self.getVersion()
 '''
 
-blacklist = ['tiglLogToFileStreamEnabled']
+blacklist = ['tiglLogToFileStreamEnabled', 'tiglSetProgressCallback',
+             'tiglWingComponentSegmentFindSegments',
+             'tiglWingComponentSegmentGetMaterials']
 
 if __name__ == '__main__':
     # parse the file
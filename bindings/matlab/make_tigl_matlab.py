@@ -13,7 +13,9 @@ import bindings_generator.matlab_generator as MG
 import bindings_generator.cheader_parser   as CP
 
 
-blacklist = ['tiglLogToFileStreamEnabled']
+blacklist = ['tiglLogToFileStreamEnabled', 'tiglSetProgressCallback',
+             'tiglWingComponentSegmentFindSegments',
+             'tiglWingComponentSegmentGetMaterials']
 
 if __name__ == '__main__':
     # parse the file    
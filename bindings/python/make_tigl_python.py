@@ -59,7 +59,9 @@ postconstr = '''
 self.version = self.getVersion()
 '''
 
-blacklist = ['tiglCloseCPACSConfiguration', 'tiglLogToFileStreamEnabled']
+blacklist = ['tiglCloseCPACSConfiguration', 'tiglLogToFileStreamEnabled', 'tiglSetProgressCallback',
+             'tiglWingComponentSegmentFindSegments',
+             'tiglWingComponentSegmentGetMaterials']
 
 if __name__ == '__main__':
     # parse the file
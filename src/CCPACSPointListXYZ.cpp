@@ -16,6 +16,7 @@ namespace tigl
             throw CTiglError("component vectors in CCPACSPointListXYZ must all have the same number of elements");
         }
         m_vec.clear();
+        m_vec.reserve(xs.size());
         for (std::size_t i = 0; i < xs.size(); i++) {
             m_vec.push_back(CTiglPoint(xs[i], ys[i], zs[i]));
         }
@@ -31,6 +32,9 @@ namespace tigl
         xs.clear();
         ys.clear();
         zs.clear();
+        xs.reserve(m_vec.size());
+        ys.reserve(m_vec.size());
+        zs.reserve(m_vec.size());
         for (std::vector<CTiglPoint>::const_iterator it = m_vec.begin(); it != m_vec.end(); ++it) {
             xs.push_back(it->x);
             ys.push_back(it->y);
@@ -1,36 +1,363 @@
-#include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <clocale>
+#include <locale.h>
+#if defined(__APPLE__)
+#include <xlocale.h>
+#endif
 
 #include "CCPACSStringVector.h"
 
+#ifdef _MSC_VER
+    #define snprintf _snprintf
+#endif
+
 namespace tigl
 {
     namespace
     {
         const char sep = ';';
+
+        // strtod using the "C" locale, independent of the locale of the application
+#if defined(_WIN32)
+        _locale_t CLocale()
+        {
+            static _locale_t locale = _create_locale(LC_NUMERIC, "C");
+            return locale;
+        }
+
+        double strtodC(const char* str, char** end)
+        {
+            return _strtod_l(str, end, CLocale());
+        }
+#else
+        locale_t CLocale()
+        {
+            static locale_t locale = newlocale(LC_NUMERIC_MASK, "C", static_cast<locale_t>(0));
+            return locale;
+        }
+
+        double strtodC(const char* str, char** end)
+        {
+            return strtod_l(str, end, CLocale());
+        }
+#endif
+
+        const double powersOfTen[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        bool isSpace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+        }
+
+        bool isDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        // Parses the number at str without allocating memory.
+        // Decimal numbers with up to 19 significant digits, whose value is exactly representable
+        // after scaling by a power of ten up to 1e22, are converted directly. As mantissa and power
+        // of ten are exact doubles, the single multiplication or division is correctly rounded.
+        // All other numbers are passed to strtod using the "C" locale.
+        double parseDouble(const char* str)
+        {
+            const char* p = str;
+            while (isSpace(*p)) {
+                ++p;
+            }
+
+            bool negative = false;
+            if (*p == '-' || *p == '+') {
+                negative = *p == '-';
+                ++p;
+            }
+
+            unsigned long long mantissa = 0;
+            int nSignificant = 0;
+            int nDigits = 0;
+            int exponent = 0;
+            for (; isDigit(*p); ++p, ++nDigits) {
+                if (nSignificant < 19) {
+                    mantissa = mantissa * 10 + static_cast<unsigned long long>(*p - '0');
+                    if (mantissa > 0) {
+                        ++nSignificant;
+                    }
+                }
+                else {
+                    ++exponent;
+                    if (*p != '0') {
+                        return strtodC(str, NULL);
+                    }
+                }
+            }
+            if (*p == '.') {
+                for (++p; isDigit(*p); ++p, ++nDigits) {
+                    if (nSignificant < 19) {
+                        mantissa = mantissa * 10 + static_cast<unsigned long long>(*p - '0');
+                        if (mantissa > 0) {
+                            ++nSignificant;
+                        }
+                        --exponent;
+                    }
+                    else if (*p != '0') {
+                        return strtodC(str, NULL);
+                    }
+                }
+            }
+            if (nDigits == 0 || *p == 'x' || *p == 'X') {
+                // inf, nan, hexadecimal numbers or no number at all
+                return strtodC(str, NULL);
+            }
+
+            if ((*p == 'e' || *p == 'E')) {
+                const char* e = p + 1;
+                bool negativeExponent = false;
+                if (*e == '-' || *e == '+') {
+                    negativeExponent = *e == '-';
+                    ++e;
+                }
+                if (isDigit(*e)) {
+                    int value = 0;
+                    for (; isDigit(*e); ++e) {
+                        if (value < 10000) {
+                            value = value * 10 + (*e - '0');
+                        }
+                    }
+                    exponent += negativeExponent ? -value : value;
+                }
+            }
+
+            double result = 0.;
+            if (mantissa != 0) {
+                if (mantissa > (1ULL << 53) || exponent < -22 || exponent > 22) {
+                    return strtodC(str, NULL);
+                }
+                result = static_cast<double>(mantissa);
+                if (exponent < 0) {
+                    result /= powersOfTen[-exponent];
+                }
+                else {
+                    result *= powersOfTen[exponent];
+                }
+            }
+            return negative ? -result : result;
+        }
+
+        // Writes the significant digits with the decimal exponent of the first digit
+        // like printf's %g, but always with '.' as decimal point. Returns the length of the text.
+        size_t layoutDigits(bool negative, const char* digits, int nDigits, int exponent, int precision, char* out)
+        {
+            char* o = out;
+            if (negative) {
+                *o++ = '-';
+            }
+
+            // remove trailing zeros
+            while (nDigits > 1 && digits[nDigits - 1] == '0') {
+                --nDigits;
+            }
+
+            if (exponent < -4 || exponent >= precision) {
+                *o++ = digits[0];
+                if (nDigits > 1) {
+                    *o++ = '.';
+                    for (int i = 1; i < nDigits; ++i) {
+                        *o++ = digits[i];
+                    }
+                }
+                o += snprintf(o, 8, "e%c%02d", exponent < 0 ? '-' : '+', exponent < 0 ? -exponent : exponent);
+            }
+            else if (exponent < 0) {
+                *o++ = '0';
+                *o++ = '.';
+                for (int i = -1; i > exponent; --i) {
+                    *o++ = '0';
+                }
+                for (int i = 0; i < nDigits; ++i) {
+                    *o++ = digits[i];
+                }
+            }
+            else {
+                for (int i = 0; i <= exponent; ++i) {
+                    *o++ = i < nDigits ? digits[i] : '0';
+                }
+                if (nDigits > exponent + 1) {
+                    *o++ = '.';
+                    for (int i = exponent + 1; i < nDigits; ++i) {
+                        *o++ = digits[i];
+                    }
+                }
+            }
+            *o = '\0';
+            return static_cast<size_t>(o - out);
+        }
+
+        // Rounds the first precision digits half up, a carry increments the exponent
+        void roundDigits(const char* digits, int precision, char* rounded, int& exponent)
+        {
+            std::memcpy(rounded, digits, static_cast<size_t>(precision));
+            if (digits[precision] < '5') {
+                return;
+            }
+            for (int i = precision - 1; i >= 0; --i) {
+                if (rounded[i] != '9') {
+                    ++rounded[i];
+                    return;
+                }
+                rounded[i] = '0';
+            }
+            rounded[0] = '1';
+            ++exponent;
+        }
+
+        // Writes the non-finite values like printf. Returns the length of the text or 0, if value is finite.
+        size_t formatNonFinite(double value, char* out)
+        {
+            if (value != value) {
+                std::strcpy(out, "nan");
+                return 3;
+            }
+            if (value > 1.7976931348623157e308 || value < -1.7976931348623157e308) {
+                std::strcpy(out, value < 0 ? "-inf" : "inf");
+                return value < 0 ? 4 : 3;
+            }
+            return 0;
+        }
+
+        bool isNegative(double value)
+        {
+            return value < 0. || (value == 0. && 1. / value < 0.);
+        }
+
+        // Extracts the first nDigits significant digits (at most 17) and the decimal exponent
+        // of the correctly rounded scientific representation. Only the decimal point of the
+        // printf text depends on the locale, hence it is not used.
+        int scientificDigits(double value, int nDigits, char* digits, int& exponent)
+        {
+            char buffer[40];
+            snprintf(buffer, sizeof(buffer), "%.*e", nDigits - 1, value);
+
+            int n = 0;
+            const char* p = buffer;
+            for (; *p != 'e' && *p != '\0'; ++p) {
+                if (isDigit(*p) && n < nDigits) {
+                    digits[n++] = *p;
+                }
+            }
+            exponent = *p == 'e' ? std::atoi(p + 1) : 0;
+            return n;
+        }
+    }
+
+    size_t formatDouble(double value, char* out)
+    {
+        const size_t nonFiniteLength = formatNonFinite(value, out);
+        if (nonFiniteLength > 0) {
+            return nonFiniteLength;
+        }
+
+        // Fast path for short decimals: if value is m / 10^k for an integer m with at most
+        // 15 digits, parseDouble computes exactly this quotient when reading the text back.
+        const bool negative = isNegative(value);
+        const double absValue = negative ? -value : value;
+        for (int k = 0; k <= 15 && absValue * powersOfTen[k] < 1e15; ++k) {
+            const double scaled = std::floor(absValue * powersOfTen[k] + 0.5);
+            if (scaled / powersOfTen[k] != absValue) {
+                continue;
+            }
+
+            unsigned long long mantissa = static_cast<unsigned long long>(scaled);
+            char reversed[24];
+            int nDigits = 0;
+            do {
+                reversed[nDigits++] = static_cast<char>('0' + mantissa % 10);
+                mantissa /= 10;
+            } while (mantissa > 0);
+
+            char digits[24];
+            for (int i = 0; i < nDigits; ++i) {
+                digits[i] = reversed[nDigits - 1 - i];
+            }
+            const int exponent = scaled == 0. ? 0 : nDigits - 1 - k;
+            return layoutDigits(negative, digits, nDigits, exponent, 15, out);
+        }
+
+        // The 17 significant digits of the scientific representation identify every double.
+        // Shorter representations are tried by rounding them, as long as they are read back
+        // as the same value.
+        char digits[24];
+        int exponent = 0;
+        const int nDigits = scientificDigits(value, 17, digits, exponent);
+
+        for (int precision = 15; precision < nDigits; ++precision) {
+            char rounded[24];
+            int roundedExponent = exponent;
+            roundDigits(digits, precision, rounded, roundedExponent);
+            const size_t length = layoutDigits(negative, rounded, precision, roundedExponent, precision, out);
+            if (parseDouble(out) == value) {
+                return length;
+            }
+        }
+        return layoutDigits(negative, digits, nDigits, exponent, 17, out);
+    }
+
+    size_t formatDouble(double value, int precision, char* out)
+    {
+        const size_t nonFiniteLength = formatNonFinite(value, out);
+        if (nonFiniteLength > 0) {
+            return nonFiniteLength;
+        }
+
+        precision = std::max(1, std::min(precision, 17));
+        char digits[24];
+        int exponent = 0;
+        const int nDigits = scientificDigits(value, precision, digits, exponent);
+        return layoutDigits(isNegative(value), digits, nDigits, exponent, precision, out);
     }
 
     std::vector<double> stringToDoubleVec(const std::string& s)
     {
-        std::stringstream ss(s);
         std::vector<double> r;
-        std::string d;
-        while (std::getline(ss, d, sep)) {
-            r.push_back(std::strtod(d.c_str(), NULL));
+        if (s.empty()) {
+            return r;
+        }
+
+        // each separator ends one value, a trailing separator does not start a new one
+        r.reserve(std::count(s.begin(), s.end(), sep) + 1);
+
+        const char* p = s.c_str();
+        const char* end = p + s.size();
+        while (p < end) {
+            r.push_back(parseDouble(p));
+            const char* next = static_cast<const char*>(std::memchr(p, sep, static_cast<size_t>(end - p)));
+            if (!next) {
+                break;
+            }
+            p = next + 1;
         }
         return r;
     }
 
     std::string doubleVecToString(const std::vector<double>& v)
     {
-        std::stringstream ss;
+        std::string result;
+        result.reserve(v.size() * 12);
+
+        char buffer[40];
         for (std::vector<double>::const_iterator it = v.begin(); it != v.end(); ++it) {
-            ss << *it;
-            if (it != v.end() - 1) {
-                ss << sep;
+            if (it != v.begin()) {
+                result += sep;
             }
+            result.append(buffer, formatDouble(*it, buffer));
         }
-        return ss.str();
+        return result;
     }
 
     void CCPACSStringVector::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string &xpath)
@@ -8,6 +8,13 @@ namespace tigl
     TIGL_EXPORT std::vector<double> stringToDoubleVec(const std::string& s);
     TIGL_EXPORT std::string doubleVecToString(const std::vector<double>& v);
 
+    // Locale independent formatting of a number into a buffer of at least 32 characters.
+    // Returns the length of the text. The first version writes the shortest text, that
+    // is read back as the same value. The second one writes the same text as printf's
+    // %.<precision>g, but always with '.' as decimal point.
+    TIGL_EXPORT size_t formatDouble(double value, char* buffer);
+    TIGL_EXPORT size_t formatDouble(double value, int precision, char* buffer);
+
     class CCPACSStringVector : private generated::CPACSStringVectorBase
     {
     public:
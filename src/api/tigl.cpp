@@ -26,6 +26,7 @@
 #include <iostream>
 #include <exception>
 #include <cstdlib>
+#include <vector>
 
 #include "tigl.h"
 #include "tigl_version.h"
@@ -39,6 +40,9 @@
 #include "CCPACSConfigurationManager.h"
 #include "CTiglIntersectionCalculation.h"
 #include "CTiglUIDManager.h"
+#include "CTiglShapeCache.h"
+#include "CTiglDiskCache.h"
+#include "CTiglAbstractGeometricComponent.h"
 #include "CCPACSWing.h"
 #include "CCPACSWingSection.h"
 #include "CCPACSWingSegment.h"
@@ -50,6 +54,8 @@
 #include "CTiglExportCollada.h"
 #include "CTiglExportBrep.h"
 #include "CTiglLogging.h"
+#include "CTiglProgress.h"
+#include "ITiglProgressHandler.h"
 #include "CCPACSFuselageSection.h"
 #include "CCPACSFuselageSectionElement.h"
 #include "CCPACSFuselageSegment.h"
@@ -354,6 +360,85 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglIsCPACSConfigurationHandleValid(TiglCPACSC
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglSetShapeCacheMemoryLimit(TiglCPACSConfigurationHandle cpacsHandle, double memoryLimitMB)
+{
+    if (memoryLimitMB < 0.) {
+        LOG(ERROR) << "Argument memoryLimitMB must not be negative in tiglSetShapeCacheMemoryLimit.";
+        return TIGL_MATH_ERROR;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        config.GetShapeCache().SetMemoryLimit(static_cast<size_t>(memoryLimitMB * 1024. * 1024.));
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglSetShapeCacheMemoryLimit!";
+        return TIGL_ERROR;
+    }
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglGetShapeCacheStatistics(TiglCPACSConfigurationHandle cpacsHandle,
+                                                              int* shapeCount,
+                                                              int* hitCount,
+                                                              int* missCount,
+                                                              double* memoryUsageMB)
+{
+    if (!shapeCount || !hitCount || !missCount || !memoryUsageMB) {
+        LOG(ERROR) << "Null pointer argument in tiglGetShapeCacheStatistics.";
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        const tigl::CTiglShapeCache& cache = config.GetShapeCache();
+
+        *shapeCount    = static_cast<int>(cache.GetNShape());
+        *hitCount      = static_cast<int>(cache.GetHitCount());
+        *missCount     = static_cast<int>(cache.GetMissCount());
+        *memoryUsageMB = static_cast<double>(cache.GetMemoryUsage()) / (1024. * 1024.);
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglGetShapeCacheStatistics!";
+        return TIGL_ERROR;
+    }
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglSetDiskCacheDirectory(const char* directory)
+{
+    try {
+        tigl::CTiglDiskCache::GetInstance().SetDirectory(directory ? directory : "");
+        return TIGL_SUCCESS;
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglSetDiskCacheDirectory!";
+        return TIGL_ERROR;
+    }
+}
+
 
 /**
 * gives the tigl version number
@@ -728,6 +813,97 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoint(TiglCPACSConfigurationHa
     }
 }
 
+namespace
+{
+    // common implementation of tiglWingGetUpperPoints and tiglWingGetLowerPoints
+    TiglReturnCode wingGetPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                 int wingIndex,
+                                 int segmentIndex,
+                                 int numPoints,
+                                 const double* etaArray,
+                                 const double* xsiArray,
+                                 double* pointXArray,
+                                 double* pointYArray,
+                                 double* pointZArray,
+                                 bool fromUpper,
+                                 const char* functionName)
+    {
+        if (etaArray == NULL || xsiArray == NULL) {
+            LOG(ERROR) << "Null pointer argument for etaArray or xsiArray\n"
+                       << "in function call to " << functionName << ".";
+            return TIGL_NULL_POINTER;
+        }
+        if (pointXArray == NULL || pointYArray == NULL || pointZArray == NULL) {
+            LOG(ERROR) << "Null pointer argument for pointXArray, pointYArray or pointZArray\n"
+                       << "in function call to " << functionName << ".";
+            return TIGL_NULL_POINTER;
+        }
+        if (numPoints < 0) {
+            LOG(ERROR) << "Negative number of points in function call to " << functionName << ".";
+            return TIGL_ERROR;
+        }
+
+        try {
+            tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+            tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+            tigl::CCPACSWing& wing = config.GetWing(wingIndex);
+            tigl::CCPACSWingSegment& segment = (tigl::CCPACSWingSegment&) wing.GetSegment(segmentIndex);
+
+            std::vector<double> etas(etaArray, etaArray + numPoints);
+            std::vector<double> xsis(xsiArray, xsiArray + numPoints);
+            std::vector<gp_Pnt> points;
+            segment.GetPoints(etas, xsis, fromUpper, points);
+
+            for (int i = 0; i < numPoints; ++i) {
+                pointXArray[i] = points[i].X();
+                pointYArray[i] = points[i].Y();
+                pointZArray[i] = points[i].Z();
+            }
+            return TIGL_SUCCESS;
+        }
+        catch (const tigl::CTiglError& ex) {
+            LOG(ERROR) << ex.what();
+            return ex.getCode();
+        }
+        catch (std::exception& ex) {
+            LOG(ERROR) << ex.what();
+            return TIGL_ERROR;
+        }
+        catch (...) {
+            LOG(ERROR) << "Caught an unknown exception in " << functionName;
+            return TIGL_ERROR;
+        }
+    }
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetUpperPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int numPoints,
+                                                         const double* etaArray,
+                                                         const double* xsiArray,
+                                                         double* pointXArray,
+                                                         double* pointYArray,
+                                                         double* pointZArray)
+{
+    return wingGetPoints(cpacsHandle, wingIndex, segmentIndex, numPoints, etaArray, xsiArray,
+                         pointXArray, pointYArray, pointZArray, true, "tiglWingGetUpperPoints");
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int numPoints,
+                                                         const double* etaArray,
+                                                         const double* xsiArray,
+                                                         double* pointXArray,
+                                                         double* pointYArray,
+                                                         double* pointZArray)
+{
+    return wingGetPoints(cpacsHandle, wingIndex, segmentIndex, numPoints, etaArray, xsiArray,
+                         pointXArray, pointYArray, pointZArray, false, "tiglWingGetLowerPoints");
+}
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetChordPoint(TiglCPACSConfigurationHandle cpacsHandle,
                                                         int wingIndex,
                                                         int segmentIndex,
@@ -1851,6 +2027,79 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentFindSegment(TiglCPACSC
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentFindSegments(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                       const char* componentSegmentUID,
+                                                                       int numPoints,
+                                                                       const double* pXArray,
+                                                                       const double* pYArray,
+                                                                       const double* pZArray,
+                                                                       char** segmentUIDArray,
+                                                                       double* segmentEtaArray,
+                                                                       double* segmentXsiArray,
+                                                                       double* deviationArray)
+{
+    if (!componentSegmentUID) {
+        LOG(ERROR) << "Null pointer argument for componentSegmentUID\n"
+                   << "in function call to tiglWingComponentSegmentFindSegments.";
+        return TIGL_NULL_POINTER;
+    }
+    if (!pXArray || !pYArray || !pZArray) {
+        LOG(ERROR) << "Null pointer argument for pXArray, pYArray or pZArray\n"
+                   << "in function call to tiglWingComponentSegmentFindSegments.";
+        return TIGL_NULL_POINTER;
+    }
+    if (!segmentUIDArray || !segmentEtaArray || !segmentXsiArray || !deviationArray) {
+        LOG(ERROR) << "Null pointer argument for segmentUIDArray, segmentEtaArray, segmentXsiArray or deviationArray\n"
+                   << "in function call to tiglWingComponentSegmentFindSegments.";
+        return TIGL_NULL_POINTER;
+    }
+    if (numPoints < 0) {
+        LOG(ERROR) << "Negative number of points in function call to tiglWingComponentSegmentFindSegments.";
+        return TIGL_ERROR;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        tigl::CCPACSWingComponentSegment& cs = config.GetUIDManager()
+                .ResolveObject<tigl::CCPACSWingComponentSegment>(componentSegmentUID);
+
+        size_t n = static_cast<size_t>(numPoints);
+        std::vector<const tigl::CCPACSWingSegment*> segments;
+        cs.findSegments(n, pXArray, pYArray, pZArray, segments, segmentEtaArray, segmentXsiArray, deviationArray);
+
+        TiglReturnCode result = TIGL_SUCCESS;
+        for (size_t i = 0; i < n; ++i) {
+            if (segments[i] && deviationArray[i] <= 1e-2) {
+                segmentUIDArray[i] = (char*) segments[i]->GetUID().c_str();
+            }
+            else {
+                segmentUIDArray[i] = NULL;
+                result = TIGL_NOT_FOUND;
+            }
+        }
+
+        if (result != TIGL_SUCCESS) {
+            LOG(WARNING) << "Some points do not lie on the component segment within 1cm tolerance "
+                         << "in tiglWingComponentSegmentFindSegments.";
+        }
+        return result;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglWingComponentSegmentFindSegments!";
+        return TIGL_ERROR;
+    }
+}
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetPoint(TiglCPACSConfigurationHandle cpacsHandle,
                                                                    const char *componentSegmentUID, double eta, double xsi,
                                                                    double * x, double * y, double * z)
@@ -1967,6 +2216,68 @@ TiglReturnCode tiglWingComponentSegmentPointGetEtaXsi(TiglCPACSConfigurationHand
     return TIGL_SUCCESS;
 }
 
+TiglReturnCode tiglWingComponentSegmentPointsGetEtaXsi(TiglCPACSConfigurationHandle cpacsHandle,
+                                                       const char* componentSegmentUID,
+                                                       int numPoints,
+                                                       const double* pXArray,
+                                                       const double* pYArray,
+                                                       const double* pZArray,
+                                                       double* etaArray,
+                                                       double* xsiArray,
+                                                       double* errorDistanceArray)
+{
+    if (!componentSegmentUID) {
+        LOG(ERROR) << "Null pointer argument for componentSegmentUID\n"
+                   << "in function call to tiglWingComponentSegmentPointsGetEtaXsi.";
+        return TIGL_NULL_POINTER;
+    }
+    if (!pXArray || !pYArray || !pZArray) {
+        LOG(ERROR) << "Null pointer argument for pXArray, pYArray or pZArray\n"
+                   << "in function call to tiglWingComponentSegmentPointsGetEtaXsi.";
+        return TIGL_NULL_POINTER;
+    }
+    if (!etaArray || !xsiArray || !errorDistanceArray) {
+        LOG(ERROR) << "Null pointer argument for etaArray, xsiArray or errorDistanceArray\n"
+                   << "in function call to tiglWingComponentSegmentPointsGetEtaXsi.";
+        return TIGL_NULL_POINTER;
+    }
+    if (numPoints < 0) {
+        LOG(ERROR) << "Negative number of points in function call to tiglWingComponentSegmentPointsGetEtaXsi.";
+        return TIGL_ERROR;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        // get component segment
+        tigl::CCPACSWingComponentSegment& segment = config.GetUIDManager()
+                .ResolveObject<tigl::CCPACSWingComponentSegment>(componentSegmentUID);
+
+        size_t n = static_cast<size_t>(numPoints);
+        segment.GetEtaXsi(n, pXArray, pYArray, pZArray, etaArray, xsiArray);
+
+        for (size_t i = 0; i < n; ++i) {
+            gp_Pnt pnt(pXArray[i], pYArray[i], pZArray[i]);
+            errorDistanceArray[i] = segment.GetPoint(etaArray[i], xsiArray[i]).Distance(pnt);
+        }
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglWingComponentSegmentPointsGetEtaXsi!";
+        return TIGL_ERROR;
+    }
+
+    return TIGL_SUCCESS;
+}
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentPointGetSegmentEtaXsi(TiglCPACSConfigurationHandle cpacsHandle,
                                                                                 const char *componentSegmentUID, double eta, double xsi,
                                                                                 char** wingUID, char** segmentUID,
@@ -4654,6 +4965,83 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglIntersectWithPlane(TiglCPACSConfigurationH
 }
 
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglIntersectWithPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                          const char*  componentUid,
+                                                          const double* pxArray,
+                                                          const double* pyArray,
+                                                          const double* pzArray,
+                                                          int numberOfPlanes,
+                                                          double nx, double ny, double nz,
+                                                          char** intersectionIDs)
+{
+    if (!componentUid) {
+        LOG(ERROR) << "Null pointer for argument componentUid in tiglIntersectWithPlanes.";
+        return TIGL_NULL_POINTER;
+    }
+    if (!pxArray || !pyArray || !pzArray) {
+        LOG(ERROR) << "Null pointer for argument pxArray, pyArray or pzArray in tiglIntersectWithPlanes.";
+        return TIGL_NULL_POINTER;
+    }
+    if (!intersectionIDs) {
+        LOG(ERROR) << "Null pointer for argument intersectionIDs in tiglIntersectWithPlanes.";
+        return TIGL_NULL_POINTER;
+    }
+    if (numberOfPlanes < 0) {
+        LOG(ERROR) << "Negative number of planes in tiglIntersectWithPlanes.";
+        return TIGL_ERROR;
+    }
+    if (nx*nx + ny*ny + nz*nz < 1e-10) {
+        LOG(ERROR) << "Normal vector must not be zero in tiglIntersectWithPlanes.";
+        return TIGL_MATH_ERROR;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+        tigl::CTiglUIDManager& uidManager = config.GetUIDManager();
+
+        if (uidManager.HasGeometricComponent(componentUid)) {
+            TopoDS_Shape shape = uidManager.GetGeometricComponent(componentUid).GetLoft()->Shape();
+
+            std::vector<gp_Pnt> points;
+            points.reserve(numberOfPlanes);
+            for (int i = 0; i < numberOfPlanes; ++i) {
+                points.push_back(gp_Pnt(pxArray[i], pyArray[i], pzArray[i]));
+            }
+
+            std::vector<std::string> ids;
+            tigl::CTiglIntersectionCalculation::IntersectWithPlanes(config.GetShapeCache(),
+                                                                    componentUid,
+                                                                    shape,
+                                                                    points,
+                                                                    gp_Dir(nx, ny, nz),
+                                                                    ids);
+
+            for (int i = 0; i < numberOfPlanes; ++i) {
+                intersectionIDs[i] = (char*) config.GetMemoryPool().MakeNontempString(ids[i].c_str());
+            }
+
+            return TIGL_SUCCESS;
+        }
+        else {
+            LOG(ERROR) << "UID can not be found in tiglIntersectWithPlanes.";
+            return TIGL_UID_ERROR;
+        }
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglIntersectWithPlanes!";
+        return TIGL_ERROR;
+    }
+}
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglIntersectWithPlaneSegment(TiglCPACSConfigurationHandle cpacsHandle,
                                                                 const char*  componentUid,
                                                                 double p1x, double p1y, double p1z,
@@ -5370,6 +5758,38 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglExportMeshedGeometrySTL(TiglCPACSConfigura
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglExportSTLSetOptions(const char *key, const char *value)
+{
+    if (!key) {
+        LOG(ERROR) << "Error: Null pointer argument for key ";
+        LOG(ERROR) << "in function call to tiglExportSTLSetOptions." << std::endl;
+        return TIGL_NULL_POINTER;
+    }
+
+    if (!value) {
+        LOG(ERROR) << "Error: Null pointer argument for value ";
+        LOG(ERROR) << "in function call to tiglExportSTLSetOptions." << std::endl;
+        return TIGL_NULL_POINTER;
+    }
+
+    try {
+        tigl::CTiglExportStl::SetOptions(key, value);
+        return TIGL_SUCCESS;
+    }
+    catch (tigl::CTiglError & ex) {
+        LOG(ERROR) << ex.what() << std::endl;
+        return ex.getCode();
+    }
+    catch (std::exception & ex) {
+        LOG(ERROR) << ex.what() << std::endl;
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an unknown exception in tiglExportSTLSetOptions" << std::endl;
+        return TIGL_ERROR;
+    }
+}
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglExportVTKSetOptions(const char *key, const char *value)
 {
     if (!key) {
@@ -6115,6 +6535,135 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetMaterialThickness(T
     }
 }
 
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetMaterialCounts(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                            const char *compSegmentUID,
+                                                                            TiglStructureType structureType,
+                                                                            int numPoints,
+                                                                            const double* etaArray,
+                                                                            const double* xsiArray,
+                                                                            int* materialCountArray)
+{
+    if (!compSegmentUID) {
+        LOG(ERROR) << "Null pointer argument for compSegmentUID\n"
+                   << "in function call to tiglWingComponentSegmentGetMaterialCounts.";
+        return TIGL_NULL_POINTER;
+    }
+    if (!etaArray || !xsiArray || !materialCountArray) {
+        LOG(ERROR) << "Null pointer argument for etaArray, xsiArray or materialCountArray\n"
+                   << "in function call to tiglWingComponentSegmentGetMaterialCounts.";
+        return TIGL_NULL_POINTER;
+    }
+    if (numPoints < 0) {
+        LOG(ERROR) << "Negative number of points in function call to tiglWingComponentSegmentGetMaterialCounts.";
+        return TIGL_ERROR;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        tigl::CCPACSWingComponentSegment& compSeg = config.GetUIDManager()
+                .ResolveObject<tigl::CCPACSWingComponentSegment>(compSegmentUID);
+
+        std::vector<tigl::MaterialList> materials;
+        compSeg.GetMaterials(static_cast<size_t>(numPoints), etaArray, xsiArray, structureType, materials);
+        for (int i = 0; i < numPoints; ++i) {
+            materialCountArray[i] = static_cast<int>(materials[i].size());
+        }
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglWingComponentSegmentGetMaterialCounts!";
+        return TIGL_ERROR;
+    }
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetMaterials(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                       const char *compSegmentUID,
+                                                                       TiglStructureType structureType,
+                                                                       int numPoints,
+                                                                       const double* etaArray,
+                                                                       const double* xsiArray,
+                                                                       int numMaterials,
+                                                                       char** materialUIDArray,
+                                                                       double* thicknessArray)
+{
+    if (!compSegmentUID) {
+        LOG(ERROR) << "Null pointer argument for compSegmentUID\n"
+                   << "in function call to tiglWingComponentSegmentGetMaterials.";
+        return TIGL_NULL_POINTER;
+    }
+    if (!etaArray || !xsiArray || !materialUIDArray || !thicknessArray) {
+        LOG(ERROR) << "Null pointer argument for etaArray, xsiArray, materialUIDArray or thicknessArray\n"
+                   << "in function call to tiglWingComponentSegmentGetMaterials.";
+        return TIGL_NULL_POINTER;
+    }
+    if (numPoints < 0 || numMaterials < 0) {
+        LOG(ERROR) << "Negative array size in function call to tiglWingComponentSegmentGetMaterials.";
+        return TIGL_ERROR;
+    }
+
+    try {
+        tigl::CCPACSConfigurationManager& manager = tigl::CCPACSConfigurationManager::GetInstance();
+        tigl::CCPACSConfiguration& config = manager.GetConfiguration(cpacsHandle);
+
+        tigl::CCPACSWingComponentSegment& compSeg = config.GetUIDManager()
+                .ResolveObject<tigl::CCPACSWingComponentSegment>(compSegmentUID);
+
+        std::vector<tigl::MaterialList> materials;
+        compSeg.GetMaterials(static_cast<size_t>(numPoints), etaArray, xsiArray, structureType, materials);
+
+        size_t totalCount = 0;
+        for (int i = 0; i < numPoints; ++i) {
+            totalCount += materials[i].size();
+        }
+        if (totalCount > static_cast<size_t>(numMaterials)) {
+            LOG(ERROR) << "Output arrays too small in tiglWingComponentSegmentGetMaterials. "
+                       << "Required size is " << totalCount << ".";
+            return TIGL_INDEX_ERROR;
+        }
+
+        int imat = 0;
+        for (int i = 0; i < numPoints; ++i) {
+            const tigl::MaterialList& list = materials[i];
+            for (tigl::MaterialList::const_iterator it = list.begin(); it != list.end(); ++it, ++imat) {
+                const tigl::CCPACSMaterialDefinition* material = *it;
+                if (!material) {
+                    return TIGL_ERROR;
+                }
+                materialUIDArray[imat] = (char*) material->GetUID().c_str();
+                if (material->GetThickness_choice2()) {
+                    thicknessArray[imat] = *material->GetThickness_choice2();
+                }
+                else {
+                    thicknessArray[imat] = -1.;
+                }
+            }
+        }
+        return TIGL_SUCCESS;
+    }
+    catch (const tigl::CTiglError& ex) {
+        LOG(ERROR) << ex.what();
+        return ex.getCode();
+    }
+    catch (std::exception& ex) {
+        LOG(ERROR) << ex.what();
+        return TIGL_ERROR;
+    }
+    catch (...) {
+        LOG(ERROR) << "Caught an exception in tiglWingComponentSegmentGetMaterials!";
+        return TIGL_ERROR;
+    }
+}
+
 /*****************************************************************************************************/
 /*                     Volume calculations                                                           */
 /*****************************************************************************************************/
@@ -6675,7 +7224,7 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglComponentGetHashCode(TiglCPACSConfiguratio
 
 TIGL_COMMON_EXPORT const char * tiglGetErrorString(TiglReturnCode code)
 {
-    if (code > TIGL_MATH_ERROR || code < 0) {
+    if (code > TIGL_CANCELED || code < 0) {
         LOG(ERROR) << "TIGL error code " << code << " is unknown!";
         return "TIGL_UNKNOWN_ERROR";
     }
@@ -6842,6 +7391,53 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglLogSetVerbosity(TiglLogLevel consoleVerbos
     return TIGL_SUCCESS;
 }
 
+namespace
+{
+    // forwards the progress of tigl operations to a C callback function
+    class CProgressCallbackHandler : public tigl::ITiglProgressHandler
+    {
+    public:
+        CProgressCallbackHandler()
+            : callback(NULL), userData(NULL)
+        {
+        }
+
+        void SetCallback(TiglProgressCallback cb, void* data)
+        {
+            callback = cb;
+            userData = data;
+        }
+
+        bool Progress(double progress, const char* message) OVERRIDE
+        {
+            return !callback || callback(progress, message, userData) != TIGL_FALSE;
+        }
+
+    private:
+        TiglProgressCallback callback;
+        void* userData;
+    };
+
+    CProgressCallbackHandler progressCallbackHandler;
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglSetProgressCallback(TiglProgressCallback callback, void* userData)
+{
+    // the handler is not used by any running operation, while it is unregistered
+    tigl::CTiglProgress::SetHandler(NULL);
+    progressCallbackHandler.SetCallback(callback, userData);
+    if (callback) {
+        tigl::CTiglProgress::SetHandler(&progressCallbackHandler);
+    }
+    return TIGL_SUCCESS;
+}
+
+TIGL_COMMON_EXPORT TiglReturnCode tiglCancelOperation()
+{
+    tigl::CTiglProgress::Cancel();
+    return TIGL_SUCCESS;
+}
+
 TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointInside(TiglCPACSConfigurationHandle cpacsHandle,
                                                        double px, double py, double pz,
                                                        const char *componentUID, TiglBoolean *isInside)
@@ -6863,8 +7459,16 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglCheckPointInside(TiglCPACSConfigurationHan
         // get component
         tigl::ITiglGeometricComponent& component = config.GetUIDManager().GetGeometricComponent(componentUID);
 
-        const TopoDS_Shape& shape = component.GetLoft()->Shape();
-        *isInside = IsPointInsideShape(shape, gp_Pnt(px, py, pz)) ? TIGL_TRUE : TIGL_FALSE;
+        // use the cached classifier of the component, if available
+        bool inside = false;
+        tigl::CTiglAbstractGeometricComponent* abstractComponent = dynamic_cast<tigl::CTiglAbstractGeometricComponent*>(&component);
+        if (abstractComponent) {
+            inside = abstractComponent->GetIsInside(gp_Pnt(px, py, pz));
+        }
+        else {
+            inside = IsPointInsideShape(component.GetLoft()->Shape(), gp_Pnt(px, py, pz));
+        }
+        *isInside = inside ? TIGL_TRUE : TIGL_FALSE;
 
         return TIGL_SUCCESS;
     }
@@ -70,7 +70,8 @@ enum TiglReturnCode
     TIGL_WRONG_CPACS_VERSION = 11,
     TIGL_UNINITIALIZED       = 12,
     TIGL_MATH_ERROR          = 13,
-    TIGL_WRITE_FAILED        = 14
+    TIGL_WRITE_FAILED        = 14,
+    TIGL_CANCELED            = 15
 };
 
 /**
@@ -89,6 +90,11 @@ enum TiglReturnCode
 * - TIGL_STRING_TRUNCATED
 * - TIGL_WRONG_TIXI_VERSION
 * - TIGL_UID_ERROR
+* - TIGL_WRONG_CPACS_VERSION
+* - TIGL_UNINITIALIZED
+* - TIGL_MATH_ERROR
+* - TIGL_WRITE_FAILED
+* - TIGL_CANCELED
 *
 */
 typedef enum TiglReturnCode TiglReturnCode;
@@ -291,6 +297,17 @@ typedef const char** TiglStringList;
 */
 typedef enum TiglImportExportFormat TiglImportExportFormat;
 
+/**
+* @brief Callback function to be notified about the progress of long running operations.
+*
+* @param progress Progress of the current operation in the range [0, 1]
+* @param message  Description of the current operation
+* @param userData The pointer passed to ::tiglSetProgressCallback
+*
+* @return TIGL_FALSE to cancel the current operation, TIGL_TRUE to continue
+*/
+typedef TiglBoolean (*TiglProgressCallback)(double progress, const char* message, void* userData);
+
 
 /**
   \defgroup GeneralFunctions General TIGL handling functions
@@ -376,6 +393,64 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglGetCPACSTixiHandle(TiglCPACSConfigurationH
 */
 TIGL_COMMON_EXPORT TiglReturnCode tiglIsCPACSConfigurationHandleValid(TiglCPACSConfigurationHandle cpacsHandle, TiglBoolean* isValidPtr);
 
+/**
+* @brief Sets the maximum memory used by the shape cache of a CPACS configuration.
+*
+* The shape cache stores intermediate results like the intersection lines computed by
+* ::tiglIntersectComponents or ::tiglIntersectWithPlane. If the memory limit is exceeded,
+* the least recently used results are removed from the cache. In this case, the
+* corresponding intersection IDs become invalid. By default, the cache size is not limited.
+*
+* @param[in]  cpacsHandle   Handle for the CPACS configuration
+* @param[in]  memoryLimitMB Maximum memory of the cache in megabytes. A value of 0 disables the limit.
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_MATH_ERROR if memoryLimitMB is negative
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglSetShapeCacheMemoryLimit(TiglCPACSConfigurationHandle cpacsHandle, double memoryLimitMB);
+
+/**
+* @brief Returns statistics of the shape cache of a CPACS configuration.
+*
+* @param[in]  cpacsHandle   Handle for the CPACS configuration
+* @param[out] shapeCount    Number of shapes currently stored in the cache
+* @param[out] hitCount      Number of lookups, that were answered from the cache
+* @param[out] missCount     Number of lookups, that required a new computation
+* @param[out] memoryUsageMB Estimated memory used by the cached shapes in megabytes
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_NULL_POINTER if one of the output arguments is NULL
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglGetShapeCacheStatistics(TiglCPACSConfigurationHandle cpacsHandle,
+                                                              int* shapeCount,
+                                                              int* hitCount,
+                                                              int* missCount,
+                                                              double* memoryUsageMB);
+
+/**
+* @brief Sets the directory of the disk cache.
+*
+* If enabled, the lofts of wings and fuselages as well as the fused configuration are stored
+* in this directory and are reused by all processes working on the same geometry. The cache entries
+* are identified by the CPACS definition of the components and the TiGL version. The cache is disabled
+* by default. It can also be enabled by setting the environment variable TIGL_CACHE_DIR.
+*
+* Old cache entries are never removed by TiGL. This has to be done manually.
+*
+* @param[in]  directory  Existing cache directory. NULL or an empty string disables the cache.
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglSetDiskCacheDirectory(const char* directory);
+
 
 /**
     @brief Returns the version number of this TIGL version.
@@ -590,6 +665,90 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoint(TiglCPACSConfigurationHa
                                                         double* pointYPtr,
                                                         double* pointZPtr);
 
+/**
+* @brief Returns multiple points on the upper wing surface of a given wing segment.
+*
+* This is the batch version of ::tiglWingGetUpperPoint. For each pair (etaArray[i], xsiArray[i])
+* the corresponding point on the upper wing surface is computed. The wing segment, its
+* profiles and the transformations are resolved only once for all points, which makes this
+* function considerably faster than calling ::tiglWingGetUpperPoint for each point.
+*
+* The output arrays pointXArray, pointYArray and pointZArray have to be allocated
+* by the user with at least numPoints entries.
+*
+* @param[in]  cpacsHandle  Handle for the CPACS configuration
+* @param[in]  wingIndex    The index of the wing, starting at 1
+* @param[in]  segmentIndex The index of the segment of the wing, starting at 1
+* @param[in]  numPoints    Number of points to compute, i.e. size of all arrays
+* @param[in]  etaArray     Eta values in the range 0.0 <= eta <= 1.0
+* @param[in]  xsiArray     Xsi values in the range 0.0 <= xsi <= 1.0
+* @param[out] pointXArray  X-coordinates of the points in absolute world coordinates
+* @param[out] pointYArray  Y-coordinates of the points in absolute world coordinates
+* @param[out] pointZArray  Z-coordinates of the points in absolute world coordinates
+*
+* @cond
+* #annotate in: 4A(3), 5A(3) out: 6AM(3), 7AM(3), 8AM(3)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if all points were found
+*   - TIGL_NOT_FOUND if no point was found or the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if wingIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if one of the arrays is a null pointer
+*   - TIGL_ERROR if some other error occurred, e.g. an eta value is out of range
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetUpperPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int numPoints,
+                                                         const double* etaArray,
+                                                         const double* xsiArray,
+                                                         double* pointXArray,
+                                                         double* pointYArray,
+                                                         double* pointZArray);
+
+/**
+* @brief Returns multiple points on the lower wing surface of a given wing segment.
+*
+* This is the batch version of ::tiglWingGetLowerPoint. For each pair (etaArray[i], xsiArray[i])
+* the corresponding point on the lower wing surface is computed. The wing segment, its
+* profiles and the transformations are resolved only once for all points, which makes this
+* function considerably faster than calling ::tiglWingGetLowerPoint for each point.
+*
+* The output arrays pointXArray, pointYArray and pointZArray have to be allocated
+* by the user with at least numPoints entries.
+*
+* @param[in]  cpacsHandle  Handle for the CPACS configuration
+* @param[in]  wingIndex    The index of the wing, starting at 1
+* @param[in]  segmentIndex The index of the segment of the wing, starting at 1
+* @param[in]  numPoints    Number of points to compute, i.e. size of all arrays
+* @param[in]  etaArray     Eta values in the range 0.0 <= eta <= 1.0
+* @param[in]  xsiArray     Xsi values in the range 0.0 <= xsi <= 1.0
+* @param[out] pointXArray  X-coordinates of the points in absolute world coordinates
+* @param[out] pointYArray  Y-coordinates of the points in absolute world coordinates
+* @param[out] pointZArray  Z-coordinates of the points in absolute world coordinates
+*
+* @cond
+* #annotate in: 4A(3), 5A(3) out: 6AM(3), 7AM(3), 8AM(3)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if all points were found
+*   - TIGL_NOT_FOUND if no point was found or the cpacs handle is not valid
+*   - TIGL_INDEX_ERROR if wingIndex or segmentIndex are not valid
+*   - TIGL_NULL_POINTER if one of the arrays is a null pointer
+*   - TIGL_ERROR if some other error occurred, e.g. an eta value is out of range
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingGetLowerPoints(TiglCPACSConfigurationHandle cpacsHandle,
+                                                         int wingIndex,
+                                                         int segmentIndex,
+                                                         int numPoints,
+                                                         const double* etaArray,
+                                                         const double* xsiArray,
+                                                         double* pointXArray,
+                                                         double* pointYArray,
+                                                         double* pointZArray);
+
 /**
 * @brief Returns a point on the wing chord surface for a
 * a given wing and segment index.
@@ -1244,6 +1403,50 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentFindSegment(TiglCPACSC
                                                                       const char *componentSegmentUID, double x, double y,
                                                                       double z, char** segmentUID, char** wingUID);
 
+/**
+* @brief Locates multiple points on a componentSegment. For each point, the segmentUID
+* of the segment containing the point, the eta/xsi coordinates of the point on this segment
+* and the deviation of the point from the segment's chord face are returned.
+*
+* This is the batch version of ::tiglWingComponentSegmentFindSegment. The segments are
+* looked up in a bounding box tree of the component segment and the points are located
+* in parallel, which makes this function suitable for large point sets (e.g. FE nodes).
+*
+* The output arrays have to be allocated by the user with at least numPoints entries.
+* For points that do not lie on the component segment within 1cm tolerance, the
+* segmentUID is set to NULL. The returned strings must not be freed by the user.
+*
+* @param[in]  cpacsHandle             Handle for the CPACS configuration
+* @param[in]  componentSegmentUID     UID of the componentSegment to search for
+* @param[in]  numPoints               Number of points, i.e. size of all arrays
+* @param[in]  pXArray                 X coordinates of the points
+* @param[in]  pYArray                 Y coordinates of the points
+* @param[in]  pZArray                 Z coordinates of the points
+* @param[out] segmentUIDArray         UIDs of the segments containing the points
+* @param[out] segmentEtaArray         Eta coordinates of the points on the segments
+* @param[out] segmentXsiArray         Xsi coordinates of the points on the segments
+* @param[out] deviationArray          Deviations of the points from the segments
+*
+* @return
+*   - TIGL_SUCCESS if all points were located
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_NOT_FOUND if at least one point does not lie on the wing component segment within 1cm tolerance.
+*     The results of all other points are valid.
+*   - TIGL_UID_ERROR if the componentSegment does not exist
+*   - TIGL_NULL_POINTER if one of the arguments is a null pointer
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentFindSegments(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                       const char* componentSegmentUID,
+                                                                       int numPoints,
+                                                                       const double* pXArray,
+                                                                       const double* pYArray,
+                                                                       const double* pZArray,
+                                                                       char** segmentUIDArray,
+                                                                       double* segmentEtaArray,
+                                                                       double* segmentXsiArray,
+                                                                       double* deviationArray);
+
 
 /**
 * @brief Returns x,y,z koordinates for a given eta and xsi on a componentSegment.
@@ -1296,6 +1499,49 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentPointGetEtaXsi(TiglCPA
                                                                          double* eta, double* xsi,
                                                                          double* errorDistance);
 
+/**
+ * @brief Projects multiple points onto the chord face of the wing component segment
+ *        and returns the eta/xsi coordinates of the points of projection.
+ *
+ * This is the batch version of ::tiglWingComponentSegmentPointGetEtaXsi. The chord face
+ * is resolved only once for all points and the projection is computed in closed form
+ * for each span of the chord face, which is considerably faster than calling
+ * ::tiglWingComponentSegmentPointGetEtaXsi for each point.
+ *
+ * The output arrays have to be allocated by the user with at least numPoints entries.
+ *
+ * @param[in] cpacsHandle           Handle for the CPACS configuration
+ * @param[in] componentSegmentUID   UID of the componentSegment to search for
+ * @param[in] numPoints             Number of points to project, i.e. size of all arrays
+ * @param[in] pXArray               X coordinates of the points to project
+ * @param[in] pYArray               Y coordinates of the points to project
+ * @param[in] pZArray               Z coordinates of the points to project
+ * @param[out] etaArray             Eta coordinates of the projected points
+ * @param[out] xsiArray             Xsi coordinates of the projected points
+ * @param[out] errorDistanceArray   Distances between the points and the projected points
+ *                                  on the component segment
+ *
+ * @cond
+ * #annotate in: 3A(2), 4A(2), 5A(2) out: 6AM(2), 7AM(2), 8AM(2)#
+ * @endcond
+ *
+ * @return
+ *   - TIGL_SUCCESS if no error occurred
+ *   - TIGL_NOT_FOUND if no configuration was found for the given handle
+ *   - TIGL_UID_ERROR if the componentSegment does not exist
+ *   - TIGL_NULL_POINTER if one of the arguments is a null pointer
+ *   - TIGL_ERROR if some other error occurred
+ */
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentPointsGetEtaXsi(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                          const char* componentSegmentUID,
+                                                                          int numPoints,
+                                                                          const double* pXArray,
+                                                                          const double* pYArray,
+                                                                          const double* pZArray,
+                                                                          double* etaArray,
+                                                                          double* xsiArray,
+                                                                          double* errorDistanceArray);
+
 /**
 * @brief Returns eta, xsi, segmentUID and wingUID for a given eta and xsi on a componentSegment.
 *
@@ -3079,6 +3325,54 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglIntersectWithPlane(TiglCPACSConfigurationH
                                                          double nx, double ny, double nz,
                                                          char** intersectionID);
 
+/**
+* @brief tiglIntersectWithPlanes computes the intersection line(s) between a shape and
+* multiple parallel planes, e.g. to slice a wing at several spanwise stations.
+*
+* This is the batch version of ::tiglIntersectWithPlane. Each plane is only intersected
+* with the faces of the shape it can hit, and the intersections are computed in
+* parallel. This makes this function considerably faster than calling
+* ::tiglIntersectWithPlane for each plane.
+*
+* The planes are specified by one point per plane and a common normal vector. The normal
+* vector must not be zero! For each plane, an intersection ID is returned, which can be
+* used with ::tiglIntersectGetLineCount and ::tiglIntersectGetPoint. The IDs are equal to the ones
+* returned by ::tiglIntersectWithPlane for the same plane.
+*
+* The output array intersectionIDs has to be allocated by the user with at least numberOfPlanes entries.
+*
+* @param[in]  cpacsHandle     Handle for the CPACS configuration
+* @param[in]  componentUid    The UID of the CPACS shape
+* @param[in]  pxArray         X Coordinates of the plane points
+* @param[in]  pyArray         Y Coordinates of the plane points
+* @param[in]  pzArray         Z Coordinates of the plane points
+* @param[in]  numberOfPlanes  Number of planes, i.e. size of the arrays
+* @param[in]  nx              X value of the plane normal vector
+* @param[in]  ny              Y value of the plane normal vector
+* @param[in]  nz              Z value of the plane normal vector
+* @param[out] intersectionIDs The identifiers of the computed intersections, one per plane.
+*
+* @cond
+* #annotate in: 2A(5), 3A(5), 4A(5) out: 9AM(5)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if the intersections could be computed
+*   - TIGL_NOT_FOUND if the cpacs handle is not valid
+*   - TIGL_NULL_POINTER if componentUid, one of the arrays or intersectionIDs are NULL pointers
+*   - TIGL_UID_ERROR if componentUid can not be found in the CPACS file
+*   - TIGL_MATH_ERROR if the normal vector is zero
+*   - TIGL_ERROR if numberOfPlanes is negative or some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglIntersectWithPlanes(TiglCPACSConfigurationHandle cpacsHandle,
+                                                          const char*  componentUid,
+                                                          const double* pxArray,
+                                                          const double* pyArray,
+                                                          const double* pzArray,
+                                                          int numberOfPlanes,
+                                                          double nx, double ny, double nz,
+                                                          char** intersectionIDs);
+
 /**
 * @brief tiglIntersectWithPlaneSegment computes the intersection line(s) between a shape
 * and a plane segment. The plane segment is defined by p(u,v) = P1*(1-u) + P2*u + w*v, with
@@ -3526,6 +3820,25 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglExportMeshedGeometrySTL(TiglCPACSConfigura
                                                               double deflection);
 
 
+/**
+ * @brief Sets options for the STL Export
+ *
+ * **Available Settings**:
+ *
+ *   - *key*: "format" *valid values*: "ascii" or "binary" *default*: "ascii".
+ *
+ *       Sets the format of the STL file. The ascii format stores each exported shape
+ *       as a separate solid named after the shape. The binary format results in
+ *       much smaller files, that are faster to write and read, but does not contain
+ *       the shape names.
+ *
+ * @return
+ *   - TIGL_SUCCESS if no error occurred
+ *   - TIGL_NULL_POINTER if key or value are a null pointer
+ *   - TIGL_ERROR if the specified key/value pair is invalid
+ */
+TIGL_COMMON_EXPORT TiglReturnCode tiglExportSTLSetOptions(const char* key, const char* value);
+
 /**
  * @brief Sets options for the VTK Export
  *
@@ -3539,6 +3852,18 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglExportMeshedGeometrySTL(TiglCPACSConfigura
  *       them as two entries. Thus, a VTK file may have "duplicate" vertices. To disable this
  *       behavior, set "normal_enabled" to "0".
  *
+ *   - *key*: "encoding" *valid values*: "ascii", "base64" or "appended" *default*: "ascii".
+ *
+ *       Sets the storage format of the data arrays. With "base64", the binary data is stored
+ *       base64 encoded inside the DataArray elements. With "appended", the raw binary data is stored
+ *       in the AppendedData section at the end of the file, which gives the smallest files and the
+ *       fastest export.
+ *
+ *   - *key*: "compression" *valid values*: "none" or "zlib" *default*: "none".
+ *
+ *       Compresses the binary data arrays with zlib. This has no effect for the ascii encoding.
+ *       The value "zlib" is only accepted, if TiGL was built with zlib support.
+ *
  * @return
  *   - TIGL_SUCCESS if no error occurred
  *   - TIGL_NULL_POINTER if key or value are a null pointer
@@ -3926,6 +4251,79 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetMaterialThickness(T
                                                                                double eta, double xsi,
                                                                                int materialIndex,
                                                                                double * thickness);
+
+/**
+* @brief Returns the number of materials defined at multiple points on the wing component segment surface.
+*
+* This is the batch version of ::tiglWingComponentSegmentGetMaterialCount. The cells of the
+* component segment shell are looked up in a precomputed index, which makes this function
+* suitable for large point sets (e.g. FE nodes). The materials themselves can be queried
+* afterwards using ::tiglWingComponentSegmentGetMaterials.
+*
+* @param[in]  cpacsHandle         Handle for the CPACS configuration
+* @param[in]  compSegmentUID      UID of the component segment
+* @param[in]  structureType       Type of structure, where the materials are queried
+* @param[in]  numPoints           Number of points, i.e. size of all arrays
+* @param[in]  etaArray            eta coordinates of the points in the range 0.0 <= eta <= 1.0
+* @param[in]  xsiArray            xsi coordinates of the points in the range 0.0 <= xsi <= 1.0
+* @param[out] materialCountArray  Number of materials defined at each point
+*
+* @cond
+* #annotate in: 4A(3), 5A(3) out: 6AM(3)#
+* @endcond
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_NULL_POINTER if compSegmentUID or one of the arrays is a null pointer
+*   - TIGL_UID_ERROR if the component segment does not exist
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetMaterialCounts(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                            const char *compSegmentUID,
+                                                                            TiglStructureType structureType,
+                                                                            int numPoints,
+                                                                            const double* etaArray,
+                                                                            const double* xsiArray,
+                                                                            int* materialCountArray);
+
+/**
+* @brief Returns the material UIDs and thicknesses at multiple points on the wing component segment surface.
+*
+* The materials of all points are stored consecutively in materialUIDArray and thicknessArray,
+* i.e. the materials of the first point are followed by the materials of the second point etc.
+* The number of materials per point has to be first queried using ::tiglWingComponentSegmentGetMaterialCounts,
+* the output arrays have to be allocated by the user with at least the sum of these counts as size.
+* The returned strings must not be freed by the user.
+*
+* @param[in]  cpacsHandle       Handle for the CPACS configuration
+* @param[in]  compSegmentUID    UID of the component segment
+* @param[in]  structureType     Type of structure, where the materials are queried
+* @param[in]  numPoints         Number of points, i.e. size of etaArray and xsiArray
+* @param[in]  etaArray          eta coordinates of the points in the range 0.0 <= eta <= 1.0
+* @param[in]  xsiArray          xsi coordinates of the points in the range 0.0 <= xsi <= 1.0
+* @param[in]  numMaterials      Size of materialUIDArray and thicknessArray
+* @param[out] materialUIDArray  Material UIDs of all points
+* @param[out] thicknessArray    Material thicknesses of all points. If no thickness is defined for a material,
+*                               the thickness gets a negative value.
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*   - TIGL_NOT_FOUND if no configuration was found for the given handle
+*   - TIGL_NULL_POINTER if compSegmentUID or one of the arrays is a null pointer
+*   - TIGL_UID_ERROR if the component segment does not exist
+*   - TIGL_INDEX_ERROR if numMaterials is smaller than the total number of materials
+*   - TIGL_ERROR if some other error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglWingComponentSegmentGetMaterials(TiglCPACSConfigurationHandle cpacsHandle,
+                                                                       const char *compSegmentUID,
+                                                                       TiglStructureType structureType,
+                                                                       int numPoints,
+                                                                       const double* etaArray,
+                                                                       const double* xsiArray,
+                                                                       int numMaterials,
+                                                                       char** materialUIDArray,
+                                                                       double* thicknessArray);
      
 
 
@@ -4459,6 +4857,47 @@ TIGL_COMMON_EXPORT TiglReturnCode tiglLogSetVerbosity(TiglLogLevel level);
 
 /*@}*/ // end of doxygen group
 
+/*****************************************************************************************************/
+/**
+  \defgroup ProgressFunctions Progress functions.
+    Long running operations like the boolean fusing of the configuration, the triangulation
+    or the CAD exports report their progress to a user defined callback function,
+    which can be registered with ::tiglSetProgressCallback.
+
+    A running operation can be canceled either by returning TIGL_FALSE from the callback
+    or by calling ::tiglCancelOperation, either from the callback or from another thread. The canceled function then returns
+    TIGL_CANCELED.
+ */
+/*@{*/
+
+/**
+* @brief Registers a callback function, that is notified about the progress of long running operations.
+*
+* The callback is global for all configurations. It might be called from different threads,
+* but never concurrently. The callback may call other TiGL functions, e.g. ::tiglCancelOperation.
+*
+* @param[in]  callback Callback function. Pass NULL to remove the current callback.
+* @param[in]  userData Arbitrary pointer, that is passed to the callback function.
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglSetProgressCallback(TiglProgressCallback callback, void* userData);
+
+/**
+* @brief Requests the cancellation of all currently running operations.
+*
+* This function may be called from any thread. The running operations stop at
+* their next progress step and return TIGL_CANCELED. Operations, that are started
+* afterwards, are not affected.
+*
+* @return
+*   - TIGL_SUCCESS if no error occurred
+*/
+TIGL_COMMON_EXPORT TiglReturnCode tiglCancelOperation();
+
+/*@}*/ // end of doxygen group
+
 /*@}*/
 /*****************************************************************************************************/
 /**
@@ -35,7 +35,8 @@ const static char * TiglErrorStrings[] =
     "TIGL_WRONG_CPACS_VERSION",
     "TIGL_UNINITIALIZED",
     "TIGL_MATH_ERROR",
-    "TIGL_WRITE_FAILED"
+    "TIGL_WRITE_FAILED",
+    "TIGL_CANCELED"
 };
 
 #endif // TIGL_ERROR_STRINGS_H
@@ -20,6 +20,7 @@
 
 #include "CNamedShape.h"
 #include "CTiglError.h"
+#include "CTiglProgress.h"
 #include "CBooleanOperTools.h"
 #include "CTrimShape.h"
 #include "BRepSewingToBRepBuilderShapeAdapter.h"
@@ -35,11 +36,123 @@
 #include <BRepBuilderAPI_MakeSolid.hxx>
 
 #include <BOPAlgo_PaveFiller.hxx>
+#include <BOPAlgo_Builder.hxx>
 #include <BOPCol_ListOfShape.hxx>
-#include <BRepAlgoAPI_Section.hxx>
+#include <BOPDS_DS.hxx>
+#include <BOPDS_InterfFF.hxx>
+#include <BOPDS_Curve.hxx>
+#include <BOPDS_PaveBlock.hxx>
+#include <BOPDS_ListOfPaveBlock.hxx>
+#include <BOPDS_CommonBlock.hxx>
+#include <BOPDS_ShapeInfo.hxx>
+#include <BOPCol_ListOfInteger.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <Message_ProgressIndicator.hxx>
 
 //#define DEBUG_BOP
 
+namespace
+{
+    // Stops the boolean operations of OpenCASCADE, if the
+    // cancellation of the current operation was requested
+    class CancelIndicator : public Message_ProgressIndicator
+    {
+    public:
+        Standard_Boolean Show(const Standard_Boolean) OVERRIDE
+        {
+            return Standard_True;
+        }
+
+        Standard_Boolean UserBreak() OVERRIDE
+        {
+            return tigl::CTiglProgress::IsCanceled() ? Standard_True : Standard_False;
+        }
+    };
+
+    // Returns true, if the shapes with the passed indices include shapes of both ranks
+    bool HasBothRanks(const BOPDS_DS& ds, const BOPCol_ListOfInteger& indices, Standard_Integer rank1, Standard_Integer rank2)
+    {
+        bool hasRank1 = false, hasRank2 = false;
+        for (BOPCol_ListIteratorOfListOfInteger it(indices); it.More(); it.Next()) {
+            Standard_Integer rank = ds.Rank(it.Value());
+            hasRank1 = hasRank1 || rank == rank1;
+            hasRank2 = hasRank2 || rank == rank2;
+        }
+        return hasRank1 && hasRank2;
+    }
+
+    // Returns the section edges, that the pave filler computed between
+    // the arguments with the indices rank1 and rank2. Like BRepAlgoAPI_Section,
+    // this includes the intersection curves of the faces and the edges, that
+    // coincide with an edge or lie on a face of the other argument.
+    TopoDS_Shape GetSectionEdges(BOPAlgo_PaveFiller& filler, Standard_Integer rank1, Standard_Integer rank2)
+    {
+        TopoDS_Compound compound;
+        BRep_Builder builder;
+        builder.MakeCompound(compound);
+        TopTools_MapOfShape addedEdges;
+
+        BOPDS_DS& ds = *filler.PDS();
+
+        // face-face intersection curves
+        BOPDS_VectorOfInterfFF& interferences = ds.InterfFF();
+        for (Standard_Integer i = 0; i < interferences.Length(); ++i) {
+            BOPDS_InterfFF& interference = interferences(i);
+            Standard_Integer face1, face2;
+            interference.Indices(face1, face2);
+            Standard_Integer faceRank1 = ds.Rank(face1);
+            Standard_Integer faceRank2 = ds.Rank(face2);
+            if (!((faceRank1 == rank1 && faceRank2 == rank2) || (faceRank1 == rank2 && faceRank2 == rank1))) {
+                continue;
+            }
+
+            const BOPDS_VectorOfCurve& curves = interference.Curves();
+            for (Standard_Integer j = 0; j < curves.Length(); ++j) {
+                BOPDS_ListIteratorOfListOfPaveBlock pbIt(curves(j).PaveBlocks());
+                for (; pbIt.More(); pbIt.Next()) {
+                    Standard_Integer edge = pbIt.Value()->Edge();
+                    if (edge >= 0 && addedEdges.Add(ds.Shape(edge))) {
+                        builder.Add(compound, ds.Shape(edge));
+                    }
+                }
+            }
+        }
+
+        // edge-edge and edge-face coincidences, i.e. common blocks
+        for (Standard_Integer i = 0; i < ds.NbSourceShapes(); ++i) {
+            if (ds.ShapeInfo(i).ShapeType() != TopAbs_EDGE || !ds.HasPaveBlocks(i)) {
+                continue;
+            }
+
+            BOPDS_ListIteratorOfListOfPaveBlock pbIt(ds.PaveBlocks(i));
+            for (; pbIt.More(); pbIt.Next()) {
+                const Handle(BOPDS_PaveBlock)& paveBlock = pbIt.Value();
+                if (!ds.IsCommonBlock(paveBlock)) {
+                    continue;
+                }
+
+                const Handle(BOPDS_CommonBlock)& commonBlock = ds.CommonBlock(paveBlock);
+                BOPCol_ListOfInteger indices(commonBlock->Faces());
+                BOPDS_ListIteratorOfListOfPaveBlock cbIt(commonBlock->PaveBlocks());
+                for (; cbIt.More(); cbIt.Next()) {
+                    indices.Append(cbIt.Value()->OriginalEdge());
+                }
+                if (!HasBothRanks(ds, indices, rank1, rank2)) {
+                    continue;
+                }
+
+                Standard_Integer edge = commonBlock->PaveBlock1()->Edge();
+                if (edge >= 0 && addedEdges.Add(ds.Shape(edge))) {
+                    builder.Add(compound, ds.Shape(edge));
+                }
+            }
+        }
+        return compound;
+    }
+} // namespace
+
 CFuseShapes::CFuseShapes(const PNamedShape parent, const ListPNamedShape &childs)
     : _resultshape()
 {
@@ -112,6 +225,10 @@ void CFuseShapes::DoFuse()
     TrimOperation childTrim  = EXCLUDE;
     TrimOperation parentTrim = EXCLUDE;
 
+    // intersecting, trimming and sewing the result
+    tigl::CTiglProgress progress("Fusing " + std::string(_parent ? _parent->Name() : "shapes"), 3);
+    Handle(CancelIndicator) cancelIndicator = new CancelIndicator;
+
     // handle case when parent has no shape
     if (!_parent) {
         _trimmedParent.reset();
@@ -124,59 +241,63 @@ void CFuseShapes::DoFuse()
         }
     }
     else {
-        // trim the childs with the parent and vice versa
-        _trimmedParent = _parent->DeepCopy();
+        // intersect the parent with all childs in one multi-argument boolean
+        ListPNamedShape validChilds;
+        BOPCol_ListOfShape aLS;
+        aLS.Append(_parent->Shape());
         for (childIter = _childs.begin(); childIter != _childs.end(); ++childIter) {
             const PNamedShape child = *childIter;
             if (!child) {
                 continue;
             }
+            aLS.Append(child->Shape());
+            validChilds.push_back(child);
+        }
 
 #ifdef DEBUG_BOP
-            clock_t start, stop;
-            start = clock();
+        clock_t start, stop;
+        start = clock();
 #endif
-            BOPCol_ListOfShape aLS;
-            aLS.Append(_trimmedParent->Shape());
-            aLS.Append(child->Shape());
-            BOPAlgo_PaveFiller DSFill;
-            DSFill.SetArguments(aLS);
-            DSFill.Perform();
+        BOPAlgo_PaveFiller DSFill;
+        DSFill.SetArguments(aLS);
+        DSFill.SetProgressIndicator(cancelIndicator);
+        DSFill.Perform();
+        tigl::CTiglProgress::CheckCanceled();
+        progress.Step();
 #ifdef DEBUG_BOP
-            stop = clock();
-            printf("dsfiller [ms]: %f\n", (stop-start)/(double)CLOCKS_PER_SEC * 1000.);
+        stop = clock();
+        printf("dsfiller [ms]: %f\n", (stop-start)/(double)CLOCKS_PER_SEC * 1000.);
 
-            start = clock();
+        start = clock();
 #endif
-            // calculate intersection
-            // Todo: make a new BOP out of this
-            TopoDS_Shape intersection = BRepAlgoAPI_Section(_trimmedParent->Shape(), child->Shape(), DSFill);
+        // split all shapes at their intersections at once
+        BOPAlgo_Builder splitter;
+        for (BOPCol_ListIteratorOfListOfShape it(aLS); it.More(); it.Next()) {
+            splitter.AddArgument(it.Value());
+        }
+        splitter.PerformWithFiller(DSFill);
+
+        // intersection lines of the parent with each child
+        for (size_t i = 0; i < validChilds.size(); ++i) {
+            const PNamedShape child = validChilds[i];
+            TopoDS_Shape intersection = GetSectionEdges(DSFill, 0, static_cast<Standard_Integer>(i + 1));
             PNamedShape intersectionShape(new CNamedShape(intersection, std::string("INT" + std::string(_parent->Name()) + child->Name()).c_str()));
             intersectionShape->SetShortName(std::string("INT" + std::string(_parent->ShortName()) + child->ShortName()).c_str());
             _intersections.push_back(intersectionShape);
+        }
 
-#ifdef DEBUG_BOP
-            stop = clock();
-            printf("intersection [ms]: %f\n", (stop-start)/(double)CLOCKS_PER_SEC * 1000.);
-
-            start = clock();
-#endif
-            _trimmedParent = CTrimShape(_trimmedParent, child, DSFill, parentTrim);
-
-#ifdef DEBUG_BOP
-            stop = clock();
-            printf("parent split [ms]: %f\n", (stop-start)/(double)CLOCKS_PER_SEC * 1000.);
-
-            start = clock();
-#endif
-            PNamedShape trimmedChild = CTrimShape(child, _parent, DSFill, childTrim);
+        // trim the parent with all childs and the childs with the parent
+        _trimmedParent = CTrimShape(_parent, validChilds, splitter, parentTrim);
+        for (size_t i = 0; i < validChilds.size(); ++i) {
+            PNamedShape trimmedChild = CTrimShape(validChilds[i], ListPNamedShape(1, _parent), splitter, childTrim);
             _trimmedChilds.push_back(trimmedChild);
+        }
+        progress.Step();
 
 #ifdef DEBUG_BOP
-            stop = clock();
-            printf("child split [ms]: %f\n", (stop-start)/(double)CLOCKS_PER_SEC * 1000.);
+        stop = clock();
+        printf("split and trim [ms]: %f\n", (stop-start)/(double)CLOCKS_PER_SEC * 1000.);
 #endif
-        } // trimming
     }
 
     // add trimmed child faces to result
@@ -224,4 +345,5 @@ void CFuseShapes::DoFuse()
     CBooleanOperTools::MapFaceNamesAfterBOP(solidmaker, resultShell, result);
 
     _resultshape = result;
+    progress.Step(3);
 }
@@ -78,7 +78,33 @@ namespace
         BRepTools::Write(c, str.str().c_str());
     }
 
-    TopoDS_Shape GetFacesNotInShape(BRepBuilderAPI_MakeShape& bop, const TopoDS_Shape& originalShape, const TopoDS_Shape& splittedShape, const TopoDS_Shape& shapeToExInclude, TrimOperation op)
+    // Returns true, if the face with the central point p is kept by the trim operation
+    bool KeepFace(const gp_Pnt& p, const ListPNamedShape& tools, TrimOperation op)
+    {
+        for (ListPNamedShape::const_iterator it = tools.begin(); it != tools.end(); ++it) {
+            BRepClass3d_SolidClassifier classifier;
+            classifier.Load((*it)->Shape());
+            classifier.Perform(p, Precision::Confusion());
+
+            switch (op) {
+            case EXCLUDE:
+                if (classifier.State() == TopAbs_IN || classifier.State() == TopAbs_ON) {
+                    return false;
+                }
+                break;
+            case INCLUDE:
+                if (classifier.State() == TopAbs_IN) {
+                    return true;
+                }
+                break;
+            default:
+                printf("illegal operation\n");
+            }
+        }
+        return op == EXCLUDE;
+    }
+
+    TopoDS_Shape GetFacesNotInShape(BRepBuilderAPI_MakeShape& bop, const TopoDS_Shape& originalShape, const TopoDS_Shape& splittedShape, const ListPNamedShape& shapesToExInclude, TrimOperation op)
     {
 
         TopoDS_Compound compound;
@@ -97,25 +123,8 @@ namespace
                 TopoDS_Face splitface = TopoDS::Face(it.Value());
                 gp_Pnt p = GetCentralFacePoint(splitface);
 
-                // check if point is in shapeToExclude
-                BRepClass3d_SolidClassifier classifier;
-                classifier.Load(shapeToExInclude);
-                classifier.Perform(p, Precision::Confusion());
-
-
-                switch (op) {
-                case EXCLUDE:
-                    if (classifier.State() != TopAbs_IN && classifier.State() != TopAbs_ON) {
-                        compoundmaker.Add(compound, splitface);
-                    }
-                    break;
-                case INCLUDE:
-                    if (classifier.State() == TopAbs_IN) {
-                        compoundmaker.Add(compound, splitface);
-                    }
-                    break;
-                default:
-                    printf("illegal operation\n");
+                if (KeepFace(p, shapesToExInclude, op)) {
+                    compoundmaker.Add(compound, splitface);
                 }
             }
         }
@@ -131,25 +140,8 @@ namespace
                 const TopoDS_Face& originalFace = TopoDS::Face(originMap.FindKey(index));
                 gp_Pnt p = GetCentralFacePoint(originalFace);
 
-                // check if point is in shapeToExclude
-                BRepClass3d_SolidClassifier classifier;
-                classifier.Load(shapeToExInclude);
-                classifier.Perform(p, Precision::Confusion());
-
-
-                switch (op) {
-                case EXCLUDE:
-                    if (classifier.State() != TopAbs_IN && classifier.State() != TopAbs_ON) {
-                        compoundmaker.Add(compound, originalFace);
-                    }
-                    break;
-                case INCLUDE:
-                    if (classifier.State() == TopAbs_IN) {
-                        compoundmaker.Add(compound, originalFace);
-                    }
-                    break;
-                default:
-                    printf("illegal operation\n");
+                if (KeepFace(p, shapesToExInclude, op)) {
+                    compoundmaker.Add(compound, originalFace);
                 }
             }
         }
@@ -160,20 +152,27 @@ namespace
 } // namespace
 
 CTrimShape::CTrimShape(const PNamedShape shape, const PNamedShape trimmingTool, TrimOperation op)
-    : _operation(op), _resultshape(), _tool(trimmingTool), _source(shape), _dsfiller(NULL)
+    : _operation(op), _resultshape(), _tool(trimmingTool), _source(shape), _tools(1, trimmingTool), _dsfiller(NULL), _splitter(NULL)
 {
     _fillerAllocated = false;
     _hasPerformed = false;
 }
 
 CTrimShape::CTrimShape(const PNamedShape shape, const PNamedShape trimmingTool, const BOPAlgo_PaveFiller & filler, TrimOperation op)
-    : _operation(op), _resultshape(), _tool(trimmingTool), _source(shape)
+    : _operation(op), _resultshape(), _tool(trimmingTool), _source(shape), _tools(1, trimmingTool), _splitter(NULL)
 {
     _fillerAllocated = false;
     _hasPerformed = false;
     _dsfiller = (BOPAlgo_PaveFiller*) &filler;
 }
 
+CTrimShape::CTrimShape(const PNamedShape shape, const ListPNamedShape& trimmingTools, BOPAlgo_BuilderShape& splitter, TrimOperation op)
+    : _operation(op), _resultshape(), _tool(), _source(shape), _tools(trimmingTools), _dsfiller(NULL), _splitter(&splitter)
+{
+    _fillerAllocated = false;
+    _hasPerformed = false;
+}
+
 CTrimShape::~CTrimShape()
 {
     if (_fillerAllocated && _dsfiller) {
@@ -213,32 +212,42 @@ void CTrimShape::Perform()
             throw tigl::CTiglError("Null pointer for source argument in CTrimShape", TIGL_NULL_POINTER);
         }
 
-        if (!_tool) {
-            throw tigl::CTiglError("Null pointer for tool argument in CTrimShape", TIGL_NULL_POINTER);
+        for (ListPNamedShape::const_iterator it = _tools.begin(); it != _tools.end(); ++it) {
+            if (!*it) {
+                throw tigl::CTiglError("Null pointer for tool argument in CTrimShape", TIGL_NULL_POINTER);
+            }
         }
 
         bool debug = (getenv("TIGL_DEBUG_BOP") != NULL);
 
         if (debug) {
             WriteDebugShape(_source->Shape(), "source");
-            WriteDebugShape(_tool->Shape(), "tool");
+            for (ListPNamedShape::const_iterator it = _tools.begin(); it != _tools.end(); ++it) {
+                WriteDebugShape((*it)->Shape(), "tool");
+            }
         }
 
-        PrepareFiller();
-        GEOMAlgo_Splitter splitter;
-        BOPBuilderShapeToBRepBuilderShapeAdapter splitAdapter(splitter);
-        splitter.AddArgument(_source->Shape());
-        splitter.AddTool(_tool->Shape());
-        splitter.PerformWithFiller(*_dsfiller);
+        GEOMAlgo_Splitter ownSplitter;
+        BOPAlgo_BuilderShape* splitter = _splitter;
+        if (!splitter) {
+            PrepareFiller();
+            ownSplitter.AddArgument(_source->Shape());
+            ownSplitter.AddTool(_tool->Shape());
+            ownSplitter.PerformWithFiller(*_dsfiller);
+            splitter = &ownSplitter;
+        }
+        BOPBuilderShapeToBRepBuilderShapeAdapter splitAdapter(*splitter);
 
         if (debug) {
-            WriteDebugShape(splitter.Shape(), "split");
+            WriteDebugShape(splitter->Shape(), "split");
         }
 
-        TopoDS_Shape trimmedShape = GetFacesNotInShape(splitAdapter, _source->Shape(), splitter.Shape(), _tool->Shape(), _operation);
+        TopoDS_Shape trimmedShape = GetFacesNotInShape(splitAdapter, _source->Shape(), splitter->Shape(), _tools, _operation);
         _resultshape = PNamedShape(new CNamedShape(trimmedShape, _source->Name()));
         CBooleanOperTools::MapFaceNamesAfterBOP(splitAdapter, _source, _resultshape);
-        CBooleanOperTools::MapFaceNamesAfterBOP(splitAdapter, _tool,   _resultshape);
+        for (ListPNamedShape::const_iterator it = _tools.begin(); it != _tools.end(); ++it) {
+            CBooleanOperTools::MapFaceNamesAfterBOP(splitAdapter, *it, _resultshape);
+        }
 
         // create shell
         _resultshape = CBooleanOperTools::Shellify(_resultshape);
@@ -20,9 +20,11 @@
 #define CTRIMSHAPE_H
 
 #include "PNamedShape.h"
+#include "ListPNamedShape.h"
 #include "tigl_internal.h"
 
 class BOPAlgo_PaveFiller;
+class BOPAlgo_BuilderShape;
 
 enum TrimOperation
 {
@@ -36,6 +38,11 @@ public:
     // the trimming tool must be a solid!
     TIGL_EXPORT CTrimShape(const PNamedShape shape, const PNamedShape trimmingTool, TrimOperation = EXCLUDE);
     TIGL_EXPORT CTrimShape(const PNamedShape shape, const PNamedShape trimmingTool, const BOPAlgo_PaveFiller&, TrimOperation = EXCLUDE);
+
+    // Trims the shape with several solid tools. The splitter must already have split
+    // the shape and the tools, e.g. in one general fuse of all of them.
+    // EXCLUDE keeps the faces outside of all tools, INCLUDE the faces inside of any tool.
+    TIGL_EXPORT CTrimShape(const PNamedShape shape, const ListPNamedShape& trimmingTools, BOPAlgo_BuilderShape& splitter, TrimOperation = EXCLUDE);
     TIGL_EXPORT virtual ~CTrimShape();
 
     TIGL_EXPORT operator PNamedShape ();
@@ -50,7 +57,9 @@ protected:
     TrimOperation _operation;
 
     PNamedShape _resultshape, _tool, _source;
+    ListPNamedShape _tools;
     BOPAlgo_PaveFiller* _dsfiller;
+    BOPAlgo_BuilderShape* _splitter;
     bool _fillerAllocated;
 
 };
@@ -0,0 +1,195 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglXmlWriter.h"
+
+#include "CCPACSStringVector.h"
+#include "CTiglError.h"
+
+#include <cstdio>
+
+#ifdef _MSC_VER
+    #define snprintf _snprintf
+#endif
+
+namespace tigl
+{
+
+CTiglXmlWriter::CTiglXmlWriter(const std::string& filename)
+    : filename(filename)
+    , startTagOpen(false)
+{
+    file.open(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw CTiglError("Cannot open file " + filename + " for writing.", TIGL_OPEN_FAILED);
+    }
+    file << "<?xml version=\"1.0\"?>";
+}
+
+CTiglXmlWriter::~CTiglXmlWriter()
+{
+    // no exceptions from the destructor, Close has to be called to check for errors
+    if (file.is_open()) {
+        file.close();
+    }
+}
+
+void CTiglXmlWriter::StartElement(const std::string& name)
+{
+    CloseStartTag();
+    if (!elements.empty()) {
+        elements.back().hasChildElements = true;
+    }
+
+    Indent();
+    file << '<' << name;
+
+    OpenElement element;
+    element.name = name;
+    element.hasChildElements = false;
+    element.hasContent = false;
+    elements.push_back(element);
+    startTagOpen = true;
+}
+
+void CTiglXmlWriter::AddTextAttribute(const std::string& name, const std::string& value)
+{
+    if (!startTagOpen) {
+        throw CTiglError("Attribute " + name + " must be added directly after starting the element.");
+    }
+    file << ' ' << name << "=\"";
+    WriteEscaped(value, true);
+    file << '"';
+}
+
+void CTiglXmlWriter::AddIntegerAttribute(const std::string& name, long long value)
+{
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%lld", value);
+    AddTextAttribute(name, buffer);
+}
+
+void CTiglXmlWriter::AddDoubleAttribute(const std::string& name, double value)
+{
+    char buffer[64];
+    formatDouble(value, buffer);
+    AddTextAttribute(name, buffer);
+}
+
+void CTiglXmlWriter::WriteText(const std::string& text)
+{
+    ContentStream();
+    WriteEscaped(text, false);
+}
+
+void CTiglXmlWriter::WriteRaw(const char* data, size_t size)
+{
+    ContentStream().write(data, static_cast<std::streamsize>(size));
+}
+
+std::ostream& CTiglXmlWriter::ContentStream()
+{
+    if (elements.empty()) {
+        throw CTiglError("No open element to write content into.");
+    }
+    CloseStartTag();
+    elements.back().hasContent = true;
+    return file;
+}
+
+void CTiglXmlWriter::EndElement()
+{
+    if (elements.empty()) {
+        throw CTiglError("No open element to close.");
+    }
+
+    const OpenElement element = elements.back();
+    elements.pop_back();
+
+    if (startTagOpen) {
+        // empty element
+        file << "/>";
+        startTagOpen = false;
+        return;
+    }
+
+    if (element.hasChildElements && !element.hasContent) {
+        Indent();
+    }
+    file << "</" << element.name << '>';
+}
+
+void CTiglXmlWriter::Close()
+{
+    if (!file.is_open()) {
+        return;
+    }
+
+    while (!elements.empty()) {
+        EndElement();
+    }
+    file << '\n';
+    file.close();
+
+    if (file.fail()) {
+        throw CTiglError("Error writing file " + filename + ".", TIGL_WRITE_FAILED);
+    }
+}
+
+void CTiglXmlWriter::CloseStartTag()
+{
+    if (startTagOpen) {
+        file << '>';
+        startTagOpen = false;
+    }
+}
+
+void CTiglXmlWriter::Indent()
+{
+    file << '\n';
+    for (size_t i = 0; i < elements.size(); ++i) {
+        file << "  ";
+    }
+}
+
+void CTiglXmlWriter::WriteEscaped(const std::string& text, bool isAttribute)
+{
+    for (std::string::const_iterator it = text.begin(); it != text.end(); ++it) {
+        switch (*it) {
+        case '&':
+            file << "&amp;";
+            break;
+        case '<':
+            file << "&lt;";
+            break;
+        case '>':
+            file << "&gt;";
+            break;
+        case '"':
+            if (isAttribute) {
+                file << "&quot;";
+            }
+            else {
+                file << *it;
+            }
+            break;
+        default:
+            file << *it;
+        }
+    }
+}
+
+} // namespace tigl
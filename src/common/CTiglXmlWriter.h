@@ -0,0 +1,100 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief The CTiglXmlWriter class writes an xml document directly to a file.
+ *
+ * In contrast to TiXI, no document tree is built in memory. Elements are
+ * written in document order, attributes have to be added directly after
+ * StartElement. This allows to write large mesh files with constant memory.
+ *
+ * Usage:
+ *   CTiglXmlWriter writer("file.xml");
+ *   writer.StartElement("root");
+ *   writer.AddTextAttribute("name", "value");
+ *   writer.WriteText("content");
+ *   writer.EndElement();
+ *   writer.Close();
+ */
+
+#ifndef CTIGLXMLWRITER_H
+#define CTIGLXMLWRITER_H
+
+#include "tigl_internal.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglXmlWriter
+{
+public:
+    /// Opens the file and writes the xml declaration. Throws, if the file can not be opened.
+    TIGL_EXPORT explicit CTiglXmlWriter(const std::string& filename);
+    TIGL_EXPORT ~CTiglXmlWriter();
+
+    /// Opens a new element as child of the current element
+    TIGL_EXPORT void StartElement(const std::string& name);
+
+    /// Adds an attribute to the element opened last. Must be called before any content is written.
+    /// Doubles are written independent of the locale with the shortest text, that is read back as the same value.
+    TIGL_EXPORT void AddTextAttribute(const std::string& name, const std::string& value);
+    TIGL_EXPORT void AddIntegerAttribute(const std::string& name, long long value);
+    TIGL_EXPORT void AddDoubleAttribute(const std::string& name, double value);
+
+    /// Writes escaped character data into the current element
+    TIGL_EXPORT void WriteText(const std::string& text);
+
+    /// Writes character data without escaping, e.g. number arrays or base64 data
+    TIGL_EXPORT void WriteRaw(const char* data, size_t size);
+
+    /// Returns the output stream for writing raw content into the current element.
+    /// Content written to the stream is not escaped.
+    TIGL_EXPORT std::ostream& ContentStream();
+
+    /// Closes the element opened last
+    TIGL_EXPORT void EndElement();
+
+    /// Closes all open elements and the file. Throws, if writing failed.
+    TIGL_EXPORT void Close();
+
+private:
+    CTiglXmlWriter(const CTiglXmlWriter&);
+    CTiglXmlWriter& operator=(const CTiglXmlWriter&);
+
+    void CloseStartTag();
+    void Indent();
+    void WriteEscaped(const std::string& text, bool isAttribute);
+
+    struct OpenElement
+    {
+        std::string name;
+        bool hasChildElements;
+        bool hasContent;
+    };
+
+    std::string filename;
+    std::ofstream file;
+    std::vector<OpenElement> elements;
+    bool startTagOpen;
+};
+
+} // namespace tigl
+
+#endif // CTIGLXMLWRITER_H
@@ -27,6 +27,12 @@
 
 #include "CCPACSFuselageSegment.h"
 #include "CCPACSWingSegment.h"
+#include "CCPACSWingComponentSegment.h"
+#include "CCPACSWingProfile.h"
+#include "CCPACSFuselageProfile.h"
+#include "CCPACSPositionings.h"
+#include "CCPACSGuideCurves.h"
+#include "CTiglDependencyGraph.h"
 
 #include "TopoDS_Shape.hxx"
 #include "Standard_CString.hxx"
@@ -51,6 +57,9 @@
 #include "generated/TixiHelper.h"
 
 #include <cfloat>
+#include <map>
+#include <set>
+#include <typeinfo>
 
 namespace tigl
 {
@@ -83,6 +92,266 @@ void CCPACSConfiguration::Invalidate()
     shapeCache.Clear();
 }
 
+namespace
+{
+    // Adds the dependencies of the sections on their positionings
+    void AddPositioningDependencies(const boost::optional<CCPACSPositionings>& positionings, CTiglDependencyGraph& graph)
+    {
+        if (!positionings) {
+            return;
+        }
+
+        typedef std::vector<unique_ptr<CCPACSPositioning> > PositioningList;
+        const PositioningList& list = positionings->GetPositionings();
+
+        // the positioning, that places a section
+        std::map<std::string, std::string> positioningOfSection;
+        for (PositioningList::const_iterator it = list.begin(); it != list.end(); ++it) {
+            positioningOfSection[(*it)->GetToSectionUID()] = (*it)->GetUID();
+        }
+
+        for (PositioningList::const_iterator it = list.begin(); it != list.end(); ++it) {
+            const CCPACSPositioning& positioning = **it;
+            graph.AddDependency(positioning.GetUID(), positioning.GetToSectionUID());
+
+            // positionings starting at the moved section move as well
+            if (positioning.GetFromSectionUID()) {
+                std::map<std::string, std::string>::const_iterator parentIt = positioningOfSection.find(*positioning.GetFromSectionUID());
+                if (parentIt != positioningOfSection.end()) {
+                    graph.AddDependency(parentIt->second, positioning.GetUID());
+                }
+            }
+        }
+    }
+
+    // Adds the dependencies of a segment on the profiles of its guide curves.
+    // Guide curves are continued from the previous segment, hence the segment
+    // also depends on the segment of the preceding guide curve.
+    void AddGuideCurveDependencies(const boost::optional<CCPACSGuideCurves>& guideCurves,
+                                   const std::string& segmentUID,
+                                   const std::map<std::string, std::string>& segmentOfGuideCurve,
+                                   CTiglDependencyGraph& graph)
+    {
+        if (!guideCurves) {
+            return;
+        }
+
+        for (int iCurve = 1; iCurve <= guideCurves->GetGuideCurveCount(); ++iCurve) {
+            const CCPACSGuideCurve& curve = guideCurves->GetGuideCurve(iCurve);
+            graph.AddDependency(curve.GetGuideCurveProfileUID(), segmentUID);
+
+            if (curve.GetFromGuideCurveUID_choice1()) {
+                std::map<std::string, std::string>::const_iterator it = segmentOfGuideCurve.find(*curve.GetFromGuideCurveUID_choice1());
+                if (it != segmentOfGuideCurve.end()) {
+                    graph.AddDependency(it->second, segmentUID);
+                }
+            }
+        }
+    }
+
+    void CollectGuideCurves(const boost::optional<CCPACSGuideCurves>& guideCurves, const std::string& segmentUID,
+                            std::map<std::string, std::string>& segmentOfGuideCurve)
+    {
+        if (!guideCurves) {
+            return;
+        }
+
+        for (int iCurve = 1; iCurve <= guideCurves->GetGuideCurveCount(); ++iCurve) {
+            segmentOfGuideCurve[guideCurves->GetGuideCurve(iCurve).GetUID()] = segmentUID;
+        }
+    }
+
+    // Collects the uids of all segments and component segments of a component
+    void CollectSubComponents(CTiglRelativelyPositionedComponent& component, std::vector<std::string>& uids)
+    {
+        if (CCPACSWing* wing = dynamic_cast<CCPACSWing*>(&component)) {
+            for (int iSegment = 1; iSegment <= wing->GetSegmentCount(); ++iSegment) {
+                uids.push_back(wing->GetSegment(iSegment).GetUID());
+            }
+            for (int iCompSeg = 1; iCompSeg <= wing->GetComponentSegmentCount(); ++iCompSeg) {
+                uids.push_back(wing->GetComponentSegment(iCompSeg).GetUID());
+            }
+        }
+        else if (CCPACSFuselage* fuselage = dynamic_cast<CCPACSFuselage*>(&component)) {
+            for (int iSegment = 1; iSegment <= fuselage->GetSegmentCount(); ++iSegment) {
+                uids.push_back(fuselage->GetSegment(iSegment).GetUID());
+            }
+        }
+    }
+} // anonymous namespace
+
+// Builds the graph of dependencies between the geometric objects:
+// profile/section/positioning -> section element -> segment -> component segment/wing/fuselage
+void CCPACSConfiguration::BuildDependencyGraph(CTiglDependencyGraph& graph)
+{
+    graph.Clear();
+
+    for (int iWing = 1; iWing <= GetWingCount(); ++iWing) {
+        CCPACSWing& wing = GetWing(iWing);
+
+        AddPositioningDependencies(wing.GetPositionings(), graph);
+
+        for (int iSection = 1; iSection <= wing.GetSectionCount(); ++iSection) {
+            const CCPACSWingSection& section = wing.GetSection(iSection);
+            for (int iElement = 1; iElement <= section.GetSectionElementCount(); ++iElement) {
+                const CCPACSWingSectionElement& element = section.GetSectionElement(iElement);
+                graph.AddDependency(section.GetUID(), element.GetUID());
+                graph.AddDependency(element.GetAirfoilUID(), element.GetUID());
+            }
+        }
+
+        std::map<std::string, std::string> segmentOfGuideCurve;
+        for (int iSegment = 1; iSegment <= wing.GetSegmentCount(); ++iSegment) {
+            const CCPACSWingSegment& segment = wing.GetSegment(iSegment);
+            CollectGuideCurves(segment.GetGuideCurves(), segment.GetUID(), segmentOfGuideCurve);
+        }
+
+        for (int iSegment = 1; iSegment <= wing.GetSegmentCount(); ++iSegment) {
+            const CCPACSWingSegment& segment = wing.GetSegment(iSegment);
+            graph.AddDependency(segment.GetInnerSectionElementUID(), segment.GetUID());
+            graph.AddDependency(segment.GetOuterSectionElementUID(), segment.GetUID());
+            AddGuideCurveDependencies(segment.GetGuideCurves(), segment.GetUID(), segmentOfGuideCurve, graph);
+            graph.AddDependency(segment.GetUID(), wing.GetUID());
+
+            for (int iCompSeg = 1; iCompSeg <= wing.GetComponentSegmentCount(); ++iCompSeg) {
+                const CCPACSWingComponentSegment& compSeg = wing.GetComponentSegment(iCompSeg);
+                if (compSeg.IsSegmentContained(segment)) {
+                    graph.AddDependency(segment.GetUID(), compSeg.GetUID());
+                }
+            }
+        }
+    }
+
+    for (int iFuselage = 1; iFuselage <= GetFuselageCount(); ++iFuselage) {
+        CCPACSFuselage& fuselage = GetFuselage(iFuselage);
+
+        AddPositioningDependencies(fuselage.GetPositionings(), graph);
+
+        for (int iSection = 1; iSection <= fuselage.GetSectionCount(); ++iSection) {
+            const CCPACSFuselageSection& section = fuselage.GetSection(iSection);
+            for (int iElement = 1; iElement <= section.GetSectionElementCount(); ++iElement) {
+                const CCPACSFuselageSectionElement& element = section.GetSectionElement(iElement);
+                graph.AddDependency(section.GetUID(), element.GetUID());
+                graph.AddDependency(element.GetProfileUID(), element.GetUID());
+            }
+        }
+
+        std::map<std::string, std::string> segmentOfGuideCurve;
+        for (int iSegment = 1; iSegment <= fuselage.GetSegmentCount(); ++iSegment) {
+            const CCPACSFuselageSegment& segment = fuselage.GetSegment(iSegment);
+            CollectGuideCurves(segment.GetGuideCurves(), segment.GetUID(), segmentOfGuideCurve);
+        }
+
+        for (int iSegment = 1; iSegment <= fuselage.GetSegmentCount(); ++iSegment) {
+            CCPACSFuselageSegment& segment = fuselage.GetSegment(iSegment);
+            graph.AddDependency(segment.GetStartSectionElementUID(), segment.GetUID());
+            graph.AddDependency(segment.GetEndSectionElementUID(), segment.GetUID());
+            AddGuideCurveDependencies(segment.GetGuideCurves(), segment.GetUID(), segmentOfGuideCurve, graph);
+            graph.AddDependency(segment.GetUID(), fuselage.GetUID());
+        }
+    }
+}
+
+// Invalidates only the objects depending on the given uid
+void CCPACSConfiguration::Invalidate(const std::string& uid)
+{
+    if (!uidManager.IsUIDRegistered(uid)) {
+        throw CTiglError("UID '" + uid + "' not found in CCPACSConfiguration::Invalidate", TIGL_UID_ERROR);
+    }
+
+    // rotors are assembled from their attached blades, which is not tracked
+    if (IsRotorcraft()) {
+        Invalidate();
+        return;
+    }
+
+    // The graph is rebuilt on each call, as the referenced uids might have been changed
+    CTiglDependencyGraph graph;
+    BuildDependencyGraph(graph);
+
+    // components, whose transformation has changed
+    std::set<std::string> movedComponents;
+    std::vector<std::string> changedUIDs(1, uid);
+
+    const CTiglUIDManager::TypedPtr object = uidManager.ResolveObject(uid);
+    CTiglRelativelyPositionedComponent* component = NULL;
+    if (*object.type == typeid(CCPACSWing)) {
+        component = static_cast<CCPACSWing*>(object.ptr);
+    }
+    else if (*object.type == typeid(CCPACSFuselage)) {
+        component = static_cast<CCPACSFuselage*>(object.ptr);
+    }
+
+    if (component) {
+        // the component and all of its children are moved
+        CTiglRelativelyPositionedComponent::ChildContainerType components = component->GetChildren(true);
+        components.insert(components.begin(), component);
+        for (CTiglRelativelyPositionedComponent::ChildContainerType::iterator it = components.begin(); it != components.end(); ++it) {
+            movedComponents.insert((*it)->GetDefaultedUID());
+            changedUIDs.push_back((*it)->GetDefaultedUID());
+            CollectSubComponents(**it, changedUIDs);
+        }
+    }
+    else if (!graph.HasNode(uid)) {
+        // we don't know, what depends on this object
+        Invalidate();
+        return;
+    }
+
+    std::set<std::string> affected(changedUIDs.begin(), changedUIDs.end());
+    for (std::vector<std::string>::const_iterator it = changedUIDs.begin(); it != changedUIDs.end(); ++it) {
+        std::set<std::string> dependents;
+        graph.GetDependents(*it, dependents);
+        affected.insert(dependents.begin(), dependents.end());
+    }
+
+    for (std::set<std::string>::const_iterator it = affected.begin(); it != affected.end(); ++it) {
+        if (!uidManager.IsUIDRegistered(*it)) {
+            continue;
+        }
+
+        const CTiglUIDManager::TypedPtr affectedObject = uidManager.ResolveObject(*it);
+        const std::type_info& type = *affectedObject.type;
+        if (type == typeid(CCPACSWingSegment)) {
+            static_cast<CCPACSWingSegment*>(affectedObject.ptr)->Invalidate();
+        }
+        else if (type == typeid(CCPACSWingComponentSegment)) {
+            static_cast<CCPACSWingComponentSegment*>(affectedObject.ptr)->Invalidate();
+        }
+        else if (type == typeid(CCPACSFuselageSegment)) {
+            static_cast<CCPACSFuselageSegment*>(affectedObject.ptr)->Invalidate();
+        }
+        else if (type == typeid(CCPACSWing)) {
+            CCPACSWing* wing = static_cast<CCPACSWing*>(affectedObject.ptr);
+            if (movedComponents.find(*it) != movedComponents.end()) {
+                wing->Invalidate();
+            }
+            wing->InvalidateShapes();
+        }
+        else if (type == typeid(CCPACSFuselage)) {
+            CCPACSFuselage* fuselage = static_cast<CCPACSFuselage*>(affectedObject.ptr);
+            if (movedComponents.find(*it) != movedComponents.end()) {
+                fuselage->Invalidate();
+            }
+            fuselage->InvalidateShapes();
+        }
+        else if (type == typeid(CCPACSWingProfile)) {
+            static_cast<CCPACSWingProfile*>(affectedObject.ptr)->Invalidate();
+        }
+        else if (type == typeid(CCPACSFuselageProfile)) {
+            static_cast<CCPACSFuselageProfile*>(affectedObject.ptr)->Invalidate();
+        }
+        else if (type == typeid(CCPACSPositioning)) {
+            static_cast<CCPACSPositioning*>(affectedObject.ptr)->Invalidate();
+        }
+
+        shapeCache.RemoveComponent(*it);
+    }
+
+    // the fused aircraft contains all components
+    aircraftFuser.reset();
+}
+
 namespace {
     const std::string headerXPath   = "/cpacs/header";
     const std::string profilesXPath = "/cpacs/vehicles/profiles";
@@ -97,6 +366,10 @@ void CCPACSConfiguration::ReadCPACS(const std::string& configurationUID)
         throw CTiglError("XML error while reading in CCPACSConfiguration::ReadCPACS", TIGL_XML_ERROR);
     }
 
+    // the generated classes look up their elements directly in the parsed document
+    // instead of evaluating an xpath for each element
+    tixi::TixiCursorScope cursorScope(tixiDocumentHandle);
+
     if (tixi::TixiCheckElement(tixiDocumentHandle, headerXPath)) {
         header.ReadCPACS(tixiDocumentHandle, headerXPath);
     }
@@ -182,6 +455,7 @@ void CCPACSConfiguration::transformAllComponents(CTiglRelativelyPositionedCompon
 // Returns the boolean fused airplane as TopoDS_Shape
 PTiglFusePlane CCPACSConfiguration::AircraftFusingAlgo()
 {
+    std::lock_guard<std::mutex> lock(aircraftFuserMutex);
     if (! aircraftFuser) {
         aircraftFuser = PTiglFusePlane(new CTiglFusePlane(*this));
     }
@@ -236,6 +510,12 @@ int CCPACSConfiguration::GetWingProfileCount() const
     return static_cast<int>(count);
 }
 
+// Returns the class which holds all profiles, if available
+const boost::optional<CCPACSProfiles>& CCPACSConfiguration::GetProfiles() const
+{
+    return profiles;
+}
+
 // Returns the class which holds all wing profiles
 CCPACSWingProfiles& CCPACSConfiguration::GetWingProfiles()
 {
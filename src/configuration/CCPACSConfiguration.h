@@ -46,11 +46,14 @@
 #include "CSharedPtr.h"
 #include "CCPACSProfiles.h"
 
+#include <mutex>
+
 
 namespace tigl
 {
 
 class CTiglFusePlane;
+class CTiglDependencyGraph;
 typedef CSharedPtr<CTiglFusePlane> PTiglFusePlane;
 
 class CCPACSConfiguration
@@ -67,6 +70,14 @@ public:
     // recalculation of wires, lofts etc.
     TIGL_EXPORT void Invalidate();
 
+    // Invalidates only the geometry, that depends on the CPACS object with the given uid
+    // (e.g. a section, section element, positioning, profile or component). Lofts of
+    // unaffected segments and components are kept.
+    TIGL_EXPORT void Invalidate(const std::string& uid);
+
+    // Builds the graph of dependencies between the geometric objects of this configuration
+    TIGL_EXPORT void BuildDependencyGraph(CTiglDependencyGraph& graph);
+
     // Read CPACS configuration
     TIGL_EXPORT void ReadCPACS(const std::string& configurationUID);
 
@@ -85,6 +96,9 @@ public:
     // Returns true if a wing or rotor profile with the given uid exists
     TIGL_EXPORT bool HasWingProfile(std::string uid) const;
 
+    // Returns the class which holds all profiles, if available
+    TIGL_EXPORT const boost::optional<CCPACSProfiles>& GetProfiles() const;
+
     // Returns the class which holds all wing profiles
     TIGL_EXPORT CCPACSWingProfiles& GetWingProfiles();
     
@@ -230,6 +244,7 @@ private:
     CCPACSACSystems                        acSystems;            /**< Configuration aircraft systems element */
     CCPACSFarField                         farField;             /**< Far field configuration for CFD tools */
     PTiglFusePlane                         aircraftFuser;        /**< The aircraft fusing algo */
+    std::mutex                             aircraftFuserMutex;   /**< Guards the lazy creation of aircraftFuser */
     CTiglShapeCache                        shapeCache;
     CTiglMemoryPool                        memoryPool;
 };
@@ -61,6 +61,8 @@ TiglCPACSConfigurationHandle CCPACSConfigurationManager::AddConfiguration(CCPACS
         throw CTiglError("Null pointer argument for CCPACSConfiguration in CCPACSConfigurationManager::AddConfiguration", TIGL_NULL_POINTER);
     }
 
+    std::lock_guard<std::mutex> lock(mutex);
+
     handleCounter++;
 
     if (handleCounter < 1) {
@@ -81,19 +83,26 @@ TiglCPACSConfigurationHandle CCPACSConfigurationManager::AddConfiguration(CCPACS
 // Removes and deletes a configuration from the configuration container
 void CCPACSConfigurationManager::DeleteConfiguration(TiglCPACSConfigurationHandle handle)
 {
-    CCPACSConfigIterator iter = configurations.find(handle);
-    if (iter == configurations.end()) {
-        throw CTiglError("Invalid CPACS configuration handle in CCPACSConfigurationManager::DeleteConfiguration", TIGL_NOT_FOUND);
+    CCPACSConfiguration* config = NULL;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        CCPACSConfigIterator iter = configurations.find(handle);
+        if (iter == configurations.end()) {
+            throw CTiglError("Invalid CPACS configuration handle in CCPACSConfigurationManager::DeleteConfiguration", TIGL_NOT_FOUND);
+        }
+
+        config = iter->second;
+        configurations.erase(iter);
     }
 
-    CCPACSConfiguration* config = iter->second;
+    // the handle is not visible to other threads anymore
     delete config;
-    configurations.erase(iter);
 }
 
 // Returns the configuration for a given handle
 CCPACSConfiguration& CCPACSConfigurationManager::GetConfiguration(TiglCPACSConfigurationHandle handle) const
 {
+    std::lock_guard<std::mutex> lock(mutex);
     CCPACSConfigConstIterator iter = configurations.find(handle);
     if (iter == configurations.end()) {
         throw CTiglError("Invalid CPACS configuration handle in CCPACSConfigurationManager::GetConfiguration", TIGL_NOT_FOUND);
@@ -106,6 +115,7 @@ CCPACSConfiguration& CCPACSConfigurationManager::GetConfiguration(TiglCPACSConfi
 // Tests if a given configuration handle is valid
 bool CCPACSConfigurationManager::IsValid(TiglCPACSConfigurationHandle handle) const
 {
+    std::lock_guard<std::mutex> lock(mutex);
     CCPACSConfigConstIterator iter = configurations.find(handle);
     return (iter != configurations.end());
 }
@@ -113,6 +123,7 @@ bool CCPACSConfigurationManager::IsValid(TiglCPACSConfigurationHandle handle) co
 // Invalidates all configurations and forces recalculation of wires/points etc.
 void CCPACSConfigurationManager::Invalidate()
 {
+    std::lock_guard<std::mutex> lock(mutex);
     for (CCPACSConfigConstIterator iter = configurations.begin(); iter != configurations.end(); ++iter) {
         CCPACSConfiguration* config = iter->second;
         config->Invalidate();
@@ -22,6 +22,13 @@
 * @file 
 * @brief  Implementation of routines for managing CPACS configurations by handle.
 *         Implements the singleton design pattern.
+*
+* Thread safety: the handle map may be accessed concurrently from multiple threads.
+* A configuration itself follows a reader/writer model: queries (e.g. point or
+* eta/xsi computations, lofts) may run concurrently on the same configuration,
+* as all lazily built caches are initialized only once. Modifications, i.e.
+* writing the configuration, setting values, invalidating or closing it,
+* must not run concurrently to any other access to the same configuration.
 */
 
 #ifndef CCPACSCONFIGURATIONMANAGER_H
@@ -31,6 +38,7 @@
 #include "tigl_internal.h"
 #include "CCPACSConfiguration.h"
 #include <map>
+#include <mutex>
 
 namespace tigl
 {
@@ -79,6 +87,7 @@ private:
 private:
     CCPACSConfigContainer        configurations; // Container to store the configurations by a handle
     TiglCPACSConfigurationHandle handleCounter;  // Used to generate new handles
+    mutable std::mutex           mutex;          // Guards configurations and handleCounter
 
 };
 
@@ -0,0 +1,83 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglDependencyGraph.h"
+
+#include <algorithm>
+
+namespace tigl
+{
+
+CTiglDependencyGraph::CTiglDependencyGraph()
+{
+}
+
+void CTiglDependencyGraph::AddDependency(const std::string& uid, const std::string& dependentUID)
+{
+    if (uid.empty() || dependentUID.empty() || uid == dependentUID) {
+        return;
+    }
+
+    nodes.insert(uid);
+    nodes.insert(dependentUID);
+
+    std::vector<std::string>& edges = dependents[uid];
+    if (std::find(edges.begin(), edges.end(), dependentUID) == edges.end()) {
+        edges.push_back(dependentUID);
+    }
+}
+
+bool CTiglDependencyGraph::HasNode(const std::string& uid) const
+{
+    return nodes.find(uid) != nodes.end();
+}
+
+void CTiglDependencyGraph::GetDependents(const std::string& uid, std::set<std::string>& result) const
+{
+    result.clear();
+
+    // graph traversal, the result set also protects against cycles
+    std::vector<std::string> queue(1, uid);
+    while (!queue.empty()) {
+        std::string current = queue.back();
+        queue.pop_back();
+
+        EdgeMap::const_iterator it = dependents.find(current);
+        if (it == dependents.end()) {
+            continue;
+        }
+
+        const std::vector<std::string>& edges = it->second;
+        for (std::vector<std::string>::const_iterator edgeIt = edges.begin(); edgeIt != edges.end(); ++edgeIt) {
+            if (*edgeIt != uid && result.insert(*edgeIt).second) {
+                queue.push_back(*edgeIt);
+            }
+        }
+    }
+}
+
+bool CTiglDependencyGraph::IsEmpty() const
+{
+    return nodes.empty();
+}
+
+void CTiglDependencyGraph::Clear()
+{
+    dependents.clear();
+    nodes.clear();
+}
+
+} // namespace tigl
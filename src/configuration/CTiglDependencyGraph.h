@@ -0,0 +1,69 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief The CTiglDependencyGraph class stores which CPACS objects
+ * (identified by their UID) have to be recomputed, if another object changes.
+ *
+ * An edge uid -> dependentUID means, that the geometry of dependentUID is
+ * derived from uid, e.g. a segment depends on its section elements, which in turn
+ * depend on their section and profile.
+ */
+
+#ifndef CTIGLDEPENDENCYGRAPH_H
+#define CTIGLDEPENDENCYGRAPH_H
+
+#include "tigl_internal.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace tigl
+{
+
+class CTiglDependencyGraph
+{
+public:
+    TIGL_EXPORT CTiglDependencyGraph();
+
+    /// Adds the information, that dependentUID has to be recomputed, if uid changes
+    TIGL_EXPORT void AddDependency(const std::string& uid, const std::string& dependentUID);
+
+    /// Returns true, if uid is part of the graph
+    TIGL_EXPORT bool HasNode(const std::string& uid) const;
+
+    /// Returns all objects, that directly or indirectly depend on uid.
+    /// uid itself is not part of the result.
+    TIGL_EXPORT void GetDependents(const std::string& uid, std::set<std::string>& dependents) const;
+
+    /// Returns true, if the graph does not contain any nodes
+    TIGL_EXPORT bool IsEmpty() const;
+
+    /// Removes all nodes and edges
+    TIGL_EXPORT void Clear();
+
+private:
+    typedef std::map<std::string, std::vector<std::string> > EdgeMap;
+
+    EdgeMap dependents;
+    std::set<std::string> nodes;
+};
+
+} // namespace tigl
+
+#endif // CTIGLDEPENDENCYGRAPH_H
@@ -26,13 +26,20 @@
 #include "CMergeShapes.h"
 #include "CTrimShape.h"
 #include "tiglcommonfunctions.h"
+#include "tiglparallel.h"
+#include "CTiglProgress.h"
+#include "CTiglDiskCache.h"
 
 #include <BOPCol_ListOfShape.hxx>
 #include <BOPAlgo_PaveFiller.hxx>
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepAlgoAPI_Common.hxx>
+#include <BRepBndLib.hxx>
+#include <Bnd_Box.hxx>
 
 
+#include <algorithm>
+#include <sstream>
 #include <string>
 #include <cassert>
 
@@ -76,75 +83,197 @@ const PNamedShape CTiglFusePlane::FarField()
 
 void CTiglFusePlane::Invalidate()
 {
-    _hasPerformed = false;
+    _performed.Reset();
     _intersections.clear();
     _result.reset();
     _farfield.reset();
 }
 
 
-PNamedShape CTiglFusePlane::FuseWithChilds(CTiglRelativelyPositionedComponent* parent, const std::vector<CTiglRelativelyPositionedComponent*>& children)
+namespace
 {
-    PNamedShape parentShape;
-    if (parent) {
-        parentShape = parent->GetLoft();
-        if (parentShape) {
-            if (_mymode == FULL_PLANE || _mymode == FULL_PLANE_TRIMMED_FF) {
-                PNamedShape rootShapeMirr = parent->GetMirroredLoft();
-                parentShape = CMergeShapes(parentShape, rootShapeMirr);
+    // The lofts of a component and its child components
+    struct ComponentTree
+    {
+        PNamedShape shape;
+        std::vector<ComponentTree> children;
+
+        // the component fused with all of its children and the intersection lines
+        PNamedShape fused;
+        ListPNamedShape intersections;
+    };
+
+    // Collects the lofts of all components. This is done before fusing, as
+    // the lofts are built lazily and must not be created concurrently.
+    void CollectComponentTree(CTiglRelativelyPositionedComponent* parent,
+                              const std::vector<CTiglRelativelyPositionedComponent*>& children,
+                              TiglFuseResultMode mode,
+                              ComponentTree& tree)
+    {
+        if (parent) {
+            tree.shape = parent->GetLoft();
+            if (tree.shape) {
+                if (mode == FULL_PLANE || mode == FULL_PLANE_TRIMMED_FF) {
+                    PNamedShape rootShapeMirr = parent->GetMirroredLoft();
+                    tree.shape = CMergeShapes(tree.shape, rootShapeMirr);
+                }
             }
         }
+
+        tree.children.resize(children.size());
+        for (size_t i = 0; i < children.size(); ++i) {
+            CollectComponentTree(children[i], children[i]->GetChildren(false), mode, tree.children[i]);
+        }
     }
 
-    if (children.size() == 0) {
-        return parentShape;
+    // Removes the parts of the intersection lines, that lie inside the shape
+    void CutIntersections(ListPNamedShape& intersections, const TopoDS_Shape& shape)
+    {
+        ListPNamedShape newInts;
+        for (ListPNamedShape::iterator intIt = intersections.begin(); intIt != intersections.end(); ++intIt) {
+            PNamedShape inters = *intIt;
+            if (!inters) {
+                continue;
+            }
+
+            TopoDS_Shape sh = BRepAlgoAPI_Cut(inters->Shape(), shape);
+            if (!sh.IsNull()) {
+                inters->SetShape(sh);
+                newInts.push_back(inters);
+            }
+        }
+        intersections = newInts;
     }
 
-    ListPNamedShape childShapes;
-    for (std::vector<CTiglRelativelyPositionedComponent*>::const_iterator it = children.begin(); it != children.end(); ++it) {
-        childShapes.push_back(FuseWithChilds(*it, (*it)->GetChildren(false)));
+    // Appends the loft cache keys of the components and their children to key.
+    // Returns false, if a component cannot be identified.
+    bool AppendComponentCacheKeys(const std::vector<CTiglRelativelyPositionedComponent*>& components, std::string& key)
+    {
+        key += "(\n";
+        for (size_t i = 0; i < components.size(); ++i) {
+            std::string componentKey;
+            if (!components[i]->GetLoftCacheKey(componentKey)) {
+                return false;
+            }
+            key += componentKey;
+            if (!AppendComponentCacheKeys(components[i]->GetChildren(false), key)) {
+                return false;
+            }
+        }
+        key += ")\n";
+        return true;
     }
-    CFuseShapes fuser(parentShape, childShapes);
-    PNamedShape result = fuser.NamedShape();
 
-    // trim previous intersections
-    ListPNamedShape::iterator intIt = _intersections.begin();
-    ListPNamedShape newInts;
-    for (; intIt != _intersections.end(); ++intIt) {
-        PNamedShape inters = *intIt;
-        if (!inters) {
-            continue;
+    // Collects the components, that have to be fused with their children, by the
+    // height of their subtree. The fuse operations of one level are independent
+    // of each other, they only need the results of the levels below.
+    // Returns the height of the subtree.
+    size_t CollectFuseOperations(ComponentTree& tree, std::vector<std::vector<ComponentTree*> >& levels)
+    {
+        if (tree.children.empty()) {
+            tree.fused = tree.shape;
+            return 0;
         }
 
-        TopoDS_Shape sh = inters->Shape();
-        if (parentShape) {
-            sh = BRepAlgoAPI_Cut(sh, parentShape->Shape());
+        size_t height = 1;
+        for (size_t i = 0; i < tree.children.size(); ++i) {
+            height = std::max(height, CollectFuseOperations(tree.children[i], levels) + 1);
         }
-        if (!sh.IsNull()) {
-            inters->SetShape(sh);
-            newInts.push_back(inters);
+        if (levels.size() < height) {
+            levels.resize(height);
         }
+        levels[height - 1].push_back(&tree);
+        return height;
     }
-    _intersections = newInts;
 
-    // insert intersections
-    ListPNamedShape::const_iterator it = fuser.Intersections().begin();
-    for (; it != fuser.Intersections().end(); it++) {
-        if (*it) {
-            _intersections.push_back(*it);
+    // Fuses the component with its already fused children. The intersection lines
+    // of the children's subtrees are trimmed with the sibling subtrees and the
+    // component, the new intersection lines are appended.
+    void FuseWithChildren(ComponentTree& tree)
+    {
+        const size_t nChildren = tree.children.size();
+
+        // trim the intersections of each subtree with the sibling subtrees
+        if (nChildren > 1) {
+            std::vector<Bnd_Box> siblingBoxes(nChildren);
+            for (size_t i = 0; i < nChildren; ++i) {
+                if (tree.children[i].fused) {
+                    BRepBndLib::Add(tree.children[i].fused->Shape(), siblingBoxes[i]);
+                }
+            }
+
+            for (size_t i = 0; i < nChildren; ++i) {
+                for (size_t j = 0; j < nChildren; ++j) {
+                    ListPNamedShape& childIntersections = tree.children[i].intersections;
+                    if (i == j || siblingBoxes[j].IsVoid() || childIntersections.empty()) {
+                        continue;
+                    }
+
+                    Bnd_Box intersectionBox;
+                    for (ListPNamedShape::const_iterator it = childIntersections.begin(); it != childIntersections.end(); ++it) {
+                        if (*it) {
+                            BRepBndLib::Add((*it)->Shape(), intersectionBox);
+                        }
+                    }
+                    if (!intersectionBox.IsOut(siblingBoxes[j])) {
+                        CutIntersections(childIntersections, tree.children[j].fused->Shape());
+                    }
+                }
+            }
+        }
+
+        // the parent is fused with all subtrees in one multi-argument boolean
+        ListPNamedShape childShapes;
+        for (size_t i = 0; i < nChildren; ++i) {
+            childShapes.push_back(tree.children[i].fused);
+        }
+        CFuseShapes fuser(tree.shape, childShapes);
+        tree.fused = fuser.NamedShape();
+
+        // trim previous intersections
+        for (size_t i = 0; i < nChildren; ++i) {
+            ListPNamedShape& childIntersections = tree.children[i].intersections;
+            if (tree.shape) {
+                CutIntersections(childIntersections, tree.shape->Shape());
+            }
+            tree.intersections.insert(tree.intersections.end(), childIntersections.begin(), childIntersections.end());
+            childIntersections.clear();
+        }
+
+        // insert intersections
+        ListPNamedShape::const_iterator it = fuser.Intersections().begin();
+        for (; it != fuser.Intersections().end(); it++) {
+            if (*it) {
+                tree.intersections.push_back(*it);
+            }
         }
     }
-    
-    return result;
-}
 
-/**
- * @todo: it would be nice if this algorithm would support
- * some progress bar interface
- */
+    // Performs the fuse operations of one level of the component tree concurrently
+    class FuseOperationTask
+    {
+    public:
+        FuseOperationTask(const std::vector<ComponentTree*>& operations, CTiglProgress& progress)
+            : operations(operations), progress(progress)
+        {
+        }
+
+        void operator()(size_t i)
+        {
+            FuseWithChildren(*operations[i]);
+            progress.Step();
+        }
+
+    private:
+        const std::vector<ComponentTree*>& operations;
+        CTiglProgress& progress;
+    };
+} // namespace
+
 void CTiglFusePlane::Perform()
 {
-    if (_hasPerformed) {
+    CTiglOnceGuard guard(_performed);
+    if (guard.IsDone()) {
         return;
     }
 
@@ -153,10 +282,59 @@ void CTiglFusePlane::Perform()
     const RelativeComponentContainerType& rootComponents = uidManager.GetRootGeometricComponents();
     for (RelativeComponentContainerType::const_iterator it = rootComponents.begin(); it != rootComponents.end(); ++it)
         rootComponentPtrs.push_back(it->second);
-    _result = FuseWithChilds(NULL, rootComponentPtrs);
 
     CCPACSFarField& farfield = _myconfig.GetFarField();
-    if (farfield.GetType() != NONE && (_mymode == FULL_PLANE_TRIMMED_FF || _mymode == HALF_PLANE_TRIMMED_FF)) {
+    bool trimWithFarField = farfield.GetType() != NONE && (_mymode == FULL_PLANE_TRIMMED_FF || _mymode == HALF_PLANE_TRIMMED_FF);
+
+    // the disk cache is used only, if all components can be identified
+    CTiglDiskCache& diskCache = CTiglDiskCache::GetInstance();
+    std::stringstream cacheKey;
+    cacheKey << "fused plane " << _myconfig.GetUID() << " " << _mymode << "\n";
+    std::string componentKeys;
+    bool useDiskCache = diskCache.IsEnabled() && AppendComponentCacheKeys(rootComponentPtrs, componentKeys);
+    if (useDiskCache) {
+        cacheKey << componentKeys;
+        if (trimWithFarField) {
+            std::string farfieldKey;
+            AppendCPACSDefinition(farfieldKey, farfield);
+            cacheKey << farfieldKey;
+        }
+
+        // result, far field and intersections
+        ListPNamedShape cachedShapes;
+        if (diskCache.Load(cacheKey.str(), cachedShapes) && cachedShapes.size() >= 2 && cachedShapes[0]) {
+            _result   = cachedShapes[0];
+            _farfield = cachedShapes[1];
+            _intersections.assign(cachedShapes.begin() + 2, cachedShapes.end());
+            guard.SetDone();
+            return;
+        }
+    }
+
+    ComponentTree tree;
+    CollectComponentTree(NULL, rootComponentPtrs, _mymode, tree);
+
+    std::vector<std::vector<ComponentTree*> > levels;
+    CollectFuseOperations(tree, levels);
+    size_t nOperations = 0;
+    for (size_t i = 0; i < levels.size(); ++i) {
+        nOperations += levels[i].size();
+    }
+
+    CTiglProgress progress("Fusing configuration", nOperations + (trimWithFarField ? 1 : 0));
+
+    // intersections of a canceled run must not remain
+    _intersections.clear();
+
+    // fuse the component tree bottom up, all components of a level in parallel
+    for (size_t i = 0; i < levels.size(); ++i) {
+        FuseOperationTask task(levels[i], progress);
+        ParallelFor(levels[i].size(), task);
+    }
+    _result = tree.fused;
+    _intersections = tree.intersections;
+
+    if (trimWithFarField) {
         PNamedShape ff = farfield.GetLoft();
         assert(_result);
 
@@ -192,14 +370,22 @@ void CTiglFusePlane::Perform()
             }
         }
         _intersections = newInts;
+        progress.Step();
     }
 
     if (_result) {
         _result->SetName(_myconfig.GetUID().c_str());
         _result->SetShortName("AIRCRAFT");
-    }
-    _hasPerformed = true;
 
+        if (useDiskCache) {
+            ListPNamedShape shapes;
+            shapes.push_back(_result);
+            shapes.push_back(_farfield);
+            shapes.insert(shapes.end(), _intersections.begin(), _intersections.end());
+            diskCache.Store(cacheKey.str(), shapes);
+        }
+    }
+    guard.SetDone();
 }
 
 } // namespace tigl
@@ -23,6 +23,7 @@
 
 #include "CNamedShape.h"
 #include "ListPNamedShape.h"
+#include "CTiglOnceFlag.h"
 
 namespace tigl
 {
@@ -51,8 +52,6 @@ public:
     TIGL_EXPORT const ListPNamedShape& Intersections();
 
 private:
-    PNamedShape FuseWithChilds(CTiglRelativelyPositionedComponent* parent, const std::vector<CTiglRelativelyPositionedComponent*>& children);
-    
     void Invalidate();
     void Perform();
 
@@ -61,7 +60,7 @@ private:
     PNamedShape          _farfield;       /**< contains the farfield if available >**/
     CCPACSConfiguration& _myconfig;       /**< Ref to CPACS config >**/
     TiglFuseResultMode    _mymode;
-    bool _hasPerformed;
+    CTiglOnceFlag        _performed;      /**< set, if the fusing is done >**/
 };
 
 } // namespace tigl
@@ -23,6 +23,8 @@
 #include "CCPACSWingSegment.h"
 #include "CCPACSFuselageSegment.h"
 #include "CCPACSExternalObject.h"
+#include "CTiglAbstractGeometricComponent.h"
+#include "CTiglProgress.h"
 
 #include <string>
 #include <cassert>
@@ -33,7 +35,10 @@ namespace tigl
 
 bool CTiglCADExporter::Write(const std::string &filename) const
 {
-    return WriteImpl(filename);
+    CTiglProgress progress("Writing " + filename, 1);
+    bool result = WriteImpl(filename);
+    progress.Step();
+    return result;
 }
 
 void CTiglCADExporter::AddShape(PNamedShape shape, ExportOptions options)
@@ -56,7 +61,7 @@ void CTiglCADExporter::AddConfiguration(CCPACSConfiguration& config, ExportOptio
             AddShape(loft, options);
 
             if (options.applySymmetries && segment.GetSymmetryAxis() != TIGL_NO_SYMMETRY) {
-                AddShape(segment.GetMirroredLoft(), options);
+                AddMirroredShape(segment, options);
             }
         }
     }
@@ -71,7 +76,7 @@ void CTiglCADExporter::AddConfiguration(CCPACSConfiguration& config, ExportOptio
             AddShape(loft, options);
 
             if (options.applySymmetries && segment.GetSymmetryAxis() != TIGL_NO_SYMMETRY) {
-                AddShape(segment.GetMirroredLoft(), options);
+                AddMirroredShape(segment, options);
             }
         }
     }
@@ -83,7 +88,7 @@ void CTiglCADExporter::AddConfiguration(CCPACSConfiguration& config, ExportOptio
         AddShape(loft, options);
 
         if (options.applySymmetries && obj.GetSymmetryAxis() != TIGL_NO_SYMMETRY) {
-            AddShape(obj.GetMirroredLoft(), options);
+            AddMirroredShape(obj, options);
         }
     }
 
@@ -142,4 +147,9 @@ ExportOptions CTiglCADExporter::GetOptions(size_t iShape) const
     return _options.at(iShape);
 }
 
+void CTiglCADExporter::AddMirroredShape(CTiglAbstractGeometricComponent& component, ExportOptions options)
+{
+    AddShape(component.GetMirroredLoft(), options);
+}
+
 } // namespace tigl
@@ -28,6 +28,7 @@ namespace tigl
 {
 
 class CCPACSConfiguration;
+class CTiglAbstractGeometricComponent;
 
 struct ExportOptions
 {
@@ -83,6 +84,11 @@ public:
 
     TIGL_EXPORT ExportOptions GetOptions(size_t iShape) const;
 
+protected:
+    /// Adds the mirrored loft of a component, whose loft was added before.
+    /// Exporters supporting instancing can override this to reference the mesh of the loft instead.
+    TIGL_EXPORT virtual void AddMirroredShape(CTiglAbstractGeometricComponent& component, ExportOptions options);
+
 private:
     /// must be overridden by the concrete implementation
     virtual bool WriteImpl(const std::string& filename) const = 0;
@@ -25,30 +25,85 @@ TODO:
 
 #include "CTiglExportCollada.h"
 
+#include "CCPACSStringVector.h"
 #include "CTiglPolyData.h"
 #include "CTiglTriangularizer.h"
+#include "CTiglAbstractGeometricComponent.h"
 #include "CCPACSConfiguration.h"
-
-#include <tixi.h>
+#include "CTiglXmlWriter.h"
+#include "CTiglError.h"
+#include "CTiglLogging.h"
+#include "CTiglProgress.h"
 
 #include <cstdio>
 #include <ctime>
 #include <string>
 #include <cassert>
+#include <vector>
 
 // OpenCASCADE
 #include <TopoDS_Shape.hxx>
 #include <BRepTools.hxx>
 
+#ifdef _MSC_VER
+    #define snprintf _snprintf
+#endif
+
 namespace 
 {
-    template <typename T>
-    std::string toStr ( T Number )
+    // size of the buffer used to format the mesh arrays
+    const size_t CHUNK_SIZE = 16384;
+
+    // Formats a space separated list of numbers into a buffer, which is
+    // written to the stream whenever it is full. The doubles are formatted
+    // like %g, but independent of the locale.
+    class ArrayFormatter
     {
-        std::ostringstream ss;
-        ss << Number;
-        return ss.str();
-    }
+    public:
+        explicit ArrayFormatter(std::ostream& out)
+            : m_out(out)
+            , m_used(0)
+            , m_first(true)
+        {
+        }
+
+        void Add(double value)
+        {
+            Reserve();
+            if (!m_first) {
+                m_buffer[m_used++] = ' ';
+            }
+            m_used += tigl::formatDouble(value, 6, m_buffer + m_used);
+            m_first = false;
+        }
+
+        void Add(unsigned long value)
+        {
+            Reserve();
+            m_used += snprintf(m_buffer + m_used, CHUNK_SIZE - m_used, m_first ? "%lu" : " %lu", value);
+            m_first = false;
+        }
+
+        void Flush()
+        {
+            m_out.write(m_buffer, static_cast<std::streamsize>(m_used));
+            m_used = 0;
+        }
+
+    private:
+        void Reserve()
+        {
+            // a formatted number has less than 32 characters
+            if (CHUNK_SIZE - m_used < 32) {
+                Flush();
+            }
+        }
+
+        std::ostream& m_out;
+        char m_buffer[CHUNK_SIZE];
+        size_t m_used;
+        bool m_first;
+    };
 }
 
 namespace tigl
@@ -58,15 +113,64 @@ CTiglExportCollada::CTiglExportCollada()
 {
 }
 
+void CTiglExportCollada::AddInstance(size_t iShape, const std::string& name, const CTiglTransformation& transformation)
+{
+    if (iShape >= NShapes()) {
+        throw CTiglError("Invalid shape index in CTiglExportCollada::AddInstance", TIGL_INDEX_ERROR);
+    }
+
+    Instance instance;
+    instance.shapeIndex = iShape;
+    instance.name = name;
+    instance.transformation = transformation;
+    _instances.push_back(instance);
+}
+
+size_t CTiglExportCollada::NInstances() const
+{
+    return _instances.size();
+}
+
+void CTiglExportCollada::AddMirroredShape(CTiglAbstractGeometricComponent& component, ExportOptions options)
+{
+    CTiglTransformation mirroring;
+    switch (component.GetSymmetryAxis()) {
+    case TIGL_X_Y_PLANE:
+        mirroring.AddMirroringAtXYPlane();
+        break;
+    case TIGL_X_Z_PLANE:
+        mirroring.AddMirroringAtXZPlane();
+        break;
+    case TIGL_Y_Z_PLANE:
+        mirroring.AddMirroringAtYZPlane();
+        break;
+    default:
+        CTiglCADExporter::AddMirroredShape(component, options);
+        return;
+    }
+
+    // the loft is usually the shape added last
+    PNamedShape loft = component.GetLoft();
+    for (size_t i = NShapes(); i > 0; --i) {
+        if (GetShape(i - 1) == loft) {
+            AddInstance(i - 1, std::string(loft->Name()) + "M", mirroring);
+            return;
+        }
+    }
+
+    // the loft itself is not exported, hence the mirrored loft has to be meshed
+    CTiglCADExporter::AddMirroredShape(component, options);
+}
 
-bool writeHeader(TixiDocumentHandle handle)
+void writeHeader(CTiglXmlWriter& writer)
 {
-    tixiAddTextAttribute(handle, "/COLLADA", "xmlns", "http://www.collada.org/2005/11/COLLADASchema");
-    tixiAddTextAttribute(handle, "/COLLADA", "version", "1.4.1");
+    writer.AddTextAttribute("xmlns", "http://www.collada.org/2005/11/COLLADASchema");
+    writer.AddTextAttribute("version", "1.4.1");
 
-    tixiCreateElement(handle, "/COLLADA", "asset");
+    writer.StartElement("asset");
 
-    tixiCreateElement(handle, "/COLLADA/asset", "contributor");
+    writer.StartElement("contributor");
+    writer.EndElement();
 
     time_t rawtime;
     struct tm * timeinfo;
@@ -74,246 +178,299 @@ bool writeHeader(TixiDocumentHandle handle)
     time (&rawtime);
     timeinfo = localtime (&rawtime);
     strftime (buffer,80,"%Y-%m-%dT%H:%S:%MZ",timeinfo);
-    tixiAddTextElement(handle, "/COLLADA/asset","created",  buffer);
-    tixiAddTextElement(handle, "/COLLADA/asset","modified", buffer); 
-    
-    tixiCreateElement(handle, "/COLLADA/asset", "unit");
-    tixiAddTextAttribute(handle, "/COLLADA/asset/unit", "name", "meters");
-    tixiAddDoubleAttribute(handle, "/COLLADA/asset/unit", "meter", 1.0, "%f");
-
-    tixiAddTextElement(handle, "/COLLADA/asset","up_axis", "Z_UP");
-    
-    return true;
-}
 
-bool writeMeshArray(TixiDocumentHandle handle, std::string meshPath, int sourceIndex, std::string id, std::string data, int dataCount)
-{
-    tixiCreateElement(handle, meshPath.c_str(), "source");
-    
-    std::string meshSourcePath = meshPath + "/source[" + toStr(sourceIndex) + "]";
-    tixiAddTextAttribute(handle, meshSourcePath.c_str(), "id", id.c_str());
-
-    // Write the data
-    tixiAddTextElement(handle, meshSourcePath.c_str(), "float_array", data.c_str());
-    tixiAddIntegerAttribute(handle, (meshSourcePath + "/float_array").c_str(), "count", dataCount*3, "%d"); // count(Pos)
-    
-    std::string arrayid = id + "-array";
-    tixiAddTextAttribute(handle, (meshSourcePath + "/float_array").c_str(), "id", arrayid.c_str());
-
-    tixiCreateElement(handle, meshSourcePath.c_str(), "technique_common");
-
-    std::string techniqueCommonPath = meshSourcePath + "/technique_common";
-    tixiCreateElement(handle, techniqueCommonPath.c_str(),"accessor");
-    
-    std::string accessorPath = techniqueCommonPath + "/accessor";
-    tixiAddIntegerAttribute(handle, accessorPath.c_str(),"count", dataCount,"%d"); // count Pos/stride
-    tixiAddTextAttribute(handle,accessorPath.c_str(),"offset","0");
-    
-    arrayid = "#" + arrayid;
-    tixiAddTextAttribute(handle, accessorPath.c_str(),"source", arrayid.c_str());
-    tixiAddTextAttribute(handle, accessorPath.c_str(),"stride","3");
-
-    tixiCreateElement(handle, accessorPath.c_str(), "param");
-    std::string paramPath = accessorPath + "/param[1]";
-    tixiAddTextAttribute(handle, paramPath.c_str(), "name", "X");
-    tixiAddTextAttribute(handle, paramPath.c_str(), "type", "float");
-
-    tixiCreateElement(handle, accessorPath.c_str(), "param");
-    paramPath = accessorPath + "/param[2]";
-    tixiAddTextAttribute(handle, paramPath.c_str(), "name", "Y");
-    tixiAddTextAttribute(handle, paramPath.c_str(), "type", "float");
-
-    tixiCreateElement(handle, accessorPath.c_str(), "param");
-    paramPath = accessorPath + "/param[3]";
-    tixiAddTextAttribute(handle, paramPath.c_str(), "name", "Z");
-    tixiAddTextAttribute(handle, paramPath.c_str(), "type", "float");
-    
-    return true;
+    writer.StartElement("created");
+    writer.WriteText(buffer);
+    writer.EndElement();
+
+    writer.StartElement("modified");
+    writer.WriteText(buffer);
+    writer.EndElement();
+
+    writer.StartElement("unit");
+    writer.AddTextAttribute("name", "meters");
+    writer.AddDoubleAttribute("meter", 1.0);
+    writer.EndElement();
+
+    writer.StartElement("up_axis");
+    writer.WriteText("Z_UP");
+    writer.EndElement();
+
+    writer.EndElement(); // asset
 }
 
-bool writeGeometryMesh(TixiDocumentHandle handle, CTiglPolyData& polyData, std::string col_id, int& geometryIndex)
+// writes the vertex coordinates or normals of all objects as source
+void writeMeshArray(CTiglXmlWriter& writer, CTiglPolyData& polyData, const std::string& id, bool normals)
 {
-    // create vertex, normal and triangle strings
-    std::stringstream stream_verts;
-    std::stringstream stream_normals;
-    std::stringstream stream_trians;
-    unsigned long count_pos =0, count_norm =0, count_vert =0; // count Points, Normals, Verticies for COLLADA-schema arrays
-
-    for (unsigned int i = 1; i <= polyData.getNObjects(); ++i) {
-        CTiglPolyObject& obj = polyData.switchObject(i);
+    const unsigned long nVertices = polyData.getTotalVertexCount();
 
-        unsigned long nvert = obj.getNVertices();
-        for (unsigned long jvert = 0; jvert < nvert; ++jvert) {
-            const CTiglPoint& v = obj.getVertexPoint(jvert);
-            const CTiglPoint& n = obj.getVertexNormal(jvert);
+    writer.StartElement("source");
+    writer.AddTextAttribute("id", id);
 
-            // VertexPoint
-            stream_verts <<  v.x << " " << v.y << " " << v.z << " ";
+    writer.StartElement("float_array");
+    writer.AddTextAttribute("id", id + "-array");
+    writer.AddIntegerAttribute("count", 3 * nVertices);
 
-            // VertexNormals
-            stream_normals <<  n.x << " " << n.y << " " << n.z << " ";
-            count_norm++;
-            count_pos++;
+    // Write the data directly from the mesh buffers
+    ArrayFormatter formatter(writer.ContentStream());
+    for (unsigned int i = 1; i <= polyData.getNObjects(); ++i) {
+        const CTiglPolyObject& obj = polyData.switchObject(i);
+        const double* values = normals ? obj.getVertexNormals() : obj.getVertexCoordinates();
+        const unsigned long nValues = values ? 3 * obj.getNVertices() : 0;
+        for (unsigned long j = 0; j < nValues; ++j) {
+            formatter.Add(values[j]);
         }
+    }
+    formatter.Flush();
+    writer.EndElement(); // float_array
+
+    writer.StartElement("technique_common");
+    writer.StartElement("accessor");
+    writer.AddIntegerAttribute("count", nVertices);
+    writer.AddTextAttribute("offset", "0");
+    writer.AddTextAttribute("source", "#" + id + "-array");
+    writer.AddTextAttribute("stride", "3");
+
+    const char* paramNames[] = {"X", "Y", "Z"};
+    for (int i = 0; i < 3; ++i) {
+        writer.StartElement("param");
+        writer.AddTextAttribute("name", paramNames[i]);
+        writer.AddTextAttribute("type", "float");
+        writer.EndElement();
+    }
 
-        unsigned long ntria = obj.getNPolygons();
+    writer.EndElement(); // accessor
+    writer.EndElement(); // technique_common
+    writer.EndElement(); // source
+}
 
-        for (unsigned long jtria = 0; jtria < ntria; ++jtria) {
-            unsigned long npoints = obj.getNPointsOfPolygon(jtria);
-            // skip all polygons that aren't triangles
-            if (npoints < 3) {
-                // we currently dont export lines
-                continue;
+unsigned long countTriangles(CTiglPolyData& polyData)
+{
+    unsigned long nTriangles = 0;
+    bool warned = false;
+    for (unsigned int i = 1; i <= polyData.getNObjects(); ++i) {
+        const CTiglPolyObject& obj = polyData.switchObject(i);
+        for (unsigned long jPoly = 0; jPoly < obj.getNPolygons(); ++jPoly) {
+            unsigned long npoints = obj.getNPointsOfPolygon(jPoly);
+            // we currently dont export lines
+            if (npoints == 3) {
+                nTriangles++;
             }
-            else if (npoints > 3) {
+            else if (npoints > 3 && !warned) {
                 LOG(WARNING) << "Polygons with more than 3 vertices are currently not supported by CTiglExportCollada!" << endl;
-                continue;
+                warned = true;
             }
+        }
+    }
+    return nTriangles;
+}
+
+// Writes the mesh of all objects. The vertices and normals are written only for
+// the geometry source_id, other geometries reference the arrays of this geometry.
+// With reverseWinding, the triangles are written with the opposite orientation,
+// as required by the instances with a mirroring transformation.
+void writeGeometryMesh(CTiglXmlWriter& writer, CTiglPolyData& polyData, const std::string& col_id,
+                       const std::string& source_id, bool reverseWinding)
+{
+    writer.StartElement("geometry");
+    writer.AddTextAttribute("id", col_id);
+    writer.AddTextAttribute("name", col_id);
 
-            for (unsigned long kpoint = 0; kpoint < npoints; ++kpoint) {
-                // get vertex index of polygon
-                unsigned long vindex = obj.getVertexIndexOfPolygon(kpoint, jtria);
+    writer.StartElement("mesh");
 
-                // write vertex index into list of vertices and normals
-                stream_trians << vindex << " " << vindex << " ";
+    // write vertices and normals
+    if (col_id == source_id) {
+        writeMeshArray(writer, polyData, source_id + "-mesh-positions", false);
+        writeMeshArray(writer, polyData, source_id + "-mesh-normals", true);
+    }
+
+    writer.StartElement("vertices");
+    writer.AddTextAttribute("id", col_id + "-mesh-vertices");
+    writer.StartElement("input");
+    writer.AddTextAttribute("semantic", "POSITION");
+    writer.AddTextAttribute("source", "#" + source_id + "-mesh-positions");
+    writer.EndElement();
+    writer.EndElement(); // vertices
+
+    writer.StartElement("triangles");
+    writer.AddIntegerAttribute("count", countTriangles(polyData));
+    writer.AddTextAttribute("material", "WHITE");
+
+    writer.StartElement("input");
+    writer.AddTextAttribute("offset", "0");
+    writer.AddTextAttribute("semantic", "VERTEX");
+    writer.AddTextAttribute("source", "#" + col_id + "-mesh-vertices");
+    writer.EndElement();
+
+    writer.StartElement("input");
+    writer.AddTextAttribute("offset", "1");
+    writer.AddTextAttribute("semantic", "NORMAL");
+    writer.AddTextAttribute("source", "#" + source_id + "-mesh-normals");
+    writer.EndElement();
+
+    // Insert vertex data. The vertices of all objects are stored in one array,
+    // hence the indices of each object are shifted by the number of preceding vertices.
+    writer.StartElement("p");
+    ArrayFormatter formatter(writer.ContentStream());
+    unsigned long vertexOffset = 0;
+    for (unsigned int i = 1; i <= polyData.getNObjects(); ++i) {
+        const CTiglPolyObject& obj = polyData.switchObject(i);
+        const unsigned int* connectivity = obj.getConnectivity();
+        const unsigned int* offsets = obj.getPolygonOffsets();
+
+        unsigned long begin = 0;
+        for (unsigned long jPoly = 0; jPoly < obj.getNPolygons(); ++jPoly) {
+            const unsigned long end = offsets[jPoly];
+            if (end - begin == 3) {
+                const unsigned long order[2][3] = {{0, 1, 2}, {0, 2, 1}};
+                for (int k = 0; k < 3; ++k) {
+                    // write vertex index into list of vertices and normals
+                    const unsigned long vindex = vertexOffset + connectivity[begin + order[reverseWinding ? 1 : 0][k]];
+                    formatter.Add(vindex);
+                    formatter.Add(vindex);
+                }
             }
-            count_vert++;
+            begin = end;
         }
-    } //end for objects
-    
-    if (tixiCreateElement(handle,"/COLLADA/library_geometries", "geometry") != SUCCESS) {
-       return false;
+        vertexOffset += obj.getNVertices();
     }
-    
-    std::string geometryPath  = "/COLLADA/library_geometries/geometry[" +  toStr(geometryIndex) + "]";
-    
-    tixiAddTextAttribute(handle, geometryPath.c_str(), "id", col_id.c_str());
-    tixiAddTextAttribute(handle, geometryPath.c_str(), "name", col_id.c_str());
-
-    tixiCreateElement(handle, geometryPath.c_str(), "mesh");
-    std::string meshPath = geometryPath  + "/mesh";
+    formatter.Flush();
+    writer.EndElement(); // p
 
-    // write vertices and normals
-    writeMeshArray(handle, meshPath, 1, col_id + "-mesh-positions", stream_verts.str(), count_pos);
-    writeMeshArray(handle, meshPath, 2, col_id + "-mesh-normals", stream_normals.str(), count_norm);
-    
-    tixiCreateElement(handle, meshPath.c_str(), "vertices");
-    std::string vertsPath = meshPath + "/vertices";
-    std::string id = col_id + "-mesh-vertices";
-    tixiAddTextAttribute(handle, vertsPath.c_str(), "id", id.c_str());
-
-    tixiCreateElement(handle, vertsPath.c_str(),"input");
-    std::string inputPath = vertsPath + "/input";
-    tixiAddTextAttribute(handle, inputPath.c_str(),"semantic","POSITION");
-    id = "#" + col_id + "-mesh-positions";
-    tixiAddTextAttribute(handle, inputPath.c_str(),"source", id.c_str());
-
-    tixiCreateElement(handle, meshPath.c_str(), "triangles");
-    std::string trianPath = meshPath + "/triangles";
-    tixiAddIntegerAttribute(handle, trianPath.c_str(), "count", count_vert, "%d");
-    tixiAddTextAttribute(handle, trianPath.c_str(), "material", "WHITE");
-
-    tixiCreateElement(handle, trianPath.c_str(),"input");
-    inputPath = trianPath + "/input";
-    tixiAddTextAttribute(handle, inputPath.c_str(),"offset","0");
-    tixiAddTextAttribute(handle, inputPath.c_str(),"semantic","VERTEX");
-    id = "#" + col_id + "-mesh-vertices";
-    tixiAddTextAttribute(handle, inputPath.c_str(),"source", id.c_str());
-
-    tixiCreateElement(handle, trianPath.c_str(),"input");
-    inputPath = trianPath + "/input[2]";
-    tixiAddTextAttribute(handle, inputPath.c_str(),"offset","1");
-    tixiAddTextAttribute(handle, inputPath.c_str(),"semantic","NORMAL");
-    id = "#" + col_id + "-mesh-normals";
-    tixiAddTextAttribute(handle, inputPath.c_str(),"source", id.c_str());
-
-    /* ------ */
-    // Insert vertex data
-    tixiAddTextElement(handle, trianPath.c_str(), "p", stream_trians.str().c_str());
-    
-    geometryIndex++;
-    return true;
+    writer.EndElement(); // triangles
+    writer.EndElement(); // mesh
+    writer.EndElement(); // geometry
 }
 
-bool writeSceneNode(TixiDocumentHandle handle, std::string scenePath, std::string nodeName, std::string meshID, int& nodeIndex)
+void writeSceneNode(CTiglXmlWriter& writer, const std::string& nodeName, const std::string& meshID, const CTiglTransformation* transformation)
 {
-    tixiCreateElement(handle, scenePath.c_str(), "node");
-    
-    std::string nodePath = scenePath + "/node[" + toStr(nodeIndex) + "]";
-    nodeIndex++;
-    tixiAddTextAttribute(handle, nodePath.c_str(), "id",   nodeName.c_str());
-    tixiAddTextAttribute(handle, nodePath.c_str(), "name", nodeName.c_str());
-
-    tixiAddTextElement(handle, nodePath.c_str(), "translate", "0 0 0");
-    tixiAddTextElement(handle, nodePath.c_str(), "rotate", "0 0 1 0");
-    tixiAddTextElement(handle, nodePath.c_str(), "rotate", "0 1 0 0");
-    tixiAddTextElement(handle, nodePath.c_str(), "rotate", "1 0 0 0");
-    tixiAddTextElement(handle, nodePath.c_str(), "scale", "1 1 1");
-
-    tixiCreateElement(handle, nodePath.c_str(), "instance_geometry");
-    std::string instGeomPath = nodePath + "/instance_geometry";
-    std::string url = "#" + meshID;
-    tixiAddTextAttribute(handle, instGeomPath.c_str(), "url", url.c_str());
-
-    tixiCreateElement(handle, instGeomPath.c_str(), "bind_material");
-    std::string bindMatPath = instGeomPath + "/bind_material";
-
-    tixiCreateElement(handle, bindMatPath.c_str(), "technique_common");
-    std::string techCommPath = bindMatPath + "/technique_common";
-
-    tixiCreateElement(handle, techCommPath.c_str(), "instance_material");
-    std::string instMatPath = techCommPath + "/instance_material";
-    
-    tixiAddTextAttribute(handle, instMatPath.c_str(),"symbol", "WHITE");
-    tixiAddTextAttribute(handle, instMatPath.c_str(),"target", "#whiteMaterial");
-    
-    return true;
+    writer.StartElement("node");
+    writer.AddTextAttribute("id",   nodeName);
+    writer.AddTextAttribute("name", nodeName);
+
+    if (transformation) {
+        // collada matrices are written row by row
+        writer.StartElement("matrix");
+        ArrayFormatter formatter(writer.ContentStream());
+        for (int row = 0; row < 4; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                formatter.Add(transformation->GetValue(row, col));
+            }
+        }
+        formatter.Flush();
+        writer.EndElement();
+    }
+    else {
+        const char* elements[] = {"translate", "rotate", "rotate", "rotate", "scale"};
+        const char* values[] = {"0 0 0", "0 0 1 0", "0 1 0 0", "1 0 0 0", "1 1 1"};
+        for (int i = 0; i < 5; ++i) {
+            writer.StartElement(elements[i]);
+            writer.WriteText(values[i]);
+            writer.EndElement();
+        }
+    }
+
+    writer.StartElement("instance_geometry");
+    writer.AddTextAttribute("url", "#" + meshID);
+
+    writer.StartElement("bind_material");
+    writer.StartElement("technique_common");
+    writer.StartElement("instance_material");
+    writer.AddTextAttribute("symbol", "WHITE");
+    writer.AddTextAttribute("target", "#whiteMaterial");
+    writer.EndElement(); // instance_material
+    writer.EndElement(); // technique_common
+    writer.EndElement(); // bind_material
+
+    writer.EndElement(); // instance_geometry
+    writer.EndElement(); // node
 }
 
 
-bool CTiglExportCollada::WriteImpl(const std::string& filename) const
+bool isMirroring(const CTiglTransformation& transformation)
 {
-    TixiDocumentHandle handle = -1;  
-    if (tixiCreateDocument("COLLADA", &handle) != SUCCESS) {
-        return false;
-    }
-    
-    writeHeader(handle);
-
-    // Body
-    tixiCreateElement(handle,"/COLLADA","library_geometries");
-
-    // write object mesh info
-    int geomIndex = 1;
-    for (unsigned int i = 0; i < NShapes(); ++i) {
-        // Do the meshing
-        PNamedShape pshape = GetShape(i);
-        double deflection = GetOptions(i).deflection;
-        CTiglTriangularizer polyData(pshape->Shape(), deflection);
-        
-        writeGeometryMesh(handle, polyData, std::string(pshape->Name()) + "-geom", geomIndex);
+    double det = 0.;
+    for (int col = 0; col < 3; ++col) {
+        det += transformation.GetValue(0, col)
+             * (transformation.GetValue(1, (col + 1) % 3) * transformation.GetValue(2, (col + 2) % 3)
+              - transformation.GetValue(1, (col + 2) % 3) * transformation.GetValue(2, (col + 1) % 3));
     }
-    
-    // write the scene and link object to geometry
-    tixiCreateElement(handle, "/COLLADA", "library_visual_scenes");
-    tixiCreateElement(handle, "/COLLADA/library_visual_scenes", "visual_scene");
-    tixiAddTextAttribute(handle, "/COLLADA/library_visual_scenes/visual_scene", "id", "DefaultScene");
-
-    // add each object to the scene
-    int nodeIndex = 1;
-    for (unsigned int i = 0; i < NShapes(); ++i) {
-        PNamedShape pshape = GetShape(i);
-        // Todo: insert transformation matrix also
-        writeSceneNode(handle, "/COLLADA/library_visual_scenes/visual_scene", pshape->Name(), std::string(pshape->Name()) + "-geom", nodeIndex);
+    return det < 0.;
+}
+
+bool CTiglExportCollada::WriteImpl(const std::string& filename) const
+{
+    // a mirroring transformation turns the triangles inside out, hence
+    // these instances reference a mesh with reversed triangle orientation
+    std::vector<bool> hasMirroredInstance(NShapes(), false);
+    for (std::vector<Instance>::const_iterator it = _instances.begin(); it != _instances.end(); ++it) {
+        if (isMirroring(it->transformation)) {
+            hasMirroredInstance[it->shapeIndex] = true;
+        }
     }
 
-    // Write Default scene entry
-    tixiCreateElement(handle, "/COLLADA", "scene");
-    tixiCreateElement(handle, "/COLLADA/scene", "instance_visual_scene");
-    tixiAddTextAttribute(handle, "/COLLADA/scene/instance_visual_scene", "url", "#DefaultScene");
+    try {
+        CTiglXmlWriter writer(filename);
+        writer.StartElement("COLLADA");
+
+        writeHeader(writer);
+
+        // Body
+        writer.StartElement("library_geometries");
+
+        // write object mesh info, each mesh is streamed into the file before the next shape is meshed
+        CTiglProgress progress("Writing COLLADA file", NShapes());
+        for (unsigned int i = 0; i < NShapes(); ++i) {
+            // Do the meshing
+            PNamedShape pshape = GetShape(i);
+            double deflection = GetOptions(i).deflection;
+            CTiglTriangularizer polyData(pshape->Shape(), deflection);
+
+            const std::string meshID = std::string(pshape->Name()) + "-geom";
+            writeGeometryMesh(writer, polyData, meshID, meshID, false);
+            if (hasMirroredInstance[i]) {
+                writeGeometryMesh(writer, polyData, meshID + "-mirrored", meshID, true);
+            }
+            progress.Step();
+        }
+        writer.EndElement(); // library_geometries
+
+        // write the scene and link object to geometry
+        writer.StartElement("library_visual_scenes");
+        writer.StartElement("visual_scene");
+        writer.AddTextAttribute("id", "DefaultScene");
 
-    if (tixiSaveDocument(handle, filename.c_str()) != SUCCESS) {
-        LOG(ERROR) << "Cannot save collada file " << filename;
+        // add each object to the scene
+        for (unsigned int i = 0; i < NShapes(); ++i) {
+            PNamedShape pshape = GetShape(i);
+            writeSceneNode(writer, pshape->Name(), std::string(pshape->Name()) + "-geom", NULL);
+        }
+
+        // instances reference the mesh of their shape
+        for (std::vector<Instance>::const_iterator it = _instances.begin(); it != _instances.end(); ++it) {
+            PNamedShape pshape = GetShape(it->shapeIndex);
+            std::string meshID = std::string(pshape->Name()) + (isMirroring(it->transformation) ? "-geom-mirrored" : "-geom");
+            writeSceneNode(writer, it->name, meshID, &it->transformation);
+        }
+
+        writer.EndElement(); // visual_scene
+        writer.EndElement(); // library_visual_scenes
+
+        // Write Default scene entry
+        writer.StartElement("scene");
+        writer.StartElement("instance_visual_scene");
+        writer.AddTextAttribute("url", "#DefaultScene");
+        writer.EndElement();
+        writer.EndElement();
+
+        writer.Close();
+    }
+    catch (CTiglError& err) {
+        // canceled operations are reported to the caller of the api function
+        if (err.getCode() == TIGL_CANCELED) {
+            throw;
+        }
+        LOG(ERROR) << "Cannot save collada file " << filename << ": " << err.what();
         return false;
     }
 
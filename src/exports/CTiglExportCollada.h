@@ -24,8 +24,10 @@
 #include "PNamedShape.h"
 #include "ListPNamedShape.h"
 #include "CTiglCADExporter.h"
+#include "CTiglTransformation.h"
 
 #include <string>
+#include <vector>
 
 
 namespace tigl 
@@ -36,11 +38,28 @@ class CTiglExportCollada : public CTiglCADExporter
 public:
     TIGL_EXPORT CTiglExportCollada();
 
+    /// Adds a scene node, that references the mesh of the shape iShape with a transformation.
+    /// The mesh is written only once, no matter how many instances use it.
+    TIGL_EXPORT void AddInstance(size_t iShape, const std::string& name, const CTiglTransformation& transformation);
+
+    /// Number of instances added with AddInstance
+    TIGL_EXPORT size_t NInstances() const;
+
+protected:
+    /// Adds the mirrored component as instance of its loft instead of meshing the mirrored loft
+    TIGL_EXPORT void AddMirroredShape(CTiglAbstractGeometricComponent& component, ExportOptions options) OVERRIDE;
+
 private:
     bool WriteImpl(const std::string& filename) const OVERRIDE;
 
-    /// Exports a polygon object to a collada file, the true export code
-    TiglReturnCode writeToDisc(class CTiglPolyData &polyData, const char * id, const char * filename);
+    struct Instance
+    {
+        size_t shapeIndex;
+        std::string name;
+        CTiglTransformation transformation;
+    };
+
+    std::vector<Instance> _instances;
 };
 
 
@@ -32,6 +32,7 @@
 #include "CNamedShape.h"
 #include "tiglcommonfunctions.h"
 #include "CTiglFusePlane.h"
+#include "CTiglProgress.h"
 
 #include "TopoDS_Shape.hxx"
 #include "TopoDS_Edge.hxx"
@@ -286,6 +287,7 @@ bool CTiglExportIges::WriteImpl(const std::string& filename) const
         }
     }
 
+    // one step per shape to be translated and one for writing
     ListPNamedShape list;
     for (it = shapeScaled.begin(); it != shapeScaled.end(); ++it) {
         ListPNamedShape templist = GroupFaces(*it, _groupMode);
@@ -299,15 +301,19 @@ bool CTiglExportIges::WriteImpl(const std::string& filename) const
     IGESControl_Writer igesWriter("MM", 1);
     igesWriter.Model()->ApplyStatic();
 
+    CTiglProgress progress("Writing IGES file", list.size() + 1);
     int level = 0;
     for (it = list.begin(); it != list.end(); ++it) {
         PNamedShape pshape = *it;
         AddToIges(pshape, igesWriter, level++);
+        progress.Step();
     }
 
     igesWriter.ComputeModel();
 
-    return toBool(igesWriter.Write(const_cast<char*>(filename.c_str())));
+    bool result = toBool(igesWriter.Write(const_cast<char*>(filename.c_str())));
+    progress.Step();
+    return result;
 }
 
 void CTiglExportIges::SetGroupMode(ShapeGroupMode mode)
@@ -30,6 +30,7 @@
 #include "CCPACSWingSegment.h"
 #include "CTiglFusePlane.h"
 #include "tiglcommonfunctions.h"
+#include "CTiglProgress.h"
 
 #include "TopoDS_Shape.hxx"
 #include "STEPControl_Controller.hxx"
@@ -311,12 +312,17 @@ bool CTiglExportStep::WriteImpl(const std::string& filename) const
 
     STEPControl_Writer stepWriter;
 
+    // one step per shape to be translated and one for writing
+    CTiglProgress progress("Writing STEP file", list.size() + 1);
     for (ListPNamedShape::iterator it = list.begin(); it != list.end(); ++it) {
         PNamedShape pshape = *it;
         AddToStep(pshape, stepWriter);
+        progress.Step();
     }
 
-    return stepWriter.Write(const_cast<char*>(filename.c_str())) <= IFSelect_RetDone;
+    bool result = stepWriter.Write(const_cast<char*>(filename.c_str())) <= IFSelect_RetDone;
+    progress.Step();
+    return result;
 }
 
 void CTiglExportStep::SetGroupMode(ShapeGroupMode mode)
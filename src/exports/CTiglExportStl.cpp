@@ -25,66 +25,438 @@
 
 #include "CTiglExportStl.h"
 #include "CCPACSConfiguration.h"
+#include "CNamedShape.h"
+#include "CTiglError.h"
+#include "CTiglLogging.h"
+#include "CTiglProgress.h"
+#include "tiglparallel.h"
 
-#include "TopoDS_Shape.hxx"
-#include "Standard_CString.hxx"
-#include "ShapeFix_Shape.hxx"
-#include "BRep_Builder.hxx"
-#include "BRepTools.hxx"
-#include "BRepMesh_IncrementalMesh.hxx"
-#include "StlAPI_Writer.hxx"
-#include "Interface_Static.hxx"
-#include "StlAPI.hxx"
-#include "CTiglFusePlane.h"
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Poly_Array1OfTriangle.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_Version.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Vec.hxx>
 
-#include <cassert>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#ifdef _MSC_VER
+    #define snprintf _snprintf
+#endif
+
+namespace
+{
+    // size of the output buffers, a multiple of the binary triangle size (50 bytes)
+    const size_t BUFFER_SIZE = 50 * 1024;
+
+    void meshShape(const TopoDS_Shape& shape, double deflection, bool inParallel)
+    {
+#if OCC_VERSION_HEX >= 0x060800
+        BRepMesh_IncrementalMesh(shape, deflection, Standard_False, 0.5, inParallel ? Standard_True : Standard_False);
+#else
+        (void)inParallel;
+        BRepMesh_IncrementalMesh(shape, deflection);
+#endif
+    }
+
+    // Groups the shapes, such that shapes sharing an edge (e.g. the fused plane and the
+    // trimmed far field) are in the same group. The groups are in the order of their first shape.
+    std::vector<std::vector<size_t> > GroupShapesWithSharedEdges(const std::vector<TopoDS_Shape>& shapes)
+    {
+        // union find over the shape indices
+        std::vector<size_t> parent(shapes.size());
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            parent[i] = i;
+        }
+
+        TopTools_DataMapOfShapeInteger edgeOwners;
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            for (TopExp_Explorer exp(shapes[i], TopAbs_EDGE); exp.More(); exp.Next()) {
+                const TopoDS_Shape& edge = exp.Current();
+                if (!edgeOwners.IsBound(edge)) {
+                    edgeOwners.Bind(edge, static_cast<Standard_Integer>(i));
+                    continue;
+                }
+
+                size_t root1 = i;
+                while (parent[root1] != root1) {
+                    root1 = parent[root1];
+                }
+                size_t root2 = static_cast<size_t>(edgeOwners.Find(edge));
+                while (parent[root2] != root2) {
+                    root2 = parent[root2];
+                }
+                parent[std::max(root1, root2)] = std::min(root1, root2);
+            }
+        }
+
+        std::vector<std::vector<size_t> > groups;
+        std::vector<size_t> groupOfRoot(shapes.size(), shapes.size());
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            size_t root = i;
+            while (parent[root] != root) {
+                root = parent[root];
+            }
+            if (groupOfRoot[root] == shapes.size()) {
+                groupOfRoot[root] = groups.size();
+                groups.push_back(std::vector<size_t>());
+            }
+            groups[groupOfRoot[root]].push_back(i);
+        }
+        return groups;
+    }
+
+    class ShapeMesher
+    {
+    public:
+        ShapeMesher(const std::vector<TopoDS_Shape>& shapes, const std::vector<double>& deflections,
+                    const std::vector<std::vector<size_t> >& groups, tigl::CTiglProgress& progress)
+            : m_shapes(shapes)
+            , m_deflections(deflections)
+            , m_groups(groups)
+            , m_progress(progress)
+        {
+        }
+
+        void operator()(size_t iGroup)
+        {
+            // The shapes of a group share edges. They are meshed one after another, such that
+            // all of them use the same discretization of the shared edges and the meshes conform.
+            const std::vector<size_t>& group = m_groups[iGroup];
+
+            // use occt's parallel meshing, if there are less groups than threads
+            bool meshInParallel = m_groups.size() < tigl::GetNumberOfThreads();
+            for (size_t i = 0; i < group.size(); ++i) {
+                meshShape(m_shapes[group[i]], m_deflections[group[i]], meshInParallel);
+                m_progress.Step();
+            }
+        }
+
+    private:
+        const std::vector<TopoDS_Shape>& m_shapes;
+        const std::vector<double>& m_deflections;
+        const std::vector<std::vector<size_t> >& m_groups;
+        tigl::CTiglProgress& m_progress;
+    };
+
+    size_t CountTriangles(const TopoDS_Shape& shape)
+    {
+        size_t nTriangles = 0;
+        for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
+            TopLoc_Location location;
+            const Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(TopoDS::Face(exp.Current()), location);
+            if (!triangulation.IsNull()) {
+                nTriangles += triangulation->NbTriangles();
+            }
+        }
+        return nTriangles;
+    }
+
+    // Passes all triangles of the shape's triangulation to writer.WriteTriangle.
+    // The triangles are oriented according to the face orientation.
+    template <class Writer>
+    void WriteTriangles(const TopoDS_Shape& shape, Writer& writer)
+    {
+        for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
+            const TopoDS_Face& face = TopoDS::Face(exp.Current());
+            TopLoc_Location location;
+            const Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+            if (triangulation.IsNull()) {
+                continue;
+            }
+
+            const gp_Trsf& transformation = location.Transformation();
+            const TColgp_Array1OfPnt& nodes = triangulation->Nodes();
+            const Poly_Array1OfTriangle& triangles = triangulation->Triangles();
+            const bool reversed = face.Orientation() == TopAbs_REVERSED;
+
+            for (int j = triangles.Lower(); j <= triangles.Upper(); ++j) {
+                int index1, index2, index3;
+                triangles(j).Get(index1, index2, index3);
+                if (reversed) {
+                    std::swap(index2, index3);
+                }
+
+                const gp_Pnt p1 = nodes(index1).Transformed(transformation);
+                const gp_Pnt p2 = nodes(index2).Transformed(transformation);
+                const gp_Pnt p3 = nodes(index3).Transformed(transformation);
+
+                gp_Vec normal = gp_Vec(p1, p2).Crossed(gp_Vec(p1, p3));
+                if (normal.SquareMagnitude() > 0.) {
+                    normal.Normalize();
+                }
+
+                writer.WriteTriangle(p1, p2, p3, normal);
+            }
+        }
+    }
+
+    // Writes binary STL data. The byte order is always little endian.
+    class BinaryStlWriter
+    {
+    public:
+        explicit BinaryStlWriter(std::ostream& out)
+            : m_out(out)
+            , m_used(0)
+        {
+        }
+
+        void WriteHeader(unsigned int nTriangles)
+        {
+            char header[80];
+            std::memset(header, ' ', sizeof(header));
+            const char* text = "binary STL file created by TiGL";
+            std::memcpy(header, text, std::strlen(text));
+            m_out.write(header, sizeof(header));
+
+            PutUInt32(nTriangles);
+            Flush();
+        }
+
+        void WriteTriangle(const gp_Pnt& p1, const gp_Pnt& p2, const gp_Pnt& p3, const gp_Vec& normal)
+        {
+            if (m_used + 50 > BUFFER_SIZE) {
+                Flush();
+            }
+            PutFloat(normal.X()); PutFloat(normal.Y()); PutFloat(normal.Z());
+            PutFloat(p1.X()); PutFloat(p1.Y()); PutFloat(p1.Z());
+            PutFloat(p2.X()); PutFloat(p2.Y()); PutFloat(p2.Z());
+            PutFloat(p3.X()); PutFloat(p3.Y()); PutFloat(p3.Z());
+            // attribute byte count
+            m_buffer[m_used++] = 0;
+            m_buffer[m_used++] = 0;
+        }
+
+        void Flush()
+        {
+            m_out.write(m_buffer, static_cast<std::streamsize>(m_used));
+            m_used = 0;
+        }
+
+    private:
+        void PutUInt32(unsigned int value)
+        {
+            for (int i = 0; i < 4; ++i) {
+                m_buffer[m_used++] = static_cast<char>((value >> (8 * i)) & 0xff);
+            }
+        }
+
+        void PutFloat(double value)
+        {
+            const float f = static_cast<float>(value);
+            unsigned int bits = 0;
+            std::memcpy(&bits, &f, sizeof(f));
+            PutUInt32(bits);
+        }
+
+        std::ostream& m_out;
+        char m_buffer[BUFFER_SIZE];
+        size_t m_used;
+    };
+
+    // Writes ASCII STL data with one solid per shape
+    class AsciiStlWriter
+    {
+    public:
+        explicit AsciiStlWriter(std::ostream& out)
+            : m_out(out)
+            , m_used(0)
+            , m_nTriangles(0)
+        {
+        }
+
+        void BeginSolid(const std::string& name)
+        {
+            m_out << "solid " << name << "\n";
+        }
+
+        void EndSolid(const std::string& name)
+        {
+            Flush();
+            m_out << "endsolid " << name << "\n";
+        }
+
+        void WriteTriangle(const gp_Pnt& p1, const gp_Pnt& p2, const gp_Pnt& p3, const gp_Vec& normal)
+        {
+            // a facet has less than 400 characters
+            if (m_used + 400 > BUFFER_SIZE) {
+                Flush();
+            }
+            m_used += snprintf(m_buffer + m_used, BUFFER_SIZE - m_used,
+                               "  facet normal %.10g %.10g %.10g\n"
+                               "    outer loop\n"
+                               "      vertex %.10g %.10g %.10g\n"
+                               "      vertex %.10g %.10g %.10g\n"
+                               "      vertex %.10g %.10g %.10g\n"
+                               "    endloop\n"
+                               "  endfacet\n",
+                               normal.X(), normal.Y(), normal.Z(),
+                               p1.X(), p1.Y(), p1.Z(),
+                               p2.X(), p2.Y(), p2.Z(),
+                               p3.X(), p3.Y(), p3.Z());
+            m_nTriangles++;
+        }
+
+        size_t GetTriangleCount() const
+        {
+            return m_nTriangles;
+        }
+
+    private:
+        void Flush()
+        {
+            m_out.write(m_buffer, static_cast<std::streamsize>(m_used));
+            m_used = 0;
+        }
+
+        std::ostream& m_out;
+        char m_buffer[BUFFER_SIZE];
+        size_t m_used;
+        size_t m_nTriangles;
+    };
+
+    // returns the shape name without whitespace, which would end the solid name
+    std::string SolidName(const tigl::CNamedShape& shape, size_t iShape)
+    {
+        std::string name = shape.Name() ? shape.Name() : "";
+        for (std::string::iterator it = name.begin(); it != name.end(); ++it) {
+            if (isspace(static_cast<unsigned char>(*it))) {
+                *it = '_';
+            }
+        }
+        if (name.empty()) {
+            std::stringstream stream;
+            stream << "shape" << iShape + 1;
+            name = stream.str();
+        }
+        return name;
+    }
+
+    std::string to_lower(const std::string& str)
+    {
+        std::string result = str;
+        std::transform(result.begin(), result.end(), result.begin(), ::tolower);
+
+        return result;
+    }
+}
 
 namespace tigl 
 {
 
+bool CTiglExportStl::binaryEnabled = false;
+
 // Constructor
 CTiglExportStl::CTiglExportStl()
+    : _nTriangles(0)
 {
 }
 
+size_t CTiglExportStl::GetTriangleCount() const
+{
+    return _nTriangles;
+}
+
+void CTiglExportStl::SetOptions(const std::string& key, const std::string& value)
+{
+    if (key == "format") {
+        if (to_lower(value) == "ascii") {
+            CTiglExportStl::binaryEnabled = false;
+        }
+        else if (to_lower(value) == "binary") {
+            CTiglExportStl::binaryEnabled = true;
+        }
+        else {
+            throw CTiglError("Wrong value for 'format' in stl export: " + value);
+        }
+    }
+    else {
+        throw CTiglError("Invalid key in stl export: " + key);
+    }
+}
 
 bool CTiglExportStl::WriteImpl(const std::string& filename) const
 {
+    _nTriangles = 0;
+
+    std::vector<TopoDS_Shape> shapes;
+    std::vector<double> deflections;
+    std::vector<std::string> names;
     for (size_t ishape = 0; ishape < NShapes(); ++ishape) {
         PNamedShape shape = GetShape(ishape);
         if (shape) {
-            BRepMesh_IncrementalMesh(shape->Shape(), GetOptions(ishape).deflection);
+            shapes.push_back(shape->Shape());
+            deflections.push_back(GetOptions(ishape).deflection);
+            names.push_back(SolidName(*shape, ishape));
         }
     }
 
-    if (NShapes() > 1) {
-        TopoDS_Compound c;
-        BRep_Builder b;
-        b.MakeCompound(c);
-        
-        for (size_t ishape = 0; ishape < NShapes(); ++ishape) {
-            PNamedShape shape = GetShape(ishape);
-            if (shape) {
-                b.Add(c, shape->Shape());
-            }
-        }
-        
-        // write the file
-        StlAPI_Writer StlWriter;
-        StlWriter.Write(c, const_cast<char*>(filename.c_str()));
-        
-        return true;
+    if (shapes.empty()) {
+        return false;
+    }
+
+    // one step per shape to be meshed and one for writing
+    CTiglProgress progress("Writing STL file", shapes.size() + 1);
+    std::vector<std::vector<size_t> > groups = GroupShapesWithSharedEdges(shapes);
+    ShapeMesher mesher(shapes, deflections, groups, progress);
+    ParallelFor(groups.size(), mesher);
+
+    // the triangles are streamed directly from the face triangulations
+    std::ofstream file(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw CTiglError("Cannot open file " + filename + " for writing.", TIGL_OPEN_FAILED);
     }
-    else if (NShapes() == 1) {
-        PNamedShape shape = GetShape(0);
-        StlAPI_Writer StlWriter;
-        StlWriter.Write(shape->Shape(), const_cast<char*>(filename.c_str()));
-        
-        return true;
+
+    size_t nTriangles = 0;
+    if (binaryEnabled) {
+        for (size_t ishape = 0; ishape < shapes.size(); ++ishape) {
+            nTriangles += CountTriangles(shapes[ishape]);
+        }
+        if (nTriangles > 0xffffffffUL) {
+            throw CTiglError("Too many triangles for a binary STL file.");
+        }
+
+        BinaryStlWriter writer(file);
+        writer.WriteHeader(static_cast<unsigned int>(nTriangles));
+        for (size_t ishape = 0; ishape < shapes.size(); ++ishape) {
+            WriteTriangles(shapes[ishape], writer);
+        }
+        writer.Flush();
     }
     else {
-        return false;
+        AsciiStlWriter writer(file);
+        for (size_t ishape = 0; ishape < shapes.size(); ++ishape) {
+            writer.BeginSolid(names[ishape]);
+            WriteTriangles(shapes[ishape], writer);
+            writer.EndSolid(names[ishape]);
+        }
+        nTriangles = writer.GetTriangleCount();
+    }
+
+    file.close();
+    if (file.fail()) {
+        throw CTiglError("Error writing file " + filename + ".", TIGL_WRITE_FAILED);
     }
+    progress.Step();
+
+    _nTriangles = nTriangles;
+    LOG(INFO) << "STL Export succeeded with " << nTriangles << " triangles." << std::endl;
+
+    return true;
 }
 
 } // end namespace tigl
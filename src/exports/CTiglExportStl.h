@@ -29,6 +29,8 @@
 #include "tigl_internal.h"
 #include "CTiglCADExporter.h"
 
+#include <string>
+
 
 
 
@@ -42,10 +44,20 @@ public:
     // Constructor
     TIGL_EXPORT CTiglExportStl();
 
+    // Returns the number of triangles written by the last call of Write
+    TIGL_EXPORT size_t GetTriangleCount() const;
+
+    TIGL_EXPORT static void SetOptions(const std::string& key, const std::string& value);
+
+    // Options
+    TIGL_EXPORT static bool binaryEnabled;
+
 private:
 
     bool WriteImpl(const std::string& filename) const OVERRIDE;
 
+    mutable size_t _nTriangles;
+
     // Assignment operator
     void operator=(const CTiglExportStl& ) { /* Do nothing */ }
 };
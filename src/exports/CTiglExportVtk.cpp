@@ -68,6 +68,8 @@ namespace tigl
 {
 
 bool CTiglExportVtk::normalsEnabled = true;
+VtkDataEncoding CTiglExportVtk::dataEncoding = TIGL_VTK_ASCII;
+bool CTiglExportVtk::compressionEnabled = false;
 
 // Constructor
 CTiglExportVtk::CTiglExportVtk(CCPACSConfiguration& config)
@@ -93,7 +95,7 @@ void CTiglExportVtk::ExportMeshedWingVTKByUID(const std::string& wingUID, const
 {
     tigl::CCPACSWing& wing = myConfig.GetWing(wingUID);
     CTiglTriangularizer wingTrian(wing, deflection, SEGMENT_INFO, getOptions(*this));
-    wingTrian.writeVTK(filename.c_str());
+    wingTrian.writeVTK(filename.c_str(), dataEncoding, compressionEnabled);
 }
 
 
@@ -111,7 +113,7 @@ void CTiglExportVtk::ExportMeshedFuselageVTKByUID(const std::string& fuselageUID
     CTiglRelativelyPositionedComponent & component = myConfig.GetFuselage(fuselageUID);
     const TopoDS_Shape& shape = component.GetLoft()->Shape();
     CTiglTriangularizer trian(shape, deflection, getOptions(*this));
-    trian.writeVTK(filename.c_str());
+    trian.writeVTK(filename.c_str(), dataEncoding, compressionEnabled);
 }
 
 
@@ -119,7 +121,7 @@ void CTiglExportVtk::ExportMeshedFuselageVTKByUID(const std::string& fuselageUID
 void CTiglExportVtk::ExportMeshedGeometryVTK(const std::string& filename, const double deflection)
 {
     tigl::CTiglTriangularizer trian(myConfig, true, deflection, SEGMENT_INFO, getOptions(*this));
-    trian.writeVTK(filename.c_str());
+    trian.writeVTK(filename.c_str(), dataEncoding, compressionEnabled);
 }
 
 /************* Simple ones *************************/
@@ -129,7 +131,7 @@ void CTiglExportVtk::ExportMeshedWingVTKSimpleByUID(const std::string& wingUID,
     CCPACSWing & component = dynamic_cast<CCPACSWing&>(myConfig.GetWing(wingUID));
     TopoDS_Shape& loft = component.GetLoftWithLeadingEdge();
     CTiglTriangularizer loftTrian(loft, deflection, getOptions(*this));
-    loftTrian.writeVTK(filename.c_str());
+    loftTrian.writeVTK(filename.c_str(), dataEncoding, compressionEnabled);
 }
 
 /************* Simple ones *************************/
@@ -146,7 +148,7 @@ void CTiglExportVtk::ExportMeshedFuselageVTKSimpleByUID(const std::string& fusel
     CTiglRelativelyPositionedComponent & component = myConfig.GetFuselage(fuselageUID);
     const TopoDS_Shape& shape = component.GetLoft()->Shape();
     CTiglTriangularizer loftTrian(shape, deflection, getOptions(*this));
-    loftTrian.writeVTK(filename.c_str());
+    loftTrian.writeVTK(filename.c_str(), dataEncoding, compressionEnabled);
 }
 
 // Exports a by UID selected fuselage, boolean fused and meshed, as VTK file
@@ -161,14 +163,14 @@ void CTiglExportVtk::ExportMeshedFuselageVTKSimpleByIndex(const int fuselageInde
 void CTiglExportVtk::ExportMeshedGeometryVTKSimple(const std::string& filename, const double deflection)
 {
     tigl::CTiglTriangularizer trian(myConfig, true, deflection, NO_INFO, getOptions(*this));
-    trian.writeVTK(filename.c_str());
+    trian.writeVTK(filename.c_str(), dataEncoding, compressionEnabled);
 }
 
 // Exports a whole geometry, not fused and meshed, as VTK file
 void CTiglExportVtk::ExportMeshedGeometryVTKNoFuse(const std::string& filename, const double deflection)
 {
     tigl::CTiglTriangularizer trian(myConfig, false, deflection, NO_INFO, getOptions(*this));
-    trian.writeVTK(filename.c_str());
+    trian.writeVTK(filename.c_str(), dataEncoding, compressionEnabled);
 }
 
 void CTiglExportVtk::SetOptions(const std::string &key, const std::string &value)
@@ -184,6 +186,34 @@ void CTiglExportVtk::SetOptions(const std::string &key, const std::string &value
             throw CTiglError("Wrong value for 'normals_enabled' in vtk export: " + value);
         }
     }
+    else if (key == "encoding") {
+        if (to_lower(value) == "ascii") {
+            CTiglExportVtk::dataEncoding = TIGL_VTK_ASCII;
+        }
+        else if (to_lower(value) == "base64") {
+            CTiglExportVtk::dataEncoding = TIGL_VTK_BASE64;
+        }
+        else if (to_lower(value) == "appended") {
+            CTiglExportVtk::dataEncoding = TIGL_VTK_APPENDED;
+        }
+        else {
+            throw CTiglError("Wrong value for 'encoding' in vtk export: " + value);
+        }
+    }
+    else if (key == "compression") {
+        if (to_lower(value) == "none") {
+            CTiglExportVtk::compressionEnabled = false;
+        }
+        else if (to_lower(value) == "zlib") {
+            if (!CTiglVtkWriter::IsCompressionAvailable()) {
+                throw CTiglError("Compression in vtk export is not available. TiGL was built without zlib support.");
+            }
+            CTiglExportVtk::compressionEnabled = true;
+        }
+        else {
+            throw CTiglError("Wrong value for 'compression' in vtk export: " + value);
+        }
+    }
 
     else {
         throw CTiglError("Invalid key in vtk export: " + key);
@@ -27,6 +27,7 @@
 #define CTIGLEXPORTVTK_H
 
 #include "tigl_internal.h"
+#include "CTiglVtkWriter.h"
 
 #include <string>
 
@@ -88,6 +89,8 @@ public:
 
     // Options
     TIGL_EXPORT static bool normalsEnabled;
+    TIGL_EXPORT static VtkDataEncoding dataEncoding;
+    TIGL_EXPORT static bool compressionEnabled;
 
 private:
     class CCPACSConfiguration & myConfig;       /**< TIGL configuration object */
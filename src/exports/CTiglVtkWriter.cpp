@@ -0,0 +1,638 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglVtkWriter.h"
+
+#include "tigl_config.h"
+#include "tigl.h"
+#include "CCPACSStringVector.h"
+#include "CTiglPolyData.h"
+#include "CTiglXmlWriter.h"
+#include "CTiglError.h"
+#include "CTiglLogging.h"
+
+#ifdef ZLIB_FOUND
+#include <zlib.h>
+#endif
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#ifdef _MSC_VER
+    #define snprintf _snprintf
+#endif
+
+namespace
+{
+
+// all binary headers are written as UInt64 (header_type attribute)
+typedef unsigned long long UInt64;
+
+// size of the uncompressed blocks, this is the vtk default
+const size_t COMPRESSION_BLOCK_SIZE = 32768;
+
+// size of the buffers used to format, encode and copy data
+const size_t CHUNK_SIZE = 16384;
+
+// indentation of the array content, matches the nesting level of the DataArray elements
+const char* const CONTENT_INDENT = "\n          ";
+const char* const CLOSING_INDENT = "\n        ";
+
+bool IsLittleEndian()
+{
+    const unsigned int one = 1;
+    return *reinterpret_cast<const unsigned char*>(&one) == 1;
+}
+
+class ByteSink
+{
+public:
+    virtual ~ByteSink() {}
+    virtual void Write(const char* data, size_t size) = 0;
+};
+
+class RawSink : public ByteSink
+{
+public:
+    explicit RawSink(std::ostream& out)
+        : out(out)
+    {
+    }
+
+    void Write(const char* data, size_t size) OVERRIDE
+    {
+        out.write(data, static_cast<std::streamsize>(size));
+    }
+
+private:
+    std::ostream& out;
+};
+
+// Encodes the data as base64 while writing. The output is buffered,
+// Finish has to be called after the last byte was written.
+class Base64Encoder : public ByteSink
+{
+public:
+    explicit Base64Encoder(std::ostream& out)
+        : out(out)
+        , nPending(0)
+        , nBuffered(0)
+    {
+    }
+
+    void Write(const char* data, size_t size) OVERRIDE
+    {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            pending[nPending++] = bytes[i];
+            if (nPending == 3) {
+                EncodePending();
+            }
+        }
+    }
+
+    void Finish()
+    {
+        if (nPending > 0) {
+            EncodePending();
+        }
+        Flush();
+    }
+
+private:
+    void EncodePending()
+    {
+        static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        if (nBuffered + 4 > CHUNK_SIZE) {
+            Flush();
+        }
+
+        const unsigned char b0 = pending[0];
+        const unsigned char b1 = nPending > 1 ? pending[1] : 0;
+        const unsigned char b2 = nPending > 2 ? pending[2] : 0;
+
+        buffer[nBuffered++] = alphabet[b0 >> 2];
+        buffer[nBuffered++] = alphabet[((b0 & 0x03) << 4) | (b1 >> 4)];
+        buffer[nBuffered++] = nPending > 1 ? alphabet[((b1 & 0x0f) << 2) | (b2 >> 6)] : '=';
+        buffer[nBuffered++] = nPending > 2 ? alphabet[b2 & 0x3f] : '=';
+        nPending = 0;
+    }
+
+    void Flush()
+    {
+        out.write(buffer, static_cast<std::streamsize>(nBuffered));
+        nBuffered = 0;
+    }
+
+    std::ostream& out;
+    unsigned char pending[3];
+    size_t nPending;
+    char buffer[CHUNK_SIZE];
+    size_t nBuffered;
+};
+
+// Temporary file next to the output file, that stores the compressed blocks
+// until their sizes are written to the vtk file. The file is removed on destruction.
+class BlockFile
+{
+public:
+    BlockFile()
+        : isOpen(false)
+    {
+    }
+
+    ~BlockFile()
+    {
+        if (isOpen) {
+            stream.close();
+            std::remove(name.c_str());
+        }
+    }
+
+    void Open(const std::string& filename)
+    {
+        name = filename;
+        stream.open(name.c_str(), std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!stream.is_open()) {
+            throw tigl::CTiglError("Cannot create temporary file " + name + ".", TIGL_OPEN_FAILED);
+        }
+        isOpen = true;
+    }
+
+    std::streamoff Append(const char* data, size_t size)
+    {
+        stream.seekp(0, std::ios::end);
+        std::streamoff position = stream.tellp();
+        stream.write(data, static_cast<std::streamsize>(size));
+        if (stream.fail()) {
+            throw tigl::CTiglError("Error writing temporary file " + name + ".", TIGL_WRITE_FAILED);
+        }
+        return position;
+    }
+
+    void CopyTo(std::streamoff position, UInt64 size, ByteSink& sink)
+    {
+        std::vector<char> buffer(CHUNK_SIZE);
+        stream.seekg(position);
+        while (size > 0) {
+            size_t chunk = static_cast<size_t>(std::min<UInt64>(size, CHUNK_SIZE));
+            stream.read(&buffer[0], static_cast<std::streamsize>(chunk));
+            if (stream.fail()) {
+                throw tigl::CTiglError("Error reading temporary file " + name + ".", TIGL_ERROR);
+            }
+            sink.Write(&buffer[0], chunk);
+            size -= chunk;
+        }
+    }
+
+private:
+    std::string name;
+    std::fstream stream;
+    bool isOpen;
+};
+
+enum ArraySection
+{
+    POINTS = 0,
+    POINT_DATA,
+    POLYS,
+    CELL_DATA,
+    NUMBER_OF_SECTIONS
+};
+
+const char* const sectionNames[NUMBER_OF_SECTIONS] = {"Points", "PointData", "Polys", "CellData"};
+
+enum ValueType
+{
+    FLOAT64,
+    INT32
+};
+
+struct DataArray
+{
+    ArraySection section;
+    std::string name;
+    ValueType type;
+    int nComponents;        // the attribute is omitted, if 0
+    const void* values;
+    size_t count;           // total number of values
+    int asciiPrecision;     // significant digits of doubles in ascii encoding
+    size_t valuesPerLine;
+
+    double rangeMin;
+    double rangeMax;
+
+    // only used for compressed data
+    std::vector<UInt64> header;
+    std::streamoff blockPosition;
+    UInt64 compressedSize;
+
+    // only used for appended data
+    UInt64 appendedOffset;
+};
+
+struct Piece
+{
+    const tigl::CTiglPolyObject* object;
+    std::vector<DataArray> arrays;
+};
+
+double GetValue(const DataArray& array, size_t i)
+{
+    if (array.type == FLOAT64) {
+        return static_cast<const double*>(array.values)[i];
+    }
+    else {
+        return static_cast<const unsigned int*>(array.values)[i];
+    }
+}
+
+UInt64 GetDataSize(const DataArray& array)
+{
+    const size_t valueSize = array.type == FLOAT64 ? sizeof(double) : sizeof(unsigned int);
+    return static_cast<UInt64>(array.count) * valueSize;
+}
+
+// size of the binary array inside the appended data section including its header
+UInt64 GetPayloadSize(const DataArray& array, bool compressed)
+{
+    if (compressed) {
+        return array.header.size() * sizeof(UInt64) + array.compressedSize;
+    }
+    else {
+        return sizeof(UInt64) + GetDataSize(array);
+    }
+}
+
+DataArray MakeArray(ArraySection section, const std::string& name, ValueType type, int nComponents,
+                    const void* values, size_t count, int asciiPrecision, size_t valuesPerLine)
+{
+    DataArray array;
+    array.section = section;
+    array.name = name;
+    array.type = type;
+    array.nComponents = nComponents;
+    array.values = values;
+    array.count = values ? count : 0;
+    array.asciiPrecision = asciiPrecision;
+    array.valuesPerLine = valuesPerLine;
+    array.blockPosition = 0;
+    array.compressedSize = 0;
+    array.appendedOffset = 0;
+
+    array.rangeMin = DBL_MAX;
+    array.rangeMax = -DBL_MAX;
+    for (size_t i = 0; i < array.count; ++i) {
+        double value = GetValue(array, i);
+        array.rangeMin = std::min(array.rangeMin, value);
+        array.rangeMax = std::max(array.rangeMax, value);
+    }
+    if (array.count == 0) {
+        array.rangeMin = array.rangeMax = 0.;
+    }
+
+    return array;
+}
+
+Piece MakePiece(const tigl::CTiglPolyObject& co)
+{
+    Piece piece;
+    piece.object = &co;
+
+    const size_t nPoints = co.getNVertices();
+    const size_t nPolys  = co.getNPolygons();
+
+    piece.arrays.push_back(MakeArray(POINTS, "Points", FLOAT64, 3, co.getVertexCoordinates(), 3 * nPoints, 10, 3));
+    if (co.hasNormals()) {
+        piece.arrays.push_back(MakeArray(POINT_DATA, "surf_normals", FLOAT64, 3, co.getVertexNormals(), 3 * nPoints, 6, 3));
+    }
+    piece.arrays.push_back(MakeArray(POLYS, "connectivity", INT32, 0, co.getConnectivity(), co.getConnectivitySize(), 0, 10));
+    piece.arrays.push_back(MakeArray(POLYS, "offsets", INT32, 0, co.getPolygonOffsets(), nPolys, 0, 10));
+
+    for (unsigned int iData = 0; iData < co.getNumberOfPolyRealData(); ++iData) {
+        const char* dataField = co.getPolyDataFieldName(iData);
+        piece.arrays.push_back(MakeArray(CELL_DATA, dataField, FLOAT64, 1, co.getPolyDataRealColumn(dataField), nPolys, 6, 10));
+    }
+
+    return piece;
+}
+
+// compresses the array block by block into the block file and stores the vtk compression header
+void CompressArray(DataArray& array, BlockFile& blocks)
+{
+#ifdef ZLIB_FOUND
+    const char* data = static_cast<const char*>(array.values);
+    const UInt64 dataSize = GetDataSize(array);
+    const UInt64 nBlocks = (dataSize + COMPRESSION_BLOCK_SIZE - 1) / COMPRESSION_BLOCK_SIZE;
+
+    array.header.clear();
+    array.header.push_back(nBlocks);
+    array.header.push_back(COMPRESSION_BLOCK_SIZE);
+    array.header.push_back(dataSize % COMPRESSION_BLOCK_SIZE);
+    array.compressedSize = 0;
+
+    std::vector<Bytef> buffer(compressBound(COMPRESSION_BLOCK_SIZE));
+    for (UInt64 iBlock = 0; iBlock < nBlocks; ++iBlock) {
+        const UInt64 begin = iBlock * COMPRESSION_BLOCK_SIZE;
+        const uLong blockSize = static_cast<uLong>(std::min<UInt64>(COMPRESSION_BLOCK_SIZE, dataSize - begin));
+
+        uLongf compressedBlockSize = static_cast<uLongf>(buffer.size());
+        if (compress2(&buffer[0], &compressedBlockSize, reinterpret_cast<const Bytef*>(data + begin), blockSize, Z_DEFAULT_COMPRESSION) != Z_OK) {
+            throw tigl::CTiglError("Error compressing vtk data array " + array.name + ".");
+        }
+
+        std::streamoff position = blocks.Append(reinterpret_cast<const char*>(&buffer[0]), compressedBlockSize);
+        if (iBlock == 0) {
+            array.blockPosition = position;
+        }
+        array.header.push_back(compressedBlockSize);
+        array.compressedSize += compressedBlockSize;
+    }
+#else
+    (void)array;
+    (void)blocks;
+    throw tigl::CTiglError("Cannot compress vtk data. TiGL was built without zlib support.");
+#endif
+}
+
+void WriteAsciiArray(const DataArray& array, std::ostream& out)
+{
+    char buffer[CHUNK_SIZE];
+    size_t used = 0;
+
+    for (size_t i = 0; i < array.count; ++i) {
+        // leave enough space for the indentation and a formatted number
+        if (CHUNK_SIZE - used < 64) {
+            out.write(buffer, static_cast<std::streamsize>(used));
+            used = 0;
+        }
+
+        if (i % array.valuesPerLine == 0) {
+            used += snprintf(buffer + used, CHUNK_SIZE - used, "%s", CONTENT_INDENT);
+        }
+        else {
+            buffer[used++] = ' ';
+        }
+
+        // the decimal point of doubles must not depend on the locale
+        if (array.type == FLOAT64) {
+            used += tigl::formatDouble(static_cast<const double*>(array.values)[i], array.asciiPrecision, buffer + used);
+        }
+        else {
+            used += snprintf(buffer + used, CHUNK_SIZE - used, "%u", static_cast<const unsigned int*>(array.values)[i]);
+        }
+    }
+    out.write(buffer, static_cast<std::streamsize>(used));
+    out << CLOSING_INDENT;
+}
+
+// inline binary data: the header and the data are encoded together, unless
+// the data is compressed. In this case, the header is encoded separately.
+void WriteBase64Array(const DataArray& array, BlockFile* blocks, std::ostream& out)
+{
+    out << CONTENT_INDENT;
+    if (blocks) {
+        Base64Encoder headerEncoder(out);
+        headerEncoder.Write(reinterpret_cast<const char*>(&array.header[0]), array.header.size() * sizeof(UInt64));
+        headerEncoder.Finish();
+
+        Base64Encoder dataEncoder(out);
+        blocks->CopyTo(array.blockPosition, array.compressedSize, dataEncoder);
+        dataEncoder.Finish();
+    }
+    else {
+        const UInt64 dataSize = GetDataSize(array);
+        Base64Encoder encoder(out);
+        encoder.Write(reinterpret_cast<const char*>(&dataSize), sizeof(UInt64));
+        encoder.Write(static_cast<const char*>(array.values), static_cast<size_t>(dataSize));
+        encoder.Finish();
+    }
+    out << CLOSING_INDENT;
+}
+
+void WriteRawArray(const DataArray& array, BlockFile* blocks, std::ostream& out)
+{
+    RawSink sink(out);
+    if (blocks) {
+        sink.Write(reinterpret_cast<const char*>(&array.header[0]), array.header.size() * sizeof(UInt64));
+        blocks->CopyTo(array.blockPosition, array.compressedSize, sink);
+    }
+    else {
+        const UInt64 dataSize = GetDataSize(array);
+        sink.Write(reinterpret_cast<const char*>(&dataSize), sizeof(UInt64));
+        sink.Write(static_cast<const char*>(array.values), static_cast<size_t>(dataSize));
+    }
+}
+
+void WriteDataArray(tigl::CTiglXmlWriter& writer, DataArray& array, tigl::VtkDataEncoding encoding, BlockFile* blocks)
+{
+    writer.StartElement("DataArray");
+    writer.AddTextAttribute("type", array.type == FLOAT64 ? "Float64" : "Int32");
+    writer.AddTextAttribute("Name", array.name);
+    if (array.nComponents > 0) {
+        writer.AddIntegerAttribute("NumberOfComponents", array.nComponents);
+    }
+
+    if (encoding == tigl::TIGL_VTK_ASCII) {
+        writer.AddTextAttribute("format", "ascii");
+    }
+    else if (encoding == tigl::TIGL_VTK_BASE64) {
+        writer.AddTextAttribute("format", "binary");
+    }
+    else {
+        writer.AddTextAttribute("format", "appended");
+    }
+
+    if (array.type == FLOAT64) {
+        writer.AddDoubleAttribute("RangeMin", array.rangeMin);
+        writer.AddDoubleAttribute("RangeMax", array.rangeMax);
+    }
+    else {
+        writer.AddIntegerAttribute("RangeMin", static_cast<long long>(array.rangeMin));
+        writer.AddIntegerAttribute("RangeMax", static_cast<long long>(array.rangeMax));
+    }
+
+    if (encoding == tigl::TIGL_VTK_APPENDED) {
+        writer.AddIntegerAttribute("offset", static_cast<long long>(array.appendedOffset));
+    }
+    else if (encoding == tigl::TIGL_VTK_BASE64) {
+        if (blocks) {
+            CompressArray(array, *blocks);
+        }
+        WriteBase64Array(array, blocks, writer.ContentStream());
+    }
+    else {
+        WriteAsciiArray(array, writer.ContentStream());
+    }
+
+    writer.EndElement();
+}
+
+void WritePolyMetadata(tigl::CTiglXmlWriter& writer, const tigl::CTiglPolyObject& co)
+{
+    writer.StartElement("MetaData");
+    writer.AddTextAttribute("elements", co.getMetadataElements());
+    for (unsigned long iPoly = 0; iPoly < co.getNPolygons(); ++iPoly) {
+        writer.WriteRaw(CONTENT_INDENT, std::strlen(CONTENT_INDENT));
+        writer.WriteText(co.getPolyMetadata(iPoly));
+    }
+    writer.WriteRaw(CLOSING_INDENT, std::strlen(CLOSING_INDENT));
+    writer.EndElement();
+}
+
+// writes the polygon data of a surface (in vtk they call it piece)
+void WritePiece(tigl::CTiglXmlWriter& writer, Piece& piece, tigl::VtkDataEncoding encoding, BlockFile* blocks)
+{
+    const tigl::CTiglPolyObject& co = *piece.object;
+
+    writer.StartElement("Piece");
+    writer.AddIntegerAttribute("NumberOfPoints", co.getNVertices());
+    writer.AddIntegerAttribute("NumberOfVerts",  0);
+    writer.AddIntegerAttribute("NumberOfLines",  0);
+    writer.AddIntegerAttribute("NumberOfStrips", 0);
+    writer.AddIntegerAttribute("NumberOfPolys",  co.getNPolygons());
+
+    for (int section = 0; section < NUMBER_OF_SECTIONS; ++section) {
+        bool sectionStarted = false;
+        for (std::vector<DataArray>::iterator it = piece.arrays.begin(); it != piece.arrays.end(); ++it) {
+            if (it->section != section) {
+                continue;
+            }
+            if (!sectionStarted) {
+                writer.StartElement(sectionNames[section]);
+                if (section == POINT_DATA) {
+                    writer.AddTextAttribute("Normals", "surf_normals");
+                }
+                sectionStarted = true;
+            }
+            WriteDataArray(writer, *it, encoding, blocks);
+        }
+
+        if (section == POLYS && sectionStarted && co.hasMetadata()) {
+            WritePolyMetadata(writer, co);
+        }
+
+        if (sectionStarted) {
+            writer.EndElement();
+        }
+    }
+
+    writer.EndElement();
+}
+
+} // namespace
+
+namespace tigl
+{
+
+CTiglVtkWriter::CTiglVtkWriter(VtkDataEncoding encoding, bool compressed)
+    : encoding(encoding)
+    , compressed(compressed)
+{
+}
+
+bool CTiglVtkWriter::IsCompressionAvailable()
+{
+#ifdef ZLIB_FOUND
+    return true;
+#else
+    return false;
+#endif
+}
+
+void CTiglVtkWriter::Write(CTiglPolyData& polyData, const std::string& filename) const
+{
+    // ascii data is never compressed
+    const bool useBlocks = compressed && encoding != TIGL_VTK_ASCII;
+    if (useBlocks && !IsCompressionAvailable()) {
+        throw CTiglError("Cannot write compressed vtk file. TiGL was built without zlib support.");
+    }
+
+    std::vector<Piece> pieces;
+    for (unsigned int iobj = 1; iobj <= polyData.getNObjects(); ++iobj) {
+        const CTiglPolyObject& co = polyData.switchObject(iobj);
+        if (co.getNPolygons() == 0 || co.getConnectivitySize() == 0) {
+            continue;
+        }
+        pieces.push_back(MakePiece(co));
+    }
+
+    BlockFile blocks;
+    if (useBlocks) {
+        blocks.Open(filename + ".tmp");
+    }
+    BlockFile* blocksPtr = useBlocks ? &blocks : NULL;
+
+    // the offsets of the appended arrays must be known, before the xml part is written
+    if (encoding == TIGL_VTK_APPENDED) {
+        UInt64 offset = 0;
+        for (std::vector<Piece>::iterator pieceIt = pieces.begin(); pieceIt != pieces.end(); ++pieceIt) {
+            for (std::vector<DataArray>::iterator it = pieceIt->arrays.begin(); it != pieceIt->arrays.end(); ++it) {
+                if (useBlocks) {
+                    CompressArray(*it, blocks);
+                }
+                it->appendedOffset = offset;
+                offset += GetPayloadSize(*it, useBlocks);
+            }
+        }
+    }
+
+    CTiglXmlWriter writer(filename);
+    writer.StartElement("VTKFile");
+    writer.AddTextAttribute("type", "PolyData");
+    writer.AddTextAttribute("version", "1.0");
+    writer.AddTextAttribute("byte_order", IsLittleEndian() ? "LittleEndian" : "BigEndian");
+    writer.AddTextAttribute("header_type", "UInt64");
+    if (useBlocks) {
+        writer.AddTextAttribute("compressor", "vtkZLibDataCompressor");
+    }
+
+    std::stringstream stream;
+    stream << "tigl " << tiglGetVersion();
+    writer.StartElement("MetaData");
+    writer.AddTextAttribute("creator", stream.str());
+    writer.EndElement();
+
+    writer.StartElement("PolyData");
+    for (std::vector<Piece>::iterator it = pieces.begin(); it != pieces.end(); ++it) {
+        WritePiece(writer, *it, encoding, blocksPtr);
+    }
+    writer.EndElement();
+
+    if (encoding == TIGL_VTK_APPENDED) {
+        writer.StartElement("AppendedData");
+        writer.AddTextAttribute("encoding", "raw");
+        std::ostream& out = writer.ContentStream();
+        out << "\n    _";
+        for (std::vector<Piece>::iterator pieceIt = pieces.begin(); pieceIt != pieces.end(); ++pieceIt) {
+            for (std::vector<DataArray>::iterator it = pieceIt->arrays.begin(); it != pieceIt->arrays.end(); ++it) {
+                WriteRawArray(*it, blocksPtr, out);
+            }
+        }
+        out << "\n  ";
+        writer.EndElement();
+    }
+
+    writer.Close();
+}
+
+} // namespace tigl
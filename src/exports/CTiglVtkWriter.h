@@ -0,0 +1,66 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief The CTiglVtkWriter class writes polygon data as VTK XML PolyData file (*.vtp).
+ *
+ * The file is streamed directly from the mesh buffers of the poly objects,
+ * no xml document is built in memory. Data arrays can be written as
+ *  - ascii text,
+ *  - base64 encoded binary data inside the DataArray elements or
+ *  - raw binary data in the AppendedData section of the file.
+ *
+ * Binary data can optionally be compressed using zlib, if TiGL was built with zlib support.
+ */
+
+#ifndef CTIGLVTKWRITER_H
+#define CTIGLVTKWRITER_H
+
+#include "tigl_internal.h"
+
+#include <string>
+
+namespace tigl
+{
+
+class CTiglPolyData;
+
+enum VtkDataEncoding
+{
+    TIGL_VTK_ASCII    = 0,
+    TIGL_VTK_BASE64   = 1,
+    TIGL_VTK_APPENDED = 2
+};
+
+class CTiglVtkWriter
+{
+public:
+    TIGL_EXPORT explicit CTiglVtkWriter(VtkDataEncoding encoding = TIGL_VTK_ASCII, bool compressed = false);
+
+    /// Writes all objects of the poly data as pieces into a vtk file
+    TIGL_EXPORT void Write(CTiglPolyData& polyData, const std::string& filename) const;
+
+    /// Returns true, if TiGL was built with zlib and compressed files can be written
+    TIGL_EXPORT static bool IsCompressionAvailable();
+
+private:
+    VtkDataEncoding encoding;
+    bool compressed;
+};
+
+} // namespace tigl
+
+#endif // CTIGLVTKWRITER_H
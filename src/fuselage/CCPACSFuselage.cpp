@@ -33,6 +33,7 @@
 #include "CCPACSWingSegment.h"
 #include "tiglcommonfunctions.h"
 #include "CNamedShape.h"
+#include "CTiglDiskCache.h"
 
 #include "BRepOffsetAPI_ThruSections.hxx"
 #include "BRepAlgoAPI_Fuse.hxx"
@@ -85,6 +86,13 @@ void CCPACSFuselage::Invalidate()
         m_positionings->Invalidate();
 }
 
+// Invalidates the fused shapes only
+void CCPACSFuselage::InvalidateShapes()
+{
+    CTiglAbstractGeometricComponent::Reset();
+    guideCurvesBuilt.Reset();
+}
+
 // Cleanup routine
 void CCPACSFuselage::Cleanup()
 {
@@ -249,6 +257,18 @@ PNamedShape CCPACSFuselage::BuildLoft()
     return loft;
 }
 
+bool CCPACSFuselage::GetLoftCacheKey(std::string& key)
+{
+    key = "fuselage " + GetShortShapeName() + "\n";
+    AppendCPACSDefinition(key, *this);
+    const boost::optional<CCPACSProfiles>& profiles = GetConfiguration().GetProfiles();
+    if (profiles) {
+        AppendCPACSDefinition(key, *profiles);
+    }
+    AppendTransformation(key, GetTransformationMatrix());
+    return true;
+}
+
 // Get the positioning transformation for a given section index
 boost::optional<CTiglTransformation> CCPACSFuselage::GetPositioningTransformation(const std::string &sectionUID)
 {
@@ -374,7 +394,8 @@ TopoDS_Compound &CCPACSFuselage::GetGuideCurveWires()
 
 void CCPACSFuselage::BuildGuideCurves()
 {
-    if (!guideCurves.IsNull()) {
+    CTiglOnceGuard guard(guideCurvesBuilt);
+    if (guard.IsDone()) {
         return;
     }
     
@@ -427,6 +448,8 @@ void CCPACSFuselage::BuildGuideCurves()
         result = wireFixer.Wire();
         b.Add(guideCurves, result);
     }
+
+    guard.SetDone();
 }
 
 void CCPACSFuselage::ConnectGuideCurveSegments(void)
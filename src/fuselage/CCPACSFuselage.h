@@ -32,6 +32,7 @@
 
 #include "tigl_config.h"
 #include "CTiglTransformation.h"
+#include "CTiglOnceFlag.h"
 #include "CCPACSFuselageSections.h"
 #include "CCPACSFuselageSegments.h"
 #include "CCPACSPositionings.h"
@@ -59,6 +60,10 @@ public:
     // Invalidates internal state
     TIGL_EXPORT void Invalidate();
 
+    // Invalidates the shapes of the whole fuselage (loft, guide curves),
+    // but keeps the geometry of the segments
+    TIGL_EXPORT void InvalidateShapes();
+
     // Read CPACS fuselage elements
     TIGL_EXPORT void ReadCPACS(TixiDocumentHandle tixiHandle, const std::string& fuselageXPath);
 
@@ -105,6 +110,9 @@ public:
     // Returns the Component Type TIGL_COMPONENT_FUSELAGE
     TIGL_EXPORT TiglGeometricComponentType GetComponentType() const OVERRIDE {return TIGL_COMPONENT_FUSELAGE | TIGL_COMPONENT_PHYSICAL;}
 
+    // Returns the CPACS definition of the fuselage and the profiles to identify the loft in the disk cache
+    TIGL_EXPORT bool GetLoftCacheKey(std::string& key) OVERRIDE;
+
     // Returns the point where the distance between the selected fuselage and the ground is at minimum.
     // The Fuselage could be turned with a given angle at at given axis, specified by a point and a direction.
     TIGL_EXPORT gp_Pnt GetMinumumDistanceToGround(gp_Ax1 RAxis, double angle);
@@ -138,6 +146,7 @@ private:
 
     TopoDS_Compound            aCompound;
     TopoDS_Compound            guideCurves;
+    CTiglOnceFlag              guideCurvesBuilt;     /**< Set, if guideCurves is up to date */
     BRep_Builder               aBuilder;
     double                     myVolume;             /**< Volume of this fuselage              */
 
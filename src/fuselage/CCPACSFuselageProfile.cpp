@@ -69,7 +69,7 @@ namespace tigl
 {
 // Constructor
 CCPACSFuselageProfile::CCPACSFuselageProfile(CTiglUIDManager* uidMgr)
-    : generated::CPACSProfileGeometry(uidMgr), invalidated(true), profileWireAlgo(new CTiglInterpolateBsplineWire), mirrorSymmetry(false) {}
+    : generated::CPACSProfileGeometry(uidMgr), profileWireAlgo(new CTiglInterpolateBsplineWire), mirrorSymmetry(false) {}
 
 CCPACSFuselageProfile::~CCPACSFuselageProfile() {}
 
@@ -101,18 +101,19 @@ bool CCPACSFuselageProfile::GetMirrorSymmetry() const
 // Invalidates internal fuselage profile state
 void CCPACSFuselageProfile::Invalidate()
 {
-    invalidated = true;
+    updated.Reset();
 }
 
 // Update the internal state, i.g. recalculates wire
 void CCPACSFuselageProfile::Update()
 {
-    if (!invalidated) {
+    CTiglOnceGuard guard(updated);
+    if (guard.IsDone()) {
         return;
     }
 
     BuildWires();
-    invalidated = false;
+    guard.SetDone();
 }
 
 // Returns the fuselage profile wire
@@ -28,6 +28,7 @@
 #include "generated/UniquePtr.h"
 #include "generated/CPACSProfileGeometry.h"
 #include "tigl_internal.h"
+#include "CTiglOnceFlag.h"
 #include "tixi.h"
 #include "CTiglArcLengthReparameterization.h"
 #include "TopoDS_Wire.hxx"
@@ -106,7 +107,7 @@ private:
 
 private:
     bool                             mirrorSymmetry; /**< Mirror symmetry with repect to the x-z plane */
-    bool                             invalidated;    /**< Flag if element is invalid */
+    CTiglOnceFlag                    updated;        /**< Set, if the internal state is up to date */
     TopoDS_Wire                      wireOriginal;   /**< Original fuselage profile wire */
     TopoDS_Wire                      wireClosed;     /**< Forced closed fuselage profile wire */
     unique_ptr<ITiglWireAlgorithm>   profileWireAlgo;
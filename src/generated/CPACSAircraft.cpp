@@ -44,7 +44,7 @@ namespace tigl
         void CPACSAircraft::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element model
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/model")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/model")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/model", m_models, m_uidMgr);
             }
             
@@ -31,7 +31,7 @@ namespace tigl
         void CPACSCFDTool::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element tool
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/tool")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/tool")) {
                 m_tool.ReadCPACS(tixiHandle, xpath + "/tool");
             }
             else {
@@ -39,8 +39,8 @@ namespace tigl
             }
             
             // read element aircraftModelUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/aircraftModelUID")) {
-                m_aircraftModelUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/aircraftModelUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/aircraftModelUID")) {
+                m_aircraftModelUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/aircraftModelUID");
                 if (m_aircraftModelUID.empty()) {
                     LOG(WARNING) << "Required element aircraftModelUID is empty at xpath " << xpath;
                 }
@@ -50,7 +50,7 @@ namespace tigl
             }
             
             // read element farField
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/farField")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/farField")) {
                 m_farField.ReadCPACS(tixiHandle, xpath + "/farField");
             }
             else {
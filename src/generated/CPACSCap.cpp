@@ -32,15 +32,15 @@ namespace tigl
         void CPACSCap::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element area
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/area")) {
-                m_area = tixi::TixiGetElement<double>(tixiHandle, xpath + "/area");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/area")) {
+                m_area = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/area");
             }
             else {
                 LOG(ERROR) << "Required element area is missing at xpath " << xpath;
             }
             
             // read element material
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/material")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/material")) {
                 m_material.ReadCPACS(tixiHandle, xpath + "/material");
             }
             else {
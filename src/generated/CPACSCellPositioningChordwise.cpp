@@ -42,21 +42,21 @@ namespace tigl
         void CPACSCellPositioningChordwise::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element sparUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparUID")) {
-                m_sparUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/sparUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparUID")) {
+                m_sparUID_choice1 = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/sparUID");
                 if (m_sparUID_choice1->empty()) {
                     LOG(WARNING) << "Optional element sparUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element xsi1
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsi1")) {
-                m_xsi1_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsi1");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/xsi1")) {
+                m_xsi1_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/xsi1");
             }
             
             // read element xsi2
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsi2")) {
-                m_xsi2_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsi2");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/xsi2")) {
+                m_xsi2_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/xsi2");
             }
             
             if (!ValidateChoices()) {
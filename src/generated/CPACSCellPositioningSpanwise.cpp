@@ -42,23 +42,23 @@ namespace tigl
         void CPACSCellPositioningSpanwise::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element eta1
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/eta1")) {
-                m_eta1_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/eta1");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/eta1")) {
+                m_eta1_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/eta1");
             }
             
             // read element eta2
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/eta2")) {
-                m_eta2_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/eta2");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/eta2")) {
+                m_eta2_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/eta2");
             }
             
             // read element ribNumber
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribNumber")) {
-                m_ribNumber_choice2 = tixi::TixiGetElement<int>(tixiHandle, xpath + "/ribNumber");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribNumber")) {
+                m_ribNumber_choice2 = tixi::cursor::TixiGetElement<int>(tixiHandle, xpath + "/ribNumber");
             }
             
             // read element ribDefinitionUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribDefinitionUID")) {
-                m_ribDefinitionUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/ribDefinitionUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribDefinitionUID")) {
+                m_ribDefinitionUID_choice2 = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/ribDefinitionUID");
                 if (m_ribDefinitionUID_choice2->empty()) {
                     LOG(WARNING) << "Optional element ribDefinitionUID is present but empty at xpath " << xpath;
                 }
@@ -55,7 +55,7 @@ namespace tigl
         void CPACSComponentSegments::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element componentSegment
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/componentSegment")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/componentSegment")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/componentSegment", m_componentSegments, reinterpret_cast<CCPACSWingComponentSegments*>(this), m_uidMgr);
             }
             
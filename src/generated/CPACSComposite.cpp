@@ -47,8 +47,8 @@ namespace tigl
         void CPACSComposite::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -58,8 +58,8 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -69,20 +69,20 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element offset
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/offset")) {
-                m_offset = tixi::TixiGetElement<double>(tixiHandle, xpath + "/offset");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/offset")) {
+                m_offset = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/offset");
             }
             
             // read element compositeLayer
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/compositeLayer")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/compositeLayer")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/compositeLayer", m_compositeLayers);
             }
             
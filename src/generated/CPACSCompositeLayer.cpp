@@ -33,40 +33,40 @@ namespace tigl
         void CPACSCompositeLayer::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name->empty()) {
                     LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
                 }
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element thickness
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/thickness")) {
-                m_thickness = tixi::TixiGetElement<double>(tixiHandle, xpath + "/thickness");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/thickness")) {
+                m_thickness = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/thickness");
             }
             else {
                 LOG(ERROR) << "Required element thickness is missing at xpath " << xpath;
             }
             
             // read element phi
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/phi")) {
-                m_phi = tixi::TixiGetElement<double>(tixiHandle, xpath + "/phi");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/phi")) {
+                m_phi = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/phi");
             }
             else {
                 LOG(ERROR) << "Required element phi is missing at xpath " << xpath;
             }
             
             // read element materialUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/materialUID")) {
-                m_materialUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/materialUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/materialUID")) {
+                m_materialUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/materialUID");
                 if (m_materialUID.empty()) {
                     LOG(WARNING) << "Required element materialUID is empty at xpath " << xpath;
                 }
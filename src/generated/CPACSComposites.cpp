@@ -44,7 +44,7 @@ namespace tigl
         void CPACSComposites::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element composite
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/composite")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/composite")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/composite", m_composites, m_uidMgr);
             }
             
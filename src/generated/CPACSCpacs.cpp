@@ -43,7 +43,7 @@ namespace tigl
         void CPACSCpacs::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element header
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/header")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/header")) {
                 m_header.ReadCPACS(tixiHandle, xpath + "/header");
             }
             else {
@@ -51,7 +51,7 @@ namespace tigl
             }
             
             // read element vehicles
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/vehicles")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/vehicles")) {
                 m_vehicles = boost::in_place(m_uidMgr);
                 try {
                     m_vehicles->ReadCPACS(tixiHandle, xpath + "/vehicles");
@@ -62,7 +62,7 @@ namespace tigl
             }
             
             // read element toolspecific
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/toolspecific")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/toolspecific")) {
                 m_toolspecific = boost::in_place();
                 try {
                     m_toolspecific->ReadCPACS(tixiHandle, xpath + "/toolspecific");
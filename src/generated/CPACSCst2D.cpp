@@ -35,7 +35,7 @@ namespace tigl
         void CPACSCst2D::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element psi
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/psi")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/psi")) {
                 m_psi.ReadCPACS(tixiHandle, xpath + "/psi");
             }
             else {
@@ -43,23 +43,23 @@ namespace tigl
             }
             
             // read element upperN1
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/upperN1")) {
-                m_upperN1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/upperN1");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/upperN1")) {
+                m_upperN1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/upperN1");
             }
             else {
                 LOG(ERROR) << "Required element upperN1 is missing at xpath " << xpath;
             }
             
             // read element upperN2
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/upperN2")) {
-                m_upperN2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/upperN2");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/upperN2")) {
+                m_upperN2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/upperN2");
             }
             else {
                 LOG(ERROR) << "Required element upperN2 is missing at xpath " << xpath;
             }
             
             // read element upperB
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/upperB")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/upperB")) {
                 m_upperB.ReadCPACS(tixiHandle, xpath + "/upperB");
             }
             else {
@@ -67,23 +67,23 @@ namespace tigl
             }
             
             // read element lowerN1
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/lowerN1")) {
-                m_lowerN1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/lowerN1");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/lowerN1")) {
+                m_lowerN1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/lowerN1");
             }
             else {
                 LOG(ERROR) << "Required element lowerN1 is missing at xpath " << xpath;
             }
             
             // read element lowerN2
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/lowerN2")) {
-                m_lowerN2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/lowerN2");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/lowerN2")) {
+                m_lowerN2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/lowerN2");
             }
             else {
                 LOG(ERROR) << "Required element lowerN2 is missing at xpath " << xpath;
             }
             
             // read element lowerB
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/lowerB")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/lowerB")) {
                 m_lowerB.ReadCPACS(tixiHandle, xpath + "/lowerB");
             }
             else {
@@ -91,8 +91,8 @@ namespace tigl
             }
             
             // read element trailingEdgeThickness
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/trailingEdgeThickness")) {
-                m_trailingEdgeThickness = tixi::TixiGetElement<double>(tixiHandle, xpath + "/trailingEdgeThickness");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/trailingEdgeThickness")) {
+                m_trailingEdgeThickness = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/trailingEdgeThickness");
             }
             
         }
@@ -31,7 +31,7 @@ namespace tigl
         void CPACSEmissivityMap::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element waveLength
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/waveLength")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/waveLength")) {
                 m_waveLength.ReadCPACS(tixiHandle, xpath + "/waveLength");
             }
             else {
@@ -39,7 +39,7 @@ namespace tigl
             }
             
             // read element diffuseEmissivity
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/diffuseEmissivity")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/diffuseEmissivity")) {
                 m_diffuseEmissivity.ReadCPACS(tixiHandle, xpath + "/diffuseEmissivity");
             }
             else {
@@ -32,16 +32,16 @@ namespace tigl
         void CPACSEtaIsoLine::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element eta
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/eta")) {
-                m_eta = tixi::TixiGetElement<double>(tixiHandle, xpath + "/eta");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/eta")) {
+                m_eta = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/eta");
             }
             else {
                 LOG(ERROR) << "Required element eta is missing at xpath " << xpath;
             }
             
             // read element referenceUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/referenceUID")) {
-                m_referenceUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/referenceUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/referenceUID")) {
+                m_referenceUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/referenceUID");
                 if (m_referenceUID.empty()) {
                     LOG(WARNING) << "Required element referenceUID is empty at xpath " << xpath;
                 }
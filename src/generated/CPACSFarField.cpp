@@ -33,24 +33,24 @@ namespace tigl
         void CPACSFarField::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element type
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/type")) {
-                m_type = stringToTiglFarFieldType(tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/type"));
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/type")) {
+                m_type = stringToTiglFarFieldType(tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/type"));
             }
             else {
                 LOG(ERROR) << "Required element type is missing at xpath " << xpath;
             }
             
             // read element referenceLength
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/referenceLength")) {
-                m_referenceLength = tixi::TixiGetElement<double>(tixiHandle, xpath + "/referenceLength");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/referenceLength")) {
+                m_referenceLength = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/referenceLength");
             }
             else {
                 LOG(ERROR) << "Required element referenceLength is missing at xpath " << xpath;
             }
             
             // read element multiplier
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/multiplier")) {
-                m_multiplier = tixi::TixiGetElement<double>(tixiHandle, xpath + "/multiplier");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/multiplier")) {
+                m_multiplier = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/multiplier");
             }
             else {
                 LOG(ERROR) << "Required element multiplier is missing at xpath " << xpath;
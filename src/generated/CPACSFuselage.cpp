@@ -60,8 +60,8 @@ namespace tigl
         void CPACSFuselage::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -71,13 +71,13 @@ namespace tigl
             }
             
             // read attribute symmetry
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "symmetry")) {
-                m_symmetry = stringToTiglSymmetryAxis(tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "symmetry"));
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "symmetry")) {
+                m_symmetry = stringToTiglSymmetryAxis(tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "symmetry"));
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -87,23 +87,23 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element parentUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
-                m_parentUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
+                m_parentUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
                 if (m_parentUID->empty()) {
                     LOG(WARNING) << "Optional element parentUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element transformation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
                 m_transformation.ReadCPACS(tixiHandle, xpath + "/transformation");
             }
             else {
@@ -111,7 +111,7 @@ namespace tigl
             }
             
             // read element sections
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sections")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sections")) {
                 m_sections.ReadCPACS(tixiHandle, xpath + "/sections");
             }
             else {
@@ -119,7 +119,7 @@ namespace tigl
             }
             
             // read element positionings
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/positionings")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/positionings")) {
                 m_positionings = boost::in_place(m_uidMgr);
                 try {
                     m_positionings->ReadCPACS(tixiHandle, xpath + "/positionings");
@@ -130,7 +130,7 @@ namespace tigl
             }
             
             // read element segments
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/segments")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/segments")) {
                 m_segments.ReadCPACS(tixiHandle, xpath + "/segments");
             }
             else {
@@ -138,7 +138,7 @@ namespace tigl
             }
             
             // read element cutOuts
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/cutOuts")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/cutOuts")) {
                 m_cutOuts = boost::in_place(m_uidMgr);
                 try {
                     m_cutOuts->ReadCPACS(tixiHandle, xpath + "/cutOuts");
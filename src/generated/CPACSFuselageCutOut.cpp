@@ -54,8 +54,8 @@ namespace tigl
         void CPACSFuselageCutOut::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -65,55 +65,55 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name->empty()) {
                     LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
                 }
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element positionX
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/positionX")) {
-                m_positionX = tixi::TixiGetElement<double>(tixiHandle, xpath + "/positionX");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/positionX")) {
+                m_positionX = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/positionX");
             }
             else {
                 LOG(ERROR) << "Required element positionX is missing at xpath " << xpath;
             }
             
             // read element referenceY
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/referenceY")) {
-                m_referenceY = tixi::TixiGetElement<double>(tixiHandle, xpath + "/referenceY");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/referenceY")) {
+                m_referenceY = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/referenceY");
             }
             else {
                 LOG(ERROR) << "Required element referenceY is missing at xpath " << xpath;
             }
             
             // read element referenceZ
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/referenceZ")) {
-                m_referenceZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/referenceZ");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/referenceZ")) {
+                m_referenceZ = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/referenceZ");
             }
             else {
                 LOG(ERROR) << "Required element referenceZ is missing at xpath " << xpath;
             }
             
             // read element referenceAngle
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/referenceAngle")) {
-                m_referenceAngle = tixi::TixiGetElement<double>(tixiHandle, xpath + "/referenceAngle");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/referenceAngle")) {
+                m_referenceAngle = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/referenceAngle");
             }
             else {
                 LOG(ERROR) << "Required element referenceAngle is missing at xpath " << xpath;
             }
             
             // read element orientationVector
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/orientationVector")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/orientationVector")) {
                 m_orientationVector.ReadCPACS(tixiHandle, xpath + "/orientationVector");
             }
             else {
@@ -121,7 +121,7 @@ namespace tigl
             }
             
             // read element alignmentVector
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/alignmentVector")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/alignmentVector")) {
                 m_alignmentVector = boost::in_place(m_uidMgr);
                 try {
                     m_alignmentVector->ReadCPACS(tixiHandle, xpath + "/alignmentVector");
@@ -132,42 +132,42 @@ namespace tigl
             }
             
             // read element deltaY
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/deltaY")) {
-                m_deltaY = tixi::TixiGetElement<double>(tixiHandle, xpath + "/deltaY");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/deltaY")) {
+                m_deltaY = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/deltaY");
             }
             else {
                 LOG(ERROR) << "Required element deltaY is missing at xpath " << xpath;
             }
             
             // read element deltaZ
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/deltaZ")) {
-                m_deltaZ = tixi::TixiGetElement<double>(tixiHandle, xpath + "/deltaZ");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/deltaZ")) {
+                m_deltaZ = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/deltaZ");
             }
             else {
                 LOG(ERROR) << "Required element deltaZ is missing at xpath " << xpath;
             }
             
             // read element deltaY1
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/deltaY1")) {
-                m_deltaY1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/deltaY1");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/deltaY1")) {
+                m_deltaY1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/deltaY1");
             }
             
             // read element deltaZ1
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/deltaZ1")) {
-                m_deltaZ1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/deltaZ1");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/deltaZ1")) {
+                m_deltaZ1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/deltaZ1");
             }
             
             // read element filletRadius
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/filletRadius")) {
-                m_filletRadius = tixi::TixiGetElement<double>(tixiHandle, xpath + "/filletRadius");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/filletRadius")) {
+                m_filletRadius = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/filletRadius");
             }
             else {
                 LOG(ERROR) << "Required element filletRadius is missing at xpath " << xpath;
             }
             
             // read element cutoutType
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/cutoutType")) {
-                m_cutoutType = stringToCPACSFuselageCutOut_cutout(tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/cutoutType"));
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/cutoutType")) {
+                m_cutoutType = stringToCPACSFuselageCutOut_cutout(tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/cutoutType"));
             }
             else {
                 LOG(ERROR) << "Required element cutoutType is missing at xpath " << xpath;
@@ -44,7 +44,7 @@ namespace tigl
         void CPACSFuselageCutOuts::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element element
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/element")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/element")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/element", m_elements, m_uidMgr);
             }
             
@@ -58,8 +58,8 @@ namespace tigl
         void CPACSFuselageElement::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -69,8 +69,8 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -80,16 +80,16 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element profileUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/profileUID")) {
-                m_profileUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/profileUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/profileUID")) {
+                m_profileUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/profileUID");
                 if (m_profileUID.empty()) {
                     LOG(WARNING) << "Required element profileUID is empty at xpath " << xpath;
                 }
@@ -99,7 +99,7 @@ namespace tigl
             }
             
             // read element transformation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
                 m_transformation.ReadCPACS(tixiHandle, xpath + "/transformation");
             }
             else {
@@ -55,7 +55,7 @@ namespace tigl
         void CPACSFuselageElements::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element element
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/element")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/element")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/element", m_elements, reinterpret_cast<CCPACSFuselageSectionElements*>(this), m_uidMgr);
             }
             
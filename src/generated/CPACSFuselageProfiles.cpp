@@ -44,7 +44,7 @@ namespace tigl
         void CPACSFuselageProfiles::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element fuselageProfile
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/fuselageProfile")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/fuselageProfile")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/fuselageProfile", m_fuselageProfiles, m_uidMgr);
             }
             
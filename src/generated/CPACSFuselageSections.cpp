@@ -55,7 +55,7 @@ namespace tigl
         void CPACSFuselageSections::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element section
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/section")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/section")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/section", m_sections, reinterpret_cast<CCPACSFuselageSections*>(this), m_uidMgr);
             }
             
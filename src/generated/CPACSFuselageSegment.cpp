@@ -57,8 +57,8 @@ namespace tigl
         void CPACSFuselageSegment::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -68,8 +68,8 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -79,16 +79,16 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element fromElementUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromElementUID")) {
-                m_fromElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/fromElementUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/fromElementUID")) {
+                m_fromElementUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/fromElementUID");
                 if (m_fromElementUID.empty()) {
                     LOG(WARNING) << "Required element fromElementUID is empty at xpath " << xpath;
                 }
@@ -98,8 +98,8 @@ namespace tigl
             }
             
             // read element toElementUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/toElementUID")) {
-                m_toElementUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/toElementUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/toElementUID")) {
+                m_toElementUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/toElementUID");
                 if (m_toElementUID.empty()) {
                     LOG(WARNING) << "Required element toElementUID is empty at xpath " << xpath;
                 }
@@ -109,7 +109,7 @@ namespace tigl
             }
             
             // read element guideCurves
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/guideCurves")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/guideCurves")) {
                 m_guideCurves = boost::in_place(m_uidMgr);
                 try {
                     m_guideCurves->ReadCPACS(tixiHandle, xpath + "/guideCurves");
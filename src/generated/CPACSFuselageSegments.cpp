@@ -55,7 +55,7 @@ namespace tigl
         void CPACSFuselageSegments::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element segment
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/segment")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/segment")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/segment", m_segments, reinterpret_cast<CCPACSFuselageSegments*>(this), m_uidMgr);
             }
             
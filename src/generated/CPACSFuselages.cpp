@@ -60,7 +60,7 @@ namespace tigl
         void CPACSFuselages::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element fuselage
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/fuselage")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/fuselage")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/fuselage", m_fuselages, reinterpret_cast<CCPACSFuselages*>(this), m_uidMgr);
             }
             
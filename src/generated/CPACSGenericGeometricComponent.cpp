@@ -58,8 +58,8 @@ namespace tigl
         void CPACSGenericGeometricComponent::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -69,13 +69,13 @@ namespace tigl
             }
             
             // read attribute symmetry
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "symmetry")) {
-                m_symmetry = stringToTiglSymmetryAxis(tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "symmetry"));
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "symmetry")) {
+                m_symmetry = stringToTiglSymmetryAxis(tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "symmetry"));
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -85,23 +85,23 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element parentUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
-                m_parentUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
+                m_parentUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
                 if (m_parentUID->empty()) {
                     LOG(WARNING) << "Optional element parentUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element transformation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
                 m_transformation.ReadCPACS(tixiHandle, xpath + "/transformation");
             }
             else {
@@ -109,7 +109,7 @@ namespace tigl
             }
             
             // read element linkToFile
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/linkToFile")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/linkToFile")) {
                 m_linkToFile.ReadCPACS(tixiHandle, xpath + "/linkToFile");
             }
             else {
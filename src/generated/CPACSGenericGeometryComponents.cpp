@@ -55,7 +55,7 @@ namespace tigl
         void CPACSGenericGeometryComponents::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element genericGeometryComponent
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/genericGeometryComponent")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/genericGeometryComponent")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/genericGeometryComponent", m_genericGeometryComponents, reinterpret_cast<CCPACSExternalObjects*>(this), m_uidMgr);
             }
             
@@ -47,8 +47,8 @@ namespace tigl
         void CPACSGuideCurve::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -58,8 +58,8 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -69,16 +69,16 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element guideCurveProfileUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/guideCurveProfileUID")) {
-                m_guideCurveProfileUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/guideCurveProfileUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/guideCurveProfileUID")) {
+                m_guideCurveProfileUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/guideCurveProfileUID");
                 if (m_guideCurveProfileUID.empty()) {
                     LOG(WARNING) << "Required element guideCurveProfileUID is empty at xpath " << xpath;
                 }
@@ -88,7 +88,7 @@ namespace tigl
             }
             
             // read element rXDirection
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rXDirection")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rXDirection")) {
                 m_rXDirection = boost::in_place(m_uidMgr);
                 try {
                     m_rXDirection->ReadCPACS(tixiHandle, xpath + "/rXDirection");
@@ -99,25 +99,25 @@ namespace tigl
             }
             
             // read element fromGuideCurveUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromGuideCurveUID")) {
-                m_fromGuideCurveUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/fromGuideCurveUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/fromGuideCurveUID")) {
+                m_fromGuideCurveUID_choice1 = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/fromGuideCurveUID");
                 if (m_fromGuideCurveUID_choice1->empty()) {
                     LOG(WARNING) << "Optional element fromGuideCurveUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element continuity
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/continuity")) {
-                m_continuity_choice1 = stringToCPACSGuideCurve_continuity(tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/continuity"));
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/continuity")) {
+                m_continuity_choice1 = stringToCPACSGuideCurve_continuity(tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/continuity"));
             }
             
             // read element fromRelativeCircumference
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromRelativeCircumference")) {
-                m_fromRelativeCircumference_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/fromRelativeCircumference");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/fromRelativeCircumference")) {
+                m_fromRelativeCircumference_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/fromRelativeCircumference");
             }
             
             // read element tangent
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/tangent")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/tangent")) {
                 m_tangent_choice2 = boost::in_place(m_uidMgr);
                 try {
                     m_tangent_choice2->ReadCPACS(tixiHandle, xpath + "/tangent");
@@ -128,15 +128,15 @@ namespace tigl
             }
             
             // read element toRelativeCircumference
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/toRelativeCircumference")) {
-                m_toRelativeCircumference = tixi::TixiGetElement<double>(tixiHandle, xpath + "/toRelativeCircumference");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/toRelativeCircumference")) {
+                m_toRelativeCircumference = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/toRelativeCircumference");
             }
             else {
                 LOG(ERROR) << "Required element toRelativeCircumference is missing at xpath " << xpath;
             }
             
             // read element tangent
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/tangent")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/tangent")) {
                 m_tangent = boost::in_place(m_uidMgr);
                 try {
                     m_tangent->ReadCPACS(tixiHandle, xpath + "/tangent");
@@ -44,7 +44,7 @@ namespace tigl
         void CPACSGuideCurveProfiles::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element guideCurveProfile
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/guideCurveProfile")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/guideCurveProfile")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/guideCurveProfile", m_guideCurveProfiles, m_uidMgr);
             }
             
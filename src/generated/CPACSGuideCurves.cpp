@@ -44,7 +44,7 @@ namespace tigl
         void CPACSGuideCurves::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element guideCurve
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/guideCurve")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/guideCurve")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/guideCurve", m_guideCurves, m_uidMgr);
             }
             
@@ -32,8 +32,8 @@ namespace tigl
         void CPACSHeader::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -43,16 +43,16 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element creator
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/creator")) {
-                m_creator = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/creator");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/creator")) {
+                m_creator = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/creator");
                 if (m_creator.empty()) {
                     LOG(WARNING) << "Required element creator is empty at xpath " << xpath;
                 }
@@ -62,16 +62,16 @@ namespace tigl
             }
             
             // read element timestamp
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/timestamp")) {
-                m_timestamp = tixi::TixiGetElement<std::time_t>(tixiHandle, xpath + "/timestamp");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/timestamp")) {
+                m_timestamp = tixi::cursor::TixiGetElement<std::time_t>(tixiHandle, xpath + "/timestamp");
             }
             else {
                 LOG(ERROR) << "Required element timestamp is missing at xpath " << xpath;
             }
             
             // read element version
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/version")) {
-                m_version = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/version");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/version")) {
+                m_version = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/version");
                 if (m_version.empty()) {
                     LOG(WARNING) << "Required element version is empty at xpath " << xpath;
                 }
@@ -81,8 +81,8 @@ namespace tigl
             }
             
             // read element cpacsVersion
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/cpacsVersion")) {
-                m_cpacsVersion = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/cpacsVersion");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/cpacsVersion")) {
+                m_cpacsVersion = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/cpacsVersion");
                 if (m_cpacsVersion.empty()) {
                     LOG(WARNING) << "Required element cpacsVersion is empty at xpath " << xpath;
                 }
@@ -92,7 +92,7 @@ namespace tigl
             }
             
             // read element updates
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/updates")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/updates")) {
                 m_updates = boost::in_place();
                 try {
                     m_updates->ReadCPACS(tixiHandle, xpath + "/updates");
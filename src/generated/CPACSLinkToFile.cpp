@@ -31,8 +31,8 @@ namespace tigl
         void CPACSLinkToFile::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read fundamental type base class 
-            if (tixi::TixiCheckElement(tixiHandle, xpath)) {
-                m_base = tixi::TixiGetElement<std::string>(tixiHandle, xpath);
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath)) {
+                m_base = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath);
                 if (m_base.empty()) {
                     LOG(WARNING) << "Required element  is empty at xpath " << xpath;
                 }
@@ -42,8 +42,8 @@ namespace tigl
             }
             
             // read attribute format
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "format")) {
-                m_format = stringToCPACSLinkToFileType_format(tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "format"));
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "format")) {
+                m_format = stringToCPACSLinkToFileType_format(tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "format"));
             }
             
         }
@@ -50,8 +50,8 @@ namespace tigl
         void CPACSMaterial::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -61,8 +61,8 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -72,59 +72,59 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element rho
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rho")) {
-                m_rho = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rho");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rho")) {
+                m_rho = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/rho");
             }
             else {
                 LOG(ERROR) << "Required element rho is missing at xpath " << xpath;
             }
             
             // read element k11
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k11")) {
-                m_k11 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k11");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k11")) {
+                m_k11 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k11");
             }
             else {
                 LOG(ERROR) << "Required element k11 is missing at xpath " << xpath;
             }
             
             // read element k12
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k12")) {
-                m_k12 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k12");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k12")) {
+                m_k12 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k12");
             }
             else {
                 LOG(ERROR) << "Required element k12 is missing at xpath " << xpath;
             }
             
             // read element maxStrain
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/maxStrain")) {
-                m_maxStrain = tixi::TixiGetElement<double>(tixiHandle, xpath + "/maxStrain");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/maxStrain")) {
+                m_maxStrain = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/maxStrain");
             }
             
             // read element fatigueFactor
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/fatigueFactor")) {
-                m_fatigueFactor = tixi::TixiGetElement<double>(tixiHandle, xpath + "/fatigueFactor");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/fatigueFactor")) {
+                m_fatigueFactor = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/fatigueFactor");
             }
             
             // read element postFailure
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/postFailure")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/postFailure")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/postFailure", m_postFailures);
             }
             
             // read element thermalConductivity
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/thermalConductivity")) {
-                m_thermalConductivity = tixi::TixiGetElement<double>(tixiHandle, xpath + "/thermalConductivity");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/thermalConductivity")) {
+                m_thermalConductivity = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/thermalConductivity");
             }
             
             // read element specificHeatMap
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/specificHeatMap")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/specificHeatMap")) {
                 m_specificHeatMap = boost::in_place();
                 try {
                     m_specificHeatMap->ReadCPACS(tixiHandle, xpath + "/specificHeatMap");
@@ -135,7 +135,7 @@ namespace tigl
             }
             
             // read element emissivityMap
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/emissivityMap")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/emissivityMap")) {
                 m_emissivityMap = boost::in_place();
                 try {
                     m_emissivityMap->ReadCPACS(tixiHandle, xpath + "/emissivityMap");
@@ -146,148 +146,148 @@ namespace tigl
             }
             
             // read element sig11
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11")) {
-                m_sig11_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig11")) {
+                m_sig11_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig11");
             }
             
             // read element tau12
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau12")) {
-                m_tau12_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau12");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/tau12")) {
+                m_tau12_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/tau12");
             }
             
             // read element sig11yieldT
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11yieldT")) {
-                m_sig11yieldT_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11yieldT");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig11yieldT")) {
+                m_sig11yieldT_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig11yieldT");
             }
             
             // read element sig11yieldC
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11yieldC")) {
-                m_sig11yieldC_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11yieldC");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig11yieldC")) {
+                m_sig11yieldC_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig11yieldC");
             }
             
             // read element k22
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k22")) {
-                m_k22_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k22");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k22")) {
+                m_k22_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k22");
             }
             
             // read element k23
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k23")) {
-                m_k23_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k23");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k23")) {
+                m_k23_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k23");
             }
             
             // read element k66
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k66")) {
-                m_k66_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k66");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k66")) {
+                m_k66_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k66");
             }
             
             // read element sig11t
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11t")) {
-                m_sig11t_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11t");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig11t")) {
+                m_sig11t_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig11t");
             }
             
             // read element sig11c
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11c")) {
-                m_sig11c_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11c");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig11c")) {
+                m_sig11c_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig11c");
             }
             
             // read element sig22t
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig22t")) {
-                m_sig22t_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig22t");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig22t")) {
+                m_sig22t_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig22t");
             }
             
             // read element sig22c
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig22c")) {
-                m_sig22c_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig22c");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig22c")) {
+                m_sig22c_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig22c");
             }
             
             // read element tau12
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau12")) {
-                m_tau12_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau12");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/tau12")) {
+                m_tau12_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/tau12");
             }
             
             // read element tau23
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau23")) {
-                m_tau23_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau23");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/tau23")) {
+                m_tau23_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/tau23");
             }
             
             // read element k13
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k13")) {
-                m_k13_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k13");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k13")) {
+                m_k13_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k13");
             }
             
             // read element k22
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k22")) {
-                m_k22_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k22");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k22")) {
+                m_k22_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k22");
             }
             
             // read element k23
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k23")) {
-                m_k23_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k23");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k23")) {
+                m_k23_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k23");
             }
             
             // read element k33
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k33")) {
-                m_k33_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k33");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k33")) {
+                m_k33_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k33");
             }
             
             // read element k44
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k44")) {
-                m_k44_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k44");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k44")) {
+                m_k44_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k44");
             }
             
             // read element k55
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k55")) {
-                m_k55_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k55");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k55")) {
+                m_k55_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k55");
             }
             
             // read element k66
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/k66")) {
-                m_k66_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/k66");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/k66")) {
+                m_k66_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/k66");
             }
             
             // read element sig11t
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11t")) {
-                m_sig11t_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11t");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig11t")) {
+                m_sig11t_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig11t");
             }
             
             // read element sig11c
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig11c")) {
-                m_sig11c_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig11c");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig11c")) {
+                m_sig11c_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig11c");
             }
             
             // read element sig22t
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig22t")) {
-                m_sig22t_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig22t");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig22t")) {
+                m_sig22t_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig22t");
             }
             
             // read element sig22c
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig22c")) {
-                m_sig22c_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig22c");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig22c")) {
+                m_sig22c_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig22c");
             }
             
             // read element sig33t
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig33t")) {
-                m_sig33t_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig33t");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig33t")) {
+                m_sig33t_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig33t");
             }
             
             // read element sig33c
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sig33c")) {
-                m_sig33c_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sig33c");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sig33c")) {
+                m_sig33c_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sig33c");
             }
             
             // read element tau12
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau12")) {
-                m_tau12_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau12");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/tau12")) {
+                m_tau12_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/tau12");
             }
             
             // read element tau13
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau13")) {
-                m_tau13_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau13");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/tau13")) {
+                m_tau13_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/tau13");
             }
             
             // read element tau23
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/tau23")) {
-                m_tau23_choice3 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tau23");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/tau23")) {
+                m_tau23_choice3 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/tau23");
             }
             
             if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
@@ -31,34 +31,34 @@ namespace tigl
         void CPACSMaterialDefinition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element compositeUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/compositeUID")) {
-                m_compositeUID_choice1 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/compositeUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/compositeUID")) {
+                m_compositeUID_choice1 = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/compositeUID");
                 if (m_compositeUID_choice1->empty()) {
                     LOG(WARNING) << "Optional element compositeUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element orthotropyDirection
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/orthotropyDirection")) {
-                m_orthotropyDirection_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/orthotropyDirection");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/orthotropyDirection")) {
+                m_orthotropyDirection_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/orthotropyDirection");
             }
             
             // read element thicknessScaling
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/thicknessScaling")) {
-                m_thicknessScaling_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/thicknessScaling");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/thicknessScaling")) {
+                m_thicknessScaling_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/thicknessScaling");
             }
             
             // read element materialUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/materialUID")) {
-                m_materialUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/materialUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/materialUID")) {
+                m_materialUID_choice2 = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/materialUID");
                 if (m_materialUID_choice2->empty()) {
                     LOG(WARNING) << "Optional element materialUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element thickness
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/thickness")) {
-                m_thickness_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/thickness");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/thickness")) {
+                m_thickness_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/thickness");
             }
             
             if (!ValidateChoices()) {
@@ -44,12 +44,12 @@ namespace tigl
         void CPACSMaterials::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element material
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/material")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/material")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/material", m_materials, m_uidMgr);
             }
             
             // read element composites
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/composites")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/composites")) {
                 m_composites = boost::in_place(m_uidMgr);
                 try {
                     m_composites->ReadCPACS(tixiHandle, xpath + "/composites");
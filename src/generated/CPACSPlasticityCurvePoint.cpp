@@ -33,16 +33,16 @@ namespace tigl
         void CPACSPlasticityCurvePoint::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element tangentModulus
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/tangentModulus")) {
-                m_tangentModulus = tixi::TixiGetElement<double>(tixiHandle, xpath + "/tangentModulus");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/tangentModulus")) {
+                m_tangentModulus = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/tangentModulus");
             }
             else {
                 LOG(ERROR) << "Required element tangentModulus is missing at xpath " << xpath;
             }
             
             // read element trueStress
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/trueStress")) {
-                m_trueStress = tixi::TixiGetElement<double>(tixiHandle, xpath + "/trueStress");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/trueStress")) {
+                m_trueStress = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/trueStress");
             }
             else {
                 LOG(ERROR) << "Required element trueStress is missing at xpath " << xpath;
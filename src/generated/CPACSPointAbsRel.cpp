@@ -46,8 +46,8 @@ namespace tigl
         void CPACSPointAbsRel::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -57,23 +57,23 @@ namespace tigl
             }
             
             // read attribute refType
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "refType")) {
-                m_refType = stringToECPACSTranslationType(tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "refType"));
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "refType")) {
+                m_refType = stringToECPACSTranslationType(tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "refType"));
             }
             
             // read element x
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/x")) {
-                m_x = tixi::TixiGetElement<double>(tixiHandle, xpath + "/x");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/x")) {
+                m_x = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/x");
             }
             
             // read element y
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/y")) {
-                m_y = tixi::TixiGetElement<double>(tixiHandle, xpath + "/y");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/y")) {
+                m_y = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/y");
             }
             
             // read element z
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/z")) {
-                m_z = tixi::TixiGetElement<double>(tixiHandle, xpath + "/z");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/z")) {
+                m_z = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/z");
             }
             
             if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
@@ -31,7 +31,7 @@ namespace tigl
         void CPACSPointListRelXYZVector::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element rX
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rX")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rX")) {
                 m_rX.ReadCPACS(tixiHandle, xpath + "/rX");
             }
             else {
@@ -39,7 +39,7 @@ namespace tigl
             }
             
             // read element rY
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rY")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rY")) {
                 m_rY.ReadCPACS(tixiHandle, xpath + "/rY");
             }
             else {
@@ -47,7 +47,7 @@ namespace tigl
             }
             
             // read element rZ
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rZ")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rZ")) {
                 m_rZ.ReadCPACS(tixiHandle, xpath + "/rZ");
             }
             else {
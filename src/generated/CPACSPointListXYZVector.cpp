@@ -31,7 +31,7 @@ namespace tigl
         void CPACSPointListXYZVector::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element x
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/x")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/x")) {
                 m_x.ReadCPACS(tixiHandle, xpath + "/x");
             }
             else {
@@ -39,7 +39,7 @@ namespace tigl
             }
             
             // read element y
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/y")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/y")) {
                 m_y.ReadCPACS(tixiHandle, xpath + "/y");
             }
             else {
@@ -47,7 +47,7 @@ namespace tigl
             }
             
             // read element z
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/z")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/z")) {
                 m_z.ReadCPACS(tixiHandle, xpath + "/z");
             }
             else {
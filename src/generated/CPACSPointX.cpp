@@ -47,8 +47,8 @@ namespace tigl
         void CPACSPointX::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -58,8 +58,8 @@ namespace tigl
             }
             
             // read element x
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/x")) {
-                m_x = tixi::TixiGetElement<double>(tixiHandle, xpath + "/x");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/x")) {
+                m_x = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/x");
             }
             else {
                 LOG(ERROR) << "Required element x is missing at xpath " << xpath;
@@ -49,8 +49,8 @@ namespace tigl
         void CPACSPositioning::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -60,8 +60,8 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -71,48 +71,48 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element length
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/length")) {
-                m_length = tixi::TixiGetElement<double>(tixiHandle, xpath + "/length");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/length")) {
+                m_length = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/length");
             }
             else {
                 LOG(ERROR) << "Required element length is missing at xpath " << xpath;
             }
             
             // read element sweepAngle
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sweepAngle")) {
-                m_sweepAngle = tixi::TixiGetElement<double>(tixiHandle, xpath + "/sweepAngle");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sweepAngle")) {
+                m_sweepAngle = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/sweepAngle");
             }
             else {
                 LOG(ERROR) << "Required element sweepAngle is missing at xpath " << xpath;
             }
             
             // read element dihedralAngle
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/dihedralAngle")) {
-                m_dihedralAngle = tixi::TixiGetElement<double>(tixiHandle, xpath + "/dihedralAngle");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/dihedralAngle")) {
+                m_dihedralAngle = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/dihedralAngle");
             }
             else {
                 LOG(ERROR) << "Required element dihedralAngle is missing at xpath " << xpath;
             }
             
             // read element fromSectionUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromSectionUID")) {
-                m_fromSectionUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/fromSectionUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/fromSectionUID")) {
+                m_fromSectionUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/fromSectionUID");
                 if (m_fromSectionUID->empty()) {
                     LOG(WARNING) << "Optional element fromSectionUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element toSectionUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/toSectionUID")) {
-                m_toSectionUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/toSectionUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/toSectionUID")) {
+                m_toSectionUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/toSectionUID");
                 if (m_toSectionUID.empty()) {
                     LOG(WARNING) << "Required element toSectionUID is empty at xpath " << xpath;
                 }
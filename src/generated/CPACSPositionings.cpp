@@ -44,7 +44,7 @@ namespace tigl
         void CPACSPositionings::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element positioning
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/positioning")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/positioning")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/positioning", m_positionings, m_uidMgr);
             }
             
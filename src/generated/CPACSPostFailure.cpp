@@ -32,62 +32,62 @@ namespace tigl
         void CPACSPostFailure::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name->empty()) {
                     LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
                 }
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element materialLaw
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/materialLaw")) {
-                m_materialLaw = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/materialLaw");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/materialLaw")) {
+                m_materialLaw = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/materialLaw");
                 if (m_materialLaw->empty()) {
                     LOG(WARNING) << "Optional element materialLaw is present but empty at xpath " << xpath;
                 }
             }
             
             // read element plasticEliminationStrain
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/plasticEliminationStrain")) {
-                m_plasticEliminationStrain_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/plasticEliminationStrain");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/plasticEliminationStrain")) {
+                m_plasticEliminationStrain_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/plasticEliminationStrain");
             }
             
             // read element plasticityCurvePoint
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/plasticityCurvePoint")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/plasticityCurvePoint")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/plasticityCurvePoint", m_plasticityCurvePoints_choice1);
             }
             
             // read element initialEquivalentShearStrain
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/initialEquivalentShearStrain")) {
-                m_initialEquivalentShearStrain_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/initialEquivalentShearStrain");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/initialEquivalentShearStrain")) {
+                m_initialEquivalentShearStrain_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/initialEquivalentShearStrain");
             }
             
             // read element intermediateEquivalentShearStrain
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/intermediateEquivalentShearStrain")) {
-                m_intermediateEquivalentShearStrain_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/intermediateEquivalentShearStrain");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/intermediateEquivalentShearStrain")) {
+                m_intermediateEquivalentShearStrain_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/intermediateEquivalentShearStrain");
             }
             
             // read element ultimateEquivalentShearStrain
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ultimateEquivalentShearStrain")) {
-                m_ultimateEquivalentShearStrain_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/ultimateEquivalentShearStrain");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ultimateEquivalentShearStrain")) {
+                m_ultimateEquivalentShearStrain_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/ultimateEquivalentShearStrain");
             }
             
             // read element intermediateDamage
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/intermediateDamage")) {
-                m_intermediateDamage_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/intermediateDamage");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/intermediateDamage")) {
+                m_intermediateDamage_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/intermediateDamage");
             }
             
             // read element ultimateDamage
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ultimateDamage")) {
-                m_ultimateDamage_choice2 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/ultimateDamage");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ultimateDamage")) {
+                m_ultimateDamage_choice2 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/ultimateDamage");
             }
             
             if (!ValidateChoices()) {
@@ -46,13 +46,13 @@ namespace tigl
         void CPACSProfileGeometry::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute symmetry
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "symmetry")) {
-                m_symmetry = stringToTiglSymmetryAxis(tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "symmetry"));
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "symmetry")) {
+                m_symmetry = stringToTiglSymmetryAxis(tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "symmetry"));
             }
             
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -62,8 +62,8 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -73,15 +73,15 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element pointList
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/pointList")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/pointList")) {
                 m_pointList_choice1 = boost::in_place();
                 try {
                     m_pointList_choice1->ReadCPACS(tixiHandle, xpath + "/pointList");
@@ -92,7 +92,7 @@ namespace tigl
             }
             
             // read element cst2D
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/cst2D")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/cst2D")) {
                 m_cst2D_choice2 = boost::in_place();
                 try {
                     m_cst2D_choice2->ReadCPACS(tixiHandle, xpath + "/cst2D");
@@ -43,7 +43,7 @@ namespace tigl
         void CPACSProfiles::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element fuselageProfiles
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/fuselageProfiles")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/fuselageProfiles")) {
                 m_fuselageProfiles = boost::in_place(m_uidMgr);
                 try {
                     m_fuselageProfiles->ReadCPACS(tixiHandle, xpath + "/fuselageProfiles");
@@ -54,7 +54,7 @@ namespace tigl
             }
             
             // read element wingAirfoils
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/wingAirfoils")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/wingAirfoils")) {
                 m_wingAirfoils = boost::in_place(m_uidMgr);
                 try {
                     m_wingAirfoils->ReadCPACS(tixiHandle, xpath + "/wingAirfoils");
@@ -65,7 +65,7 @@ namespace tigl
             }
             
             // read element guideCurves
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/guideCurves")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/guideCurves")) {
                 m_guideCurves = boost::in_place(m_uidMgr);
                 try {
                     m_guideCurves->ReadCPACS(tixiHandle, xpath + "/guideCurves");
@@ -76,7 +76,7 @@ namespace tigl
             }
             
             // read element rotorAirfoils
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotorAirfoils")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotorAirfoils")) {
                 m_rotorAirfoils = boost::in_place(m_uidMgr);
                 try {
                     m_rotorAirfoils->ReadCPACS(tixiHandle, xpath + "/rotorAirfoils");
@@ -43,13 +43,13 @@ namespace tigl
         void CPACSRibRotation::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element ribRotationReference
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribRotationReference")) {
-                m_ribRotationReference = stringToCPACSRibRotation_ribRotationReference(tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/ribRotationReference"));
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribRotationReference")) {
+                m_ribRotationReference = stringToCPACSRibRotation_ribRotationReference(tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/ribRotationReference"));
             }
             
             // read element z
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/z")) {
-                m_z = tixi::TixiGetElement<double>(tixiHandle, xpath + "/z");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/z")) {
+                m_z = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/z");
             }
             else {
                 LOG(ERROR) << "Required element z is missing at xpath " << xpath;
@@ -59,8 +59,8 @@ namespace tigl
         void CPACSRotor::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -70,13 +70,13 @@ namespace tigl
             }
             
             // read attribute symmetry
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "symmetry")) {
-                m_symmetry = stringToTiglSymmetryAxis(tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "symmetry"));
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "symmetry")) {
+                m_symmetry = stringToTiglSymmetryAxis(tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "symmetry"));
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -86,33 +86,33 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element parentUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
-                m_parentUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
+                m_parentUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
                 if (m_parentUID->empty()) {
                     LOG(WARNING) << "Optional element parentUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element type
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/type")) {
-                m_type = stringToCPACSRotor_type(tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/type"));
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/type")) {
+                m_type = stringToCPACSRotor_type(tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/type"));
             }
             
             // read element nominalRotationsPerMinute
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/nominalRotationsPerMinute")) {
-                m_nominalRotationsPerMinute = tixi::TixiGetElement<double>(tixiHandle, xpath + "/nominalRotationsPerMinute");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/nominalRotationsPerMinute")) {
+                m_nominalRotationsPerMinute = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/nominalRotationsPerMinute");
             }
             
             // read element transformation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
                 m_transformation.ReadCPACS(tixiHandle, xpath + "/transformation");
             }
             else {
@@ -120,7 +120,7 @@ namespace tigl
             }
             
             // read element rotorHub
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotorHub")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotorHub")) {
                 m_rotorHub.ReadCPACS(tixiHandle, xpath + "/rotorHub");
             }
             else {
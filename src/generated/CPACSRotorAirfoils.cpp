@@ -44,7 +44,7 @@ namespace tigl
         void CPACSRotorAirfoils::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element rotorAirfoil
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotorAirfoil")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotorAirfoil")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/rotorAirfoil", m_rotorAirfoils, m_uidMgr);
             }
             
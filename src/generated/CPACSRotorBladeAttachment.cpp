@@ -57,8 +57,8 @@ namespace tigl
         void CPACSRotorBladeAttachment::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -68,23 +68,23 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name->empty()) {
                     LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
                 }
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element hinges
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/hinges")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/hinges")) {
                 m_hinges = boost::in_place(reinterpret_cast<CCPACSRotorBladeAttachment*>(this), m_uidMgr);
                 try {
                     m_hinges->ReadCPACS(tixiHandle, xpath + "/hinges");
@@ -95,8 +95,8 @@ namespace tigl
             }
             
             // read element rotorBladeUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotorBladeUID")) {
-                m_rotorBladeUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/rotorBladeUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotorBladeUID")) {
+                m_rotorBladeUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/rotorBladeUID");
                 if (m_rotorBladeUID.empty()) {
                     LOG(WARNING) << "Required element rotorBladeUID is empty at xpath " << xpath;
                 }
@@ -106,7 +106,7 @@ namespace tigl
             }
             
             // read element azimuthAngles
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/azimuthAngles")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/azimuthAngles")) {
                 m_azimuthAngles_choice1 = boost::in_place();
                 try {
                     m_azimuthAngles_choice1->ReadCPACS(tixiHandle, xpath + "/azimuthAngles");
@@ -117,8 +117,8 @@ namespace tigl
             }
             
             // read element numberOfBlades
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/numberOfBlades")) {
-                m_numberOfBlades_choice2 = tixi::TixiGetElement<int>(tixiHandle, xpath + "/numberOfBlades");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/numberOfBlades")) {
+                m_numberOfBlades_choice2 = tixi::cursor::TixiGetElement<int>(tixiHandle, xpath + "/numberOfBlades");
             }
             
             if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
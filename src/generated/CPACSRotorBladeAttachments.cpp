@@ -55,7 +55,7 @@ namespace tigl
         void CPACSRotorBladeAttachments::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element rotorBladeAttachment
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotorBladeAttachment")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotorBladeAttachment")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/rotorBladeAttachment", m_rotorBladeAttachments, reinterpret_cast<CCPACSRotorBladeAttachments*>(this), m_uidMgr);
             }
             
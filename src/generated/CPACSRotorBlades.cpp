@@ -55,7 +55,7 @@ namespace tigl
         void CPACSRotorBlades::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element rotorBlade
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotorBlade")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotorBlade")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/rotorBlade", m_rotorBlades, reinterpret_cast<CCPACSRotorBlades*>(this), m_uidMgr);
             }
             
@@ -58,8 +58,8 @@ namespace tigl
         void CPACSRotorHub::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -69,28 +69,28 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name->empty()) {
                     LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
                 }
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element type
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/type")) {
-                m_type = stringToTiglRotorHubType(tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/type"));
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/type")) {
+                m_type = stringToTiglRotorHubType(tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/type"));
             }
             
             // read element rotorBladeAttachments
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotorBladeAttachments")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotorBladeAttachments")) {
                 m_rotorBladeAttachments.ReadCPACS(tixiHandle, xpath + "/rotorBladeAttachments");
             }
             else {
@@ -58,8 +58,8 @@ namespace tigl
         void CPACSRotorHubHinge::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -69,23 +69,23 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name->empty()) {
                     LOG(WARNING) << "Optional element name is present but empty at xpath " << xpath;
                 }
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element transformation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
                 m_transformation.ReadCPACS(tixiHandle, xpath + "/transformation");
             }
             else {
@@ -93,31 +93,31 @@ namespace tigl
             }
             
             // read element type
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/type")) {
-                m_type = stringToCPACSRotorHubHinge_type(tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/type"));
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/type")) {
+                m_type = stringToCPACSRotorHubHinge_type(tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/type"));
             }
             else {
                 LOG(ERROR) << "Required element type is missing at xpath " << xpath;
             }
             
             // read element neutralPosition
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/neutralPosition")) {
-                m_neutralPosition = tixi::TixiGetElement<double>(tixiHandle, xpath + "/neutralPosition");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/neutralPosition")) {
+                m_neutralPosition = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/neutralPosition");
             }
             
             // read element staticStiffness
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/staticStiffness")) {
-                m_staticStiffness = tixi::TixiGetElement<double>(tixiHandle, xpath + "/staticStiffness");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/staticStiffness")) {
+                m_staticStiffness = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/staticStiffness");
             }
             
             // read element dynamicStiffness
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/dynamicStiffness")) {
-                m_dynamicStiffness = tixi::TixiGetElement<double>(tixiHandle, xpath + "/dynamicStiffness");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/dynamicStiffness")) {
+                m_dynamicStiffness = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/dynamicStiffness");
             }
             
             // read element damping
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/damping")) {
-                m_damping = tixi::TixiGetElement<double>(tixiHandle, xpath + "/damping");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/damping")) {
+                m_damping = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/damping");
             }
             
             if (m_uidMgr && !m_uID.empty()) m_uidMgr->RegisterObject(m_uID, *this);
@@ -55,7 +55,7 @@ namespace tigl
         void CPACSRotorHubHinges::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element hinge
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/hinge")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/hinge")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/hinge", m_hinges, reinterpret_cast<CCPACSRotorHinges*>(this), m_uidMgr);
             }
             
@@ -46,8 +46,8 @@ namespace tigl
         void CPACSRotorcraftModel::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -57,8 +57,8 @@ namespace tigl
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -68,15 +68,15 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element fuselages
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/fuselages")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/fuselages")) {
                 m_fuselages = boost::in_place(reinterpret_cast<CCPACSRotorcraftModel*>(this), m_uidMgr);
                 try {
                     m_fuselages->ReadCPACS(tixiHandle, xpath + "/fuselages");
@@ -87,7 +87,7 @@ namespace tigl
             }
             
             // read element wings
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/wings")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/wings")) {
                 m_wings = boost::in_place(reinterpret_cast<CCPACSRotorcraftModel*>(this), m_uidMgr);
                 try {
                     m_wings->ReadCPACS(tixiHandle, xpath + "/wings");
@@ -98,7 +98,7 @@ namespace tigl
             }
             
             // read element rotors
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotors")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotors")) {
                 m_rotors = boost::in_place(reinterpret_cast<CCPACSRotorcraftModel*>(this), m_uidMgr);
                 try {
                     m_rotors->ReadCPACS(tixiHandle, xpath + "/rotors");
@@ -109,7 +109,7 @@ namespace tigl
             }
             
             // read element rotorBlades
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotorBlades")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotorBlades")) {
                 m_rotorBlades = boost::in_place(reinterpret_cast<CCPACSRotorcraftModel*>(this), m_uidMgr);
                 try {
                     m_rotorBlades->ReadCPACS(tixiHandle, xpath + "/rotorBlades");
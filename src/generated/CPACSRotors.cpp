@@ -55,7 +55,7 @@ namespace tigl
         void CPACSRotors::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element rotor
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotor")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotor")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/rotor", m_rotors, reinterpret_cast<CCPACSRotors*>(this), m_uidMgr);
             }
             
@@ -47,8 +47,8 @@ namespace tigl
         void CPACSSparCell::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -58,7 +58,7 @@ namespace tigl
             }
             
             // read element fromEta
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromEta")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/fromEta")) {
                 m_fromEta.ReadCPACS(tixiHandle, xpath + "/fromEta");
             }
             else {
@@ -66,7 +66,7 @@ namespace tigl
             }
             
             // read element toEta
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/toEta")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/toEta")) {
                 m_toEta.ReadCPACS(tixiHandle, xpath + "/toEta");
             }
             else {
@@ -74,7 +74,7 @@ namespace tigl
             }
             
             // read element upperCap
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/upperCap")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/upperCap")) {
                 m_upperCap.ReadCPACS(tixiHandle, xpath + "/upperCap");
             }
             else {
@@ -82,7 +82,7 @@ namespace tigl
             }
             
             // read element lowerCap
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/lowerCap")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/lowerCap")) {
                 m_lowerCap.ReadCPACS(tixiHandle, xpath + "/lowerCap");
             }
             else {
@@ -90,7 +90,7 @@ namespace tigl
             }
             
             // read element web1
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/web1")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/web1")) {
                 m_web1.ReadCPACS(tixiHandle, xpath + "/web1");
             }
             else {
@@ -98,7 +98,7 @@ namespace tigl
             }
             
             // read element web2
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/web2")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/web2")) {
                 m_web2 = boost::in_place();
                 try {
                     m_web2->ReadCPACS(tixiHandle, xpath + "/web2");
@@ -109,8 +109,8 @@ namespace tigl
             }
             
             // read element rotation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotation")) {
-                m_rotation = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotation");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotation")) {
+                m_rotation = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/rotation");
             }
             else {
                 LOG(ERROR) << "Required element rotation is missing at xpath " << xpath;
@@ -44,7 +44,7 @@ namespace tigl
         void CPACSSparCells::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element sparCell
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparCell")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparCell")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/sparCell", m_sparCells, m_uidMgr);
             }
             
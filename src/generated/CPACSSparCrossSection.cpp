@@ -55,7 +55,7 @@ namespace tigl
         void CPACSSparCrossSection::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element upperCap
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/upperCap")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/upperCap")) {
                 m_upperCap = boost::in_place();
                 try {
                     m_upperCap->ReadCPACS(tixiHandle, xpath + "/upperCap");
@@ -66,7 +66,7 @@ namespace tigl
             }
             
             // read element lowerCap
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/lowerCap")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/lowerCap")) {
                 m_lowerCap = boost::in_place();
                 try {
                     m_lowerCap->ReadCPACS(tixiHandle, xpath + "/lowerCap");
@@ -77,7 +77,7 @@ namespace tigl
             }
             
             // read element web1
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/web1")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/web1")) {
                 m_web1.ReadCPACS(tixiHandle, xpath + "/web1");
             }
             else {
@@ -85,7 +85,7 @@ namespace tigl
             }
             
             // read element web2
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/web2")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/web2")) {
                 m_web2 = boost::in_place();
                 try {
                     m_web2->ReadCPACS(tixiHandle, xpath + "/web2");
@@ -96,7 +96,7 @@ namespace tigl
             }
             
             // read element sparCells
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparCells")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparCells")) {
                 m_sparCells = boost::in_place(m_uidMgr);
                 try {
                     m_sparCells->ReadCPACS(tixiHandle, xpath + "/sparCells");
@@ -107,8 +107,8 @@ namespace tigl
             }
             
             // read element rotation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotation")) {
-                m_rotation = tixi::TixiGetElement<double>(tixiHandle, xpath + "/rotation");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotation")) {
+                m_rotation = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/rotation");
             }
             else {
                 LOG(ERROR) << "Required element rotation is missing at xpath " << xpath;
@@ -58,29 +58,29 @@ namespace tigl
         void CPACSSparPosition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID->empty()) {
                     LOG(WARNING) << "Optional attribute uID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element xsi
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/xsi")) {
-                m_xsi = tixi::TixiGetElement<double>(tixiHandle, xpath + "/xsi");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/xsi")) {
+                m_xsi = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/xsi");
             }
             else {
                 LOG(ERROR) << "Required element xsi is missing at xpath " << xpath;
             }
             
             // read element eta
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/eta")) {
-                m_eta_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/eta");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/eta")) {
+                m_eta_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/eta");
             }
             
             // read element elementUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/elementUID")) {
-                m_elementUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/elementUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/elementUID")) {
+                m_elementUID_choice2 = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/elementUID");
                 if (m_elementUID_choice2->empty()) {
                     LOG(WARNING) << "Optional element elementUID is present but empty at xpath " << xpath;
                 }
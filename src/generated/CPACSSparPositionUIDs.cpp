@@ -31,7 +31,7 @@ namespace tigl
         void CPACSSparPositionUIDs::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element sparPositionUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparPositionUID")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparPositionUID")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/sparPositionUID", m_sparPositionUIDs);
             }
             
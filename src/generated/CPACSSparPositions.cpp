@@ -55,7 +55,7 @@ namespace tigl
         void CPACSSparPositions::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element sparPosition
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparPosition")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparPosition")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/sparPosition", m_sparPositions, reinterpret_cast<CCPACSWingSparPositions*>(this), m_uidMgr);
             }
             
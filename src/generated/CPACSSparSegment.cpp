@@ -58,16 +58,16 @@ namespace tigl
         void CPACSSparSegment::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID->empty()) {
                     LOG(WARNING) << "Optional attribute uID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -77,8 +77,8 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description.empty()) {
                     LOG(WARNING) << "Required element description is empty at xpath " << xpath;
                 }
@@ -88,7 +88,7 @@ namespace tigl
             }
             
             // read element sparPositionUIDs
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparPositionUIDs")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparPositionUIDs")) {
                 m_sparPositionUIDs.ReadCPACS(tixiHandle, xpath + "/sparPositionUIDs");
             }
             else {
@@ -96,7 +96,7 @@ namespace tigl
             }
             
             // read element sparCrossSection
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparCrossSection")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparCrossSection")) {
                 m_sparCrossSection.ReadCPACS(tixiHandle, xpath + "/sparCrossSection");
             }
             else {
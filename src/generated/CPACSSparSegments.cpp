@@ -55,7 +55,7 @@ namespace tigl
         void CPACSSparSegments::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element sparSegment
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparSegment")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparSegment")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/sparSegment", m_sparSegments, reinterpret_cast<CCPACSWingSparSegments*>(this), m_uidMgr);
             }
             
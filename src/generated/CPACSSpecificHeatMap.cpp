@@ -31,7 +31,7 @@ namespace tigl
         void CPACSSpecificHeatMap::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element temperature
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/temperature")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/temperature")) {
                 m_temperature.ReadCPACS(tixiHandle, xpath + "/temperature");
             }
             else {
@@ -39,7 +39,7 @@ namespace tigl
             }
             
             // read element specificHeat
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/specificHeat")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/specificHeat")) {
                 m_specificHeat.ReadCPACS(tixiHandle, xpath + "/specificHeat");
             }
             else {
@@ -31,8 +31,8 @@ namespace tigl
         void CPACSStringVectorBase::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute mapType
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "mapType")) {
-                m_mapType = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "mapType");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "mapType")) {
+                m_mapType = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "mapType");
                 if (m_mapType.empty()) {
                     LOG(WARNING) << "Required attribute mapType is empty at xpath " << xpath;
                 }
@@ -42,64 +42,64 @@ namespace tigl
             }
             
             // read attribute mu
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "mu")) {
-                m_mu = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "mu");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "mu")) {
+                m_mu = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "mu");
                 if (m_mu->empty()) {
                     LOG(WARNING) << "Optional attribute mu is present but empty at xpath " << xpath;
                 }
             }
             
             // read attribute delta
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "delta")) {
-                m_delta = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "delta");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "delta")) {
+                m_delta = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "delta");
                 if (m_delta->empty()) {
                     LOG(WARNING) << "Optional attribute delta is present but empty at xpath " << xpath;
                 }
             }
             
             // read attribute a
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "a")) {
-                m_a = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "a");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "a")) {
+                m_a = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "a");
                 if (m_a->empty()) {
                     LOG(WARNING) << "Optional attribute a is present but empty at xpath " << xpath;
                 }
             }
             
             // read attribute b
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "b")) {
-                m_b = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "b");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "b")) {
+                m_b = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "b");
                 if (m_b->empty()) {
                     LOG(WARNING) << "Optional attribute b is present but empty at xpath " << xpath;
                 }
             }
             
             // read attribute c
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "c")) {
-                m_c = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "c");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "c")) {
+                m_c = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "c");
                 if (m_c->empty()) {
                     LOG(WARNING) << "Optional attribute c is present but empty at xpath " << xpath;
                 }
             }
             
             // read attribute v
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "v")) {
-                m_v = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "v");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "v")) {
+                m_v = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "v");
                 if (m_v->empty()) {
                     LOG(WARNING) << "Optional attribute v is present but empty at xpath " << xpath;
                 }
             }
             
             // read attribute w
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "w")) {
-                m_w = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "w");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "w")) {
+                m_w = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "w");
                 if (m_w->empty()) {
                     LOG(WARNING) << "Optional attribute w is present but empty at xpath " << xpath;
                 }
             }
             
             // read simpleContent 
-            if (tixi::TixiCheckElement(tixiHandle, xpath)) {
-                m_simpleContent = tixi::TixiGetElement<std::string>(tixiHandle, xpath);
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath)) {
+                m_simpleContent = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath);
                 if (m_simpleContent.empty()) {
                     LOG(WARNING) << "Required element  is empty at xpath " << xpath;
                 }
@@ -31,8 +31,8 @@ namespace tigl
         void CPACSTool::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -42,8 +42,8 @@ namespace tigl
             }
             
             // read element version
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/version")) {
-                m_version = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/version");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/version")) {
+                m_version = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/version");
                 if (m_version.empty()) {
                     LOG(WARNING) << "Required element version is empty at xpath " << xpath;
                 }
@@ -31,7 +31,7 @@ namespace tigl
         void CPACSToolspecific::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element cFD
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/cFD")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/cFD")) {
                 m_cFD = boost::in_place();
                 try {
                     m_cFD->ReadCPACS(tixiHandle, xpath + "/cFD");
@@ -46,8 +46,8 @@ namespace tigl
         void CPACSTransformation::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -57,7 +57,7 @@ namespace tigl
             }
             
             // read element scaling
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/scaling")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/scaling")) {
                 m_scaling = boost::in_place(m_uidMgr);
                 try {
                     m_scaling->ReadCPACS(tixiHandle, xpath + "/scaling");
@@ -68,7 +68,7 @@ namespace tigl
             }
             
             // read element rotation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotation")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotation")) {
                 m_rotation = boost::in_place(m_uidMgr);
                 try {
                     m_rotation->ReadCPACS(tixiHandle, xpath + "/rotation");
@@ -79,7 +79,7 @@ namespace tigl
             }
             
             // read element translation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/translation")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/translation")) {
                 m_translation = boost::in_place(m_uidMgr);
                 try {
                     m_translation->ReadCPACS(tixiHandle, xpath + "/translation");
@@ -32,8 +32,8 @@ namespace tigl
         void CPACSUpdate::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element modification
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/modification")) {
-                m_modification = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/modification");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/modification")) {
+                m_modification = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/modification");
                 if (m_modification.empty()) {
                     LOG(WARNING) << "Required element modification is empty at xpath " << xpath;
                 }
@@ -43,8 +43,8 @@ namespace tigl
             }
             
             // read element creator
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/creator")) {
-                m_creator = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/creator");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/creator")) {
+                m_creator = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/creator");
                 if (m_creator.empty()) {
                     LOG(WARNING) << "Required element creator is empty at xpath " << xpath;
                 }
@@ -54,16 +54,16 @@ namespace tigl
             }
             
             // read element timestamp
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/timestamp")) {
-                m_timestamp = tixi::TixiGetElement<std::time_t>(tixiHandle, xpath + "/timestamp");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/timestamp")) {
+                m_timestamp = tixi::cursor::TixiGetElement<std::time_t>(tixiHandle, xpath + "/timestamp");
             }
             else {
                 LOG(ERROR) << "Required element timestamp is missing at xpath " << xpath;
             }
             
             // read element version
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/version")) {
-                m_version = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/version");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/version")) {
+                m_version = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/version");
                 if (m_version.empty()) {
                     LOG(WARNING) << "Required element version is empty at xpath " << xpath;
                 }
@@ -73,8 +73,8 @@ namespace tigl
             }
             
             // read element cpacsVersion
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/cpacsVersion")) {
-                m_cpacsVersion = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/cpacsVersion");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/cpacsVersion")) {
+                m_cpacsVersion = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/cpacsVersion");
                 if (m_cpacsVersion.empty()) {
                     LOG(WARNING) << "Required element cpacsVersion is empty at xpath " << xpath;
                 }
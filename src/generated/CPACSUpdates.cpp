@@ -32,7 +32,7 @@ namespace tigl
         void CPACSUpdates::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element update
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/update")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/update")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/update", m_updates);
             }
             
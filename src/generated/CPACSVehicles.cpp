@@ -43,7 +43,7 @@ namespace tigl
         void CPACSVehicles::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element aircraft
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/aircraft")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/aircraft")) {
                 m_aircraft = boost::in_place(m_uidMgr);
                 try {
                     m_aircraft->ReadCPACS(tixiHandle, xpath + "/aircraft");
@@ -54,7 +54,7 @@ namespace tigl
             }
             
             // read element rotorcraft
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/rotorcraft")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/rotorcraft")) {
                 m_rotorcraft = boost::in_place(m_uidMgr);
                 try {
                     m_rotorcraft->ReadCPACS(tixiHandle, xpath + "/rotorcraft");
@@ -65,7 +65,7 @@ namespace tigl
             }
             
             // read element profiles
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/profiles")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/profiles")) {
                 m_profiles = boost::in_place(m_uidMgr);
                 try {
                     m_profiles->ReadCPACS(tixiHandle, xpath + "/profiles");
@@ -76,7 +76,7 @@ namespace tigl
             }
             
             // read element materials
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/materials")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/materials")) {
                 m_materials = boost::in_place(m_uidMgr);
                 try {
                     m_materials->ReadCPACS(tixiHandle, xpath + "/materials");
@@ -32,7 +32,7 @@ namespace tigl
         void CPACSWeb::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element material
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/material")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/material")) {
                 m_material.ReadCPACS(tixiHandle, xpath + "/material");
             }
             else {
@@ -40,8 +40,8 @@ namespace tigl
             }
             
             // read element relPos
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/relPos")) {
-                m_relPos = tixi::TixiGetElement<double>(tixiHandle, xpath + "/relPos");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/relPos")) {
+                m_relPos = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/relPos");
             }
             else {
                 LOG(ERROR) << "Required element relPos is missing at xpath " << xpath;
@@ -68,8 +68,8 @@ namespace tigl
         void CPACSWing::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -79,13 +79,13 @@ namespace tigl
             }
             
             // read attribute symmetry
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "symmetry")) {
-                m_symmetry = stringToTiglSymmetryAxis(tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "symmetry"));
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "symmetry")) {
+                m_symmetry = stringToTiglSymmetryAxis(tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "symmetry"));
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -95,23 +95,23 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element parentUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
-                m_parentUID = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/parentUID")) {
+                m_parentUID = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/parentUID");
                 if (m_parentUID->empty()) {
                     LOG(WARNING) << "Optional element parentUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element transformation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/transformation")) {
                 m_transformation.ReadCPACS(tixiHandle, xpath + "/transformation");
             }
             else {
@@ -119,7 +119,7 @@ namespace tigl
             }
             
             // read element sections
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sections")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sections")) {
                 m_sections.ReadCPACS(tixiHandle, xpath + "/sections");
             }
             else {
@@ -127,7 +127,7 @@ namespace tigl
             }
             
             // read element positionings
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/positionings")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/positionings")) {
                 m_positionings = boost::in_place(m_uidMgr);
                 try {
                     m_positionings->ReadCPACS(tixiHandle, xpath + "/positionings");
@@ -138,7 +138,7 @@ namespace tigl
             }
             
             // read element segments
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/segments")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/segments")) {
                 m_segments.ReadCPACS(tixiHandle, xpath + "/segments");
             }
             else {
@@ -146,7 +146,7 @@ namespace tigl
             }
             
             // read element componentSegments
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/componentSegments")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/componentSegments")) {
                 m_componentSegments = boost::in_place(reinterpret_cast<CCPACSWing*>(this), m_uidMgr);
                 try {
                     m_componentSegments->ReadCPACS(tixiHandle, xpath + "/componentSegments");
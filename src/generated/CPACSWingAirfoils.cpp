@@ -44,7 +44,7 @@ namespace tigl
         void CPACSWingAirfoils::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element wingAirfoil
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/wingAirfoil")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/wingAirfoil")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/wingAirfoil", m_wingAirfoils, m_uidMgr);
             }
             
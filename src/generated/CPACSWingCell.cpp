@@ -61,8 +61,8 @@ namespace tigl
         void CPACSWingCell::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -72,7 +72,7 @@ namespace tigl
             }
             
             // read element skin
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/skin")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/skin")) {
                 m_skin.ReadCPACS(tixiHandle, xpath + "/skin");
             }
             else {
@@ -80,7 +80,7 @@ namespace tigl
             }
             
             // read element positioningLeadingEdge
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/positioningLeadingEdge")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/positioningLeadingEdge")) {
                 m_positioningLeadingEdge.ReadCPACS(tixiHandle, xpath + "/positioningLeadingEdge");
             }
             else {
@@ -88,7 +88,7 @@ namespace tigl
             }
             
             // read element positioningTrailingEdge
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/positioningTrailingEdge")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/positioningTrailingEdge")) {
                 m_positioningTrailingEdge.ReadCPACS(tixiHandle, xpath + "/positioningTrailingEdge");
             }
             else {
@@ -96,7 +96,7 @@ namespace tigl
             }
             
             // read element positioningInnerBorder
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/positioningInnerBorder")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/positioningInnerBorder")) {
                 m_positioningInnerBorder.ReadCPACS(tixiHandle, xpath + "/positioningInnerBorder");
             }
             else {
@@ -104,7 +104,7 @@ namespace tigl
             }
             
             // read element positioningOuterBorder
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/positioningOuterBorder")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/positioningOuterBorder")) {
                 m_positioningOuterBorder.ReadCPACS(tixiHandle, xpath + "/positioningOuterBorder");
             }
             else {
@@ -55,7 +55,7 @@ namespace tigl
         void CPACSWingCells::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element cell
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/cell")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/cell")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/cell", m_cells, reinterpret_cast<CCPACSWingCells*>(this), m_uidMgr);
             }
             
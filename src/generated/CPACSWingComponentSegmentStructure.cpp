@@ -56,7 +56,7 @@ namespace tigl
         void CPACSWingComponentSegmentStructure::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element upperShell
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/upperShell")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/upperShell")) {
                 m_upperShell.ReadCPACS(tixiHandle, xpath + "/upperShell");
             }
             else {
@@ -64,7 +64,7 @@ namespace tigl
             }
             
             // read element lowerShell
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/lowerShell")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/lowerShell")) {
                 m_lowerShell.ReadCPACS(tixiHandle, xpath + "/lowerShell");
             }
             else {
@@ -72,7 +72,7 @@ namespace tigl
             }
             
             // read element ribsDefinitions
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribsDefinitions")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribsDefinitions")) {
                 m_ribsDefinitions = boost::in_place(reinterpret_cast<CCPACSWingCSStructure*>(this), m_uidMgr);
                 try {
                     m_ribsDefinitions->ReadCPACS(tixiHandle, xpath + "/ribsDefinitions");
@@ -83,7 +83,7 @@ namespace tigl
             }
             
             // read element spars
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/spars")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/spars")) {
                 m_spars = boost::in_place(reinterpret_cast<CCPACSWingCSStructure*>(this), m_uidMgr);
                 try {
                     m_spars->ReadCPACS(tixiHandle, xpath + "/spars");
@@ -47,8 +47,8 @@ namespace tigl
         void CPACSWingRibCell::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -58,8 +58,8 @@ namespace tigl
             }
             
             // read element fromRib
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/fromRib")) {
-                m_fromRib = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/fromRib");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/fromRib")) {
+                m_fromRib = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/fromRib");
                 if (m_fromRib.empty()) {
                     LOG(WARNING) << "Required element fromRib is empty at xpath " << xpath;
                 }
@@ -69,8 +69,8 @@ namespace tigl
             }
             
             // read element toRib
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/toRib")) {
-                m_toRib = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/toRib");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/toRib")) {
+                m_toRib = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/toRib");
                 if (m_toRib.empty()) {
                     LOG(WARNING) << "Required element toRib is empty at xpath " << xpath;
                 }
@@ -80,7 +80,7 @@ namespace tigl
             }
             
             // read element ribRotation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribRotation")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribRotation")) {
                 m_ribRotation.ReadCPACS(tixiHandle, xpath + "/ribRotation");
             }
             else {
@@ -88,7 +88,7 @@ namespace tigl
             }
             
             // read element material
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/material")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/material")) {
                 m_material.ReadCPACS(tixiHandle, xpath + "/material");
             }
             else {
@@ -96,7 +96,7 @@ namespace tigl
             }
             
             // read element upperCap
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/upperCap")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/upperCap")) {
                 m_upperCap.ReadCPACS(tixiHandle, xpath + "/upperCap");
             }
             else {
@@ -104,7 +104,7 @@ namespace tigl
             }
             
             // read element lowerCap
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/lowerCap")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/lowerCap")) {
                 m_lowerCap.ReadCPACS(tixiHandle, xpath + "/lowerCap");
             }
             else {
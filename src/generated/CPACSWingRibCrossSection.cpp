@@ -54,7 +54,7 @@ namespace tigl
         void CPACSWingRibCrossSection::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element material
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/material")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/material")) {
                 m_material.ReadCPACS(tixiHandle, xpath + "/material");
             }
             else {
@@ -62,7 +62,7 @@ namespace tigl
             }
             
             // read element ribRotation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribRotation")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribRotation")) {
                 m_ribRotation = boost::in_place(m_uidMgr);
                 try {
                     m_ribRotation->ReadCPACS(tixiHandle, xpath + "/ribRotation");
@@ -73,7 +73,7 @@ namespace tigl
             }
             
             // read element ribCell
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribCell")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribCell")) {
                 m_ribCell = boost::in_place(m_uidMgr);
                 try {
                     m_ribCell->ReadCPACS(tixiHandle, xpath + "/ribCell");
@@ -84,7 +84,7 @@ namespace tigl
             }
             
             // read element upperCap
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/upperCap")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/upperCap")) {
                 m_upperCap = boost::in_place();
                 try {
                     m_upperCap->ReadCPACS(tixiHandle, xpath + "/upperCap");
@@ -95,7 +95,7 @@ namespace tigl
             }
             
             // read element lowerCap
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/lowerCap")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/lowerCap")) {
                 m_lowerCap = boost::in_place();
                 try {
                     m_lowerCap->ReadCPACS(tixiHandle, xpath + "/lowerCap");
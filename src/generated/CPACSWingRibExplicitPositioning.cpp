@@ -44,8 +44,8 @@ namespace tigl
         void CPACSWingRibExplicitPositioning::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element startReference
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/startReference")) {
-                m_startReference = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/startReference");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/startReference")) {
+                m_startReference = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/startReference");
                 if (m_startReference.empty()) {
                     LOG(WARNING) << "Required element startReference is empty at xpath " << xpath;
                 }
@@ -55,16 +55,16 @@ namespace tigl
             }
             
             // read element etaStart
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/etaStart")) {
-                m_etaStart = tixi::TixiGetElement<double>(tixiHandle, xpath + "/etaStart");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/etaStart")) {
+                m_etaStart = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/etaStart");
             }
             else {
                 LOG(ERROR) << "Required element etaStart is missing at xpath " << xpath;
             }
             
             // read element endReference
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/endReference")) {
-                m_endReference = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/endReference");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/endReference")) {
+                m_endReference = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/endReference");
                 if (m_endReference.empty()) {
                     LOG(WARNING) << "Required element endReference is empty at xpath " << xpath;
                 }
@@ -74,8 +74,8 @@ namespace tigl
             }
             
             // read element etaEnd
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/etaEnd")) {
-                m_etaEnd = tixi::TixiGetElement<double>(tixiHandle, xpath + "/etaEnd");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/etaEnd")) {
+                m_etaEnd = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/etaEnd");
             }
             else {
                 LOG(ERROR) << "Required element etaEnd is missing at xpath " << xpath;
@@ -58,16 +58,16 @@ namespace tigl
         void CPACSWingRibsDefinition::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID->empty()) {
                     LOG(WARNING) << "Optional attribute uID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element name
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/name")) {
-                m_name = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/name")) {
+                m_name = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/name");
                 if (m_name.empty()) {
                     LOG(WARNING) << "Required element name is empty at xpath " << xpath;
                 }
@@ -77,15 +77,15 @@ namespace tigl
             }
             
             // read element description
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/description")) {
-                m_description = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/description")) {
+                m_description = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/description");
                 if (m_description->empty()) {
                     LOG(WARNING) << "Optional element description is present but empty at xpath " << xpath;
                 }
             }
             
             // read element ribCrossSection
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribCrossSection")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribCrossSection")) {
                 m_ribCrossSection.ReadCPACS(tixiHandle, xpath + "/ribCrossSection");
             }
             else {
@@ -93,7 +93,7 @@ namespace tigl
             }
             
             // read element ribsPositioning
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribsPositioning")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribsPositioning")) {
                 m_ribsPositioning_choice1 = boost::in_place(reinterpret_cast<CCPACSWingRibsDefinition*>(this));
                 try {
                     m_ribsPositioning_choice1->ReadCPACS(tixiHandle, xpath + "/ribsPositioning");
@@ -104,7 +104,7 @@ namespace tigl
             }
             
             // read element ribExplicitPositioning
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribExplicitPositioning")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribExplicitPositioning")) {
                 m_ribExplicitPositioning_choice2 = boost::in_place(reinterpret_cast<CCPACSWingRibsDefinition*>(this));
                 try {
                     m_ribExplicitPositioning_choice2->ReadCPACS(tixiHandle, xpath + "/ribExplicitPositioning");
@@ -55,7 +55,7 @@ namespace tigl
         void CPACSWingRibsDefinitions::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element ribsDefinition
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribsDefinition")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribsDefinition")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/ribsDefinition", m_ribsDefinitions, reinterpret_cast<CCPACSWingRibsDefinitions*>(this), m_uidMgr);
             }
             
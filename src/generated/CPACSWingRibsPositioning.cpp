@@ -43,8 +43,8 @@ namespace tigl
         void CPACSWingRibsPositioning::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element ribReference
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribReference")) {
-                m_ribReference = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/ribReference");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribReference")) {
+                m_ribReference = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/ribReference");
                 if (m_ribReference.empty()) {
                     LOG(WARNING) << "Required element ribReference is empty at xpath " << xpath;
                 }
@@ -54,8 +54,8 @@ namespace tigl
             }
             
             // read element ribStart
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribStart")) {
-                m_ribStart = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/ribStart");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribStart")) {
+                m_ribStart = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/ribStart");
                 if (m_ribStart.empty()) {
                     LOG(WARNING) << "Required element ribStart is empty at xpath " << xpath;
                 }
@@ -65,8 +65,8 @@ namespace tigl
             }
             
             // read element ribEnd
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribEnd")) {
-                m_ribEnd = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/ribEnd");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribEnd")) {
+                m_ribEnd = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/ribEnd");
                 if (m_ribEnd.empty()) {
                     LOG(WARNING) << "Required element ribEnd is empty at xpath " << xpath;
                 }
@@ -76,15 +76,15 @@ namespace tigl
             }
             
             // read element ribCrossingBehaviour
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribCrossingBehaviour")) {
-                m_ribCrossingBehaviour = stringToCPACSRibCrossingBehaviour(tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/ribCrossingBehaviour"));
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribCrossingBehaviour")) {
+                m_ribCrossingBehaviour = stringToCPACSRibCrossingBehaviour(tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/ribCrossingBehaviour"));
             }
             else {
                 LOG(ERROR) << "Required element ribCrossingBehaviour is missing at xpath " << xpath;
             }
             
             // read element ribRotation
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/ribRotation")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/ribRotation")) {
                 m_ribRotation.ReadCPACS(tixiHandle, xpath + "/ribRotation");
             }
             else {
@@ -92,55 +92,55 @@ namespace tigl
             }
             
             // read element etaStart
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/etaStart")) {
-                m_etaStart_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/etaStart");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/etaStart")) {
+                m_etaStart_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/etaStart");
             }
             
             // read element elementStartUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/elementStartUID")) {
-                m_elementStartUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/elementStartUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/elementStartUID")) {
+                m_elementStartUID_choice2 = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/elementStartUID");
                 if (m_elementStartUID_choice2->empty()) {
                     LOG(WARNING) << "Optional element elementStartUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element sparPositionStartUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparPositionStartUID")) {
-                m_sparPositionStartUID_choice3 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/sparPositionStartUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparPositionStartUID")) {
+                m_sparPositionStartUID_choice3 = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/sparPositionStartUID");
                 if (m_sparPositionStartUID_choice3->empty()) {
                     LOG(WARNING) << "Optional element sparPositionStartUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element etaEnd
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/etaEnd")) {
-                m_etaEnd_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/etaEnd");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/etaEnd")) {
+                m_etaEnd_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/etaEnd");
             }
             
             // read element elementEndUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/elementEndUID")) {
-                m_elementEndUID_choice2 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/elementEndUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/elementEndUID")) {
+                m_elementEndUID_choice2 = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/elementEndUID");
                 if (m_elementEndUID_choice2->empty()) {
                     LOG(WARNING) << "Optional element elementEndUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element sparPositionEndUID
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparPositionEndUID")) {
-                m_sparPositionEndUID_choice3 = tixi::TixiGetElement<std::string>(tixiHandle, xpath + "/sparPositionEndUID");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparPositionEndUID")) {
+                m_sparPositionEndUID_choice3 = tixi::cursor::TixiGetElement<std::string>(tixiHandle, xpath + "/sparPositionEndUID");
                 if (m_sparPositionEndUID_choice3->empty()) {
                     LOG(WARNING) << "Optional element sparPositionEndUID is present but empty at xpath " << xpath;
                 }
             }
             
             // read element spacing
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/spacing")) {
-                m_spacing_choice1 = tixi::TixiGetElement<double>(tixiHandle, xpath + "/spacing");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/spacing")) {
+                m_spacing_choice1 = tixi::cursor::TixiGetElement<double>(tixiHandle, xpath + "/spacing");
             }
             
             // read element numberOfRibs
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/numberOfRibs")) {
-                m_numberOfRibs_choice2 = tixi::TixiGetElement<int>(tixiHandle, xpath + "/numberOfRibs");
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/numberOfRibs")) {
+                m_numberOfRibs_choice2 = tixi::cursor::TixiGetElement<int>(tixiHandle, xpath + "/numberOfRibs");
             }
             
             if (!ValidateChoices()) {
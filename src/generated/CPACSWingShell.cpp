@@ -57,8 +57,8 @@ namespace tigl
         void CPACSWingShell::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read attribute uID
-            if (tixi::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
-                m_uID = tixi::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
+            if (tixi::cursor::TixiCheckAttribute(tixiHandle, xpath, "uID")) {
+                m_uID = tixi::cursor::TixiGetAttribute<std::string>(tixiHandle, xpath, "uID");
                 if (m_uID.empty()) {
                     LOG(WARNING) << "Required attribute uID is empty at xpath " << xpath;
                 }
@@ -68,7 +68,7 @@ namespace tigl
             }
             
             // read element skin
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/skin")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/skin")) {
                 m_skin.ReadCPACS(tixiHandle, xpath + "/skin");
             }
             else {
@@ -76,7 +76,7 @@ namespace tigl
             }
             
             // read element cells
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/cells")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/cells")) {
                 m_cells = boost::in_place(reinterpret_cast<CCPACSWingShell*>(this), m_uidMgr);
                 try {
                     m_cells->ReadCPACS(tixiHandle, xpath + "/cells");
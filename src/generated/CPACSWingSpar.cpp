@@ -56,7 +56,7 @@ namespace tigl
         void CPACSWingSpar::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element sparPositions
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparPositions")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparPositions")) {
                 m_sparPositions.ReadCPACS(tixiHandle, xpath + "/sparPositions");
             }
             else {
@@ -64,7 +64,7 @@ namespace tigl
             }
             
             // read element sparSegments
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/sparSegments")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/sparSegments")) {
                 m_sparSegments.ReadCPACS(tixiHandle, xpath + "/sparSegments");
             }
             else {
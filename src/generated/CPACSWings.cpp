@@ -60,7 +60,7 @@ namespace tigl
         void CPACSWings::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
         {
             // read element wing
-            if (tixi::TixiCheckElement(tixiHandle, xpath + "/wing")) {
+            if (tixi::cursor::TixiCheckElement(tixiHandle, xpath + "/wing")) {
                 tixi::TixiReadElements(tixiHandle, xpath + "/wing", m_wings, reinterpret_cast<CCPACSWings*>(this), m_uidMgr);
             }
             
@@ -0,0 +1,668 @@
+// Copyright (c) 2017 RISC Software GmbH
+//
+// This file is part of the CPACSGen runtime.
+// Do not edit, all changes are lost when files are re-generated.
+//
+// Licensed under the Apache License, Version 2.0 (the "License")
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "TixiHelper.h"
+
+#include <cstring>
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tixi
+{
+    namespace
+    {
+        // element of the parsed document
+        struct CursorNode
+        {
+            std::string name;
+            std::string text; // concatenated text and CDATA content of the element itself
+            std::vector<std::pair<std::string, std::string> > attributes;
+            std::vector<const CursorNode*> children;
+
+            // children grouped by name, built on the first lookup of a node with many children
+            mutable std::map<std::string, std::vector<const CursorNode*> > childrenByName;
+            mutable bool indexed;
+
+            CursorNode() : indexed(false) {}
+
+            const std::string* FindAttribute(const std::string& attributeName) const
+            {
+                for (std::size_t i = 0; i < attributes.size(); ++i) {
+                    if (attributes[i].first == attributeName) {
+                        return &attributes[i].second;
+                    }
+                }
+                return NULL;
+            }
+
+            // returns all children named childName, small nodes are searched linearly into buffer
+            const std::vector<const CursorNode*>& FindChildren(const std::string& childName, std::vector<const CursorNode*>& buffer) const
+            {
+                if (children.size() < 16) {
+                    for (std::size_t i = 0; i < children.size(); ++i) {
+                        if (children[i]->name == childName) {
+                            buffer.push_back(children[i]);
+                        }
+                    }
+                    return buffer;
+                }
+
+                if (!indexed) {
+                    for (std::size_t i = 0; i < children.size(); ++i) {
+                        childrenByName[children[i]->name].push_back(children[i]);
+                    }
+                    indexed = true;
+                }
+                std::map<std::string, std::vector<const CursorNode*> >::const_iterator it = childrenByName.find(childName);
+                return it != childrenByName.end() ? it->second : buffer;
+            }
+        };
+
+        // Minimal parser for the well-formed documents exported by tixi.
+        // Documents using features, which would change the results of the xpath evaluation
+        // (default namespaces, DTDs), are rejected and read with tixi instead.
+        class CursorParser
+        {
+        public:
+            CursorParser(const char* text, std::deque<CursorNode>& nodes)
+                : m_pos(text)
+                , m_nodes(nodes)
+            {
+            }
+
+            // returns the root element or NULL, if the document is not supported
+            const CursorNode* Parse()
+            {
+                const CursorNode* root = NULL;
+                while (*m_pos) {
+                    if (IsSpace(*m_pos)) {
+                        ++m_pos;
+                    }
+                    else if (StartsWith("<?")) {
+                        if (!Skip("?>")) {
+                            return NULL;
+                        }
+                    }
+                    else if (StartsWith("<!--")) {
+                        if (!Skip("-->")) {
+                            return NULL;
+                        }
+                    }
+                    else if (*m_pos == '<' && !root && m_pos[1] != '!') {
+                        root = ParseElement();
+                        if (!root) {
+                            return NULL;
+                        }
+                    }
+                    else {
+                        // DOCTYPE, second root element or text outside of the root
+                        return NULL;
+                    }
+                }
+                return root;
+            }
+
+        private:
+            static bool IsSpace(char c)
+            {
+                return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+            }
+
+            static bool IsNameEnd(char c)
+            {
+                return c == '\0' || IsSpace(c) || c == '/' || c == '>' || c == '=';
+            }
+
+            bool StartsWith(const char* prefix) const
+            {
+                return std::strncmp(m_pos, prefix, std::strlen(prefix)) == 0;
+            }
+
+            // moves behind the next occurence of end
+            bool Skip(const char* end)
+            {
+                const char* found = std::strstr(m_pos, end);
+                if (!found) {
+                    return false;
+                }
+                m_pos = found + std::strlen(end);
+                return true;
+            }
+
+            void SkipSpace()
+            {
+                while (IsSpace(*m_pos)) {
+                    ++m_pos;
+                }
+            }
+
+            bool ParseName(std::string& name)
+            {
+                const char* begin = m_pos;
+                while (!IsNameEnd(*m_pos)) {
+                    ++m_pos;
+                }
+                name.assign(begin, m_pos);
+                return !name.empty();
+            }
+
+            static void AppendUtf8(unsigned long code, std::string& out)
+            {
+                if (code < 0x80) {
+                    out += static_cast<char>(code);
+                }
+                else if (code < 0x800) {
+                    out += static_cast<char>(0xC0 | (code >> 6));
+                    out += static_cast<char>(0x80 | (code & 0x3F));
+                }
+                else if (code < 0x10000) {
+                    out += static_cast<char>(0xE0 | (code >> 12));
+                    out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                    out += static_cast<char>(0x80 | (code & 0x3F));
+                }
+                else {
+                    out += static_cast<char>(0xF0 | (code >> 18));
+                    out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                    out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                    out += static_cast<char>(0x80 | (code & 0x3F));
+                }
+            }
+
+            // decodes the reference at the current position (behind the '&')
+            bool ParseReference(std::string& out)
+            {
+                const char* end = std::strchr(m_pos, ';');
+                if (!end) {
+                    return false;
+                }
+                const std::string ref(m_pos, end);
+                m_pos = end + 1;
+
+                if (ref == "lt") {
+                    out += '<';
+                }
+                else if (ref == "gt") {
+                    out += '>';
+                }
+                else if (ref == "amp") {
+                    out += '&';
+                }
+                else if (ref == "quot") {
+                    out += '"';
+                }
+                else if (ref == "apos") {
+                    out += '\'';
+                }
+                else if (ref.size() > 1 && ref[0] == '#') {
+                    const bool hex = ref[1] == 'x';
+                    const char* digits = ref.c_str() + (hex ? 2 : 1);
+                    char* digitsEnd = NULL;
+                    const unsigned long code = std::strtoul(digits, &digitsEnd, hex ? 16 : 10);
+                    if (digitsEnd == digits || *digitsEnd != '\0' || code > 0x10FFFF) {
+                        return false;
+                    }
+                    AppendUtf8(code, out);
+                }
+                else {
+                    // entities declared in a DTD are not supported
+                    return false;
+                }
+                return true;
+            }
+
+            bool ParseAttributeValue(std::string& value)
+            {
+                const char quote = *m_pos;
+                if (quote != '"' && quote != '\'') {
+                    return false;
+                }
+                ++m_pos;
+                while (*m_pos != quote) {
+                    if (*m_pos == '\0' || *m_pos == '<') {
+                        return false;
+                    }
+                    if (*m_pos == '&') {
+                        ++m_pos;
+                        if (!ParseReference(value)) {
+                            return false;
+                        }
+                    }
+                    else {
+                        // attribute value normalization
+                        value += IsSpace(*m_pos) ? ' ' : *m_pos;
+                        ++m_pos;
+                    }
+                }
+                ++m_pos;
+                return true;
+            }
+
+            // parses the element at the current position, returns NULL on errors
+            CursorNode* ParseElement()
+            {
+                m_nodes.push_back(CursorNode());
+                CursorNode* node = &m_nodes.back();
+
+                ++m_pos; // '<'
+                if (!ParseName(node->name)) {
+                    return NULL;
+                }
+
+                // attributes
+                for (;;) {
+                    SkipSpace();
+                    if (*m_pos == '>') {
+                        ++m_pos;
+                        break;
+                    }
+                    if (StartsWith("/>")) {
+                        m_pos += 2;
+                        return node;
+                    }
+
+                    std::pair<std::string, std::string> attribute;
+                    if (!ParseName(attribute.first)) {
+                        return NULL;
+                    }
+                    SkipSpace();
+                    if (*m_pos != '=') {
+                        return NULL;
+                    }
+                    ++m_pos;
+                    SkipSpace();
+                    if (!ParseAttributeValue(attribute.second)) {
+                        return NULL;
+                    }
+                    if (attribute.first == "xmlns") {
+                        // unprefixed xpath steps do not match elements in a default namespace
+                        return NULL;
+                    }
+                    node->attributes.push_back(attribute);
+                }
+
+                // content
+                for (;;) {
+                    if (*m_pos == '\0') {
+                        return NULL;
+                    }
+                    else if (StartsWith("</")) {
+                        m_pos += 2;
+                        std::string endName;
+                        if (!ParseName(endName) || endName != node->name) {
+                            return NULL;
+                        }
+                        SkipSpace();
+                        if (*m_pos != '>') {
+                            return NULL;
+                        }
+                        ++m_pos;
+                        return node;
+                    }
+                    else if (StartsWith("<!--")) {
+                        if (!Skip("-->")) {
+                            return NULL;
+                        }
+                    }
+                    else if (StartsWith("<![CDATA[")) {
+                        const char* begin = m_pos + 9;
+                        const char* end = std::strstr(begin, "]]>");
+                        if (!end) {
+                            return NULL;
+                        }
+                        node->text.append(begin, end);
+                        m_pos = end + 3;
+                    }
+                    else if (StartsWith("<?")) {
+                        if (!Skip("?>")) {
+                            return NULL;
+                        }
+                    }
+                    else if (*m_pos == '<') {
+                        if (m_pos[1] == '!') {
+                            return NULL;
+                        }
+                        const CursorNode* child = ParseElement();
+                        if (!child) {
+                            return NULL;
+                        }
+                        node->children.push_back(child);
+                    }
+                    else if (*m_pos == '&') {
+                        ++m_pos;
+                        if (!ParseReference(node->text)) {
+                            return NULL;
+                        }
+                    }
+                    else {
+                        const char* begin = m_pos;
+                        while (*m_pos != '\0' && *m_pos != '<' && *m_pos != '&') {
+                            ++m_pos;
+                        }
+                        node->text.append(begin, m_pos);
+                    }
+                }
+            }
+
+            const char* m_pos;
+            std::deque<CursorNode>& m_nodes;
+        };
+
+        // position of the '/' separating the last step of xpath or npos, if xpath has no top level '/'
+        std::size_t FindLastStep(const std::string& xpath)
+        {
+            std::size_t last = std::string::npos;
+            int depth = 0;
+            char quote = '\0';
+            for (std::size_t i = 0; i < xpath.size(); ++i) {
+                const char c = xpath[i];
+                if (quote) {
+                    if (c == quote) {
+                        quote = '\0';
+                    }
+                }
+                else if (c == '\'' || c == '"') {
+                    quote = c;
+                }
+                else if (c == '[') {
+                    ++depth;
+                }
+                else if (c == ']') {
+                    --depth;
+                }
+                else if (c == '/' && depth == 0) {
+                    last = i;
+                }
+            }
+            return last;
+        }
+
+        // a location step of the form name, name[index] or name[@attribute='value']
+        struct CursorStep
+        {
+            std::string name;
+            long index;
+            std::string attribute;
+            std::string value;
+
+            CursorStep() : index(0) {}
+
+            bool Parse(const std::string& step)
+            {
+                const std::size_t bracket = step.find('[');
+                name = step.substr(0, bracket);
+                if (name.empty() || name.find_first_of("*:@.()") != std::string::npos) {
+                    return false;
+                }
+                if (bracket == std::string::npos) {
+                    return true;
+                }
+                if (step[step.size() - 1] != ']') {
+                    return false;
+                }
+
+                const std::string predicate = step.substr(bracket + 1, step.size() - bracket - 2);
+                if (predicate.empty()) {
+                    return false;
+                }
+                if (predicate[0] == '@') {
+                    const std::size_t equals = predicate.find('=');
+                    if (equals == std::string::npos || equals + 2 >= predicate.size()) {
+                        return false;
+                    }
+                    attribute = predicate.substr(1, equals - 1);
+                    const char quote = predicate[equals + 1];
+                    if ((quote != '\'' && quote != '"') || predicate[predicate.size() - 1] != quote) {
+                        return false;
+                    }
+                    value = predicate.substr(equals + 2, predicate.size() - equals - 3);
+                    return !attribute.empty() && value.find(quote) == std::string::npos;
+                }
+
+                char* end = NULL;
+                index = std::strtol(predicate.c_str(), &end, 10);
+                return *end == '\0' && index > 0;
+            }
+        };
+
+        struct CursorEntry
+        {
+            internal::CursorResult result;
+            const CursorNode* node;
+        };
+
+        // the cursor of the current thread
+        thread_local TixiDocumentCursor* currentCursor = NULL;
+    } // namespace
+
+    class TixiDocumentCursor
+    {
+    public:
+        explicit TixiDocumentCursor(const TixiDocumentHandle& tixiHandle)
+            : m_tixiHandle(tixiHandle)
+            , m_root(NULL)
+        {
+            char* text = NULL;
+            if (tixiExportDocumentAsString(tixiHandle, &text) == SUCCESS && text) {
+                CursorParser parser(text, m_nodes);
+                m_root = parser.Parse();
+            }
+            if (!m_root) {
+                m_nodes.clear();
+            }
+        }
+
+        bool IsValid() const
+        {
+            return m_root != NULL;
+        }
+
+        const TixiDocumentHandle& GetHandle() const
+        {
+            return m_tixiHandle;
+        }
+
+        // resolves an absolute xpath, the results of all parent xpaths are cached
+        CursorEntry Find(const std::string& xpath)
+        {
+            std::unordered_map<std::string, CursorEntry>::const_iterator it = m_cache.find(xpath);
+            if (it != m_cache.end()) {
+                return it->second;
+            }
+
+            const CursorEntry entry = Resolve(xpath);
+            m_cache.insert(std::make_pair(xpath, entry));
+            return entry;
+        }
+
+    private:
+        static CursorEntry MakeEntry(internal::CursorResult result, const CursorNode* node = NULL)
+        {
+            CursorEntry entry;
+            entry.result = result;
+            entry.node = node;
+            return entry;
+        }
+
+        CursorEntry Resolve(const std::string& xpath)
+        {
+            const std::size_t slash = FindLastStep(xpath);
+            if (slash == std::string::npos || slash + 1 == xpath.size()) {
+                // relative xpath or trailing '/'
+                return MakeEntry(internal::CURSOR_UNRESOLVED);
+            }
+
+            CursorStep step;
+            if (!step.Parse(xpath.substr(slash + 1))) {
+                return MakeEntry(internal::CURSOR_UNRESOLVED);
+            }
+
+            std::vector<const CursorNode*> buffer;
+            const std::vector<const CursorNode*>* candidates = &buffer;
+            if (slash == 0) {
+                // the document node has the root element as only child
+                if (m_root->name == step.name) {
+                    buffer.push_back(m_root);
+                }
+            }
+            else {
+                const CursorEntry parent = Find(xpath.substr(0, slash));
+                if (parent.result != internal::CURSOR_FOUND) {
+                    return parent;
+                }
+                candidates = &parent.node->FindChildren(step.name, buffer);
+            }
+
+            if (step.index > 0) {
+                if (static_cast<std::size_t>(step.index) > candidates->size()) {
+                    return MakeEntry(internal::CURSOR_NOT_FOUND);
+                }
+                return MakeEntry(internal::CURSOR_FOUND, (*candidates)[step.index - 1]);
+            }
+
+            const CursorNode* found = NULL;
+            for (std::size_t i = 0; i < candidates->size(); ++i) {
+                if (!step.attribute.empty()) {
+                    const std::string* value = (*candidates)[i]->FindAttribute(step.attribute);
+                    if (!value || *value != step.value) {
+                        continue;
+                    }
+                }
+                if (found) {
+                    // the xpath is not unique, tixi decides what to do
+                    return MakeEntry(internal::CURSOR_UNRESOLVED);
+                }
+                found = (*candidates)[i];
+            }
+            return found ? MakeEntry(internal::CURSOR_FOUND, found) : MakeEntry(internal::CURSOR_NOT_FOUND);
+        }
+
+        TixiDocumentHandle m_tixiHandle;
+        std::deque<CursorNode> m_nodes;
+        const CursorNode* m_root;
+        std::unordered_map<std::string, CursorEntry> m_cache;
+    };
+
+    TixiCursorScope::TixiCursorScope(const TixiDocumentHandle& tixiHandle)
+        : m_cursor(NULL)
+        , m_previous(currentCursor)
+        , m_active(false)
+    {
+        if (m_previous && m_previous->GetHandle() == tixiHandle) {
+            // nested scope for the same document, the outer cursor is used
+            m_active = true;
+            return;
+        }
+
+        m_cursor = new TixiDocumentCursor(tixiHandle);
+        if (!m_cursor->IsValid()) {
+            // the document is read with tixi
+            delete m_cursor;
+            m_cursor = NULL;
+            return;
+        }
+        currentCursor = m_cursor;
+        m_active = true;
+    }
+
+    TixiCursorScope::~TixiCursorScope()
+    {
+        if (m_cursor) {
+            currentCursor = m_previous;
+            delete m_cursor;
+        }
+    }
+
+    bool TixiCursorScope::IsActive() const
+    {
+        return m_active;
+    }
+
+    namespace internal
+    {
+        namespace
+        {
+            TixiDocumentCursor* GetCursor(const TixiDocumentHandle& tixiHandle)
+            {
+                if (currentCursor && currentCursor->GetHandle() == tixiHandle) {
+                    return currentCursor;
+                }
+                return NULL;
+            }
+        }
+
+        CursorResult CursorFindElement(const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::string** text)
+        {
+            TixiDocumentCursor* cursor = GetCursor(tixiHandle);
+            if (!cursor) {
+                return CURSOR_UNRESOLVED;
+            }
+
+            const CursorEntry entry = cursor->Find(xpath);
+            if (entry.result == CURSOR_FOUND) {
+                *text = &entry.node->text;
+            }
+            return entry.result;
+        }
+
+        CursorResult CursorFindAttribute(const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::string& attribute, const std::string** value)
+        {
+            TixiDocumentCursor* cursor = GetCursor(tixiHandle);
+            if (!cursor) {
+                return CURSOR_UNRESOLVED;
+            }
+
+            const CursorEntry entry = cursor->Find(xpath);
+            if (entry.result != CURSOR_FOUND) {
+                // tixi reports a missing element as error
+                return CURSOR_UNRESOLVED;
+            }
+
+            *value = entry.node->FindAttribute(attribute);
+            return *value ? CURSOR_FOUND : CURSOR_NOT_FOUND;
+        }
+
+        CursorResult CursorCountNamedChildren(const TixiDocumentHandle& tixiHandle, const std::string& xpath, int* count)
+        {
+            TixiDocumentCursor* cursor = GetCursor(tixiHandle);
+            if (!cursor) {
+                return CURSOR_UNRESOLVED;
+            }
+
+            const std::size_t slash = FindLastStep(xpath);
+            if (slash == std::string::npos || slash == 0) {
+                return CURSOR_UNRESOLVED;
+            }
+
+            const std::string childName = xpath.substr(slash + 1);
+            if (childName.empty() || childName.find_first_of("[]*:@.()") != std::string::npos) {
+                return CURSOR_UNRESOLVED;
+            }
+
+            const CursorEntry parent = cursor->Find(xpath.substr(0, slash));
+            if (parent.result != CURSOR_FOUND) {
+                return CURSOR_UNRESOLVED;
+            }
+
+            std::vector<const CursorNode*> buffer;
+            *count = static_cast<int>(parent.node->FindChildren(childName, buffer).size());
+            return CURSOR_FOUND;
+        }
+    }
+}
@@ -23,7 +23,11 @@
 #include <boost/date_time/posix_time/posix_time.hpp>
 
 #include <ctime>
+#include <cstdlib>
+#include <climits>
+#include <cerrno>
 
+#include "tigl_internal.h"
 #include "UniquePtr.h"
 
 // some extensions to tixi
@@ -46,11 +50,181 @@ namespace tixi
     }
 
 
+    // Cursor mode for reading documents
+    //
+    // While a TixiCursorScope is alive, the document is parsed once into a tree of nodes. The read functions
+    // in the namespace tixi::cursor look up the nodes in this tree instead of evaluating the xpath with tixi.
+    // The node of an xpath is found from the already resolved node of its parent xpath, hence reading all
+    // elements of a document scales linearly with its size. Xpaths, which cannot be resolved unambiguously
+    // by the cursor, and all reads outside of a cursor scope are passed on to tixi. The xpath is thus still
+    // used to identify the node and for the diagnostics of the calling code.
+    //
+    // The document must not be modified while the scope is alive.
+    class TixiDocumentCursor;
+
+    class TixiCursorScope
+    {
+    public:
+        TIGL_EXPORT explicit TixiCursorScope(const TixiDocumentHandle& tixiHandle);
+        TIGL_EXPORT ~TixiCursorScope();
+
+        // returns true, if the document could be parsed and the cursor mode is active
+        TIGL_EXPORT bool IsActive() const;
+
+    private:
+        TixiCursorScope(const TixiCursorScope&);
+        TixiCursorScope& operator=(const TixiCursorScope&);
+
+        TixiDocumentCursor* m_cursor;   // cursor owned by this scope
+        TixiDocumentCursor* m_previous; // cursor of the enclosing scope
+        bool m_active;
+    };
+
+    namespace internal
+    {
+        enum CursorResult
+        {
+            CURSOR_FOUND,
+            CURSOR_NOT_FOUND,
+            CURSOR_UNRESOLVED // no active cursor or the xpath has to be evaluated by tixi
+        };
+
+        // looks up the element at xpath and returns its text
+        TIGL_EXPORT CursorResult CursorFindElement(const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::string** text);
+
+        // looks up the attribute of the element at xpath and returns its value
+        TIGL_EXPORT CursorResult CursorFindAttribute(const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::string& attribute, const std::string** value);
+
+        // counts the elements named like the last step of xpath inside its parent element
+        TIGL_EXPORT CursorResult CursorCountNamedChildren(const TixiDocumentHandle& tixiHandle, const std::string& xpath, int* count);
+
+        // converts the text of an element or attribute, returns false if the text is invalid
+        // or the type is not supported, in which case tixi has to read the value
+        template<typename T>
+        inline bool CursorFromText(const std::string&, T&)
+        {
+            return false;
+        }
+
+        template<>
+        inline bool CursorFromText<std::string>(const std::string& text, std::string& value)
+        {
+            value = text;
+            return true;
+        }
+
+        inline bool CursorIsTrailingSpace(const char* end)
+        {
+            while (*end == ' ' || *end == '\t' || *end == '\n' || *end == '\r') {
+                ++end;
+            }
+            return *end == '\0';
+        }
+
+        template<>
+        inline bool CursorFromText<double>(const std::string& text, double& value)
+        {
+            const char* begin = text.c_str();
+            char* end = NULL;
+            errno = 0;
+            value = std::strtod(begin, &end);
+            return end != begin && errno == 0 && CursorIsTrailingSpace(end);
+        }
+
+        template<>
+        inline bool CursorFromText<int>(const std::string& text, int& value)
+        {
+            const char* begin = text.c_str();
+            char* end = NULL;
+            errno = 0;
+            const long number = std::strtol(begin, &end, 10);
+            if (end == begin || errno != 0 || !CursorIsTrailingSpace(end) || number < INT_MIN || number > INT_MAX) {
+                return false;
+            }
+            value = static_cast<int>(number);
+            return true;
+        }
+
+        template<>
+        inline bool CursorFromText<std::time_t>(const std::string& text, std::time_t& value)
+        {
+            try {
+                value = boost::posix_time::to_time_t(boost::posix_time::from_iso_extended_string(text));
+                return true;
+            }
+            catch (const std::exception&) {
+                return false;
+            }
+        }
+    }
+
+    // Read functions using the cursor of the current thread, see TixiCursorScope
+    namespace cursor
+    {
+        inline bool TixiCheckElement(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
+        {
+            const std::string* text = NULL;
+            const internal::CursorResult result = internal::CursorFindElement(tixiHandle, xpath, &text);
+            if (result == internal::CURSOR_UNRESOLVED) {
+                return tixi::TixiCheckElement(tixiHandle, xpath);
+            }
+            return result == internal::CURSOR_FOUND;
+        }
+
+        inline bool TixiCheckAttribute(const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::string& attribute)
+        {
+            const std::string* value = NULL;
+            const internal::CursorResult result = internal::CursorFindAttribute(tixiHandle, xpath, attribute, &value);
+            if (result == internal::CURSOR_UNRESOLVED) {
+                return tixi::TixiCheckAttribute(tixiHandle, xpath, attribute);
+            }
+            return result == internal::CURSOR_FOUND;
+        }
+
+        template<typename T>
+        T TixiGetElement(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
+        {
+            const std::string* text = NULL;
+            T value;
+            if (internal::CursorFindElement(tixiHandle, xpath, &text) == internal::CURSOR_FOUND && internal::CursorFromText(*text, value)) {
+                return value;
+            }
+            // let tixi read the value or report the error
+            return tixi::TixiGetElement<T>(tixiHandle, xpath);
+        }
+
+        inline std::string TixiGetTextElement(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
+        {
+            return TixiGetElement<std::string>(tixiHandle, xpath);
+        }
+
+        template<typename T>
+        T TixiGetAttribute(const TixiDocumentHandle& tixiHandle, const std::string& xpath, const std::string& attribute)
+        {
+            const std::string* text = NULL;
+            T value;
+            if (internal::CursorFindAttribute(tixiHandle, xpath, attribute, &text) == internal::CURSOR_FOUND && internal::CursorFromText(*text, value)) {
+                return value;
+            }
+            // let tixi read the value or report the error
+            return tixi::TixiGetAttribute<T>(tixiHandle, xpath, attribute);
+        }
+
+        inline int TixiGetNamedChildrenCount(const TixiDocumentHandle& tixiHandle, const std::string& xpath)
+        {
+            int count = 0;
+            if (internal::CursorCountNamedChildren(tixiHandle, xpath, &count) == internal::CURSOR_FOUND) {
+                return count;
+            }
+            return tixi::TixiGetNamedChildrenCount(tixiHandle, xpath);
+        }
+    }
+
     template<typename T, typename ReadChildFunc>
     void TixiReadElements(const TixiDocumentHandle& tixiHandle, const std::string& xpath, std::vector<T>& children, ReadChildFunc readChild, int minOccurs = -1, int maxOccurs = -1)
     {
         // read number of child nodes
-        const int childCount = TixiGetNamedChildrenCount(tixiHandle, xpath);
+        const int childCount = cursor::TixiGetNamedChildrenCount(tixiHandle, xpath);
 
         // validate number of child nodes
         if (minOccurs >= 0) {
@@ -85,7 +259,7 @@ namespace tixi
     {
         T operator()(const TixiDocumentHandle& tixiHandle, const std::string& xpath) const
         {
-            return TixiGetElement<T>(tixiHandle, xpath);
+            return cursor::TixiGetElement<T>(tixiHandle, xpath);
         }
     };
 
@@ -29,20 +29,77 @@
 #include "TiglSymmetryAxis.h"
 #include "CCPACSTransformation.h"
 #include "CNamedShape.h"
+#include "CTiglDiskCache.h"
 
 // OCCT defines
 #include <BRepBuilderAPI_Transform.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <Bnd_Box.hxx>
 #include <BRepBndLib.hxx>
+#include <TopoDS_Shape.hxx>
 
 namespace tigl
 {
+
+struct CTiglAbstractGeometricComponent::ClassifierCache
+{
+    explicit ClassifierCache(const PNamedShape& loft)
+        : shape(loft)
+        , isSolid(loft->Shape().ShapeType() == TopAbs_SOLID)
+        , isReversed(false)
+    {
+        BRepBndLib::Add(loft->Shape(), boundingBox);
+        classifier.Load(loft->Shape());
+
+        // test whether a point at infinity lies inside. If yes, then the solid is reversed
+        if (isSolid) {
+            classifier.PerformInfinitePoint(1e-3);
+            isReversed = classifier.State() == TopAbs_IN;
+        }
+    }
+
+    bool IsOutsideBoundingBox(const gp_Pnt& pnt) const
+    {
+        return boundingBox.IsOut(pnt) == Standard_True;
+    }
+
+    // Points, that are outside of the box by less than the tolerance, may still be
+    // classified as on the shape
+    bool IsOutsideBoundingBox(const gp_Pnt& pnt, double tolerance) const
+    {
+        Bnd_Box box(boundingBox);
+        box.Enlarge(tolerance);
+        return box.IsOut(pnt) == Standard_True;
+    }
+
+    PNamedShape shape; ///< the loft, the cache was built for
+    Bnd_Box boundingBox;
+    BRepClass3d_SolidClassifier classifier;
+    bool isSolid;
+    bool isReversed;
+};
+
 CTiglAbstractGeometricComponent::CTiglAbstractGeometricComponent() {}
 
 
 void CTiglAbstractGeometricComponent::Reset() {
-    loft.reset();
+    {
+        std::lock_guard<std::recursive_mutex> lock(loftMutex);
+        loft.reset();
+    }
+    std::lock_guard<std::mutex> lock(classifierMutex);
+    classifierCache.reset();
+}
+
+// must be called with a lock on classifierMutex
+CTiglAbstractGeometricComponent::ClassifierCache& CTiglAbstractGeometricComponent::GetClassifierCache()
+{
+    // some components reset their loft directly, hence we check, if the loft has changed
+    PNamedShape currentLoft = GetLoft();
+    if (!classifierCache || classifierCache->shape != currentLoft) {
+        classifierCache = CSharedPtr<ClassifierCache>(new ClassifierCache(currentLoft));
+    }
+    return *classifierCache;
 }
 
 TiglSymmetryAxis CTiglAbstractGeometricComponent::GetSymmetryAxis() const
@@ -52,12 +109,34 @@ TiglSymmetryAxis CTiglAbstractGeometricComponent::GetSymmetryAxis() const
 
 PNamedShape CTiglAbstractGeometricComponent::GetLoft()
 {
+    // The lock is recursive, since BuildLoft may query the component again.
+    // Lofts of child components are locked after their parents, which avoids deadlocks.
+    std::lock_guard<std::recursive_mutex> lock(loftMutex);
     if (!loft) {
-        loft = BuildLoft();
+        CTiglDiskCache& diskCache = CTiglDiskCache::GetInstance();
+        std::string key;
+        if (diskCache.IsEnabled() && GetLoftCacheKey(key)) {
+            ListPNamedShape cachedShapes;
+            if (diskCache.Load(key, cachedShapes) && cachedShapes.size() == 1 && cachedShapes[0]) {
+                loft = cachedShapes[0];
+            }
+            else {
+                loft = BuildLoft();
+                diskCache.Store(key, ListPNamedShape(1, loft));
+            }
+        }
+        else {
+            loft = BuildLoft();
+        }
     }
     return loft;
 }
 
+bool CTiglAbstractGeometricComponent::GetLoftCacheKey(std::string&)
+{
+    return false;
+}
+
 PNamedShape CTiglAbstractGeometricComponent::GetMirroredLoft()
 {
     const TiglSymmetryAxis& symmetryAxis = GetSymmetryAxis();
@@ -95,28 +174,18 @@ PNamedShape CTiglAbstractGeometricComponent::GetMirroredLoft()
 
 bool CTiglAbstractGeometricComponent::GetIsOn(const gp_Pnt& pnt) 
 {
-    const TopoDS_Shape& segmentShape = GetLoft()->Shape();
+    std::lock_guard<std::mutex> lock(classifierMutex);
+    ClassifierCache& cache = GetClassifierCache();
 
     // fast check with bounding box
-    Bnd_Box boundingBox;
-    BRepBndLib::Add(segmentShape, boundingBox);
-
-    Standard_Real xmin, xmax, ymin, ymax, zmin, zmax;
-    boundingBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-
-    if (pnt.X() < xmin || pnt.X() > xmax ||
-        pnt.Y() < ymin || pnt.Y() > ymax ||
-        pnt.Z() < zmin || pnt.Z() > zmax) {
-
+    if (cache.IsOutsideBoundingBox(pnt)) {
         return false;
     }
 
     double tolerance = 0.03; // 3cm
 
-    BRepClass3d_SolidClassifier classifier;
-    classifier.Load(segmentShape);
-    classifier.Perform(pnt, tolerance);
-    if ((classifier.State() == TopAbs_IN) || (classifier.State() == TopAbs_ON)) {
+    cache.classifier.Perform(pnt, tolerance);
+    if ((cache.classifier.State() == TopAbs_IN) || (cache.classifier.State() == TopAbs_ON)) {
         return true;
     }
     else {
@@ -124,6 +193,31 @@ bool CTiglAbstractGeometricComponent::GetIsOn(const gp_Pnt& pnt)
     }
 }
 
+void CTiglAbstractGeometricComponent::GetIsOn(const std::vector<gp_Pnt>& points, std::vector<bool>& isOn)
+{
+    isOn.resize(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        isOn[i] = GetIsOn(points[i]);
+    }
+}
+
+bool CTiglAbstractGeometricComponent::GetIsInside(const gp_Pnt& pnt, double tolerance)
+{
+    std::lock_guard<std::mutex> lock(classifierMutex);
+    ClassifierCache& cache = GetClassifierCache();
+    if (!cache.isSolid) {
+        throw CTiglError("The shape is not a solid");
+    }
+
+    // points outside the bounding box can only be inside of a reversed solid
+    if (!cache.isReversed && cache.IsOutsideBoundingBox(pnt, tolerance)) {
+        return false;
+    }
+
+    cache.classifier.Perform(pnt, tolerance);
+    return ((cache.classifier.State() == TopAbs_IN) != cache.isReversed) || (cache.classifier.State() == TopAbs_ON);
+}
+
 bool CTiglAbstractGeometricComponent::GetIsOnMirrored(const gp_Pnt& pnt) 
 {
     const TiglSymmetryAxis& symmetryAxis = GetSymmetryAxis();
@@ -27,9 +27,12 @@
 #define CTIGLABSTRACTGEOMETRICCOMPONENT_H
 
 #include <gp_Pnt.hxx>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "PNamedShape.h"
+#include "CSharedPtr.h"
 #include "ITiglGeometricComponent.h"
 
 namespace tigl
@@ -46,7 +49,8 @@ public:
 
     TIGL_EXPORT virtual TiglSymmetryAxis GetSymmetryAxis() const;
 
-    // Gets the loft of a geometric component
+    // Gets the loft of a geometric component. The loft is built only once,
+    // also if GetLoft is called concurrently from multiple threads.
     TIGL_EXPORT PNamedShape GetLoft() OVERRIDE;
 
     // Get the loft mirrored at the mirror plane
@@ -54,17 +58,37 @@ public:
 
     // return if pnt lies on the loft
     TIGL_EXPORT virtual bool GetIsOn(const gp_Pnt &pnt);
+
+    // checks for each point, if it lies on the loft
+    TIGL_EXPORT void GetIsOn(const std::vector<gp_Pnt>& points, std::vector<bool>& isOn);
     
     // return if pnt lies on the mirrored loft
     // if the loft as no symmetry, false is returned
     TIGL_EXPORT bool GetIsOnMirrored(const gp_Pnt &pnt);
 
+    // return if pnt lies inside the loft, which must be a solid
+    TIGL_EXPORT bool GetIsInside(const gp_Pnt &pnt, double tolerance = 1e-3);
+
+    // returns a string, that describes all input data of the loft. The lofts of
+    // components, that return true, are stored in the disk cache.
+    TIGL_EXPORT virtual bool GetLoftCacheKey(std::string& key);
+
 protected:
     virtual PNamedShape BuildLoft() = 0;
 
     PNamedShape loft;
 
 private:
+    // The bounding box and the preloaded solid classifier of the loft
+    struct ClassifierCache;
+    ClassifierCache& GetClassifierCache();
+
+    CSharedPtr<ClassifierCache> classifierCache;
+
+    std::recursive_mutex loftMutex;  // guards the lazy creation of loft
+    std::mutex classifierMutex;      // guards classifierCache, the classifier is stateful
+
+
     CTiglAbstractGeometricComponent(const CTiglAbstractGeometricComponent&);
     void operator=(const CTiglAbstractGeometricComponent&);
 };
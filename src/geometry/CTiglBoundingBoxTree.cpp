@@ -0,0 +1,190 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglBoundingBoxTree.h"
+
+#include <Bnd_Box.hxx>
+#include <gp_Pnt.hxx>
+
+#include <algorithm>
+
+namespace
+{
+    // maximum number of boxes per leaf
+    const size_t MAX_LEAF_SIZE = 4;
+
+    // compares box indices by the box centers along an axis
+    template <class BoxVector>
+    class CenterLess
+    {
+    public:
+        CenterLess(const BoxVector& boxes, int axis)
+            : m_boxes(boxes), m_axis(axis)
+        {
+        }
+
+        bool operator()(size_t i, size_t j) const
+        {
+            return m_boxes[i].min[m_axis] + m_boxes[i].max[m_axis] < m_boxes[j].min[m_axis] + m_boxes[j].max[m_axis];
+        }
+
+    private:
+        const BoxVector& m_boxes;
+        int m_axis;
+    };
+
+    template <class Box>
+    bool overlaps(const Box& a, const Box& b)
+    {
+        for (int k = 0; k < 3; ++k) {
+            if (a.max[k] < b.min[k] || a.min[k] > b.max[k]) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+namespace tigl
+{
+
+CTiglBoundingBoxTree::CTiglBoundingBoxTree()
+{
+}
+
+CTiglBoundingBoxTree::CTiglBoundingBoxTree(const std::vector<Bnd_Box>& boxes)
+{
+    m_boxes.resize(boxes.size());
+    m_leafIndices.reserve(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        if (boxes[i].IsVoid()) {
+            continue;
+        }
+        Box& box = m_boxes[i];
+        boxes[i].Get(box.min[0], box.min[1], box.min[2], box.max[0], box.max[1], box.max[2]);
+        m_leafIndices.push_back(i);
+    }
+
+    if (!m_leafIndices.empty()) {
+        m_nodes.reserve(2 * m_leafIndices.size());
+        BuildNode(0, m_leafIndices.size());
+    }
+}
+
+size_t CTiglBoundingBoxTree::BuildNode(size_t begin, size_t end)
+{
+    size_t iNode = m_nodes.size();
+    m_nodes.push_back(Node());
+
+    // compute the bounds of all boxes in this node
+    Box bounds = m_boxes[m_leafIndices[begin]];
+    for (size_t i = begin + 1; i < end; ++i) {
+        const Box& box = m_boxes[m_leafIndices[i]];
+        for (int k = 0; k < 3; ++k) {
+            bounds.min[k] = std::min(bounds.min[k], box.min[k]);
+            bounds.max[k] = std::max(bounds.max[k], box.max[k]);
+        }
+    }
+    m_nodes[iNode].box    = bounds;
+    m_nodes[iNode].isLeaf = end - begin <= MAX_LEAF_SIZE;
+    m_nodes[iNode].left   = 0;
+    m_nodes[iNode].right  = 0;
+    m_nodes[iNode].first  = begin;
+    m_nodes[iNode].count  = end - begin;
+
+    if (m_nodes[iNode].isLeaf) {
+        return iNode;
+    }
+
+    // split at the median along the longest axis
+    int axis = 0;
+    for (int k = 1; k < 3; ++k) {
+        if (bounds.max[k] - bounds.min[k] > bounds.max[axis] - bounds.min[axis]) {
+            axis = k;
+        }
+    }
+    size_t mid = begin + (end - begin) / 2;
+    std::nth_element(m_leafIndices.begin() + begin, m_leafIndices.begin() + mid, m_leafIndices.begin() + end,
+                     CenterLess<std::vector<Box> >(m_boxes, axis));
+
+    // m_nodes might be reallocated during the recursion, hence no references
+    size_t left  = BuildNode(begin, mid);
+    size_t right = BuildNode(mid, end);
+    m_nodes[iNode].left  = left;
+    m_nodes[iNode].right = right;
+    return iNode;
+}
+
+size_t CTiglBoundingBoxTree::GetBoxCount() const
+{
+    return m_boxes.size();
+}
+
+void CTiglBoundingBoxTree::FindBoxes(const gp_Pnt& point, std::vector<size_t>& indices) const
+{
+    Box box;
+    box.min[0] = box.max[0] = point.X();
+    box.min[1] = box.max[1] = point.Y();
+    box.min[2] = box.max[2] = point.Z();
+    FindBoxes(box, indices);
+}
+
+void CTiglBoundingBoxTree::FindBoxes(const Bnd_Box& bndBox, std::vector<size_t>& indices) const
+{
+    indices.clear();
+    if (bndBox.IsVoid()) {
+        return;
+    }
+
+    Box box;
+    bndBox.Get(box.min[0], box.min[1], box.min[2], box.max[0], box.max[1], box.max[2]);
+    FindBoxes(box, indices);
+}
+
+void CTiglBoundingBoxTree::FindBoxes(const Box& box, std::vector<size_t>& indices) const
+{
+    indices.clear();
+    if (m_nodes.empty()) {
+        return;
+    }
+
+    std::vector<size_t> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (!overlaps(node.box, box)) {
+            continue;
+        }
+
+        if (node.isLeaf) {
+            for (size_t i = node.first; i < node.first + node.count; ++i) {
+                if (overlaps(m_boxes[m_leafIndices[i]], box)) {
+                    indices.push_back(m_leafIndices[i]);
+                }
+            }
+        }
+        else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+
+    std::sort(indices.begin(), indices.end());
+}
+
+} // namespace tigl
@@ -0,0 +1,85 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief The CTiglBoundingBoxTree class is a bounding volume hierarchy of
+ * axis aligned boxes. It is used to quickly find all boxes containing a point,
+ * e.g. to find candidate components or segments before running an exact
+ * (and expensive) classification.
+ */
+
+#ifndef CTIGLBOUNDINGBOXTREE_H
+#define CTIGLBOUNDINGBOXTREE_H
+
+#include "tigl_internal.h"
+
+#include <vector>
+#include <cstddef>
+
+class Bnd_Box;
+class gp_Pnt;
+
+namespace tigl
+{
+
+class CTiglBoundingBoxTree
+{
+public:
+    /// Creates an empty tree
+    TIGL_EXPORT CTiglBoundingBoxTree();
+
+    /// Creates the tree of the given boxes. Void boxes are never found.
+    TIGL_EXPORT explicit CTiglBoundingBoxTree(const std::vector<Bnd_Box>& boxes);
+
+    /// Returns the number of boxes the tree was built from
+    TIGL_EXPORT size_t GetBoxCount() const;
+
+    /// Returns the indices of all boxes containing the point in ascending order
+    TIGL_EXPORT void FindBoxes(const gp_Pnt& point, std::vector<size_t>& indices) const;
+
+    /// Returns the indices of all boxes intersecting the box in ascending order
+    TIGL_EXPORT void FindBoxes(const Bnd_Box& box, std::vector<size_t>& indices) const;
+
+private:
+    struct Box
+    {
+        double min[3];
+        double max[3];
+    };
+
+    struct Node
+    {
+        Box box;
+        bool isLeaf;
+        // child nodes of inner nodes
+        size_t left;
+        size_t right;
+        // range of a leaf in m_leafIndices
+        size_t first;
+        size_t count;
+    };
+
+    size_t BuildNode(size_t begin, size_t end);
+    void FindBoxes(const Box& box, std::vector<size_t>& indices) const;
+
+    std::vector<Box> m_boxes;
+    std::vector<size_t> m_leafIndices;
+    std::vector<Node> m_nodes;
+};
+
+} // namespace tigl
+
+#endif // CTIGLBOUNDINGBOXTREE_H
@@ -0,0 +1,444 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglDiskCache.h"
+
+#include "CNamedShape.h"
+#include "CTiglLogging.h"
+#include "CTiglTransformation.h"
+#include "tigl_version.h"
+
+#include <BinTools.hxx>
+#include <BRep_Builder.hxx>
+#include <Standard_Failure.hxx>
+#include <Standard_Version.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+
+#if defined _WIN32 || defined __WIN32__
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace tigl
+{
+
+namespace
+{
+    const char* const CACHE_FILE_MAGIC = "TIGL_DISK_CACHE 2";
+
+    // 64 bit FNV-1a hash
+    unsigned long long hashString(const std::string& str, unsigned long long hash)
+    {
+        for (std::string::const_iterator it = str.begin(); it != str.end(); ++it) {
+            hash ^= static_cast<unsigned char>(*it);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    int processId()
+    {
+#if defined _WIN32 || defined __WIN32__
+        return _getpid();
+#else
+        return static_cast<int>(getpid());
+#endif
+    }
+
+    std::string toHex(unsigned long long value)
+    {
+        std::stringstream stream;
+        stream << std::hex << std::setw(16) << std::setfill('0') << value;
+        return stream.str();
+    }
+
+    // the cached shapes are only valid for the same TiGL and OpenCASCADE version
+    std::string versionedKey(const std::string& key)
+    {
+        return std::string(TIGL_VERSION_STRING) + "-" + TIGL_REVISION + "\n" + OCC_VERSION_COMPLETE + "\n" + key;
+    }
+
+    void writeString(std::ostream& stream, const std::string& str)
+    {
+        stream << str.size() << "\n" << str << "\n";
+    }
+
+    bool readString(std::istream& stream, std::string& str)
+    {
+        size_t size = 0;
+        if (!(stream >> size) || stream.get() != '\n') {
+            return false;
+        }
+        str.resize(size);
+        if (size > 0 && !stream.read(&str[0], static_cast<std::streamsize>(size))) {
+            return false;
+        }
+        return stream.get() == '\n';
+    }
+
+    template <typename T>
+    bool readValue(std::istream& stream, T& value)
+    {
+        return static_cast<bool>(stream >> value);
+    }
+
+    // writes names and face traits of all shapes. The face origins are
+    // written as a separate list, as multiple faces share the same origin.
+    void writeMetaData(std::ostream& stream, const ListPNamedShape& shapes)
+    {
+        std::map<PNamedShape, int> originIndices;
+        ListPNamedShape origins;
+
+        stream << shapes.size() << "\n";
+        for (ListPNamedShape::const_iterator it = shapes.begin(); it != shapes.end(); ++it) {
+            const PNamedShape& shape = *it;
+            if (!shape || shape->Shape().IsNull()) {
+                stream << 0 << "\n";
+                continue;
+            }
+
+            stream << 1 << "\n";
+            writeString(stream, shape->Name());
+            writeString(stream, shape->ShortName());
+            stream << shape->GetFaceCount() << "\n";
+            for (unsigned int iFace = 0; iFace < shape->GetFaceCount(); ++iFace) {
+                const CFaceTraits& traits = shape->GetFaceTraits(iFace);
+                int originIndex = -1;
+                if (traits.Origin()) {
+                    std::map<PNamedShape, int>::iterator originIt = originIndices.find(traits.Origin());
+                    if (originIt == originIndices.end()) {
+                        originIndex = static_cast<int>(origins.size());
+                        originIndices[traits.Origin()] = originIndex;
+                        origins.push_back(traits.Origin());
+                    }
+                    else {
+                        originIndex = originIt->second;
+                    }
+                }
+                writeString(stream, traits.Name());
+                stream << originIndex << " " << traits.Index() << "\n";
+            }
+        }
+
+        stream << origins.size() << "\n";
+        for (ListPNamedShape::const_iterator it = origins.begin(); it != origins.end(); ++it) {
+            writeString(stream, (*it)->Name());
+            writeString(stream, (*it)->ShortName());
+        }
+    }
+
+    struct FaceMetaData
+    {
+        std::string name;
+        int originIndex;
+        unsigned int indexInOrigin;
+    };
+
+    struct ShapeMetaData
+    {
+        bool hasShape;
+        std::string name;
+        std::string shortName;
+        std::vector<FaceMetaData> faces;
+    };
+
+    bool readMetaData(std::istream& stream, std::vector<ShapeMetaData>& shapes, ListPNamedShape& origins)
+    {
+        size_t nShapes = 0;
+        if (!readValue(stream, nShapes)) {
+            return false;
+        }
+
+        shapes.resize(nShapes);
+        for (size_t iShape = 0; iShape < nShapes; ++iShape) {
+            ShapeMetaData& data = shapes[iShape];
+            int hasShape = 0;
+            if (!readValue(stream, hasShape)) {
+                return false;
+            }
+            data.hasShape = hasShape != 0;
+            if (!data.hasShape) {
+                continue;
+            }
+
+            size_t nFaces = 0;
+            if (!readString(stream, data.name) || !readString(stream, data.shortName) || !readValue(stream, nFaces)) {
+                return false;
+            }
+            stream.get();
+
+            data.faces.resize(nFaces);
+            for (size_t iFace = 0; iFace < nFaces; ++iFace) {
+                FaceMetaData& face = data.faces[iFace];
+                if (!readString(stream, face.name) || !readValue(stream, face.originIndex) || !readValue(stream, face.indexInOrigin)) {
+                    return false;
+                }
+                stream.get();
+            }
+        }
+
+        // the origins are restored as shapes without geometry, that only carry the names
+        size_t nOrigins = 0;
+        if (!readValue(stream, nOrigins)) {
+            return false;
+        }
+        stream.get();
+        for (size_t iOrigin = 0; iOrigin < nOrigins; ++iOrigin) {
+            std::string name, shortName;
+            if (!readString(stream, name) || !readString(stream, shortName)) {
+                return false;
+            }
+            origins.push_back(PNamedShape(new CNamedShape(TopoDS_Shape(), name.c_str(), shortName.c_str())));
+        }
+        return true;
+    }
+} // namespace
+
+CTiglDiskCache& CTiglDiskCache::GetInstance()
+{
+    static CTiglDiskCache instance;
+    return instance;
+}
+
+CTiglDiskCache::CTiglDiskCache()
+    : nHits(0)
+    , nMisses(0)
+    , nStores(0)
+{
+    const char* envDirectory = std::getenv("TIGL_CACHE_DIR");
+    if (envDirectory) {
+        directory = envDirectory;
+    }
+}
+
+void CTiglDiskCache::SetDirectory(const std::string& dir)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    directory = dir;
+}
+
+std::string CTiglDiskCache::GetDirectory() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return directory;
+}
+
+bool CTiglDiskCache::IsEnabled() const
+{
+    return !GetDirectory().empty();
+}
+
+std::string CTiglDiskCache::GetFileName(const std::string& key) const
+{
+    std::string dir = GetDirectory();
+    if (dir.empty()) {
+        return "";
+    }
+
+    char last = dir[dir.size() - 1];
+    if (last != '/' && last != '\\') {
+        dir += "/";
+    }
+
+    // two independent hashes reduce the probability of collisions
+    std::string fullKey = versionedKey(key);
+    return dir + toHex(hashString(fullKey, 14695981039346656037ULL))
+               + toHex(hashString(fullKey, 9650029242287828579ULL)) + ".tiglcache";
+}
+
+bool CTiglDiskCache::Load(const std::string& key, ListPNamedShape& shapes) const
+{
+    std::string filename = GetFileName(key);
+    if (filename.empty()) {
+        return false;
+    }
+
+    if (LoadFile(filename, key, shapes)) {
+        nHits++;
+        return true;
+    }
+    nMisses++;
+    return false;
+}
+
+bool CTiglDiskCache::LoadFile(const std::string& filename, const std::string& key, ListPNamedShape& shapes) const
+{
+    std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    std::vector<ShapeMetaData> metaData;
+    ListPNamedShape origins;
+    std::string magic, fileKey;
+    if (!std::getline(file, magic) || magic != CACHE_FILE_MAGIC || !readString(file, fileKey)) {
+        LOG(WARNING) << "Ignoring invalid cache file " << filename;
+        return false;
+    }
+
+    // the file name is only a hash of the key. In case of a collision,
+    // the file belongs to another entry.
+    if (fileKey != versionedKey(key)) {
+        return false;
+    }
+
+    if (!readMetaData(file, metaData, origins)) {
+        LOG(WARNING) << "Ignoring invalid cache file " << filename;
+        return false;
+    }
+
+    TopoDS_Shape compound;
+    try {
+        BinTools::Read(compound, file);
+    }
+    catch (Standard_Failure&) {
+        LOG(WARNING) << "Ignoring invalid cache file " << filename;
+        return false;
+    }
+
+    ListPNamedShape result;
+    TopoDS_Iterator shapeIt(compound);
+    for (std::vector<ShapeMetaData>::const_iterator it = metaData.begin(); it != metaData.end(); ++it) {
+        if (!it->hasShape) {
+            result.push_back(PNamedShape());
+            continue;
+        }
+        if (!shapeIt.More()) {
+            LOG(WARNING) << "Ignoring invalid cache file " << filename;
+            return false;
+        }
+
+        PNamedShape shape(new CNamedShape(shapeIt.Value(), it->name.c_str(), it->shortName.c_str()));
+        shapeIt.Next();
+        if (shape->GetFaceCount() != it->faces.size()) {
+            LOG(WARNING) << "Ignoring invalid cache file " << filename;
+            return false;
+        }
+
+        for (unsigned int iFace = 0; iFace < shape->GetFaceCount(); ++iFace) {
+            const FaceMetaData& face = it->faces[iFace];
+            CFaceTraits& traits = shape->FaceTraits(iFace);
+            traits.SetName(face.name.c_str());
+            traits.SetIndex(face.indexInOrigin);
+            if (face.originIndex >= 0 && static_cast<size_t>(face.originIndex) < origins.size()) {
+                traits.SetOrigin(origins[face.originIndex]);
+            }
+        }
+        result.push_back(shape);
+    }
+
+    shapes = result;
+    return true;
+}
+
+void CTiglDiskCache::Store(const std::string& key, const ListPNamedShape& shapes) const
+{
+    std::string filename = GetFileName(key);
+    if (filename.empty()) {
+        return;
+    }
+
+    TopoDS_Compound compound;
+    BRep_Builder builder;
+    builder.MakeCompound(compound);
+    for (ListPNamedShape::const_iterator it = shapes.begin(); it != shapes.end(); ++it) {
+        if (*it && !(*it)->Shape().IsNull()) {
+            builder.Add(compound, (*it)->Shape());
+        }
+    }
+
+    // write into a temporary file first, such that concurrent processes never read
+    // an incomplete entry. The name is unique for each process, thread and call.
+    static std::atomic<unsigned long> fileCounter(0);
+    std::stringstream tmpName;
+    tmpName << filename << "." << processId() << "." << std::hash<std::thread::id>()(std::this_thread::get_id())
+            << "." << fileCounter++ << ".tmp";
+
+    {
+        std::ofstream file(tmpName.str().c_str(), std::ios::out | std::ios::binary);
+        if (!file) {
+            LOG(WARNING) << "Cannot write cache file " << tmpName.str();
+            return;
+        }
+
+        file << CACHE_FILE_MAGIC << "\n";
+        writeString(file, versionedKey(key));
+        writeMetaData(file, shapes);
+        BinTools::Write(compound, file);
+        if (!file) {
+            LOG(WARNING) << "Cannot write cache file " << tmpName.str();
+            file.close();
+            std::remove(tmpName.str().c_str());
+            return;
+        }
+    }
+
+    if (std::rename(tmpName.str().c_str(), filename.c_str()) != 0) {
+        // another process might have stored the same entry already
+        std::remove(tmpName.str().c_str());
+        return;
+    }
+    nStores++;
+}
+
+unsigned long CTiglDiskCache::GetHitCount() const
+{
+    return nHits;
+}
+
+unsigned long CTiglDiskCache::GetMissCount() const
+{
+    return nMisses;
+}
+
+unsigned long CTiglDiskCache::GetStoreCount() const
+{
+    return nStores;
+}
+
+void CTiglDiskCache::ResetStatistics()
+{
+    nHits   = 0;
+    nMisses = 0;
+    nStores = 0;
+}
+
+void AppendTransformation(std::string& key, const CTiglTransformation& transformation)
+{
+    std::stringstream stream;
+    stream << std::setprecision(17);
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            stream << transformation.GetValue(row, col) << " ";
+        }
+    }
+    key += stream.str() + "\n";
+}
+
+} // namespace tigl
@@ -0,0 +1,130 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+ * @brief The CTiglDiskCache class stores shapes like lofts or fused planes
+ * in a directory, such that they can be reused by other processes.
+ *
+ * Each entry is identified by a key string, that describes all input data of
+ * the shape, e.g. the CPACS definition of the component. The key is hashed
+ * together with the TiGL and OpenCASCADE version to obtain the file name.
+ * The shapes are stored in the binary BRep format including their face names.
+ *
+ * The cache is disabled by default. It is enabled by setting the cache
+ * directory, either with SetDirectory or with the environment variable TIGL_CACHE_DIR.
+ */
+
+#ifndef CTIGLDISKCACHE_H
+#define CTIGLDISKCACHE_H
+
+#include "tigl_internal.h"
+#include "ListPNamedShape.h"
+#include "CTiglError.h"
+
+#include <tixi.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+namespace tigl
+{
+
+class CTiglTransformation;
+
+class CTiglDiskCache
+{
+public:
+    TIGL_EXPORT static CTiglDiskCache& GetInstance();
+
+    /// Sets the directory of the cache, which must exist. An empty string disables the cache.
+    TIGL_EXPORT void SetDirectory(const std::string& directory);
+
+    /// Returns the cache directory or an empty string, if the cache is disabled
+    TIGL_EXPORT std::string GetDirectory() const;
+
+    /// Returns true, if a cache directory is set
+    TIGL_EXPORT bool IsEnabled() const;
+
+    /// Loads the shapes stored for the key. Returns false, if no valid entry exists.
+    TIGL_EXPORT bool Load(const std::string& key, ListPNamedShape& shapes) const;
+
+    /// Stores the shapes for the key. Null shapes are allowed and restored as such.
+    TIGL_EXPORT void Store(const std::string& key, const ListPNamedShape& shapes) const;
+
+    /// Returns the name of the cache file for the key or an empty string, if the cache is disabled
+    TIGL_EXPORT std::string GetFileName(const std::string& key) const;
+
+    /// Returns the number of entries read by Load
+    TIGL_EXPORT unsigned long GetHitCount() const;
+
+    /// Returns the number of failed calls of Load, while the cache is enabled
+    TIGL_EXPORT unsigned long GetMissCount() const;
+
+    /// Returns the number of entries written by Store
+    TIGL_EXPORT unsigned long GetStoreCount() const;
+
+    /// Resets the hit, miss and store counters
+    TIGL_EXPORT void ResetStatistics();
+
+private:
+    CTiglDiskCache();
+
+    bool LoadFile(const std::string& filename, const std::string& key, ListPNamedShape& shapes) const;
+
+    mutable std::mutex mutex;
+    std::string directory;
+
+    mutable std::atomic<unsigned long> nHits;
+    mutable std::atomic<unsigned long> nMisses;
+    mutable std::atomic<unsigned long> nStores;
+};
+
+/**
+ * @brief Appends the values of the transformation matrix to key
+ */
+TIGL_EXPORT void AppendTransformation(std::string& key, const CTiglTransformation& transformation);
+
+/**
+ * @brief Appends the CPACS representation of a CPACS object to key,
+ * e.g. to identify cached shapes, that are computed from this object.
+ */
+template <class T>
+void AppendCPACSDefinition(std::string& key, const T& object)
+{
+    TixiDocumentHandle handle = -1;
+    if (tixiCreateDocument("definition", &handle) != SUCCESS) {
+        throw CTiglError("Cannot create document in AppendCPACSDefinition.");
+    }
+
+    try {
+        object.WriteCPACS(handle, "/definition");
+
+        char* text = NULL;
+        if (tixiExportDocumentAsString(handle, &text) == SUCCESS && text) {
+            key += text;
+        }
+    }
+    catch (...) {
+        tixiCloseDocument(handle);
+        throw;
+    }
+    tixiCloseDocument(handle);
+}
+
+} // namespace tigl
+
+#endif // CTIGLDISKCACHE_H
@@ -27,6 +27,7 @@
 #include "CTiglError.h"
 #include "CTiglShapeCache.h"
 #include "tiglcommonfunctions.h"
+#include "tiglparallel.h"
 
 #include "GeomAPI_IntSS.hxx"
 #include "BRep_Tool.hxx"
@@ -64,8 +65,18 @@
 #include "BRepPrimAPI_MakeHalfSpace.hxx"
 #include "BRepAlgoAPI_Cut.hxx"
 #include "BRepProj_Projection.hxx"
+#include "BRepBuilderAPI_Copy.hxx"
+#include "BRepBndLib.hxx"
+#include "Bnd_Box.hxx"
+#include "TopTools_IndexedMapOfShape.hxx"
+#include "TopExp.hxx"
+#include "TopoDS_Face.hxx"
+#include "Precision.hxx"
 
 #include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <set>
 #include <boost/functional/hash.hpp>
 
 #ifndef max
@@ -146,6 +157,141 @@ namespace
             return lhs;
         }
     }
+
+    // Joins two ids to the component part of a cache key.
+    // It should not matter, if the arguments One and Two are interchanged.
+    std::string joinIDsSymmetric(const std::string& idOne, const std::string& idTwo)
+    {
+        return idOne < idTwo ? idOne + "," + idTwo : idTwo + "," + idOne;
+    }
+
+    // cache key of the intersection of a shape with a plane
+    std::string planeIntersectionID(const std::string& shapeID, const gp_Pnt& point, const gp_Dir& normal)
+    {
+        return tigl::CTiglShapeCacheKey("plane", shapeID, HashablePlane(point, normal).HashValue()).ToString();
+    }
+
+    // computes the section of both shapes and connects the resulting edges to wires
+    TopoDS_Compound computeSectionWires(const TopoDS_Shape& compoundOne, const TopoDS_Shape& compoundTwo, double tolerance)
+    {
+        Standard_Boolean PerformNow=Standard_False;
+        BRepAlgoAPI_Section section(compoundOne, compoundTwo, PerformNow);
+        section.ComputePCurveOn1(Standard_True);
+        section.Approximation(Standard_True);
+        section.Build();
+        TopoDS_Shape result = section.Shape();
+        TopExp_Explorer myEdgeExplorer (result, TopAbs_EDGE);
+
+        Handle(TopTools_HSequenceOfShape) Edges = new TopTools_HSequenceOfShape();
+
+        while (myEdgeExplorer.More()) {
+            Edges->Append(TopoDS::Edge(myEdgeExplorer.Current()));
+            myEdgeExplorer.Next();
+        }
+
+        // connect all connected edges to wires and save them in container Edges again
+        ShapeAnalysis_FreeBounds::ConnectEdgesToWires(Edges, tolerance, false, Edges);
+        int numWires = Edges->Length();
+
+        TopoDS_Compound wires;
+        BRep_Builder builder;
+        builder.MakeCompound(wires);
+        std::vector<TopoDS_Wire> Wires;
+
+        // filter duplicated wires
+        for (int wireID=1; wireID <= numWires; wireID++) {
+            bool found = false;
+            TopoDS_Wire wire = TopoDS::Wire(Edges->Value(wireID));
+            for (std::vector<TopoDS_Wire>::size_type i = 0; i < Wires.size(); i++) {
+                if (Wires[i].HashCode(200000) == wire.HashCode(200000)) {
+                        found = true;
+                }
+            }
+
+            if (!found) {
+                Wires.push_back(wire);
+                builder.Add(wires, wire);
+            }
+        }
+        return wires;
+    }
+
+    // A face of the shape, together with its extent along the plane normal
+    struct StationFace
+    {
+        double dmin;
+        double dmax;
+        TopoDS_Face face;
+
+        bool operator<(const StationFace& other) const
+        {
+            return dmin < other.dmin;
+        }
+    };
+
+    // Intersects the faces, that can be hit by a plane, with the plane
+    class PlaneSectionTask
+    {
+    public:
+        PlaneSectionTask(const std::vector<StationFace>& faces,
+                         const std::vector<gp_Pnt>& points,
+                         const gp_Dir& normal,
+                         const std::vector<size_t>& planeIndices,
+                         double tolerance,
+                         std::vector<TopoDS_Compound>& results)
+            : faces(faces), points(points), normal(normal), planeIndices(planeIndices)
+            , tolerance(tolerance), results(results)
+            , copyShapes(tigl::GetNumberOfThreads() > 1)
+        {
+        }
+
+        void operator()(size_t i)
+        {
+            const gp_Pnt& point = points[planeIndices[i]];
+            double d = gp_Vec(normal).Dot(gp_Vec(point.XYZ()));
+
+            // the faces are sorted by their lower bound
+            StationFace upper;
+            upper.dmin = d + Precision::Confusion();
+            std::vector<StationFace>::const_iterator last = std::upper_bound(faces.begin(), faces.end(), upper);
+
+            TopoDS_Compound candidates;
+            BRep_Builder builder;
+            builder.MakeCompound(candidates);
+            bool hasCandidates = false;
+            for (std::vector<StationFace>::const_iterator it = faces.begin(); it != last; ++it) {
+                if (it->dmax >= d - Precision::Confusion()) {
+                    builder.Add(candidates, it->face);
+                    hasCandidates = true;
+                }
+            }
+
+            if (!hasCandidates) {
+                builder.MakeCompound(results[i]);
+                return;
+            }
+
+            // Stations are sectioned concurrently and neighbouring stations share
+            // candidate faces. ComputePCurveOn1 attaches the pcurves of the section
+            // edges to these faces, so each task works on its own copy.
+            TopoDS_Shape input = candidates;
+            if (copyShapes) {
+                input = BRepBuilderAPI_Copy(candidates).Shape();
+            }
+
+            TopoDS_Shape plane = BRepBuilderAPI_MakeFace(gp_Pln(point, normal));
+            results[i] = computeSectionWires(input, plane, tolerance);
+        }
+
+    private:
+        const std::vector<StationFace>& faces;
+        const std::vector<gp_Pnt>& points;
+        gp_Dir normal;
+        const std::vector<size_t>& planeIndices;
+        double tolerance;
+        std::vector<TopoDS_Compound>& results;
+        bool copyShapes;
+    };
 }
 
 
@@ -160,9 +306,12 @@ CTiglIntersectionCalculation::CTiglIntersectionCalculation(CTiglShapeCache * cac
                                                            TopoDS_Shape compoundTwo)
     : tolerance(1.0e-7)
 {
-    size_t hash1 = boost::hash<std::string>()(idOne);
-    size_t hash2 = boost::hash<std::string>()(idTwo);
-    computeIntersection(cache, hash1, hash2, compoundOne, compoundTwo);
+    std::string intersectionID = CTiglShapeCacheKey("shapes", joinIDsSymmetric(idOne, idTwo), 0).ToString();
+
+    std::vector<std::string> componentUIDs;
+    componentUIDs.push_back(idOne);
+    componentUIDs.push_back(idTwo);
+    computeIntersection(cache, intersectionID, compoundOne, compoundTwo, componentUIDs);
 }
 
 // Compute intersection of a shape with a plane
@@ -174,12 +323,9 @@ CTiglIntersectionCalculation::CTiglIntersectionCalculation(CTiglShapeCache* cach
     : tolerance(1.0e-7)
 {
 
-    size_t hash1 = boost::hash<std::string>()(shapeID);
-    size_t hash2 = HashablePlane(point, normal).HashValue();
-
     // create plane
     TopoDS_Shape plane = BRepBuilderAPI_MakeFace(gp_Pln(point, normal));
-    computeIntersection(cache, hash1, hash2, shape, plane);
+    computeIntersection(cache, planeIntersectionID(shapeID, point, normal), shape, plane, std::vector<std::string>(1, shapeID));
 }
 
 // Computes the intersection of a shape with a plane segment,
@@ -198,25 +344,21 @@ CTiglIntersectionCalculation::CTiglIntersectionCalculation(CTiglShapeCache* cach
 {
 
     // create hash
-    size_t hash = boost::hash<std::string>()(shapeID);
-    size_t hashP1P2 = hash_combine_symmetric( HashableProjection(point1, normal).HashValue(), HashableProjection(point2, normal).HashValue() );
-    boost::hash_combine(hash, hashP1P2);
+    size_t hash = hash_combine_symmetric( HashableProjection(point1, normal).HashValue(), HashableProjection(point2, normal).HashValue() );
     //TODO make hash independent of sign of normal
     boost::hash_combine(hash, normal.X());
     boost::hash_combine(hash, normal.Y());
     boost::hash_combine(hash, normal.Z());
+    boost::hash_combine(hash, forceOrthogonal);
 
-    std::stringstream s;
-    s << "int" << hash;
-    id = s.str();
+    id = CTiglShapeCacheKey("planesegment", shapeID, hash).ToString();
 
     bool inCache = false;
-    if (cache) {
-        // check, if result is already in cache
-        if (cache->HasShape(id)) {
-            intersectionResult = TopoDS::Compound(cache->GetShape(id));
-            inCache = true;
-        }
+    TopoDS_Shape cachedResult;
+    if (cache && cache->Find(id, cachedResult)) {
+        // result is already in cache
+        intersectionResult = TopoDS::Compound(cachedResult);
+        inCache = true;
     }
 
     if (!inCache) {
@@ -239,7 +381,7 @@ CTiglIntersectionCalculation::CTiglIntersectionCalculation(CTiglShapeCache* cach
 
         //add to cache
         if (cache) {
-            cache->Insert(intersectionResult, id);
+            cache->Insert(intersectionResult, id, std::vector<std::string>(1, shapeID));
         }
     }
 }
@@ -252,20 +394,19 @@ CTiglIntersectionCalculation::CTiglIntersectionCalculation(CTiglShapeCache* cach
                                                            double tol)
     : tolerance(tol)
 {
-    size_t hash = hash_combine_symmetric( boost::hash<std::string>()(wireID1),
-                                          boost::hash<std::string>()(wireID2) );
+    // the result depends on the selected wires, i.e. on the indices in the order of the ids
+    size_t hash = wireID1 < wireID2 ? boost::hash_value(wireIdx1) : boost::hash_value(wireIdx2);
+    boost::hash_combine(hash, wireID1 < wireID2 ? wireIdx2 : wireIdx1);
+    boost::hash_combine(hash, tolerance);
 
-    std::stringstream s;
-    s << "int" << hash;
-    id = s.str();
+    id = CTiglShapeCacheKey("curves", joinIDsSymmetric(wireID1, wireID2), hash).ToString();
 
     bool inCache = false;
-    if (cache) {
-        // check, if result is already in cache
-        if (cache->HasShape(id)) {
-            intersectionResult = TopoDS::Compound(cache->GetShape(id));
-            inCache = true;
-        }
+    TopoDS_Shape cachedResult;
+    if (cache && cache->Find(id, cachedResult)) {
+        // result is already in cache
+        intersectionResult = TopoDS::Compound(cachedResult);
+        inCache = true;
     }
 
     if (!inCache) {
@@ -292,9 +433,12 @@ CTiglIntersectionCalculation::CTiglIntersectionCalculation(CTiglShapeCache* cach
         }
 
 
-        //add to cache
+        //add to cache, the result depends on the same components as the two wires
         if (cache) {
-            cache->Insert(intersectionResult, id);
+            std::vector<std::string> componentUIDs = cache->GetComponentUIDs(wireID1);
+            std::vector<std::string> componentUIDs2 = cache->GetComponentUIDs(wireID2);
+            componentUIDs.insert(componentUIDs.end(), componentUIDs2.begin(), componentUIDs2.end());
+            cache->Insert(intersectionResult, id, componentUIDs);
         }
     }
 
@@ -305,12 +449,13 @@ CTiglIntersectionCalculation::CTiglIntersectionCalculation(CTiglShapeCache& cach
     : tolerance(1.0e-7)
 {
     // check that intersectionID is in cache
-    if (!cache.HasShape(intersectionID)) {
+    TopoDS_Shape cachedResult;
+    if (!cache.Find(intersectionID, cachedResult)) {
         throw CTiglError("The given intersectionID can not be found.", TIGL_NOT_FOUND);
     }
     
     try {
-        intersectionResult = TopoDS::Compound(cache.GetShape(intersectionID));
+        intersectionResult = TopoDS::Compound(cachedResult);
     }
     catch (Standard_TypeMismatch&) {
         throw CTiglError("The given intersectionID is invalid.", TIGL_NOT_FOUND);
@@ -320,81 +465,103 @@ CTiglIntersectionCalculation::CTiglIntersectionCalculation(CTiglShapeCache& cach
 }
 
 void CTiglIntersectionCalculation::computeIntersection(CTiglShapeCache * cache,
-                                                       size_t hashOne,
-                                                       size_t hashTwo,
+                                                       const std::string& intersectionID,
                                                        TopoDS_Shape compoundOne,
-                                                       TopoDS_Shape compoundTwo)
+                                                       TopoDS_Shape compoundTwo,
+                                                       const std::vector<std::string>& componentUIDs)
 {
-    // create some identification id to store intersection in cache
-    // it should not matter, if the arguments One and Two are interchanged
-    // the xor commutes, so this should work
-    size_t tmpid;
-    if (hashOne != hashTwo) {
-        tmpid = hash_combine_symmetric(hashOne, hashTwo);
-    }
-    else
-    {
-        tmpid = hashOne;
-    }
-    std::stringstream s;
-    s << "int" << tmpid;
-    id = s.str();
+    id = intersectionID;
 
     bool inCache = false;
-    if (cache) {
-        // check, if result is already in cache
-        if (cache->HasShape(id)) {
-            intersectionResult = TopoDS::Compound(cache->GetShape(id));
-            inCache = true;
-        }
+    TopoDS_Shape cachedResult;
+    if (cache && cache->Find(id, cachedResult)) {
+        // result is already in cache
+        intersectionResult = TopoDS::Compound(cachedResult);
+        inCache = true;
     }
 
     if (!inCache) {
-        Standard_Boolean PerformNow=Standard_False;
-        BRepAlgoAPI_Section section(compoundOne, compoundTwo, PerformNow);
-        section.ComputePCurveOn1(Standard_True);
-        section.Approximation(Standard_True);
-        section.Build();
-        TopoDS_Shape result = section.Shape();
-        TopExp_Explorer myEdgeExplorer (result, TopAbs_EDGE);
-
-        Handle(TopTools_HSequenceOfShape) Edges = new TopTools_HSequenceOfShape();
+        intersectionResult = computeSectionWires(compoundOne, compoundTwo, tolerance);
 
-        while (myEdgeExplorer.More()) {
-            Edges->Append(TopoDS::Edge(myEdgeExplorer.Current()));
-            myEdgeExplorer.Next();
+        // add to cache
+        if (cache) {
+            cache->Insert(intersectionResult, id, componentUIDs);
         }
+    }
+}
 
-        // connect all connected edges to wires and save them in container Edges again
-        ShapeAnalysis_FreeBounds::ConnectEdgesToWires(Edges, tolerance, false, Edges);
-        int numWires = Edges->Length();
+void CTiglIntersectionCalculation::IntersectWithPlanes(CTiglShapeCache& cache,
+                                                       const std::string& shapeID,
+                                                       const TopoDS_Shape& shape,
+                                                       const std::vector<gp_Pnt>& points,
+                                                       const gp_Dir& normal,
+                                                       std::vector<std::string>& intersectionIDs)
+{
+    const double tolerance = 1.0e-7;
+
+    // collect all planes, that are not yet computed, and the cached results of the others
+    intersectionIDs.resize(points.size());
+    std::vector<size_t> planeIndices;
+    std::set<std::string> knownIDs;
+    std::vector<std::string> batchIDs;
+    std::vector<TopoDS_Shape> batchShapes;
+    for (size_t i = 0; i < points.size(); ++i) {
+        intersectionIDs[i] = planeIntersectionID(shapeID, points[i], normal);
+        if (!knownIDs.insert(intersectionIDs[i]).second) {
+            continue;
+        }
 
-        intersectionResult.Nullify();
-        BRep_Builder builder;
-        builder.MakeCompound(intersectionResult);
-        std::vector<TopoDS_Wire> Wires;
+        // GetShape does not count the lookup as a cache miss
+        TopoDS_Shape cachedResult = cache.GetShape(intersectionIDs[i]);
+        if (cachedResult.IsNull()) {
+            planeIndices.push_back(i);
+        }
+        else {
+            batchIDs.push_back(intersectionIDs[i]);
+            batchShapes.push_back(cachedResult);
+        }
+    }
 
-        // filter duplicated wires
-        for (int wireID=1; wireID <= numWires; wireID++) {
-            bool found = false;
-            TopoDS_Wire wire = TopoDS::Wire(Edges->Value(wireID));
-            for (std::vector<TopoDS_Wire>::size_type i = 0; i < Wires.size(); i++) {
-                if (Wires[i].HashCode(200000) == wire.HashCode(200000)) {
-                        found = true;
-                }
-            }
+    if (planeIndices.empty()) {
+        return;
+    }
 
-            if (!found) {
-                Wires.push_back(wire);
-                builder.Add(intersectionResult, wire);
-            }
+    // compute the extent of all faces along the normal direction
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    std::vector<StationFace> faces;
+    faces.reserve(faceMap.Extent());
+    for (int iFace = 1; iFace <= faceMap.Extent(); ++iFace) {
+        Bnd_Box box;
+        BRepBndLib::Add(faceMap(iFace), box, Standard_False);
+        if (box.IsVoid()) {
+            continue;
         }
 
-        // add to cache
-        if (cache) {
-            cache->Insert(intersectionResult, id);
-        }
+        Standard_Real xmin, ymin, zmin, xmax, ymax, zmax;
+        box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        double center = 0.5 * (normal.X() * (xmin + xmax) + normal.Y() * (ymin + ymax) + normal.Z() * (zmin + zmax));
+        double extent = 0.5 * (fabs(normal.X()) * (xmax - xmin) + fabs(normal.Y()) * (ymax - ymin) + fabs(normal.Z()) * (zmax - zmin));
+
+        StationFace face;
+        face.dmin = center - extent;
+        face.dmax = center + extent;
+        face.face = TopoDS::Face(faceMap(iFace));
+        faces.push_back(face);
+    }
+    std::sort(faces.begin(), faces.end());
+
+    std::vector<TopoDS_Compound> results(planeIndices.size());
+    PlaneSectionTask task(faces, points, normal, planeIndices, tolerance, results);
+    ParallelFor(planeIndices.size(), task);
+
+    // Insert all results at once, including the cached ones. Single inserts could evict
+    // results of this call due to the memory limit, before their ids are returned.
+    for (size_t i = 0; i < planeIndices.size(); ++i) {
+        batchIDs.push_back(intersectionIDs[planeIndices[i]]);
+        batchShapes.push_back(results[i]);
     }
+    cache.Insert(batchShapes, batchIDs, std::vector<std::string>(1, shapeID));
 }
 
 // Destructor
@@ -37,6 +37,8 @@
 #include "ShapeAnalysis_Wire.hxx"
 #include "TopTools_HSequenceOfShape.hxx"
 #include "ShapeAnalysis_FreeBounds.hxx"
+#include <string>
+#include <vector>
 
 
 namespace tigl 
@@ -64,6 +66,18 @@ public:
                                              gp_Pnt point,
                                              gp_Dir normal );
 
+    // Computes the intersections of a shape with multiple parallel planes, each
+    // defined by a point on the plane and the common normal vector. Each plane
+    // is only intersected with the faces of the shape, whose bounding box it cuts.
+    // The sections are computed in parallel and stored in the cache. The ids of the
+    // results are returned in the order of the points.
+    TIGL_EXPORT static void IntersectWithPlanes(CTiglShapeCache& cache,
+                                                const std::string& shapeID,
+                                                const TopoDS_Shape& shape,
+                                                const std::vector<gp_Pnt>& points,
+                                                const gp_Dir& normal,
+                                                std::vector<std::string>& intersectionIDs);
+
     // Computes the intersection of a shape with a plane segment,
     // that is defined by two points p1 and p2 and a vector w in
     // the following way: p(u,v) = p1 (1-u) + p2u + wv, with
@@ -120,10 +134,10 @@ public:
 
 protected:
     void computeIntersection(CTiglShapeCache* cache,
-                             size_t hashOne,
-                             size_t hashTwo,
+                             const std::string& intersectionID,
                              TopoDS_Shape compoundOne,
-                             TopoDS_Shape compoundTwo );
+                             TopoDS_Shape compoundTwo,
+                             const std::vector<std::string>& componentUIDs);
 
 private:        
     Standard_Real tolerance;
@@ -20,19 +20,22 @@
 */
 
 #include "CTiglPolyData.h"
+#include "CTiglVtkWriter.h"
 #include "CTiglPoint.h"
 #include "CTiglError.h"
 #include "CTiglLogging.h"
 #include "tigl.h"
-#include "tixi.h"
-#include "to_string.h"
 
 #include <iostream>
 #include <cassert>
 #include <vector>
 #include <map>
+#include <algorithm>
 #include <set>
+#include <unordered_map>
 #include <utility>
+#include <cmath>
+#include <climits>
 
 #include <fstream>
 #include <cfloat>
@@ -48,214 +51,168 @@ using namespace tigl;
 #define COMP_TOLERANCE 1.e-10
 
 
-struct TiglPointComparer;
-
-class PointImpl 
+// Spatial hash grid used to weld vertices that are closer than the
+// comparison tolerance. The grid cell size equals the tolerance, hence all
+// candidates for a point are located in the 27 neighbouring cells.
+// The vertices of a cell are stored as a singly linked list inside a
+// contiguous vector, which avoids an allocation per cell.
+class VertexGrid
 {
 public:
-    PointImpl() : 
-        p_(CTiglPoint(0,0,0)),
-        n_(CTiglPoint(1,0,0)) 
+    VertexGrid()
+        : invCellSize(1. / sqrt(COMP_TOLERANCE))
     {
     }
 
-    PointImpl(const CTiglPoint& p, const CTiglPoint& n) : p_(p), n_(n) 
+    // Returns the smallest index of a vertex that is equal to p and n
+    // within the tolerance or ULONG_MAX, if no such vertex exists
+    unsigned long find(const CTiglPoint& p, const CTiglPoint& n,
+                       const std::vector<double>& points,
+                       const std::vector<double>& normals) const
     {
-        realDataMap.clear();
+        const CellKey cell = cellOf(p);
+        unsigned long found = ULONG_MAX;
+        for (long long di = -1; di <= 1; ++di) {
+            for (long long dj = -1; dj <= 1; ++dj) {
+                for (long long dk = -1; dk <= 1; ++dk) {
+                    CellKey neighbor = {cell.i + di, cell.j + dj, cell.k + dk};
+                    CellMap::const_iterator it = cells.find(neighbor);
+                    if (it == cells.end()) {
+                        continue;
+                    }
+                    for (unsigned long idx = it->second; idx != ULONG_MAX; idx = nextInCell[idx]) {
+                        if (idx < found &&
+                            distance2(&points[3*idx], p) < COMP_TOLERANCE &&
+                            distance2(&normals[3*idx], n) < COMP_TOLERANCE) {
+                            found = idx;
+                        }
+                    }
+                }
+            }
+        }
+        return found;
     }
 
-    CTiglPoint& point(){ return p_; }
-    CTiglPoint& normal(){ return n_; }
-
-    const CTiglPoint& getPoint() const { return p_; }
-    const CTiglPoint& getNormal()const { return n_; }
-    
-    void setRealData(const char * txt, double value)
-    {
-        realDataMap[txt] = value;
-    }
-    
-    double getRealData(const char * txt) const 
+    // Inserts vertex with index "index" located at p. Indices must be inserted in ascending order.
+    void insert(unsigned long index, const CTiglPoint& p)
     {
-        std::map<std::string, double>::const_iterator it=realDataMap.find(txt);
-        if (it != realDataMap.end()) {
-            return it->second;
+        assert(index == nextInCell.size());
+        std::pair<CellMap::iterator, bool> ret = cells.insert(std::make_pair(cellOf(p), index));
+        if (ret.second) {
+            nextInCell.push_back(ULONG_MAX);
         }
         else {
-            return UNDEFINED_REAL;
+            // prepend to the list of the cell
+            nextInCell.push_back(ret.first->second);
+            ret.first->second = index;
         }
     }
 
 private:
-    CTiglPoint p_;
-    CTiglPoint n_;
-    
-    std::map<std::string, double> realDataMap;
-};
-
-typedef std::map<PointImpl, unsigned int, TiglPointComparer> PointMap;
-
-// Comparer for gp_Pnts
-struct TiglPointComparer
-{
-    bool isSmaller(const CTiglPoint& lhs, const CTiglPoint& rhs) const 
+    struct CellKey
     {
-        // if two points lie inside the epsilon environment
-        // they should be the same, hence lhs is not smaller than rhs
-        if (lhs.distance2(rhs) < COMP_TOLERANCE ) {
-            return false;
-        }
-
+        long long i, j, k;
 
-        // as lhs and rhs don't lie inside an epsilon environment
-        if (lhs.x < rhs.x) {
-            return true;
-        }
-        else if (lhs.x == rhs.x) {
-            if (lhs.y < rhs.y) {
-                return true;
-            }
-            else if (lhs.y == rhs.y) {
-                return lhs.z < rhs.z;
-            }
-            else {
-                return false;
-            }
-        }
-        else {
-            return false;
+        bool operator==(const CellKey& other) const
+        {
+            return i == other.i && j == other.j && k == other.k;
         }
-    }
-
+    };
 
-    // function should only return true, if lhs < rhs
-    bool operator()(const PointImpl& lhs, const PointImpl& rhs) const
+    struct CellKeyHash
     {
-        const CTiglPoint& leftP  = lhs.getPoint();
-        const CTiglPoint& rightP = rhs.getPoint();
-
-        const CTiglPoint& leftN  = lhs.getNormal();
-        const CTiglPoint& rightN = rhs.getNormal();
-
-        if (isSmaller(leftP,rightP)) {
-            return true;
-        }
-        else {
-            // if points are equal, compare normals
-            if (leftP.distance2(rightP) <  COMP_TOLERANCE ) {
-                return isSmaller(leftN, rightN);
-            }
-            else {
-                return false;
-            }
+        size_t operator()(const CellKey& key) const
+        {
+            size_t h = static_cast<size_t>(key.i) * 73856093u;
+            h ^= static_cast<size_t>(key.j) * 19349663u;
+            h ^= static_cast<size_t>(key.k) * 83492791u;
+            return h;
         }
-    }
-};
+    };
 
+    typedef std::unordered_map<CellKey, unsigned long, CellKeyHash> CellMap;
 
-//class to store a polygon by its point indices
-struct PolyIndexList
-{
-    PolyIndexList(int num) : _metadata("")
+    static double distance2(const double* xyz, const CTiglPoint& p)
     {
-        myid = num;
+        const double dx = xyz[0] - p.x;
+        const double dy = xyz[1] - p.y;
+        const double dz = xyz[2] - p.z;
+        return dx*dx + dy*dy + dz*dz;
     }
 
-    void setMetadata(const std::string& str)
+    CellKey cellOf(const CTiglPoint& p) const
     {
-        _metadata = str;
+        CellKey key = {
+            static_cast<long long>(std::floor(p.x * invCellSize)),
+            static_cast<long long>(std::floor(p.y * invCellSize)),
+            static_cast<long long>(std::floor(p.z * invCellSize))
+        };
+        return key;
     }
 
-    const std::string& getMetadata() const
-    {
-        return _metadata;
-    }
-    
-    void addPoint(int index);
-    
-    void setRealData(const char * txt, double value)
-    {
-        realDataMap[txt] = value;
-    }
-    
-    double getRealData(const char * txt) const 
-    {
-        std::map<std::string, double>::const_iterator it=realDataMap.find(txt);
-        if (it != realDataMap.end()) {
-            return it->second;
-        }
-        else {
-            return UNDEFINED_REAL;
-        }
-    }
-    
-    int getNVert() const
-    {
-        return static_cast<int>(pindex.size());
-    }
+    double invCellSize;
 
-    int getPointIndex(int i) const
-    {
-        return pindex.at(i);
-    }
-    
-private:
-    std::vector<int> pindex;
+    // maps a grid cell to the last inserted vertex of this cell
+    CellMap cells;
 
-    //each polygon should have it's own metadata
-    std::string _metadata;
-    
-    std::map<std::string, double> realDataMap;
-
-    int myid;
+    // index of the next vertex in the same cell
+    std::vector<unsigned long> nextInCell;
 };
 
+// Named data columns, each column has one entry per vertex or polygon
+typedef std::map<std::string, std::vector<double> > DataColumns;
 
 class ObjectImpl 
 {
 public:
     ObjectImpl()
     {
-        pointlist.clear();
-        polys.clear();
-        pPoints.clear();
         has_normals = false;
         has_metadata = false;
         metaDataElements = "";
     }
 
-    void addPointNorm(const CTiglPoint &p, const CTiglPoint& norm, long polynum);
     unsigned long addPointNorm(const CTiglPoint &p, const CTiglPoint &norm);
     
     unsigned long addTriangleByVertexIndex(unsigned long i1, unsigned long i2, unsigned long i3 );
     
     void addPolygon(const CTiglPolygon&);
+
+    void addObject(const ObjectImpl&);
     
+    unsigned long getNVertices() const;
     unsigned long getNPolygons() const;
     unsigned long getNPointsOfPolygon(unsigned long ipoly) const;
 
-    const CTiglPoint& getVertexPoint(unsigned long iVertexIndex) const;
-    const CTiglPoint& getVertexNormal(unsigned long iVertexIndex) const;
-
     unsigned long getVertexIndexOfPolygon(unsigned long ipoint, unsigned long ipoly) const;
 
     bool has_normals;
     bool has_metadata;
 
-    // we use this container to store point data, it allows us to find
-    // efficiently a specific point in the list
-    PointMap pointlist;
+    // vertex coordinates and normals, stored as x0, y0, z0, x1, y1, z1, ...
+    std::vector<double> points;
+    std::vector<double> normals;
 
-    // this vector keeps track of the order of points, it complies with
-    // the polygon indices
-    std::vector<PointImpl*> pPoints;
+    // this grid allows us to efficiently find already inserted vertices
+    VertexGrid grid;
 
-    std::vector<PolyIndexList> polys;
-    
-    std::set<std::string> polyDataElems;
-    std::set<std::string> vertexDataElems;
+    // vertex indices of all polygons
+    std::vector<unsigned int> connectivity;
+
+    // end of each polygon in the connectivity array
+    std::vector<unsigned int> offsets;
+
+    // metadata of each polygon, only allocated if metadata are set
+    std::vector<std::string> polyMetadata;
+
+    DataColumns polyData;
+    DataColumns vertexData;
     
     std::string metaDataElements;
+
+private:
+    // closes the polygon consisting of all indices added since the last polygon
+    void finishPolygon();
 };
 
 
@@ -338,237 +295,15 @@ unsigned long CTiglPolyData::getTotalVertexCount()
     return nVertices;
 }
 
-void CTiglPolyData::writeVTK(const char *filename)
+void CTiglPolyData::writeVTK(const char *filename, VtkDataEncoding encoding, bool compressed)
 {
-    TixiDocumentHandle handle;
-    createVTK(handle);
-    if (tixiSaveDocument(handle, filename)!= SUCCESS) {
-        throw CTiglError("Error saving vtk file!");
-    }
+    CTiglVtkWriter writer(encoding, compressed);
+    writer.Write(*this, filename);
+
     LOG(INFO) << "VTK Export succeeded with " << getTotalPolygonCount()
               << " polygons and " << getTotalVertexCount() << " vertices." << std::endl;
 }
 
-void CTiglPolyData::createVTK(TixiDocumentHandle& handle)
-{
-    tixiCreateDocument("VTKFile", &handle);
-    tixiAddTextAttribute(handle, "/VTKFile", "type", "PolyData");
-    tixiAddTextAttribute(handle, "/VTKFile", "version", "0.1");
-    tixiAddTextAttribute(handle, "/VTKFile", "byte_order", "LittleEndian");
-    tixiAddTextAttribute(handle, "/VTKFile", "compressor", "vtkZLibDataCompressor");
-
-    std::stringstream stream;
-    stream << "tigl " << tiglGetVersion();
-    tixiCreateElement(handle, "/VTKFile","MetaData");
-    tixiAddTextAttribute(handle, "/VTKFile/MetaData", "creator", stream.str().c_str());
-    
-    tixiCreateElement(handle, "/VTKFile", "PolyData");
-
-    for (unsigned int iobj = 1; iobj <= getNObjects(); ++iobj ) {
-        writeVTKPiece(handle, iobj);
-    }
-}
-
-void setMinMax(const CTiglPoint& p, double* oldmin, double* oldmax)
-{
-    if (p.x > *oldmax) {
-        *oldmax = p.x;
-    }
-
-    if (p.y > *oldmax) {
-        *oldmax = p.y;
-    }
-
-    if (p.z > *oldmax) {
-        *oldmax = p.z;
-    }
-
-    if (p.x < *oldmin) {
-        *oldmin = p.x;
-    }
-
-    if (p.y < *oldmin) {
-        *oldmin = p.y;
-    }
-
-    if (p.z < *oldmin) {
-        *oldmin = p.z;
-    }
-}
-
-// writes the polygon data of a surface (in vtk they call it piece)
-void CTiglPolyData::writeVTKPiece(TixiDocumentHandle& handle, unsigned int iObject)
-{
-    CTiglPolyObject& co = switchObject(iObject);
-
-    if (co.getNPolygons() == 0) {
-        return;
-    }
-
-    // count number of vertices - this is not necessarily the number of points
-    int nvert = 0;
-    for (unsigned int i = 0; i < co.getNPolygons(); ++i) {
-        nvert += co.getNPointsOfPolygon(i);
-    }
-
-    if (nvert <= 0) {
-        return;
-    }
-
-    // surface specific stuff
-    tixiCreateElement(handle, "/VTKFile/PolyData","Piece");
-
-    const std::string piecepath = "/VTKFile/PolyData/Piece[" + std_to_string(iObject) + "]";
-
-    tixiAddIntegerAttribute(handle, piecepath.c_str(), "NumberOfPoints", co.getNVertices(), "%d");
-    tixiAddIntegerAttribute(handle, piecepath.c_str(), "NumberOfVerts",  0, "%d");
-    tixiAddIntegerAttribute(handle, piecepath.c_str(), "NumberOfLines",  0, "%d");
-    tixiAddIntegerAttribute(handle, piecepath.c_str(), "NumberOfStrips", 0, "%d");
-    tixiAddIntegerAttribute(handle, piecepath.c_str(), "NumberOfPolys",  co.getNPolygons(), "%d");
-
-    tixiCreateElement(handle, piecepath.c_str(), "Points");
-
-    //points
-    {
-        unsigned int nPoints = co.getNVertices();
-        std::stringstream stream1;
-        stream1 << std::endl <<   "         ";
-        double min_coord = DBL_MAX, max_coord = DBL_MIN;
-        for (unsigned int i = 0; i < nPoints; ++i) {
-            const CTiglPoint& p = co.getVertexPoint(i);
-            setMinMax(p, &min_coord, &max_coord);
-            stream1 << "    " << std::setprecision(10) << p.x << " " << p.y << " " << p.z << std::endl;
-            stream1 << "         ";
-        }
-        std::string tmpPath = piecepath + "/Points";
-        tixiAddTextElement(handle, tmpPath.c_str(), "DataArray", stream1.str().c_str());
-        tmpPath += "/DataArray";
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "type", "Float64");
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "Name", "Points");
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "NumberOfComponents", "3");
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "format", "ascii");
-        tixiAddDoubleAttribute(handle, tmpPath.c_str(), "RangeMin", min_coord ,"%f");
-        tixiAddDoubleAttribute(handle, tmpPath.c_str(), "RangeMax", max_coord ,"%f");
-    }
-
-    //normals
-    if (co.hasNormals()) {
-        tixiCreateElement(handle, piecepath.c_str(), "PointData");
-        std::string tmpPath = piecepath + "/PointData";
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "Normals", "surf_normals");
-
-        std::stringstream stream;
-        double min_coord = DBL_MAX, max_coord = DBL_MIN;
-        stream << endl  << "        ";
-        for (unsigned int i=0; i < co.getNVertices(); ++i) {
-             const CTiglPoint& n = co.getVertexNormal(i);
-             setMinMax(n, &min_coord, &max_coord);
-             stream << "    " << n.x << " " << n.y << " "  << n.z << endl;
-             stream <<  "        ";
-        }
-
-        tixiAddTextElement(handle, tmpPath.c_str(), "DataArray", stream.str().c_str());
-        tmpPath += "/DataArray";
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "type", "Float64");
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "Name", "surf_normals");
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "NumberOfComponents", "3");
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "format", "ascii");
-        tixiAddDoubleAttribute(handle, tmpPath.c_str(), "RangeMin", min_coord ,"%f");
-        tixiAddDoubleAttribute(handle, tmpPath.c_str(), "RangeMax", max_coord ,"%f");
-    }
-
-    //polygons
-    {
-        tixiCreateElement(handle, piecepath.c_str(), "Polys");
-        std::stringstream stream2;
-        stream2 << std::endl <<   "        ";
-        for (unsigned int iPoly = 0; iPoly < co.getNPolygons(); ++iPoly) {
-            stream2 <<     "    ";
-            for (unsigned int jPoint = 0; jPoint < co.getNPointsOfPolygon(iPoly); ++jPoint ) {
-                stream2 << co.getVertexIndexOfPolygon(jPoint, iPoly) << " ";
-            }
-            stream2  << std::endl <<  "        ";;
-        }
-
-        std::string tmpPath = piecepath + "/Polys";
-        tixiAddTextElement(handle, tmpPath.c_str(), "DataArray", stream2.str().c_str());
-        tmpPath += "/DataArray";
-        tixiAddTextAttribute(handle,tmpPath.c_str(), "type", "Int32");
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "Name", "connectivity");
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "format", "ascii");
-        tixiAddIntegerAttribute(handle, tmpPath.c_str(), "RangeMin", 0 ,"%d");
-        tixiAddIntegerAttribute(handle, tmpPath.c_str(), "RangeMax", co.getNVertices()-1,"%d");
-    }
-
-    //offset
-    {
-        unsigned int next = 0;
-        std::stringstream stream3;
-        for (unsigned int i = 0; i < co.getNPolygons(); i ++) {
-            if ((i % 10 == 0) && (i != (co.getNPolygons() - 1))) {
-                stream3 << endl << "            ";
-            }
-            next += co.getNPointsOfPolygon(i);
-            stream3 << " " << next;
-        }
-        stream3 << endl << "        ";
-        std::string tmpPath = piecepath + "/Polys";
-        tixiAddTextElement(handle, tmpPath.c_str(), "DataArray", stream3.str().c_str());
-        tmpPath += "/DataArray[2]";
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "type", "Int32");
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "Name", "offsets");
-        tixiAddIntegerAttribute(handle, tmpPath.c_str(), "RangeMin", co.getNPointsOfPolygon(0) ,"%d");
-        tixiAddIntegerAttribute(handle, tmpPath.c_str(), "RangeMax", nvert,"%d");
-    }
-    
-    // write cell data
-    if (currentObject().getNumberOfPolyRealData() > 0) {
-        tixiCreateElement(handle, piecepath.c_str(), "CellData");
-        const std::string tmpPath = piecepath + "/CellData";
-        
-        for (unsigned int iData = 0; iData < currentObject().getNumberOfPolyRealData(); ++iData) {
-            const char * dataField = currentObject().getPolyDataFieldName(iData);
-            std::stringstream stream;
-            for (unsigned long jPoly = 0; jPoly < currentObject().getNPolygons(); ++jPoly) {
-                stream << currentObject().getPolyDataReal(jPoly, dataField) << " ";
-            }
-            tixiAddTextElement(handle, tmpPath.c_str(), "DataArray", stream.str().c_str());
-            const std::string path = tmpPath + "/DataArray[" + std_to_string(iData + 1) + "]";
-            tixiAddTextAttribute(handle, path.c_str(), "type", "Float64");
-            tixiAddTextAttribute(handle, path.c_str(), "Name", dataField);
-            tixiAddTextAttribute(handle, path.c_str(), "NumberOfComponents", "1");
-            tixiAddTextAttribute(handle, path.c_str(), "format", "ascii");
-            tixiAddDoubleAttribute(handle, path.c_str(), "RangeMin", 0. ,"%f");
-            tixiAddDoubleAttribute(handle, path.c_str(), "RangeMax", 1. ,"%f");
-        }
-    }
-
-    // write metadata
-    if (currentObject().hasMetadata()) {
-        std::stringstream stream4;
-        stream4 << endl  << "        ";
-        for (unsigned int i = 0; i < co.getNPolygons(); i ++) {
-            stream4 << "    " << co.getPolyMetadata(i) << endl;
-            stream4 << "        ";
-        }
-        std::string tmpPath = piecepath + "/Polys";
-        tixiAddTextElement(handle, tmpPath.c_str(), "MetaData", stream4.str().c_str());
-        tmpPath += "/MetaData";
-        tixiAddTextAttribute(handle, tmpPath.c_str(), "elements", currentObject().getMetadataElements() );
-    }
-}
-
-// --------------------------------------------------------------------------//
-
-void PolyIndexList::addPoint(int index)
-{
-    // dont add same point twice
-    if (pindex.size() == 0 || pindex.back() != index) {
-         pindex.push_back(index);
-    }
-}
-
-
 //--------------------------------------------------------------------------//
 
 CTiglPolyObject::CTiglPolyObject()
@@ -591,6 +326,11 @@ void CTiglPolyObject::addPolygon(const CTiglPolygon & polygon)
     impl->addPolygon(polygon);
 }
 
+void CTiglPolyObject::addObject(const CTiglPolyObject& other)
+{
+    impl->addObject(*other.impl);
+}
+
 unsigned long CTiglPolyObject::addTriangleByVertexIndex(unsigned long i1, unsigned long i2, unsigned long i3)
 {
     return impl->addTriangleByVertexIndex(i1, i2, i3);
@@ -608,7 +348,7 @@ unsigned long CTiglPolyObject::getNPolygons() const
 
 unsigned long CTiglPolyObject::getNVertices() const
 {
-    return static_cast<unsigned long>(impl->pPoints.size());
+    return impl->getNVertices();
 }
 
 void CTiglPolyObject::enableNormals(bool normals_enabled)
@@ -625,7 +365,7 @@ unsigned long CTiglPolyObject::getVertexIndexOfPolygon(unsigned long iPoint, uns
 {
     if (iPoly < getNPolygons()) {
         if (iPoint < getNPointsOfPolygon(iPoly)) {
-            return impl->polys[iPoly].getPointIndex(iPoint);
+            return impl->getVertexIndexOfPolygon(iPoint, iPoly);
         }
         else {
             throw tigl::CTiglError("Illegal Point Index at CTiglPolyObject::getVertexIndexOfPolygon", TIGL_INDEX_ERROR);
@@ -636,26 +376,71 @@ unsigned long CTiglPolyObject::getVertexIndexOfPolygon(unsigned long iPoint, uns
     }
 }
 
-const CTiglPoint& CTiglPolyObject::getVertexNormal(unsigned long iVertexIndex) const 
+CTiglPoint CTiglPolyObject::getVertexNormal(unsigned long iVertexIndex) const 
 {
     if (iVertexIndex < getNVertices()) {
-        return impl->pPoints[iVertexIndex]->getNormal();
+        const double* n = &impl->normals[3*iVertexIndex];
+        return CTiglPoint(n[0], n[1], n[2]);
     }
     else {
         throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::getVertexNormal", TIGL_INDEX_ERROR);
     }
 }
 
-const CTiglPoint& CTiglPolyObject::getVertexPoint(unsigned long iVertexIndex) const 
+CTiglPoint CTiglPolyObject::getVertexPoint(unsigned long iVertexIndex) const 
 {
     if (iVertexIndex < getNVertices()) {
-        return impl->pPoints[iVertexIndex]->getPoint();
+        const double* p = &impl->points[3*iVertexIndex];
+        return CTiglPoint(p[0], p[1], p[2]);
     }
     else {
-        throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::getVertexNormal", TIGL_INDEX_ERROR);
+        throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::getVertexPoint", TIGL_INDEX_ERROR);
     }
 }
 
+const double* CTiglPolyObject::getVertexCoordinates() const
+{
+    return impl->points.empty() ? NULL : &impl->points[0];
+}
+
+const double* CTiglPolyObject::getVertexNormals() const
+{
+    return impl->normals.empty() ? NULL : &impl->normals[0];
+}
+
+unsigned long CTiglPolyObject::getConnectivitySize() const
+{
+    return static_cast<unsigned long>(impl->connectivity.size());
+}
+
+const unsigned int* CTiglPolyObject::getConnectivity() const
+{
+    return impl->connectivity.empty() ? NULL : &impl->connectivity[0];
+}
+
+const unsigned int* CTiglPolyObject::getPolygonOffsets() const
+{
+    return impl->offsets.empty() ? NULL : &impl->offsets[0];
+}
+
+const double* CTiglPolyObject::getPolyDataRealColumn(const char * dataName) const
+{
+    DataColumns::const_iterator it = impl->polyData.find(dataName);
+    if (it == impl->polyData.end() || it->second.empty()) {
+        return NULL;
+    }
+    return &it->second[0];
+}
+
+const double* CTiglPolyObject::getVertexDataRealColumn(const char * dataName) const
+{
+    DataColumns::const_iterator it = impl->vertexData.find(dataName);
+    if (it == impl->vertexData.end() || it->second.empty()) {
+        return NULL;
+    }
+    return &it->second[0];
+}
+
 bool CTiglPolyObject::hasMetadata() const 
 {
     return impl->has_metadata;
@@ -674,7 +459,10 @@ void CTiglPolyObject::setMetadataElements(const char * elems)
 const char * CTiglPolyObject::getPolyMetadata(unsigned long iPoly) const 
 {
     if (iPoly < getNPolygons()) {
-        return impl->polys[iPoly].getMetadata().c_str();
+        if (impl->polyMetadata.empty()) {
+            return "";
+        }
+        return impl->polyMetadata[iPoly].c_str();
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at CTiglPolyObject::getPolyMetadata", TIGL_INDEX_ERROR);
@@ -684,7 +472,8 @@ const char * CTiglPolyObject::getPolyMetadata(unsigned long iPoly) const
 void CTiglPolyObject::setPolyMetadata(unsigned long iPoly, const char * txt)
 {
     if (iPoly < getNPolygons()) {
-        impl->polys[iPoly].setMetadata(txt);
+        impl->polyMetadata.resize(getNPolygons());
+        impl->polyMetadata[iPoly] = txt;
         impl->has_metadata = true;
     }
     else {
@@ -695,10 +484,9 @@ void CTiglPolyObject::setPolyMetadata(unsigned long iPoly, const char * txt)
 void CTiglPolyObject::setVertexDataReal(unsigned long iVertexIndex, const char *dataName, double value)
 {
     if (iVertexIndex < getNVertices()) {
-        //insert into elems
-        impl->vertexDataElems.insert(dataName);
-        
-        impl->pPoints[iVertexIndex]->setRealData(dataName, value);
+        std::vector<double>& column = impl->vertexData[dataName];
+        column.resize(getNVertices(), UNDEFINED_REAL);
+        column[iVertexIndex] = value;
     }
     else {
         throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::setVertexDataReal", TIGL_INDEX_ERROR);
@@ -708,7 +496,8 @@ void CTiglPolyObject::setVertexDataReal(unsigned long iVertexIndex, const char *
 double CTiglPolyObject::getVertexDataReal(unsigned long iVertexIndex, const char *dataName) const
 {
     if (iVertexIndex < getNVertices()) {
-        return impl->pPoints[iVertexIndex]->getRealData(dataName);
+        const double* column = getVertexDataRealColumn(dataName);
+        return column ? column[iVertexIndex] : UNDEFINED_REAL;
     }
     else {
         throw tigl::CTiglError("Illegal Vertex Index at CTiglPolyObject::getVertexDataReal", TIGL_INDEX_ERROR);
@@ -718,10 +507,9 @@ double CTiglPolyObject::getVertexDataReal(unsigned long iVertexIndex, const char
 void CTiglPolyObject::setPolyDataReal(unsigned long iPolyIndex, const char *dataName, double value)
 {
     if (iPolyIndex < getNPolygons()) {
-        //insert into elems
-        impl->polyDataElems.insert(dataName);
-        
-        impl->polys[iPolyIndex].setRealData(dataName, value);
+        std::vector<double>& column = impl->polyData[dataName];
+        column.resize(getNPolygons(), UNDEFINED_REAL);
+        column[iPolyIndex] = value;
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at CTiglPolyObject::setPolyDataReal", TIGL_INDEX_ERROR);
@@ -731,7 +519,8 @@ void CTiglPolyObject::setPolyDataReal(unsigned long iPolyIndex, const char *data
 double CTiglPolyObject::getPolyDataReal(unsigned long iPolyIndex, const char *dataName) const
 {
     if (iPolyIndex < getNPolygons()) {
-        return impl->polys[iPolyIndex].getRealData(dataName);
+        const double* column = getPolyDataRealColumn(dataName);
+        return column ? column[iPolyIndex] : UNDEFINED_REAL;
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at CTiglPolyObject::getPolyDataReal", TIGL_INDEX_ERROR);
@@ -741,18 +530,16 @@ double CTiglPolyObject::getPolyDataReal(unsigned long iPolyIndex, const char *da
 // returns the number if different polygon data entries 
 unsigned int CTiglPolyObject::getNumberOfPolyRealData() const 
 {
-    return static_cast<unsigned int>(impl->polyDataElems.size());
+    return static_cast<unsigned int>(impl->polyData.size());
 }
 
 // retuns the  name of the ith data field (i = 0 .. getNumberPolyReadlData - 1)
 const char * CTiglPolyObject::getPolyDataFieldName(unsigned long iField) const 
 {
     if (iField < getNumberOfPolyRealData()) {
-        std::set<std::string>::iterator it = impl->polyDataElems.begin();
-        for (unsigned long i = 0; i < iField; ++i) {
-            ++it;
-        }
-        return it->c_str();
+        DataColumns::const_iterator it = impl->polyData.begin();
+        std::advance(it, iField);
+        return it->first.c_str();
     }
     else {
         throw tigl::CTiglError("Illegal Data Field Index at CTiglPolyObject::getPolyDataFieldName", TIGL_INDEX_ERROR);
@@ -811,38 +598,28 @@ const char * CTiglPolygon::getMetadata() const
 
 //--------------------------------------------------------------//
 
-void ObjectImpl::addPointNorm(const CTiglPoint& p, const CTiglPoint& n, long polynum)
+unsigned long ObjectImpl::addPointNorm(const CTiglPoint& p, const CTiglPoint& n) 
 {
-    unsigned long index = addPointNorm(p,n);
-
-    // now insert point into polygon list
-    if (polynum > (long) polys.size()) {
-        polys.push_back(PolyIndexList(polynum));
+    //check if point was already added
+    unsigned long index = grid.find(p, n, points, normals);
+    if (index != ULONG_MAX) {
+        return index;
     }
-    assert(polynum == polys.size());
-    polys.at(polynum-1).addPoint(index);
-}
 
-unsigned long ObjectImpl::addPointNorm(const CTiglPoint& p, const CTiglPoint& n) 
-{
-    //check if point is already in pointlist
-    unsigned int index = static_cast<unsigned int>(pointlist.size());
-    std::pair<PointMap::iterator,bool> ret;
+    // a new point has to be inserted
+    index = getNVertices();
+    points.push_back(p.x);
+    points.push_back(p.y);
+    points.push_back(p.z);
+    normals.push_back(n.x);
+    normals.push_back(n.y);
+    normals.push_back(n.z);
+    grid.insert(index, p);
 
-    ret = pointlist.insert(std::pair<PointImpl, int>(PointImpl(p,n),index));
-    index = ret.first->second;
-/*#ifndef NDEBUG
-    if(ret.second == false){
-        double dist = ret.first->first.dist2(p);
-        assert(pointlist.size() == 0 ||  dist < 1e-9);
+    for (DataColumns::iterator it = vertexData.begin(); it != vertexData.end(); ++it) {
+        it->second.resize(getNVertices(), UNDEFINED_REAL);
     }
-#endif*/
-    if (ret.second == true) {
-        // a new point was inserted, we have to keep track
-        PointImpl * ptmp = (PointImpl*)&ret.first->first;
-        pPoints.push_back(ptmp);
-    }
-    
+
     return index;
 }
 
@@ -853,13 +630,12 @@ unsigned long ObjectImpl::addTriangleByVertexIndex(unsigned long i1, unsigned lo
         return ULONG_MAX;
     }
 
-    unsigned long nPolys = static_cast<unsigned long>(polys.size());
-    polys.push_back(PolyIndexList(nPolys));
+    unsigned long nPolys = getNPolygons();
     
-    std::vector<PolyIndexList>::iterator itLastPoly = polys.end()-1;
-    itLastPoly->addPoint(i1);
-    itLastPoly->addPoint(i2);
-    itLastPoly->addPoint(i3);
+    connectivity.push_back(static_cast<unsigned int>(i1));
+    connectivity.push_back(static_cast<unsigned int>(i2));
+    connectivity.push_back(static_cast<unsigned int>(i3));
+    finishPolygon();
     
     return nPolys;
 }
@@ -867,35 +643,104 @@ unsigned long ObjectImpl::addTriangleByVertexIndex(unsigned long i1, unsigned lo
 
 void ObjectImpl::addPolygon(const CTiglPolygon & poly)
 {
-    long polynum = static_cast<long>(polys.size()) + 1;
-    if (!has_normals) {
-        for (unsigned long i = 0 ; i < poly.getNPoints(); ++i) {
-            CTiglPoint n(1,0,0);
-            addPointNorm(poly.getPointConst(i), n, polynum);
+    size_t start = connectivity.size();
+    for (unsigned long i = 0 ; i < poly.getNPoints(); ++i) {
+        unsigned long index = has_normals ? addPointNorm(poly.getPointConst(i), poly.getNormConst(i))
+                                          : addPointNorm(poly.getPointConst(i), CTiglPoint(1,0,0));
+
+        // dont add same point twice
+        if (connectivity.size() == start || connectivity.back() != index) {
+            connectivity.push_back(static_cast<unsigned int>(index));
         }
     }
-    else {
-        for (unsigned long i = 0 ; i < poly.getNPoints(); ++i) {
-            addPointNorm(poly.getPointConst(i), poly.getNormConst(i), polynum);
+    finishPolygon();
+
+    if (*poly.getMetadata() != '\0') {
+        polyMetadata.resize(getNPolygons());
+        polyMetadata.back() = poly.getMetadata();
+    }
+}
+
+void ObjectImpl::addObject(const ObjectImpl& other)
+{
+    // insert the vertices, duplicates are merged with the existing ones
+    unsigned long nOtherVertices = other.getNVertices();
+    std::vector<unsigned int> vertexMap(nOtherVertices);
+    for (unsigned long i = 0; i < nOtherVertices; ++i) {
+        const double* p = &other.points[3*i];
+        const double* n = &other.normals[3*i];
+        vertexMap[i] = static_cast<unsigned int>(addPointNorm(CTiglPoint(p[0], p[1], p[2]), CTiglPoint(n[0], n[1], n[2])));
+    }
+
+    for (DataColumns::const_iterator it = other.vertexData.begin(); it != other.vertexData.end(); ++it) {
+        std::vector<double>& column = vertexData[it->first];
+        column.resize(getNVertices(), UNDEFINED_REAL);
+        for (unsigned long i = 0; i < nOtherVertices; ++i) {
+            column[vertexMap[i]] = it->second[i];
         }
     }
-    assert(polynum == polys.size());
-    polys.at(polynum-1).setMetadata(poly.getMetadata());
+
+    // append the polygons
+    unsigned long iPolyOffset = getNPolygons();
+    unsigned long nOtherPolys = other.getNPolygons();
+    unsigned int begin = 0;
+    for (unsigned long iPoly = 0; iPoly < nOtherPolys; ++iPoly) {
+        unsigned int end = other.offsets[iPoly];
+        for (unsigned int j = begin; j < end; ++j) {
+            connectivity.push_back(vertexMap[other.connectivity[j]]);
+        }
+        finishPolygon();
+        begin = end;
+    }
+
+    for (DataColumns::const_iterator it = other.polyData.begin(); it != other.polyData.end(); ++it) {
+        std::vector<double>& column = polyData[it->first];
+        column.resize(getNPolygons(), UNDEFINED_REAL);
+        std::copy(it->second.begin(), it->second.end(), column.begin() + iPolyOffset);
+    }
+
+    if (!other.polyMetadata.empty()) {
+        polyMetadata.resize(getNPolygons());
+        std::copy(other.polyMetadata.begin(), other.polyMetadata.end(), polyMetadata.begin() + iPolyOffset);
+    }
+    has_metadata = has_metadata || other.has_metadata;
 }
 
+void ObjectImpl::finishPolygon()
+{
+    offsets.push_back(static_cast<unsigned int>(connectivity.size()));
+
+    for (DataColumns::iterator it = polyData.begin(); it != polyData.end(); ++it) {
+        it->second.resize(getNPolygons(), UNDEFINED_REAL);
+    }
+    if (!polyMetadata.empty()) {
+        polyMetadata.resize(getNPolygons());
+    }
+}
+
+unsigned long ObjectImpl::getNVertices() const 
+{
+    return static_cast<unsigned long>(points.size() / 3);
+}
 
 unsigned long ObjectImpl::getNPolygons() const 
 {
-    return static_cast<unsigned long>(polys.size());
+    return static_cast<unsigned long>(offsets.size());
 }
 
 unsigned long ObjectImpl::getNPointsOfPolygon(unsigned long ipoly) const 
 {
     if (ipoly < getNPolygons()) {
-        return polys[ipoly].getNVert();
+        unsigned int begin = ipoly > 0 ? offsets[ipoly - 1] : 0;
+        return offsets[ipoly] - begin;
     }
     else {
         throw tigl::CTiglError("Illegal Polygon Index at SurfaceImpl::getNPointsOfPolygon", TIGL_INDEX_ERROR);
     }
 }
 
+unsigned long ObjectImpl::getVertexIndexOfPolygon(unsigned long ipoint, unsigned long ipoly) const
+{
+    unsigned int begin = ipoly > 0 ? offsets[ipoly - 1] : 0;
+    return connectivity[begin + ipoint];
+}
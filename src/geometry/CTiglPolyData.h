@@ -26,6 +26,7 @@
 #include "tigl_internal.h"
 #include <tixi.h>
 #include "CTiglPoint.h"
+#include "CTiglVtkWriter.h"
 
 class ObjectImpl;
 
@@ -83,6 +84,9 @@ public:
 
     // adds a polygon to the object
     TIGL_EXPORT void addPolygon(const class CTiglPolygon&);
+
+    // appends all vertices, polygons and data of another object. Coinciding vertices are merged.
+    TIGL_EXPORT void addObject(const CTiglPolyObject& other);
     
     TIGL_EXPORT unsigned long getNVertices() const;
 
@@ -119,10 +123,10 @@ public:
     TIGL_EXPORT unsigned long addPointNormal(const class CTiglPoint& p, const class CTiglPoint& n);
     
     // returns the actual point, specified with the vertex index
-    TIGL_EXPORT const CTiglPoint& getVertexPoint(unsigned long iVertexIndex) const;
+    TIGL_EXPORT CTiglPoint getVertexPoint(unsigned long iVertexIndex) const;
     
     // returns the normal vector, specified with vertex index
-    TIGL_EXPORT const CTiglPoint& getVertexNormal(unsigned long iVertexIndex) const;
+    TIGL_EXPORT CTiglPoint getVertexNormal(unsigned long iVertexIndex) const;
     
     // each vertex has a list of data elements, this methods sets the value
     TIGL_EXPORT void setVertexDataReal(unsigned long iVertexIndex, const char * dataName, double value);
@@ -135,6 +139,31 @@ public:
     // retuns the  name of the ith data field (i = 0 .. getNumberPolyReadlData - 1)
     TIGL_EXPORT const char * getPolyDataFieldName(unsigned long iField) const;
 
+    //  ---------- Bulk access to the mesh buffers -----------------
+    //  The returned pointers are valid until the object is modified.
+    //  They are NULL, if the respective buffer is empty.
+
+    // returns the coordinates of all vertices as x0, y0, z0, x1, y1, z1, ... (3 * getNVertices() values)
+    TIGL_EXPORT const double* getVertexCoordinates() const;
+
+    // returns the normal vectors of all vertices as x0, y0, z0, x1, y1, z1, ... (3 * getNVertices() values)
+    TIGL_EXPORT const double* getVertexNormals() const;
+
+    // returns the number of entries of the connectivity array, i.e. the sum of all polygon sizes
+    TIGL_EXPORT unsigned long getConnectivitySize() const;
+
+    // returns the vertex indices of all polygons, stored one polygon after another
+    TIGL_EXPORT const unsigned int* getConnectivity() const;
+
+    // returns the end position of each polygon inside the connectivity array (getNPolygons() values)
+    TIGL_EXPORT const unsigned int* getPolygonOffsets() const;
+
+    // returns the values of a polygon data field (getNPolygons() values) or NULL, if the field does not exist
+    TIGL_EXPORT const double* getPolyDataRealColumn(const char * dataName) const;
+
+    // returns the values of a vertex data field (getNVertices() values) or NULL, if the field does not exist
+    TIGL_EXPORT const double* getVertexDataRealColumn(const char * dataName) const;
+
 
 private:
     CTiglPolyObject& operator=(const CTiglPolyObject&);
@@ -166,11 +195,10 @@ public:
     // changes the current surface, we count from 1 to getNObjects
     TIGL_EXPORT CTiglPolyObject& switchObject(unsigned int iObject);
 
-    TIGL_EXPORT void writeVTK(const char * filename);
+    // writes all objects into a vtk xml file. Binary data can be compressed, if TiGL was built with zlib
+    TIGL_EXPORT void writeVTK(const char * filename, VtkDataEncoding encoding = TIGL_VTK_ASCII, bool compressed = false);
 
 private:
-    void writeVTKPiece(TixiDocumentHandle& handle, unsigned int iObject);
-    void createVTK(TixiDocumentHandle& handle);
 
     std::vector<CTiglPolyObject*> _objects;
     std::vector<CTiglPolyObject*>::iterator itCurrentObj;
@@ -17,67 +17,294 @@
 */
 
 #include "CTiglShapeCache.h"
+#include "CTiglError.h"
+
+#include <TopExp.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopLoc_Location.hxx>
+#include <BRep_Tool.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Poly_Triangulation.hxx>
+
+#include <algorithm>
+#include <set>
 #include <sstream>
 
+namespace
+{
+    // rough memory estimates of the topological and geometrical entities in bytes
+    const size_t VERTEX_SIZE = 150;
+    const size_t EDGE_SIZE   = 300;
+    const size_t FACE_SIZE   = 500;
+    const size_t POLE_SIZE   = sizeof(double) * 4;
+
+    /// Estimates the memory used by a shape. Only bspline geometries and triangulations are considered in detail.
+    size_t EstimateMemorySize(const TopoDS_Shape& shape)
+    {
+        if (shape.IsNull()) {
+            return 0;
+        }
+
+        TopTools_IndexedMapOfShape vertices, edges, faces;
+        TopExp::MapShapes(shape, TopAbs_VERTEX, vertices);
+        TopExp::MapShapes(shape, TopAbs_EDGE, edges);
+        TopExp::MapShapes(shape, TopAbs_FACE, faces);
+
+        size_t size = vertices.Extent() * VERTEX_SIZE + edges.Extent() * EDGE_SIZE + faces.Extent() * FACE_SIZE;
+
+        for (int i = 1; i <= edges.Extent(); ++i) {
+            Standard_Real umin, umax;
+            Handle(Geom_Curve) curve = BRep_Tool::Curve(TopoDS::Edge(edges(i)), umin, umax);
+            Handle(Geom_BSplineCurve) bspl = Handle(Geom_BSplineCurve)::DownCast(curve);
+            if (!bspl.IsNull()) {
+                size += bspl->NbPoles() * POLE_SIZE;
+            }
+        }
+
+        for (int i = 1; i <= faces.Extent(); ++i) {
+            const TopoDS_Face& face = TopoDS::Face(faces(i));
+            Handle(Geom_BSplineSurface) bspl = Handle(Geom_BSplineSurface)::DownCast(BRep_Tool::Surface(face));
+            if (!bspl.IsNull()) {
+                size += bspl->NbUPoles() * bspl->NbVPoles() * POLE_SIZE;
+            }
+
+            TopLoc_Location location;
+            Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+            if (!triangulation.IsNull()) {
+                size += triangulation->NbNodes() * 5 * sizeof(double) + triangulation->NbTriangles() * 3 * sizeof(int);
+            }
+        }
+
+        return size;
+    }
+}
+
 namespace tigl 
 {
 
+CTiglShapeCacheKey::CTiglShapeCacheKey(const std::string& operation, const std::string& componentUID, size_t parameterHash)
+    : operation(operation), componentUID(componentUID), parameterHash(parameterHash)
+{
+}
+
+std::string CTiglShapeCacheKey::ToString() const
+{
+    std::stringstream s;
+    s << operation << ":" << componentUID << ":" << parameterHash;
+    return s.str();
+}
+
 CTiglShapeCache::CTiglShapeCache() 
+    : memoryLimit(0)
 {
     Reset();
 }
 
 void CTiglShapeCache::Insert(const TopoDS_Shape &shape, const std::string& id)
 {
-    shapeContainer[id] = shape;
+    Insert(shape, id, std::vector<std::string>());
+}
+
+void CTiglShapeCache::Insert(const TopoDS_Shape& shape, const std::string& id, const std::vector<std::string>& componentUIDs)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    InsertEntry(shape, id, componentUIDs);
+    ApplyMemoryLimit();
+}
+
+void CTiglShapeCache::Insert(const std::vector<TopoDS_Shape>& shapes, const std::vector<std::string>& ids,
+                             const std::vector<std::string>& componentUIDs)
+{
+    if (shapes.size() != ids.size()) {
+        throw CTiglError("Number of shapes and ids differ in CTiglShapeCache::Insert", TIGL_ERROR);
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        InsertEntry(shapes[i], ids[i], componentUIDs);
+    }
+
+    // the shapes of the batch are the most recently used ones
+    std::set<std::string> uniqueIDs(ids.begin(), ids.end());
+    ApplyMemoryLimit(std::max(uniqueIDs.size(), static_cast<size_t>(1)));
 }
 
-TopoDS_Shape& CTiglShapeCache::GetShape(const std::string& id) 
+TopoDS_Shape CTiglShapeCache::GetShape(const std::string& id) 
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     ShapeContainer::iterator it = shapeContainer.find(id);
     if (it == shapeContainer.end()) {
-        return nullShape;
+        return TopoDS_Shape();
     }
     else {
-        return it->second;
+        MarkUsed(it->second);
+        return it->second.shape;
     }
 }
 
-/// Returns true, if the shape with id is in the cache
-bool CTiglShapeCache::HasShape(const std::string& id)
+bool CTiglShapeCache::Find(const std::string& id, TopoDS_Shape& shape)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     ShapeContainer::iterator it = shapeContainer.find(id);
-    return it != shapeContainer.end();
+    if (it == shapeContainer.end()) {
+        nMisses++;
+        return false;
+    }
+
+    nHits++;
+    MarkUsed(it->second);
+    shape = it->second.shape;
+    return true;
+}
+
+/// Returns true, if the shape with id is in the cache
+bool CTiglShapeCache::HasShape(const std::string& id) const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return shapeContainer.find(id) != shapeContainer.end();
 }
 
 unsigned int CTiglShapeCache::GetNShape() const 
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     return static_cast<unsigned int>(shapeContainer.size());
 }
 
 
 void CTiglShapeCache::Clear()
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     shapeContainer.clear();
+    usageList.clear();
+    memoryUsage = 0;
 }
 
 void CTiglShapeCache::Remove(const std::string& id) 
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
     ShapeContainer::iterator it = shapeContainer.find(id);
     if (it != shapeContainer.end()) {
-        shapeContainer.erase(it);
+        Erase(it);
+    }
+}
+
+void CTiglShapeCache::RemoveComponent(const std::string& componentUID)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    ShapeContainer::iterator it = shapeContainer.begin();
+    while (it != shapeContainer.end()) {
+        const std::vector<std::string>& uids = it->second.componentUIDs;
+        ShapeContainer::iterator current = it++;
+        if (std::find(uids.begin(), uids.end(), componentUID) != uids.end()) {
+            Erase(current);
+        }
+    }
+}
+
+std::vector<std::string> CTiglShapeCache::GetComponentUIDs(const std::string& id) const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    ShapeContainer::const_iterator it = shapeContainer.find(id);
+    if (it == shapeContainer.end()) {
+        return std::vector<std::string>();
     }
+    return it->second.componentUIDs;
+}
+
+void CTiglShapeCache::SetMemoryLimit(size_t limitInBytes)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    memoryLimit = limitInBytes;
+    ApplyMemoryLimit();
+}
+
+size_t CTiglShapeCache::GetMemoryLimit() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return memoryLimit;
+}
+
+size_t CTiglShapeCache::GetMemoryUsage() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return memoryUsage;
+}
+
+unsigned long CTiglShapeCache::GetHitCount() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return nHits;
+}
+
+unsigned long CTiglShapeCache::GetMissCount() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return nMisses;
+}
+
+void CTiglShapeCache::ResetStatistics()
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    nHits = 0;
+    nMisses = 0;
 }
 
 void CTiglShapeCache::Reset() 
 {
-    nullShape.Nullify();
     Clear();
+    ResetStatistics();
+}
+
+void CTiglShapeCache::InsertEntry(const TopoDS_Shape& shape, const std::string& id, const std::vector<std::string>& componentUIDs)
+{
+    ShapeContainer::iterator it = shapeContainer.find(id);
+    if (it != shapeContainer.end() && it->second.shape.IsEqual(shape)) {
+        // no need to estimate the memory size again
+        it->second.componentUIDs = componentUIDs;
+        MarkUsed(it->second);
+        return;
+    }
+    Remove(id);
+
+    usageList.push_front(id);
+
+    Entry& entry = shapeContainer[id];
+    entry.shape = shape;
+    entry.componentUIDs = componentUIDs;
+    entry.memorySize = EstimateMemorySize(shape);
+    entry.usagePosition = usageList.begin();
+    memoryUsage += entry.memorySize;
+}
+
+void CTiglShapeCache::MarkUsed(Entry& entry)
+{
+    usageList.splice(usageList.begin(), usageList, entry.usagePosition);
+}
+
+void CTiglShapeCache::Erase(ShapeContainer::iterator it)
+{
+    memoryUsage -= it->second.memorySize;
+    usageList.erase(it->second.usagePosition);
+    shapeContainer.erase(it);
 }
 
-CTiglShapeCache::ShapeContainer& CTiglShapeCache::GetContainer() 
+// removes the least recently used shapes, but always keeps the nKeep most recently used ones
+void CTiglShapeCache::ApplyMemoryLimit(size_t nKeep)
 {
-    return shapeContainer;
+    if (memoryLimit == 0) {
+        return;
+    }
+
+    while (memoryUsage > memoryLimit && usageList.size() > nKeep) {
+        std::string id = usageList.back();
+        Remove(id);
+    }
 }
 
 } // namespace tigl
@@ -19,52 +19,138 @@
 /**
  * @brief The CTiglShapeCache class acts as a storage for all kinds of intermediate 
  * shape results in order to improve speed of reoccurent calculations.
+ *
+ * Each shape can be tagged with the UIDs of the components it was computed from,
+ * which allows to remove all results of a component, if it changes.
+ * Optionally, the memory used by the cache can be bounded. If the
+ * limit is exceeded, the least recently used shapes are removed.
+ *
+ * All functions may be called concurrently.
  */
 
 #ifndef CTIGLSHAPECACHE_H
 #define CTIGLSHAPECACHE_H
 
 #include "tigl_internal.h"
-#include <map>
+#include <list>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include <TopoDS_Shape.hxx>
 
 namespace tigl 
 {
 
+/**
+ * @brief Identifies a cached shape by the operation, the UID of the component(s)
+ * the shape was computed from and a hash of the remaining parameters of the operation.
+ *
+ * The shapes are stored by the string representation of the key, as these ids
+ * are handed out to the users, e.g. as intersection ids.
+ */
+struct CTiglShapeCacheKey
+{
+    TIGL_EXPORT CTiglShapeCacheKey(const std::string& operation, const std::string& componentUID, size_t parameterHash);
+
+    /// Returns the id "<operation>:<componentUID>:<parameterHash>"
+    TIGL_EXPORT std::string ToString() const;
+
+    std::string operation;
+    std::string componentUID;
+    size_t parameterHash;
+};
+
 class CTiglShapeCache
 {
 public:
-    typedef std::map<std::string, TopoDS_Shape> ShapeContainer;
-    
     TIGL_EXPORT CTiglShapeCache();
     
     /// Inserts a shape with the given id into the cache
     TIGL_EXPORT void Insert(const TopoDS_Shape& shape, const std::string& id);
+
+    /// Inserts a shape with the given id into the cache, that was computed from the given components
+    TIGL_EXPORT void Insert(const TopoDS_Shape& shape, const std::string& id, const std::vector<std::string>& componentUIDs);
+
+    /// Inserts multiple shapes at once, that were computed from the given components. Shapes, that are
+    /// already in the cache, are marked as used. The memory limit is applied afterwards and keeps all
+    /// shapes of the batch, so that their ids remain valid for the caller.
+    TIGL_EXPORT void Insert(const std::vector<TopoDS_Shape>& shapes, const std::vector<std::string>& ids,
+                            const std::vector<std::string>& componentUIDs);
     
-    /// Returns the shape with the given id. If the shape is not found, a nullshape/empty shape is returned
-    TIGL_EXPORT TopoDS_Shape& GetShape(const std::string& id);
+    /// Returns the shape with the given id. If the shape is not found, a nullshape/empty shape is returned.
+    /// In contrast to Find, the call is not counted as a cache hit or miss.
+    TIGL_EXPORT TopoDS_Shape GetShape(const std::string& id);
+
+    /// Looks up the shape with the given id. Returns false, if the shape is not in the cache.
+    /// Each call is counted as a cache hit or miss.
+    TIGL_EXPORT bool Find(const std::string& id, TopoDS_Shape& shape);
     
     /// Returns true, if the shape with id is in the cache
-    TIGL_EXPORT bool HasShape(const std::string& id);
+    TIGL_EXPORT bool HasShape(const std::string& id) const;
     
     /// Returns total number of shapes in map
     TIGL_EXPORT unsigned int GetNShape() const;
     
     /// Removes alles shapes with the given id from the cache
     TIGL_EXPORT void Remove(const std::string& id);
+
+    /// Removes all shapes, that were computed from the given component
+    TIGL_EXPORT void RemoveComponent(const std::string& componentUID);
+
+    /// Returns the UIDs of the components, the shape with the given id was computed from
+    TIGL_EXPORT std::vector<std::string> GetComponentUIDs(const std::string& id) const;
     
     /// Empties the cache
     TIGL_EXPORT void Clear();
-    
-    /// Returns the underlying map for direct access
-    TIGL_EXPORT ShapeContainer& GetContainer();
+
+    /// Sets the maximum memory used by the cached shapes in bytes. A limit of 0 disables the limit.
+    TIGL_EXPORT void SetMemoryLimit(size_t limitInBytes);
+
+    /// Returns the maximum memory used by the cached shapes in bytes (0, if unlimited)
+    TIGL_EXPORT size_t GetMemoryLimit() const;
+
+    /// Returns the estimated memory used by the cached shapes in bytes
+    TIGL_EXPORT size_t GetMemoryUsage() const;
+
+    /// Returns the number of successful lookups using Find
+    TIGL_EXPORT unsigned long GetHitCount() const;
+
+    /// Returns the number of failed lookups using Find
+    TIGL_EXPORT unsigned long GetMissCount() const;
+
+    /// Resets the hit and miss counters
+    TIGL_EXPORT void ResetStatistics();
     
 private:
+    typedef std::list<std::string> UsageList;
+
+    struct Entry
+    {
+        TopoDS_Shape shape;
+        std::vector<std::string> componentUIDs;
+        size_t memorySize;
+        UsageList::iterator usagePosition;
+    };
+
+    typedef std::unordered_map<std::string, Entry> ShapeContainer;
+
     void Reset();
+    void InsertEntry(const TopoDS_Shape& shape, const std::string& id, const std::vector<std::string>& componentUIDs);
+    void MarkUsed(Entry& entry);
+    void Erase(ShapeContainer::iterator it);
+    void ApplyMemoryLimit(size_t nKeep = 1);
     
     ShapeContainer shapeContainer;
-    TopoDS_Shape nullShape;
+    UsageList usageList; ///< ids of all shapes, most recently used first
+
+    size_t memoryLimit;
+    size_t memoryUsage;
+    unsigned long nHits;
+    unsigned long nMisses;
+
+    // lookups modify the usage list, hence all accesses are locked
+    mutable std::recursive_mutex mutex;
 };
 
 } // namespace tigl
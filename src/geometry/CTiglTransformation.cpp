@@ -422,9 +422,15 @@ TopoDS_Shape CTiglTransformation::Transform(const TopoDS_Shape& shape) const
 // returns the transformed point
 gp_Pnt CTiglTransformation::Transform(const gp_Pnt& point) const
 {
-    gp_XYZ transformed(point.X(), point.Y(), point.Z());
-    Get_gp_GTrsf().Transforms(transformed);
-    return gp_Pnt(transformed.X(), transformed.Y(), transformed.Z());
+    // Apply the affine part of the matrix directly. This is equivalent to
+    // Get_gp_GTrsf().Transforms(...) but avoids setting up the gp_GTrsf object,
+    // as this function is called in many inner loops.
+    const double x = point.X();
+    const double y = point.Y();
+    const double z = point.Z();
+    return gp_Pnt(m_matrix[0][0] * x + m_matrix[0][1] * y + m_matrix[0][2] * z + m_matrix[0][3],
+                  m_matrix[1][0] * x + m_matrix[1][1] * y + m_matrix[1][2] * z + m_matrix[1][3],
+                  m_matrix[2][0] * x + m_matrix[2][1] * y + m_matrix[2][2] * z + m_matrix[2][3]);
 }
 
 bool CTiglTransformation::IsUniform() const
@@ -23,6 +23,11 @@
 #include "CCPACSWingSegment.h"
 #include "CCPACSConfiguration.h"
 #include "CTiglFusePlane.h"
+#include "CTiglBoundingBoxTree.h"
+#include "CNamedShape.h"
+#include "tiglparallel.h"
+#include "CTiglProgress.h"
+#include "UniquePtr.h"
 
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
@@ -36,12 +41,19 @@
 #include <BRepGProp_Face.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
+#include <BRepBndLib.hxx>
+#include <Bnd_Box.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 
 #include <gp_Pnt.hxx>
 #include <gp_Pnt2d.hxx>
 
 #include <TColgp_Array1OfPnt2d.hxx>
+#include <Standard_Version.hxx>
 #include <climits>
+#include <map>
+#include <string>
 
 namespace 
 {
@@ -60,6 +72,149 @@ namespace
         }
         return p;
     }
+
+    void meshShape(const TopoDS_Shape& shape, double deflection, bool inParallel)
+    {
+#if OCC_VERSION_HEX >= 0x060800
+        BRepMesh_IncrementalMesh(shape, deflection, Standard_False, 0.5, inParallel ? Standard_True : Standard_False);
+#else
+        (void)inParallel;
+        BRepMesh_IncrementalMesh(shape, deflection);
+#endif
+    }
+
+    Bnd_Box mirrorBox(const Bnd_Box& box, TiglSymmetryAxis axis)
+    {
+        Bnd_Box mirrored;
+        if (!box.IsVoid()) {
+            Standard_Real xmin, ymin, zmin, xmax, ymax, zmax;
+            box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+            mirrored.Add(mirrorPoint(gp_Pnt(xmin, ymin, zmin), axis));
+            mirrored.Add(mirrorPoint(gp_Pnt(xmax, ymax, zmax), axis));
+        }
+        return mirrored;
+    }
+
+    /**
+     * @brief Finds the wing segment, on which a point is located.
+     *
+     * The bounding boxes of all wing segments (and their mirrored counterparts)
+     * are stored in a bounding box tree. Hence, the expensive solid classification
+     * is only performed for the few segments, whose boxes contain the point.
+     * In addition, the name of the face origin is used to test the segments
+     * of the originating component first.
+     */
+    class WingSegmentLocator
+    {
+    public:
+        explicit WingSegmentLocator(const tigl::CTiglRelativelyPositionedComponent::ChildContainerType& components)
+        {
+            std::vector<Bnd_Box> boxes;
+            for (size_t iComp = 0; iComp < components.size(); ++iComp) {
+                tigl::CTiglRelativelyPositionedComponent& component = *components[iComp];
+                bool isWing = (component.GetComponentType() & TIGL_COMPONENT_WING) != 0;
+
+                std::string uid = component.GetDefaultedUID();
+                m_origins.insert(std::make_pair(uid, Origin(iComp, false)));
+                m_origins.insert(std::make_pair(uid + "M", Origin(iComp, true)));
+
+                if (!isWing) {
+                    continue;
+                }
+
+                tigl::CCPACSWing& wing = dynamic_cast<tigl::CCPACSWing&>(component);
+                for (int iSegment = 1; iSegment <= wing.GetSegmentCount(); ++iSegment) {
+                    tigl::CCPACSWingSegment& segment = wing.GetSegment(iSegment);
+
+                    // the tolerance of the classification in CCPACSWingSegment::GetIsOn
+                    Bnd_Box box;
+                    BRepBndLib::Add(segment.GetLoft()->Shape(), box);
+                    box.Enlarge(0.03);
+
+                    m_candidates.push_back(Candidate(&segment, iComp, false));
+                    boxes.push_back(box);
+                    if (wing.GetSymmetryAxis() != TIGL_NO_SYMMETRY) {
+                        m_candidates.push_back(Candidate(&segment, iComp, true));
+                        boxes.push_back(mirrorBox(box, segment.GetSymmetryAxis()));
+                    }
+                }
+            }
+            m_tree = tigl::CTiglBoundingBoxTree(boxes);
+        }
+
+        // Returns the segment containing the point or NULL, if it is not located on any wing segment
+        tigl::CCPACSWingSegment* Find(const gp_Pnt& point, const std::string& originName, bool& onMirroredShape)
+        {
+            m_tree.FindBoxes(point, m_indices);
+
+            // first test the segments of the component, the face was created from
+            const Origin* origin = NULL;
+            std::map<std::string, Origin>::const_iterator originIt = m_origins.find(originName);
+            if (originIt != m_origins.end()) {
+                origin = &originIt->second;
+                for (size_t i = 0; i < m_indices.size(); ++i) {
+                    const Candidate& candidate = m_candidates[m_indices[i]];
+                    if (candidate.IsFrom(*origin) && candidate.Contains(point)) {
+                        onMirroredShape = candidate.mirrored;
+                        return candidate.segment;
+                    }
+                }
+            }
+
+            // test the remaining segments in the order of the components. This is
+            // also done for faces of other components, as they may touch a wing segment.
+            for (size_t i = 0; i < m_indices.size(); ++i) {
+                const Candidate& candidate = m_candidates[m_indices[i]];
+                if (origin && candidate.IsFrom(*origin)) {
+                    continue;
+                }
+                if (candidate.Contains(point)) {
+                    onMirroredShape = candidate.mirrored;
+                    return candidate.segment;
+                }
+            }
+            return NULL;
+        }
+
+    private:
+        struct Origin
+        {
+            Origin(size_t c, bool m)
+                : component(c), mirrored(m)
+            {
+            }
+
+            size_t component;
+            bool mirrored;
+        };
+
+        struct Candidate
+        {
+            Candidate(tigl::CCPACSWingSegment* s, size_t c, bool m)
+                : segment(s), component(c), mirrored(m)
+            {
+            }
+
+            bool IsFrom(const Origin& origin) const
+            {
+                return component == origin.component && mirrored == origin.mirrored;
+            }
+
+            bool Contains(const gp_Pnt& point) const
+            {
+                return mirrored ? segment->GetIsOnMirrored(point) : segment->GetIsOn(point);
+            }
+
+            tigl::CCPACSWingSegment* segment;
+            size_t component;
+            bool mirrored;
+        };
+
+        std::vector<Candidate> m_candidates;
+        std::map<std::string, Origin> m_origins;
+        tigl::CTiglBoundingBoxTree m_tree;
+        std::vector<size_t> m_indices;
+    };
 }
 
 namespace tigl
@@ -73,30 +228,27 @@ CTiglTriangularizer::CTiglTriangularizer(const CTiglTriangularizerOptions& optio
 CTiglTriangularizer::CTiglTriangularizer(const TopoDS_Shape& shape, double deflection, const CTiglTriangularizerOptions& options)
     : m_options(options)
 {
-    
+    CTiglProgress progress("Triangulating shape", 2);
+
     // check if we have already a mesh with given deflection
     if (!BRepTools::Triangulation (shape, deflection)) {
         BRepTools::Clean (shape);
-        BRepMesh_IncrementalMesh(shape, deflection);
+        meshShape(shape, deflection, true);
     }
+    progress.Step();
+
     triangularizeShape(shape);
+    progress.Step();
 }
 
 int CTiglTriangularizer::triangularizeShape(const TopoDS_Shape& shape)
 {
     TopExp_Explorer shellExplorer;
-    TopExp_Explorer faceExplorer;
     
     for (shellExplorer.Init(shape, TopAbs_SHELL); shellExplorer.More(); shellExplorer.Next()) {
         const TopoDS_Shell shell = TopoDS::Shell(shellExplorer.Current());
         
-        currentObject().enableNormals(m_options.normalsEnabled());
-
-        for (faceExplorer.Init(shell, TopAbs_FACE); faceExplorer.More(); faceExplorer.Next()) {
-            TopoDS_Face face = TopoDS::Face(faceExplorer.Current());
-            unsigned long nVertices, iPolyLower, iPolyUpper;
-            triangularizeFace(face, nVertices, iPolyLower, iPolyUpper);
-        } // for faces
+        triangularizeFaces(shell, currentObject());
         if (m_options.useMultipleObjects()) {
             createNewObject();
         }
@@ -105,24 +257,86 @@ int CTiglTriangularizer::triangularizeShape(const TopoDS_Shape& shape)
     return 0;
 }
 
+void CTiglTriangularizer::triangularizeFaces(const TopoDS_Shape& shape, CTiglPolyObject& object) const
+{
+    object.enableNormals(m_options.normalsEnabled());
+
+    TopExp_Explorer faceExplorer;
+    for (faceExplorer.Init(shape, TopAbs_FACE); faceExplorer.More(); faceExplorer.Next()) {
+        TopoDS_Face face = TopoDS::Face(faceExplorer.Current());
+        unsigned long nVertices, iPolyLower, iPolyUpper;
+        triangularizeFace(face, object, nVertices, iPolyLower, iPolyUpper);
+    }
+}
+
+/**
+ * @brief Meshes the shapes of a single component and triangulates them
+ * into a separate poly object.
+ *
+ * The shapes of different components do not share any topology and can therefore
+ * be meshed concurrently. The shapes of one component (e.g. the loft and its mirrored
+ * copy) are processed in the same task, as they might share their underlying geometry.
+ */
+class CTiglTriangularizer::ComponentMesher
+{
+public:
+    ComponentMesher(const CTiglTriangularizer& triangularizer,
+                    const std::vector<std::vector<TopoDS_Shape> >& componentShapes,
+                    std::vector<unique_ptr<CTiglPolyObject> >& results,
+                    double deflection,
+                    CTiglProgress& progress)
+        : m_triangularizer(triangularizer)
+        , m_componentShapes(componentShapes)
+        , m_results(results)
+        , m_deflection(deflection)
+        , m_progress(progress)
+    {
+    }
+
+    void operator()(size_t iComponent)
+    {
+        // use occt's parallel meshing, if there are less components than threads
+        bool meshInParallel = m_componentShapes.size() < GetNumberOfThreads();
+
+        CTiglPolyObject& object = *m_results[iComponent];
+        const std::vector<TopoDS_Shape>& shapes = m_componentShapes[iComponent];
+        for (std::vector<TopoDS_Shape>::const_iterator it = shapes.begin(); it != shapes.end(); ++it) {
+            meshShape(*it, m_deflection, meshInParallel);
+            m_triangularizer.triangularizeFaces(*it, object);
+        }
+        m_progress.Step();
+    }
+
+private:
+    const CTiglTriangularizer& m_triangularizer;
+    const std::vector<std::vector<TopoDS_Shape> >& m_componentShapes;
+    std::vector<unique_ptr<CTiglPolyObject> >& m_results;
+    double m_deflection;
+    CTiglProgress& m_progress;
+};
+
 CTiglTriangularizer::CTiglTriangularizer(CTiglRelativelyPositionedComponent& comp, double deflection, ComponentTraingMode mode, const CTiglTriangularizerOptions& options)
     : m_options(options)
 {
     LOG(INFO) << "Calculating fused plane";
-    triangularizeComponent(comp, false, comp.GetLoft()->Shape(), deflection, mode);
+    triangularizeComponent(comp, false, comp.GetLoft(), deflection, mode);
 }
 
 CTiglTriangularizer::CTiglTriangularizer(CCPACSConfiguration& config, bool fuseShapes, double deflection, ComponentTraingMode mode ,const CTiglTriangularizerOptions& options)
     : m_options(options)
 {
     if (fuseShapes){
+        // fusing and triangulation
+        CTiglProgress progress("Triangulating fused configuration", 2);
+
         PTiglFusePlane fuser = config.AircraftFusingAlgo();
         fuser->SetResultMode(FULL_PLANE);
         if (!fuser->FusedPlane()) {
             throw CTiglError("Error computing fused aircraft in CTiglTriangularizer", TIGL_ERROR);
         }
 
-        TopoDS_Shape planeShape = fuser->FusedPlane()->Shape();
+        PNamedShape planeShape = fuser->FusedPlane();
+        progress.Step();
 
         m_options.setMutipleObjectsEnabled(false);
         std::vector<CTiglRelativelyPositionedComponent*> rootComponentPtrs;
@@ -130,39 +344,45 @@ CTiglTriangularizer::CTiglTriangularizer(CCPACSConfiguration& config, bool fuseS
         for (RelativeComponentContainerType::const_iterator it = rootComponents.begin(); it != rootComponents.end(); ++it)
             rootComponentPtrs.push_back(it->second);
         triangularizeComponent(rootComponentPtrs, true, planeShape, deflection, mode);
+        progress.Step();
     }
     else {
         m_options.setMutipleObjectsEnabled(false);
+
+        // The lofts are computed lazily and cached inside the components,
+        // hence they must be created before meshing in parallel
+        std::vector<std::vector<TopoDS_Shape> > componentShapes;
         for (int iWing = 1; iWing <= config.GetWingCount(); ++iWing) {
             CCPACSWing& wing = config.GetWing(iWing);
 
-            TopoDS_Shape wshape = wing.GetLoft()->Shape();
-            BRepMesh_IncrementalMesh(wshape,deflection);
-            triangularizeShape(wshape);
-
-            if (wing.GetSymmetryAxis() == TIGL_NO_SYMMETRY) {
-                continue;
+            componentShapes.push_back(std::vector<TopoDS_Shape>(1, wing.GetLoft()->Shape()));
+            if (wing.GetSymmetryAxis() != TIGL_NO_SYMMETRY) {
+                componentShapes.back().push_back(wing.GetMirroredLoft()->Shape());
             }
-
-            TopoDS_Shape wshape_m = wing.GetMirroredLoft()->Shape();
-            BRepMesh_IncrementalMesh(wshape_m,deflection);
-            triangularizeShape(wshape_m);
         }
 
         for (int iFuselage = 1; iFuselage <= config.GetFuselageCount(); ++iFuselage) {
             CCPACSFuselage& fuselage = config.GetFuselage(iFuselage);
 
-            TopoDS_Shape wshape = fuselage.GetLoft()->Shape();
-            BRepMesh_IncrementalMesh(wshape,deflection);
-            triangularizeShape(wshape);
-
-            if (fuselage.GetSymmetryAxis() == TIGL_NO_SYMMETRY) {
-                continue;
+            componentShapes.push_back(std::vector<TopoDS_Shape>(1, fuselage.GetLoft()->Shape()));
+            if (fuselage.GetSymmetryAxis() != TIGL_NO_SYMMETRY) {
+                componentShapes.back().push_back(fuselage.GetMirroredLoft()->Shape());
             }
+        }
 
-            TopoDS_Shape wshape_m = fuselage.GetMirroredLoft()->Shape();
-            BRepMesh_IncrementalMesh(wshape_m,deflection);
-            triangularizeShape(wshape_m);
+        std::vector<unique_ptr<CTiglPolyObject> > componentObjects;
+        for (size_t i = 0; i < componentShapes.size(); ++i) {
+            componentObjects.push_back(make_unique<CTiglPolyObject>());
+        }
+
+        CTiglProgress progress("Triangulating configuration", componentShapes.size());
+        ComponentMesher mesher(*this, componentShapes, componentObjects, deflection, progress);
+        ParallelFor(componentShapes.size(), mesher);
+
+        // merge in the original component order to get reproducible results
+        currentObject().enableNormals(m_options.normalsEnabled());
+        for (size_t i = 0; i < componentObjects.size(); ++i) {
+            currentObject().addObject(*componentObjects[i]);
         }
     }
 }
@@ -178,12 +398,12 @@ bool isValidCoord(double c)
     }
 }
 
-int CTiglTriangularizer::triangularizeComponent(CTiglRelativelyPositionedComponent& component, bool include_childs, const TopoDS_Shape& shape, double deflection, ComponentTraingMode mode)
+int CTiglTriangularizer::triangularizeComponent(CTiglRelativelyPositionedComponent& component, bool include_childs, const PNamedShape& shape, double deflection, ComponentTraingMode mode)
 {
     return triangularizeComponent(std::vector<CTiglRelativelyPositionedComponent*>(1, &component), include_childs, shape, deflection, mode);
 }
 
-int CTiglTriangularizer::triangularizeComponent(const std::vector<CTiglRelativelyPositionedComponent*>& components, bool include_childs, const TopoDS_Shape& shape, double deflection, ComponentTraingMode mode)
+int CTiglTriangularizer::triangularizeComponent(const std::vector<CTiglRelativelyPositionedComponent*>& components, bool include_childs, const PNamedShape& shape, double deflection, ComponentTraingMode mode)
 {
     // create list of child components
     CTiglRelativelyPositionedComponent::ChildContainerType allcomponents;
@@ -193,17 +413,28 @@ int CTiglTriangularizer::triangularizeComponent(const std::vector<CTiglRelativel
         allcomponents.insert(allcomponents.end(), children.begin(), children.end());
     }
     
-    BRepTools::Clean (shape);
-    BRepMesh_IncrementalMesh(shape, deflection);
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape->Shape(), TopAbs_FACE, faceMap);
+
+    // one step for meshing and one per face
+    CTiglProgress progress("Triangulating " + std::string(shape->Name()), faceMap.Extent() + 1);
+
+    BRepTools::Clean (shape->Shape());
+    meshShape(shape->Shape(), deflection, true);
     LOG(INFO) << "Done meshing";
+    progress.Step();
 
     currentObject().enableNormals(m_options.normalsEnabled());
-    
-    TopExp_Explorer faceExplorer;
-    for (faceExplorer.Init(shape, TopAbs_FACE); faceExplorer.More(); faceExplorer.Next()) {
-        TopoDS_Face face = TopoDS::Face(faceExplorer.Current());
+
+    unique_ptr<WingSegmentLocator> segmentLocator;
+    if (mode == SEGMENT_INFO) {
+        segmentLocator.reset(new WingSegmentLocator(allcomponents));
+    }
+
+    for (int iFace = 1; iFace <= faceMap.Extent(); ++iFace) {
+        TopoDS_Face face = TopoDS::Face(faceMap(iFace));
         unsigned long nVertices, iPolyLower, iPolyUpper;
-        triangularizeFace(face, nVertices, iPolyLower, iPolyUpper);
+        triangularizeFace(face, currentObject(), nVertices, iPolyLower, iPolyUpper);
         
         // find to which segment the face belongs
         if (nVertices > 0  &&  mode ==  SEGMENT_INFO) {
@@ -217,44 +448,25 @@ int CTiglTriangularizer::triangularizeComponent(const std::vector<CTiglRelativel
             
             gp_Pnt centralP; gp_Vec n;
             prop.Normal(umean,vmean,centralP,n);
+
+            // the name of the shape, where the face was created originally
+            const CFaceTraits& traits = shape->GetFaceTraits(iFace-1);
+            std::string originName = traits.Origin() ? traits.Origin()->Name() : shape->Name();
             
-            // search to which component the current face belongs to
-            bool found = false;
-            CTiglRelativelyPositionedComponent::ChildContainerType::iterator compit;
-            for (compit = allcomponents.begin(); compit != allcomponents.end(); ++compit) {
-                CTiglRelativelyPositionedComponent& curcomp = *(*compit);
-                if (curcomp.GetComponentType() & TIGL_COMPONENT_WING){
-                    // check to which segment this face belongs
-                    CCPACSWing& wing = dynamic_cast<CCPACSWing&>(curcomp);
-                    int iSegmentFound = 0;
-                    bool pointOnMirroredShape = false;
-                    for (int iSegment = 1 ; iSegment <= wing.GetSegmentCount(); ++iSegment) {
-                        CCPACSWingSegment& segment = (CCPACSWingSegment&) wing.GetSegment(iSegment);
-                        if (segment.GetIsOn(centralP) == true) {
-                            iSegmentFound = iSegment;
-                            break;
-                        }
-                        else if (wing.GetSymmetryAxis() != TIGL_NO_SYMMETRY && segment.GetIsOnMirrored(centralP) == true){
-                            iSegmentFound = iSegment;
-                            pointOnMirroredShape = true;
-                            break;
-                        }
-                    }
-                    if (iSegmentFound > 0) {
-                        CCPACSWingSegment& segment = (CCPACSWingSegment&) wing.GetSegment(iSegmentFound);
-                        annotateWingSegment(segment, centralP, pointOnMirroredShape, iPolyLower, iPolyUpper);
-                        found = true;
-                        break;
-                    }
-                } // is wing
-            } // for components
-            if ( !found ) {
+            // search to which segment the current face belongs to
+            bool pointOnMirroredShape = false;
+            CCPACSWingSegment* segment = segmentLocator->Find(centralP, originName, pointOnMirroredShape);
+            if (segment) {
+                annotateWingSegment(*segment, centralP, pointOnMirroredShape, iPolyLower, iPolyUpper);
+            }
+            else {
                 //make dummy annotation for non wing faces
                 for (unsigned int iPoly = iPolyLower; iPoly <= iPolyUpper; iPoly++) {
                     currentObject().setPolyMetadata(iPoly,"\"\" 0 0.0 0.0 0");
                 }
             } // ! found
         }
+        progress.Step();
     }
     if (m_options.useMultipleObjects()) {
         createNewObject();
@@ -313,7 +525,7 @@ void CTiglTriangularizer::annotateWingSegment(tigl::CCPACSWingSegment &segment,
     }
 }
 
-int CTiglTriangularizer::triangularizeFace(const TopoDS_Face & face, unsigned long &nVertices, unsigned long &iPolyLower, unsigned long &iPolyUpper)
+int CTiglTriangularizer::triangularizeFace(const TopoDS_Face & face, CTiglPolyObject& object, unsigned long &nVertices, unsigned long &iPolyLower, unsigned long &iPolyUpper) const
 {
     TopLoc_Location location;
     std::vector<unsigned long> indexBuffer;
@@ -349,7 +561,7 @@ int CTiglTriangularizer::triangularizeFace(const TopoDS_Face & face, unsigned lo
             if (face.Orientation() == TopAbs_INTERNAL) {
                 n.Reverse();
             }
-            indexBuffer.push_back(currentObject().addPointNormal(p.XYZ(), n.XYZ()));
+            indexBuffer.push_back(object.addPointNormal(p.XYZ(), n.XYZ()));
         }
     } 
     else {
@@ -361,7 +573,7 @@ int CTiglTriangularizer::triangularizeFace(const TopoDS_Face & face, unsigned lo
         iBufferSize = nodes.Upper()-nodes.Lower()+1;
         indexBuffer.reserve(iBufferSize);        for (int inode = nodes.Lower(); inode <= nodes.Upper(); inode++) {
             const gp_Pnt& p = nodes(inode).Transformed(nodeTransformation);
-            indexBuffer.push_back(currentObject().addPointNormal(p.XYZ(), CTiglPoint(1,0,0)));
+            indexBuffer.push_back(object.addPointNormal(p.XYZ(), CTiglPoint(1,0,0)));
         }
     }
 
@@ -382,10 +594,10 @@ int CTiglTriangularizer::triangularizeFace(const TopoDS_Face & face, unsigned lo
         unsigned long iPolyIndex = 0;
         
         if (face.Orientation() != TopAbs_REVERSED && face.Orientation() != TopAbs_INTERNAL) {
-            iPolyIndex = currentObject().addTriangleByVertexIndex(index1, index2, index3);
+            iPolyIndex = object.addTriangleByVertexIndex(index1, index2, index3);
         }
         else {
-            iPolyIndex = currentObject().addTriangleByVertexIndex(index1, index3, index2);
+            iPolyIndex = object.addTriangleByVertexIndex(index1, index3, index2);
         }
         
         // In some rare cases, 2 indices are the same
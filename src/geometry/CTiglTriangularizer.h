@@ -25,6 +25,7 @@
 #include <vector>
 #include "tigl_internal.h"
 #include "CTiglPolyData.h"
+#include "PNamedShape.h"
 #include <gp_Pnt.hxx>
 
 class TopoDS_Shape;
@@ -89,13 +90,17 @@ public:
                                     const CTiglTriangularizerOptions& options = CTiglTriangularizerOptions());
 
 private:
-    int triangularizeComponent(CTiglRelativelyPositionedComponent& component, bool includeChilds, const TopoDS_Shape& shape, double deflection, ComponentTraingMode = NO_INFO);
-    int triangularizeComponent(const std::vector<CTiglRelativelyPositionedComponent*>& components, bool includeChilds, const TopoDS_Shape& shape, double deflection, ComponentTraingMode = NO_INFO);
+    int triangularizeComponent(CTiglRelativelyPositionedComponent& component, bool includeChilds, const PNamedShape& shape, double deflection, ComponentTraingMode = NO_INFO);
+    int triangularizeComponent(const std::vector<CTiglRelativelyPositionedComponent*>& components, bool includeChilds, const PNamedShape& shape, double deflection, ComponentTraingMode = NO_INFO);
     int triangularizeShape(const TopoDS_Shape&);
+    void triangularizeFaces(const TopoDS_Shape&, CTiglPolyObject& object) const;
     void annotateWingSegment(CCPACSWingSegment& segment, gp_Pnt centralP, bool pointOnMirroredShape, unsigned long iPolyLow, unsigned long iPolyUp);
-    int triangularizeFace(const TopoDS_Face&, unsigned long& nVertices, unsigned long& iPolyLow, unsigned long& iPolyUp);
+    int triangularizeFace(const TopoDS_Face&, CTiglPolyObject& object, unsigned long& nVertices, unsigned long& iPolyLow, unsigned long& iPolyUp) const;
     int computeVTKMetaData(class CCPACSWing&);
 
+    // meshes and triangulates independent components concurrently
+    class ComponentMesher;
+
     // some options
     CTiglTriangularizerOptions m_options;
 };
@@ -26,26 +26,40 @@
 #include "CTiglLogging.h"
 
 #include <cassert>
+#include <cmath>
 #include <iomanip>
 #include <limits>
+#include <vector>
 
 #include <GeomFill.hxx>
 #include <Geom_Line.hxx>
 
-namespace tigl
+namespace
 {
+    inline double cross2d(double u1, double u2, double v1, double v2)
+    {
+        return u1*v2 - u2*v1;
+    }
 
-void CTiglPointTranslator::SegmentProjection::setProjectionPoint(const CTiglPoint& p)
-{
-    _x = p;
+    // measures, how far the parameters are away from the unit square
+    inline double distanceToUnitSquare(double eta, double xsi)
+    {
+        double de = fabs(eta - 0.5);
+        double dx = fabs(xsi - 0.5);
+        return de > dx ? de : dx;
+    }
 }
 
-CTiglPointTranslator::CTiglPointTranslator() : projector(*this, a,b,c,d)
+namespace tigl
+{
+
+CTiglPointTranslator::CTiglPointTranslator()
 { 
     initialized = false;
+    planeValid  = false;
 }
 
-CTiglPointTranslator::CTiglPointTranslator(const CTiglPoint& x1, const CTiglPoint& x2, const CTiglPoint& x3, const CTiglPoint& x4) : projector(*this, a,b,c,d) 
+CTiglPointTranslator::CTiglPointTranslator(const CTiglPoint& x1, const CTiglPoint& x2, const CTiglPoint& x3, const CTiglPoint& x4)
 {
     setQuadriangle(x1, x2, x3, x4);
 }
@@ -57,6 +71,31 @@ void CTiglPointTranslator::setQuadriangle(const CTiglPoint& x1, const CTiglPoint
     c = x1-x2-x3+x4;
     d = x1;
 
+    // Scale of the whole problem. Must be
+    // Computed to make convergence independent of scale
+    double scale = a.norm2() * b.norm2();
+    if (scale < 1.0) {
+        scale = 1.0;
+    }
+    gradTol = 1e-7*scale;
+
+    // local 2d coordinate system in the plane spanned by a and b
+    CTiglPoint n = CTiglPoint::cross_prod(a, b);
+    aLen = a.norm2();
+    double nLen = n.norm2();
+    planeValid = aLen > 0. && nLen > 1e-12 * aLen * b.norm2();
+    if (planeValid) {
+        e1 = a * (1./aLen);
+        e2 = CTiglPoint::cross_prod(n * (1./nLen), e1);
+        b1 = CTiglPoint::inner_prod(b, e1);
+        b2 = CTiglPoint::inner_prod(b, e2);
+        c1 = CTiglPoint::inner_prod(c, e1);
+        c2 = CTiglPoint::inner_prod(c, e2);
+    }
+    else {
+        b1 = b2 = c1 = c2 = 0.;
+    }
+
     initialized = true;
 }
 
@@ -138,12 +177,189 @@ void CTiglPointTranslator::SegmentProjection::getHessian(const double * x, doubl
     TIGL_MATRIX2D(hess,2,1,0) = TIGL_MATRIX2D(hess,2,0,1);
 }
 
-TiglReturnCode CTiglPointTranslator::translate(const CTiglPoint& p, double* eta, double * xsi)
+TiglReturnCode CTiglPointTranslator::translate(const CTiglPoint& p, double* eta, double * xsi) const
 {
     if (!eta || !xsi) {
         LOG(ERROR) << "Error in CTiglPointTranslator::translate(): eta and xsi may not be NULL Pointers!" << std::endl;
         return TIGL_NULL_POINTER;
     }
+
+    assert(initialized);
+
+    if (planeValid) {
+        CTiglPoint q = p - d;
+        double q1 = CTiglPoint::inner_prod(q, e1);
+        double q2 = CTiglPoint::inner_prod(q, e2);
+        if (translateAnalytic(p, q1, q2, *eta, *xsi)) {
+            return TIGL_SUCCESS;
+        }
+    }
+
+    return translateOptimizer(p, eta, xsi);
+}
+
+TiglReturnCode CTiglPointTranslator::translate(size_t n, const double* px, const double* py, const double* pz, double* etas, double* xsis) const
+{
+    if (n == 0) {
+        return TIGL_SUCCESS;
+    }
+    if (!px || !py || !pz || !etas || !xsis) {
+        LOG(ERROR) << "Error in CTiglPointTranslator::translate(): Arguments may not be NULL Pointers!" << std::endl;
+        return TIGL_NULL_POINTER;
+    }
+
+    assert(initialized);
+
+    TiglReturnCode result = TIGL_SUCCESS;
+
+    if (!planeValid) {
+        for (size_t i = 0; i < n; ++i) {
+            TiglReturnCode ret = translateOptimizer(CTiglPoint(px[i], py[i], pz[i]), &etas[i], &xsis[i]);
+            if (ret != TIGL_SUCCESS && result == TIGL_SUCCESS) {
+                result = ret;
+            }
+        }
+        return result;
+    }
+
+    // First pass: transform all points into the local coordinate system of the plane.
+    // This loop has no branches and no dependencies between iterations
+    // and can be vectorized by the compiler.
+    std::vector<double> q1(n), q2(n);
+    const double e1x = e1.x, e1y = e1.y, e1z = e1.z;
+    const double e2x = e2.x, e2y = e2.y, e2z = e2.z;
+    const double dx  = d.x,  dy  = d.y,  dz  = d.z;
+    for (size_t i = 0; i < n; ++i) {
+        const double qx = px[i] - dx;
+        const double qy = py[i] - dy;
+        const double qz = pz[i] - dz;
+        q1[i] = qx*e1x + qy*e1y + qz*e1z;
+        q2[i] = qx*e2x + qy*e2y + qz*e2z;
+    }
+
+    // Second pass: solve the quadratic equation and refine each point
+    for (size_t i = 0; i < n; ++i) {
+        CTiglPoint pi(px[i], py[i], pz[i]);
+        if (translateAnalytic(pi, q1[i], q2[i], etas[i], xsis[i])) {
+            continue;
+        }
+        TiglReturnCode ret = translateOptimizer(pi, &etas[i], &xsis[i]);
+        if (ret != TIGL_SUCCESS && result == TIGL_SUCCESS) {
+            result = ret;
+        }
+    }
+
+    return result;
+}
+
+// Inside the plane, the point q = alpha*a + beta*b + alpha*beta*c must hold exactly.
+// Eliminating beta by the 2d cross product with (b + alpha*c) yields
+//    cross(a,c)*alpha^2 + (cross(a,b) - cross(q,c))*alpha - cross(q,b) = 0
+bool CTiglPointTranslator::translateAnalytic(const CTiglPoint& p, double q1, double q2, double& eta, double& xsi) const
+{
+    const double k2 = aLen * c2;
+    const double k1 = aLen * b2 - cross2d(q1, q2, c1, c2);
+    const double k0 = -cross2d(q1, q2, b1, b2);
+
+    double roots[2];
+    int nRoots = 0;
+    if (k2 == 0.) {
+        if (k1 == 0.) {
+            return false;
+        }
+        roots[nRoots++] = -k0/k1;
+    }
+    else {
+        double disc = k1*k1 - 4.*k2*k0;
+        if (disc < 0.) {
+            return false;
+        }
+        // numerically stable form of the quadratic formula
+        double s = -0.5 * (k1 + (k1 >= 0. ? sqrt(disc) : -sqrt(disc)));
+        roots[nRoots++] = s/k2;
+        if (s != 0.) {
+            roots[nRoots++] = k0/s;
+        }
+    }
+
+    bool found = false;
+    double bestDist = std::numeric_limits<double>::max();
+    for (int i = 0; i < nRoots; ++i) {
+        double alpha = roots[i];
+        double v1 = b1 + alpha*c1;
+        double v2 = b2 + alpha*c2;
+        double vv = v1*v1 + v2*v2;
+        if (vv <= 0.) {
+            continue;
+        }
+        double beta = ((q1 - alpha*aLen)*v1 + q2*v2) / vv;
+        double dist = distanceToUnitSquare(alpha, beta);
+        if (dist < bestDist) {
+            bestDist = dist;
+            eta = alpha;
+            xsi = beta;
+            found = true;
+        }
+    }
+
+    if (!found) {
+        return false;
+    }
+
+    // the point lies exactly on twisted quadriangles only in special cases
+    return refineNewton(p, eta, xsi);
+}
+
+bool CTiglPointTranslator::refineNewton(const CTiglPoint& p, double& eta, double& xsi) const
+{
+    CTiglPoint r;
+    calcPoint(eta, xsi, r);
+    r -= p;
+    double of = r.norm2Sqr();
+
+    for (int iter = 0; iter < 20; ++iter) {
+        CTiglPoint acb = a + c*xsi;
+        CTiglPoint bca = b + c*eta;
+
+        double g0 = 2.*CTiglPoint::inner_prod(r, acb);
+        double g1 = 2.*CTiglPoint::inner_prod(r, bca);
+        if (sqrt(g0*g0 + g1*g1) <= gradTol) {
+            return true;
+        }
+
+        double h00 = 2.*acb.norm2Sqr();
+        double h11 = 2.*bca.norm2Sqr();
+        double h01 = 2.*CTiglPoint::inner_prod(acb, bca) + 2.*CTiglPoint::inner_prod(r, c);
+        // the threshold is relative to the squared lengths of the jacobian columns,
+        // such that the test does not depend on the scale of the geometry
+        double det = h00*h11 - h01*h01;
+        if (h00 <= 0. || det <= 1e-12 * h00 * h11) {
+            // not a local minimum, leave this case to the optimizer
+            return false;
+        }
+
+        double dEta = -( h11*g0 - h01*g1) / det;
+        double dXsi = -(-h01*g0 + h00*g1) / det;
+
+        CTiglPoint rNew;
+        calcPoint(eta + dEta, xsi + dXsi, rNew);
+        rNew -= p;
+        double ofNew = rNew.norm2Sqr();
+        if (ofNew > of * (1. + 1e-12) + 1e-30) {
+            return false;
+        }
+
+        eta += dEta;
+        xsi += dXsi;
+        r  = rNew;
+        of = ofNew;
+    }
+
+    return false;
+}
+
+TiglReturnCode CTiglPointTranslator::translateOptimizer(const CTiglPoint& p, double* eta, double* xsi) const
+{
     double etaxsi[2];
     //initial guess
     double minDist = std::numeric_limits<double>::max();
@@ -159,18 +375,12 @@ TiglReturnCode CTiglPointTranslator::translate(const CTiglPoint& p, double* eta,
             }
         }
     }
-    
-    assert(initialized);
-    projector.setProjectionPoint(p);
 
-    // Scale of the whole problem. Must be
-    // Computed to make convergence independent of scale
-    double scale = a.norm2() * b.norm2();
-    if (scale < 1.0) {
-        scale = 1.0;
-    }
+    // the objective function is the only mutable state of the solver. It lives
+    // on the stack, so that concurrent calls don't interfere
+    SegmentProjection projector(*this, p);
 
-    TiglReturnCode ret = CTiglOptimizer::optNewton2d(projector, etaxsi, 1e-7*scale, 1e-8);
+    TiglReturnCode ret = CTiglOptimizer::optNewton2d(projector, etaxsi, gradTol, 1e-8);
     if (ret != TIGL_SUCCESS){
         // show some debuggin info
         CTiglPoint x1 = d;
@@ -228,7 +438,7 @@ TiglReturnCode CTiglPointTranslator::getNormal(double eta, double xsi, CTiglPoin
 
     
 // projects the point x onto the plane and returns this point
-TiglReturnCode CTiglPointTranslator::project(const CTiglPoint& xx, CTiglPoint* pOnSurf)
+TiglReturnCode CTiglPointTranslator::project(const CTiglPoint& xx, CTiglPoint* pOnSurf) const
 {
     if (!pOnSurf) {
         LOG(ERROR) << "Error in CTiglPointTranslator::project(): p may not be a NULL Pointer!" << std::endl;
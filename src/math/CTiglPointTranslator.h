@@ -21,6 +21,10 @@
 *
 * The theory behind the calculation is given in the document http://tigl.googlecode.com/files/PointTranslatorTheory.pdf
 * Information about the newton solver can be found here: http://en.wikipedia.org/wiki/Newton%27s_method_in_optimization
+*
+* The inverse mapping is first solved in closed form within the plane of the quadriangle,
+* which reduces to a quadratic equation in eta. For twisted quadriangles, this solution is
+* refined by a few Newton steps. The generic optimizer is used only for degenerate cases.
 */
 
 
@@ -32,6 +36,8 @@
 #include "tigl_internal.h"
 #include "ITiglObjectiveFunction.h"
 
+#include <cstddef>
+
 namespace tigl 
 {
 
@@ -59,33 +65,33 @@ public:
     TIGL_EXPORT void setQuadriangle(const CTiglPoint& xfl, const CTiglPoint& xfr, const CTiglPoint& xbl, const CTiglPoint& xbr);
 
     /// Finds an eta-xsi coordinate that minimizes the distance to point p.
-    /// The function is not reentrant. If you want to parallelize it, use 
-    /// multiple instances of CTiglPointTranslator.
-    TIGL_EXPORT TiglReturnCode translate(const CTiglPoint& p, double* eta, double* xsi);
+    /// Reentrant, the optimizer state is kept on the stack of the calling thread.
+    TIGL_EXPORT TiglReturnCode translate(const CTiglPoint& p, double* eta, double* xsi) const;
     
+    /// Batch version of translate for n points, that are given as separate coordinate arrays.
+    /// Returns TIGL_SUCCESS, if all points could be translated, otherwise the error code of
+    /// the first failing point. Reentrant.
+    TIGL_EXPORT TiglReturnCode translate(size_t n, const double* px, const double* py, const double* pz, double* etas, double* xsis) const;
+
     /// Converts from eta-xsi to spatial coordinates. Reentrant.
     TIGL_EXPORT TiglReturnCode translate(double eta, double xsi, CTiglPoint* p) const;
 
     TIGL_EXPORT TiglReturnCode getNormal(double eta, double xsi, CTiglPoint* n) const;
     
-    /// Projects the point p onto the plane and returns that point pOnSurf.
-    /// The function is not reentrant. If you want to parallelize it, use 
-    /// multiple instances of CTiglPointTranslator.
-    TIGL_EXPORT TiglReturnCode project(const CTiglPoint& p, CTiglPoint* pOnSurf);
+    /// Projects the point p onto the plane and returns that point pOnSurf. Reentrant.
+    TIGL_EXPORT TiglReturnCode project(const CTiglPoint& p, CTiglPoint* pOnSurf) const;
 
 private:
     class SegmentProjection : public tigl::ITiglObjectiveFunction 
     {
     public:
-        TIGL_EXPORT SegmentProjection(CTiglPointTranslator& t, CTiglPoint & a, CTiglPoint& b, CTiglPoint& c, CTiglPoint& d)
-          : ITiglObjectiveFunction(), _t(t), _a(a), _b(b), _c(c), _x(0,0,0)
+        TIGL_EXPORT SegmentProjection(const CTiglPointTranslator& t, const CTiglPoint& p)
+          : ITiglObjectiveFunction(), _t(t), _a(t.a), _b(t.b), _c(t.c), _x(p)
         {
         }
 
         TIGL_EXPORT ~SegmentProjection() OVERRIDE{}
 
-        TIGL_EXPORT void setProjectionPoint(const CTiglPoint& p);
-
         TIGL_EXPORT double getFunctionValue(const double * x) const OVERRIDE;
         TIGL_EXPORT void   getGradient     (const double * x, double * dx) const OVERRIDE;
         TIGL_EXPORT void   getHessian      (const double * x, double * H)  const OVERRIDE;
@@ -96,17 +102,33 @@ private:
         TIGL_EXPORT bool hasAnalyticHessian () const OVERRIDE { return true; }
 
     private:
-        CTiglPointTranslator& _t;
-        CTiglPoint &_a, &_b, &_c;
+        const CTiglPointTranslator& _t;
+        const CTiglPoint &_a, &_b, &_c;
         CTiglPoint _x;
     };
 
     void   calcPoint(double eta, double xsi, CTiglPoint& p) const;
 
+    // Inverts the bilinear mapping in the plane of the quadriangle in closed form. The in-plane
+    // coordinates (q1, q2) of p - d are passed by the caller. For non-planar quadriangles,
+    // the result is refined by some Newton steps. Returns false in degenerate cases.
+    bool translateAnalytic(const CTiglPoint& p, double q1, double q2, double& eta, double& xsi) const;
+
+    // Newton iteration on the exact projection problem starting at (eta, xsi)
+    bool refineNewton(const CTiglPoint& p, double& eta, double& xsi) const;
+
+    // Generic optimization, used as a fallback for degenerate cases
+    TiglReturnCode translateOptimizer(const CTiglPoint& p, double* eta, double* xsi) const;
 
-    SegmentProjection projector;
     CTiglPoint a, b, c, d;
 
+    // Orthonormal basis (e1, e2) of the plane spanned by a and b. In this basis,
+    // a = (aLen, 0), b = (b1, b2) and the plane component of c is (c1, c2).
+    CTiglPoint e1, e2;
+    double aLen, b1, b2, c1, c2;
+    double gradTol;
+    bool planeValid;
+
     bool initialized;
 };
 
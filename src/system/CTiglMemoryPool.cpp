@@ -19,6 +19,7 @@
 #include "CTiglMemoryPool.h"
 
 #include <list>
+#include <mutex>
 #include <string>
 
 namespace tigl
@@ -28,6 +29,7 @@ class CTiglMemoryPoolImpl
 {
 public:
     std::list<std::string> strings;
+    std::mutex mutex;
 };
 
 CTiglMemoryPool::CTiglMemoryPool()
@@ -45,6 +47,8 @@ CTiglMemoryPool::~CTiglMemoryPool()
 
 const char* CTiglMemoryPool::MakeNontempString(const char *s)
 {
+    // the list never invalidates the storage of existing strings, hence locking the insertion is sufficient
+    std::lock_guard<std::mutex> lock(impl->mutex);
     impl->strings.push_back(s);
     return impl->strings.back().c_str();
 }
@@ -0,0 +1,123 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef CTIGLONCEFLAG_H
+#define CTIGLONCEFLAG_H
+
+#include <atomic>
+#include <mutex>
+
+namespace tigl
+{
+
+/**
+ * @brief Flag that protects the lazy initialization of a cache.
+ *
+ * In contrast to std::once_flag, the flag can be reset, if the cached data
+ * becomes invalid. The initialization itself is done using CTiglOnceGuard:
+ *
+ * @code
+ * CTiglOnceGuard guard(cacheFlag);
+ * if (!guard.IsDone()) {
+ *     // build the cache
+ *     guard.SetDone();
+ * }
+ * @endcode
+ *
+ * Resetting the flag is a modification of the owning object and must not
+ * happen concurrently to queries on it.
+ */
+class CTiglOnceFlag
+{
+public:
+    CTiglOnceFlag() : done(false) {}
+
+    // a copy is not initialized, the cached data must be built again
+    CTiglOnceFlag(const CTiglOnceFlag&) : done(false) {}
+    CTiglOnceFlag& operator=(const CTiglOnceFlag&)
+    {
+        Reset();
+        return *this;
+    }
+
+    bool IsSet() const
+    {
+        return done.load(std::memory_order_acquire);
+    }
+
+    void Reset()
+    {
+        done.store(false, std::memory_order_release);
+    }
+
+private:
+    friend class CTiglOnceGuard;
+
+    std::atomic<bool> done;
+    // recursive, as the initialization of a cache may query the object again
+    std::recursive_mutex mutex;
+};
+
+/**
+ * @brief Scoped lock for the initialization of a cache protected by a CTiglOnceFlag.
+ *
+ * If the flag is already set, no lock is acquired. Otherwise, the flag's mutex
+ * is held until the guard is destroyed, so that only one thread builds the cache.
+ * If the initialization throws, the flag stays unset and the next caller retries.
+ */
+class CTiglOnceGuard
+{
+public:
+    explicit CTiglOnceGuard(CTiglOnceFlag& flag)
+        : _flag(flag)
+        , _locked(false)
+    {
+        if (!_flag.IsSet()) {
+            _flag.mutex.lock();
+            _locked = true;
+        }
+    }
+
+    ~CTiglOnceGuard()
+    {
+        if (_locked) {
+            _flag.mutex.unlock();
+        }
+    }
+
+    /// Returns true, if the cache has already been built
+    bool IsDone() const
+    {
+        return _flag.IsSet();
+    }
+
+    /// Marks the cache as built
+    void SetDone()
+    {
+        _flag.done.store(true, std::memory_order_release);
+    }
+
+private:
+    CTiglOnceGuard(const CTiglOnceGuard&);
+    void operator=(const CTiglOnceGuard&);
+
+    CTiglOnceFlag& _flag;
+    bool _locked;
+};
+
+} // namespace tigl
+
+#endif // CTIGLONCEFLAG_H
@@ -0,0 +1,177 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglProgress.h"
+
+#include "ITiglProgressHandler.h"
+#include "CTiglError.h"
+#include "tiglparallel.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace tigl
+{
+
+namespace
+{
+    std::mutex progressMutex;
+    ITiglProgressHandler* progressHandler = NULL;
+
+    // Serializes the calls of the progress handler. It is locked before progressMutex
+    // and, unlike progressMutex, held while the handler runs. It is recursive, as the
+    // handler may start tigl operations, that report their progress as well.
+    std::recursive_mutex reportMutex;
+
+    // running top level operations, guarded by progressMutex
+    std::vector<CTiglProgress*> runningOperations;
+
+    // innermost operation of the current thread
+    thread_local CTiglProgress* currentProgress = NULL;
+} // namespace
+
+CTiglProgress::CTiglProgress(const std::string& message, size_t nSteps)
+    : _previous(currentProgress)
+    , _root(currentProgress ? currentProgress->_root : this)
+    , _message(message)
+    , _nSteps(std::max(nSteps, static_cast<size_t>(1)))
+    , _done(0)
+    , _begin(0.)
+    , _end(1.)
+    , _silent(false)
+    , _canceled(false)
+{
+    if (IsInsideParallelTask() || (_previous && _previous->_silent)) {
+        _silent = true;
+    }
+    else if (_previous) {
+        // map into the current step of the outer operation
+        std::lock_guard<std::mutex> lock(progressMutex);
+        double stepSize = (_previous->_end - _previous->_begin) / static_cast<double>(_previous->_nSteps);
+        _begin = _previous->_begin + stepSize * static_cast<double>(_previous->_done);
+        _end   = std::min(_begin + stepSize, _previous->_end);
+    }
+
+    if (_root == this) {
+        // a new top level operation starts
+        std::lock_guard<std::mutex> lock(progressMutex);
+        runningOperations.push_back(this);
+    }
+
+    currentProgress = this;
+
+    if (_root == this && !_silent) {
+        Report();
+    }
+}
+
+CTiglProgress::~CTiglProgress()
+{
+    currentProgress = _previous;
+
+    if (_root == this) {
+        std::lock_guard<std::mutex> lock(progressMutex);
+        runningOperations.erase(std::find(runningOperations.begin(), runningOperations.end(), this));
+    }
+}
+
+void CTiglProgress::Step(size_t n)
+{
+    {
+        std::lock_guard<std::mutex> lock(progressMutex);
+        _done = std::min(_done + n, _nSteps);
+    }
+    if (!_silent) {
+        Report();
+    }
+    CheckCanceled();
+}
+
+// Must be called without holding progressMutex, as the handler may call tigl
+// functions like tiglCancelOperation. If the handler is busy with the report of
+// another thread, this report is skipped instead of waiting for the handler.
+void CTiglProgress::Report() const
+{
+    std::unique_lock<std::recursive_mutex> reportLock(reportMutex, std::try_to_lock);
+    if (!reportLock.owns_lock()) {
+        return;
+    }
+
+    ITiglProgressHandler* handler = NULL;
+    double progress = 0.;
+    {
+        std::lock_guard<std::mutex> lock(progressMutex);
+        handler = progressHandler;
+        progress = _begin + (_end - _begin) * static_cast<double>(_done) / static_cast<double>(_nSteps);
+    }
+
+    if (handler && !handler->Progress(progress, _message.c_str())) {
+        _root->_canceled = true;
+    }
+}
+
+void CTiglProgress::SetHandler(ITiglProgressHandler* handler)
+{
+    // wait for running reports, so that the old handler is not used anymore
+    std::lock_guard<std::recursive_mutex> reportLock(reportMutex);
+    std::lock_guard<std::mutex> lock(progressMutex);
+    progressHandler = handler;
+}
+
+ITiglProgressHandler* CTiglProgress::GetHandler()
+{
+    std::lock_guard<std::mutex> lock(progressMutex);
+    return progressHandler;
+}
+
+void CTiglProgress::Cancel()
+{
+    std::lock_guard<std::mutex> lock(progressMutex);
+    for (size_t i = 0; i < runningOperations.size(); ++i) {
+        runningOperations[i]->_canceled = true;
+    }
+}
+
+bool CTiglProgress::IsCanceled()
+{
+    return currentProgress && currentProgress->_root->_canceled;
+}
+
+void CTiglProgress::CheckCanceled()
+{
+    if (IsCanceled()) {
+        throw CTiglError("The operation was canceled.", TIGL_CANCELED);
+    }
+}
+
+CTiglProgress* CTiglProgress::Current()
+{
+    return currentProgress;
+}
+
+CTiglProgressThreadScope::CTiglProgressThreadScope(CTiglProgress* progress)
+    : _previous(currentProgress)
+{
+    currentProgress = progress;
+}
+
+CTiglProgressThreadScope::~CTiglProgressThreadScope()
+{
+    currentProgress = _previous;
+}
+
+} // namespace tigl
@@ -0,0 +1,116 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef CTIGLPROGRESS_H
+#define CTIGLPROGRESS_H
+
+#include "tigl_internal.h"
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+namespace tigl
+{
+
+class ITiglProgressHandler;
+
+/**
+ * @brief Reports the progress of an operation, that consists of a number of steps,
+ * to the registered ITiglProgressHandler and checks for cancellation.
+ *
+ * Operations can be nested: if a CTiglProgress object is created, while another
+ * one is alive in the same thread, the progress of the inner operation is mapped
+ * into the current step of the outer operation. Inside of a ParallelFor task, no
+ * progress is reported by nested operations, they only check for cancellation.
+ *
+ * Each top level operation has its own cancellation flag, which is shared by all of
+ * its nested operations and by the tasks of ParallelFor loops started inside of it.
+ * If the operation is canceled, a CTiglError with code TIGL_CANCELED is thrown
+ * by Step and CheckCanceled.
+ */
+class CTiglProgress
+{
+public:
+    TIGL_EXPORT CTiglProgress(const std::string& message, size_t nSteps);
+    TIGL_EXPORT ~CTiglProgress();
+
+    /// Marks n steps as done. This function is thread safe.
+    TIGL_EXPORT void Step(size_t n = 1);
+
+    /// Registers the progress handler. Pass NULL to remove the handler.
+    /// Waits until the current handler has finished its running report, unless
+    /// it is called from within the handler.
+    TIGL_EXPORT static void SetHandler(ITiglProgressHandler* handler);
+    TIGL_EXPORT static ITiglProgressHandler* GetHandler();
+
+    /// Requests the cancellation of all currently running operations.
+    /// This function may be called from any thread.
+    TIGL_EXPORT static void Cancel();
+
+    /// Returns true, if the cancellation of the operation of the calling thread was requested
+    TIGL_EXPORT static bool IsCanceled();
+
+    /// Throws a CTiglError with code TIGL_CANCELED, if the operation of the calling thread was canceled
+    TIGL_EXPORT static void CheckCanceled();
+
+    /// Returns the innermost operation of the calling thread or NULL
+    TIGL_EXPORT static CTiglProgress* Current();
+
+private:
+    friend class CTiglProgressThreadScope;
+
+    CTiglProgress(const CTiglProgress&);
+    CTiglProgress& operator=(const CTiglProgress&);
+
+    void Report() const;
+
+    CTiglProgress* _previous;
+    CTiglProgress* _root;
+    std::string    _message;
+    size_t         _nSteps;
+    size_t         _done;
+    double         _begin;
+    double         _end;
+    bool           _silent;
+
+    // only used by the top level operation
+    std::atomic<bool> _canceled;
+};
+
+/**
+ * @brief Makes an operation of another thread the current operation of the
+ * calling thread, while the scope is alive.
+ *
+ * ParallelFor uses it to pass the operation of the calling thread to its workers,
+ * so that the tasks are canceled together with the operation.
+ */
+class CTiglProgressThreadScope
+{
+public:
+    TIGL_EXPORT explicit CTiglProgressThreadScope(CTiglProgress* progress);
+    TIGL_EXPORT ~CTiglProgressThreadScope();
+
+private:
+    CTiglProgressThreadScope(const CTiglProgressThreadScope&);
+    CTiglProgressThreadScope& operator=(const CTiglProgressThreadScope&);
+
+    CTiglProgress* _previous;
+};
+
+} // namespace tigl
+
+#endif // CTIGLPROGRESS_H
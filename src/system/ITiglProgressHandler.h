@@ -0,0 +1,48 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef ITIGLPROGRESSHANDLER_H
+#define ITIGLPROGRESSHANDLER_H
+
+namespace tigl
+{
+
+/**
+ * @brief Interface to be notified about the progress of long running
+ * operations, e.g. fusing a configuration or exporting CAD files.
+ *
+ * The handler is registered with CTiglProgress::SetHandler. It might be called
+ * from different threads, but never concurrently. The handler may call tigl
+ * functions, e.g. to cancel the operation.
+ */
+class ITiglProgressHandler
+{
+public:
+    virtual ~ITiglProgressHandler() {}
+
+    /**
+     * @brief Reports the progress of the current operation
+     *
+     * @param progress Progress of the operation in the range [0, 1]
+     * @param message  Description of the current operation
+     * @return False, if the operation should be canceled
+     */
+    virtual bool Progress(double progress, const char* message) = 0;
+};
+
+} // namespace tigl
+
+#endif // ITIGLPROGRESSHANDLER_H
@@ -0,0 +1,280 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "tiglparallel.h"
+
+#include "CTiglProgress.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace tigl
+{
+
+namespace
+{
+    std::atomic<unsigned int> numberOfThreads(0);
+
+    // true, while the current thread executes a task of ParallelFor
+    thread_local bool insideParallelTask = false;
+
+    // marks the current thread as executing parallel tasks
+    class ParallelTaskScope
+    {
+    public:
+        ParallelTaskScope()
+            : previous(insideParallelTask)
+        {
+            insideParallelTask = true;
+        }
+
+        ~ParallelTaskScope()
+        {
+            insideParallelTask = previous;
+        }
+
+    private:
+        bool previous;
+    };
+
+    struct ParallelForState
+    {
+        ParallelForState(size_t n, detail::ParallelTaskFunction f, void* d, size_t nHelpers)
+            : count(n), func(f), data(d), progress(CTiglProgress::Current())
+            , helpersWanted(nHelpers), helpersRunning(0), nextIndex(0), failed(false)
+        {
+        }
+
+        void run()
+        {
+            for (;;) {
+                if (failed) {
+                    return;
+                }
+                size_t index = nextIndex++;
+                if (index >= count) {
+                    return;
+                }
+                try {
+                    func(data, index);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!failed) {
+                        error  = std::current_exception();
+                        failed = true;
+                    }
+                }
+            }
+        }
+
+        const size_t count;
+        detail::ParallelTaskFunction func;
+        void* data;
+
+        // operation of the calling thread, passed to the workers
+        CTiglProgress* progress;
+
+        // guarded by the mutex of the thread pool
+        size_t helpersWanted;
+
+        // guarded by helperMutex
+        size_t helpersRunning;
+        std::mutex helperMutex;
+        std::condition_variable helpersDone;
+
+        std::atomic<size_t> nextIndex;
+        std::atomic<bool> failed;
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+    /**
+     * Worker threads, that are started on first use and wait for loops to help with.
+     * They live until the library is unloaded.
+     */
+    class ThreadPool
+    {
+    public:
+        ThreadPool()
+            : stopping(false)
+        {
+        }
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wakeUp.notify_all();
+            for (size_t i = 0; i < workers.size(); ++i) {
+                workers[i].join();
+            }
+        }
+
+        static ThreadPool& Instance()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        // Offers the loop to up to state.helpersWanted idle workers
+        void Submit(ParallelForState& state)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                while (workers.size() < state.helpersWanted) {
+                    try {
+                        workers.push_back(std::thread(&ThreadPool::WorkerLoop, this));
+                    }
+                    catch (std::system_error&) {
+                        // could not spawn more threads, continue with the existing ones
+                        break;
+                    }
+                }
+                if (workers.empty()) {
+                    return;
+                }
+                jobs.push_back(&state);
+            }
+            wakeUp.notify_all();
+        }
+
+        // Withdraws the loop from the workers, that did not start to help yet,
+        // and waits until all helping workers are finished
+        void Finish(ParallelForState& state)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                std::deque<ParallelForState*>::iterator it = std::find(jobs.begin(), jobs.end(), &state);
+                if (it != jobs.end()) {
+                    jobs.erase(it);
+                }
+            }
+            std::unique_lock<std::mutex> lock(state.helperMutex);
+            while (state.helpersRunning > 0) {
+                state.helpersDone.wait(lock);
+            }
+        }
+
+    private:
+        void WorkerLoop()
+        {
+            ParallelTaskScope scope;
+            for (;;) {
+                ParallelForState* state = NULL;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (!stopping && jobs.empty()) {
+                        wakeUp.wait(lock);
+                    }
+                    if (stopping) {
+                        return;
+                    }
+                    state = jobs.front();
+                    if (--state->helpersWanted == 0) {
+                        jobs.pop_front();
+                    }
+
+                    // registered while the job is still visible to Finish
+                    std::lock_guard<std::mutex> helperLock(state->helperMutex);
+                    state->helpersRunning++;
+                }
+
+                {
+                    CTiglProgressThreadScope progressScope(state->progress);
+                    state->run();
+                }
+
+                std::lock_guard<std::mutex> helperLock(state->helperMutex);
+                if (--state->helpersRunning == 0) {
+                    state->helpersDone.notify_all();
+                }
+            }
+        }
+
+        std::mutex mutex;
+        std::condition_variable wakeUp;
+        std::deque<ParallelForState*> jobs;
+        std::vector<std::thread> workers;
+        bool stopping;
+    };
+} // namespace
+
+unsigned int GetNumberOfThreads()
+{
+    unsigned int nThreads = numberOfThreads;
+    if (nThreads == 0) {
+        nThreads = std::thread::hardware_concurrency();
+    }
+    return std::max(nThreads, 1u);
+}
+
+void SetNumberOfThreads(unsigned int nThreads)
+{
+    numberOfThreads = nThreads;
+}
+
+bool IsInsideParallelTask()
+{
+    return insideParallelTask;
+}
+
+namespace detail
+{
+
+void ParallelForImpl(size_t count, ParallelTaskFunction func, void* data)
+{
+    if (count == 0) {
+        return;
+    }
+
+    // nested loops are executed serially to avoid oversubscription
+    size_t nThreads = std::min(static_cast<size_t>(GetNumberOfThreads()), count);
+    if (nThreads <= 1 || insideParallelTask) {
+        for (size_t i = 0; i < count; ++i) {
+            func(data, i);
+        }
+        return;
+    }
+
+    ParallelForState state(count, func, data, nThreads - 1);
+
+    // the calling thread works as well
+    ThreadPool& pool = ThreadPool::Instance();
+    pool.Submit(state);
+    {
+        ParallelTaskScope scope;
+        state.run();
+    }
+    pool.Finish(state);
+
+    if (state.error) {
+        std::rethrow_exception(state.error);
+    }
+}
+
+} // namespace detail
+
+} // namespace tigl
@@ -0,0 +1,79 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef TIGLPARALLEL_H
+#define TIGLPARALLEL_H
+
+#include "tigl_internal.h"
+
+#include <cstddef>
+
+namespace tigl
+{
+
+/**
+ * @brief Returns the number of worker threads used by TiGL's parallel algorithms.
+ *
+ * By default, this is the number of hardware threads of the machine.
+ */
+TIGL_EXPORT unsigned int GetNumberOfThreads();
+
+/**
+ * @brief Sets the number of worker threads used by TiGL's parallel algorithms.
+ *
+ * A value of 0 restores the default (number of hardware threads),
+ * a value of 1 disables multithreading.
+ */
+TIGL_EXPORT void SetNumberOfThreads(unsigned int nThreads);
+
+/**
+ * @brief Returns true, if the calling thread currently executes a task of ParallelFor.
+ */
+TIGL_EXPORT bool IsInsideParallelTask();
+
+namespace detail
+{
+    typedef void (*ParallelTaskFunction)(void* data, size_t index);
+
+    TIGL_EXPORT void ParallelForImpl(size_t count, ParallelTaskFunction func, void* data);
+
+    template <class Functor>
+    void CallFunctor(void* data, size_t index)
+    {
+        (*static_cast<Functor*>(data))(index);
+    }
+} // namespace detail
+
+/**
+ * @brief Calls func(i) for all i in [0, count) using a pool of worker threads.
+ *
+ * The worker threads are started on the first call and reused by all later calls.
+ * The calling thread executes tasks as well. The tasks are distributed dynamically, i.e. it is fine if the workload of
+ * the single tasks differs. The functor must be safe to be called concurrently
+ * for different indices. If a task throws, the remaining tasks are not started
+ * and the first exception is rethrown in the calling thread after all
+ * workers have finished. Calls of ParallelFor from within a task are
+ * executed serially.
+ */
+template <class Functor>
+void ParallelFor(size_t count, Functor& func)
+{
+    detail::ParallelForImpl(count, &detail::CallFunctor<Functor>, &func);
+}
+
+} // namespace tigl
+
+#endif // TIGLPARALLEL_H
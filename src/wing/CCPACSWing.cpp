@@ -40,6 +40,7 @@
 #include "tiglcommonfunctions.h"
 #include "tiglmathfunctions.h"
 #include "CNamedShape.h"
+#include "CTiglDiskCache.h"
 
 #include "BRepOffsetAPI_ThruSections.hxx"
 #include "BRepAlgoAPI_Fuse.hxx"
@@ -91,9 +92,7 @@ namespace
 CCPACSWing::CCPACSWing(CCPACSWings* parent, CTiglUIDManager* uidMgr)
     : generated::CPACSWing(parent, uidMgr)
     , CTiglRelativelyPositionedComponent(&m_parentUID, &m_transformation, &m_symmetry)
-    , rebuildFusedSegments(true)
-    , rebuildFusedSegWEdge(true)
-    , rebuildShells(true) {
+    , rebuildFusedSegments(true) {
 
     if (parent->IsParent<CCPACSAircraftModel>())
         configuration = &parent->GetParent<CCPACSAircraftModel>()->GetConfiguration();
@@ -108,9 +107,7 @@ CCPACSWing::CCPACSWing(CCPACSRotorBlades* parent, CTiglUIDManager* uidMgr)
     : generated::CPACSWing(parent, uidMgr)
     , CTiglRelativelyPositionedComponent(&m_parentUID, &m_transformation, &m_symmetry)
     , configuration(&parent->GetConfiguration())
-    , rebuildFusedSegments(true)
-    , rebuildFusedSegWEdge(true)
-    , rebuildShells(true) {
+    , rebuildFusedSegments(true) {
     Cleanup();
 }
 
@@ -134,6 +131,15 @@ void CCPACSWing::Invalidate()
         m_componentSegments->Invalidate();
 }
 
+// Invalidates the fused shapes only
+void CCPACSWing::InvalidateShapes()
+{
+    CTiglAbstractGeometricComponent::Reset();
+    fusedSegWEdgeBuilt.Reset();
+    shellsBuilt.Reset();
+    guideCurvesBuilt.Reset();
+}
+
 // Cleanup routine
 void CCPACSWing::Cleanup()
 {
@@ -181,7 +187,7 @@ void CCPACSWing::Update()
     m_transformation.updateMatrix();
     invalidated = false;
     rebuildFusedSegments = true;    // forces a rebuild of all segments with regards to the updated translation
-    rebuildShells = true;
+    shellsBuilt.Reset();
 }
 
 // Read CPACS wing element
@@ -298,30 +304,33 @@ CCPACSWingComponentSegment& CCPACSWing::GetComponentSegment(const std::string& u
 // Gets the loft of the whole wing with modeled leading edge.
 TopoDS_Shape & CCPACSWing::GetLoftWithLeadingEdge()
 {
-    if (rebuildFusedSegWEdge) {
+    CTiglOnceGuard guard(fusedSegWEdgeBuilt);
+    if (!guard.IsDone()) {
         fusedSegmentWithEdge = BuildFusedSegments(true)->Shape();
+        guard.SetDone();
     }
-    rebuildFusedSegWEdge = false;
     return fusedSegmentWithEdge;
 }
     
 // Gets the loft of the whole wing.
 TopoDS_Shape & CCPACSWing::GetUpperShape()
 {
-    if (rebuildShells) {
+    CTiglOnceGuard guard(shellsBuilt);
+    if (!guard.IsDone()) {
         BuildUpperLowerShells();
+        guard.SetDone();
     }
-    rebuildShells = false;
     return upperShape;
 }
     
 // Gets the loft of the whole wing.
 TopoDS_Shape & CCPACSWing::GetLowerShape()
 {
-    if (rebuildShells) {
+    CTiglOnceGuard guard(shellsBuilt);
+    if (!guard.IsDone()) {
         BuildUpperLowerShells();
+        guard.SetDone();
     }
-    rebuildShells = false;
     return lowerShape;
 }
     
@@ -348,6 +357,18 @@ PNamedShape CCPACSWing::BuildLoft()
     return BuildFusedSegments(true);
 }
 
+bool CCPACSWing::GetLoftCacheKey(std::string& key)
+{
+    key = "wing " + GetShortShapeName() + "\n";
+    AppendCPACSDefinition(key, *this);
+    const boost::optional<CCPACSProfiles>& profiles = GetConfiguration().GetProfiles();
+    if (profiles) {
+        AppendCPACSDefinition(key, *profiles);
+    }
+    AppendTransformation(key, GetTransformationMatrix());
+    return true;
+}
+
 // Builds a fused shape of all wing segments
 PNamedShape CCPACSWing::BuildFusedSegments(bool splitWingInUpperAndLower)
 {
@@ -763,7 +784,8 @@ TopoDS_Compound& CCPACSWing::GetGuideCurveWires()
 
 void CCPACSWing::BuildGuideCurveWires()
 {
-    if (!guideCurves.IsNull()) {
+    CTiglOnceGuard guard(guideCurvesBuilt);
+    if (guard.IsDone()) {
         return;
     }
     
@@ -827,6 +849,8 @@ void CCPACSWing::BuildGuideCurveWires()
         result = wireFixer.Wire();
         b.Add(guideCurves, result);
     }
+
+    guard.SetDone();
 }
 
 TopoDS_Shape transformWingProfileGeometry(const CTiglTransformation& wingTransform, const CTiglWingConnection& connection, const TopoDS_Shape& wire)
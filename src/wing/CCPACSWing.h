@@ -31,6 +31,7 @@
 #include "generated/CPACSWing.h"
 #include "tigl_config.h"
 #include "CTiglTransformation.h"
+#include "CTiglOnceFlag.h"
 #include "CTiglRelativelyPositionedComponent.h"
 #include "CCPACSWingSections.h"
 #include "CCPACSWingSegments.h"
@@ -61,6 +62,10 @@ public:
     // Invalidates internal state
     TIGL_EXPORT void Invalidate();
 
+    // Invalidates the shapes of the whole wing (loft, shells, guide curves),
+    // but keeps the geometry of the segments
+    TIGL_EXPORT void InvalidateShapes();
+
     // Read CPACS wing elements
     TIGL_EXPORT void ReadCPACS(TixiDocumentHandle tixiHandle, const std::string & wingXPath);
 
@@ -152,6 +157,9 @@ public:
     // Returns the Component Type TIGL_COMPONENT_WING.
     TIGL_EXPORT TiglGeometricComponentType GetComponentType() const OVERRIDE { return TIGL_COMPONENT_WING | TIGL_COMPONENT_PHYSICAL; }
 
+    // Returns the CPACS definition of the wing and the profiles to identify the loft in the disk cache
+    TIGL_EXPORT bool GetLoftCacheKey(std::string& key) OVERRIDE;
+
     // Returns the lower Surface of a Segment
     TIGL_EXPORT Handle(Geom_Surface) GetLowerSegmentSurface(int index);
 
@@ -195,8 +203,9 @@ private:
     TopoDS_Compound                guideCurves;
     bool                           invalidated;              /**< Internal state flag */
     bool                           rebuildFusedSegments;     /**< Indicates if segmentation fusing need rebuild */
-    bool                           rebuildFusedSegWEdge;     /**< Indicates if segmentation fusing need rebuild */
-    bool                           rebuildShells;
+    CTiglOnceFlag                  fusedSegWEdgeBuilt;       /**< Set, if fusedSegmentWithEdge is up to date */
+    CTiglOnceFlag                  shellsBuilt;              /**< Set, if upperShape and lowerShape are up to date */
+    CTiglOnceFlag                  guideCurvesBuilt;         /**< Set, if guideCurves is up to date */
     FusedElementsContainerType     fusedElements;            /**< Stores already fused segments */
     double                         myVolume;                 /**< Volume of this Wing           */
 
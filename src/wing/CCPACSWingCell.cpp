@@ -90,6 +90,68 @@ namespace WingCellInternal
         bool s3 = sign(p, p3, p1) > 0.;
         return (s1 == s2) && (s2 == s3);
     }
+
+    // checks if the quadriangle p1-p2-p3-p4 is convex
+    bool is_convex(Point2D p1, Point2D p2, Point2D p3, Point2D p4)
+    {
+        // calculate for all 4 edges the relative position of the opposite corner
+        // trailing edge
+        bool s1 = sign(p3, p1, p2) > 0.;
+        // outer border
+        bool s2 = sign(p4, p2, p3) > 0.;
+        // leading edge
+        bool s3 = sign(p1, p3, p4) > 0.;
+        // inner border
+        bool s4 = sign(p2, p4, p1) > 0.;
+
+        return (s1 == s2) && (s2 == s3) && (s3 == s4);
+    }
+
+    // checks if point p is in the quadriangle p1-p2-p3-p4
+    bool is_in_quadriangle(Point2D p, Point2D p1, Point2D p2, Point2D p3, Point2D p4, bool convex)
+    {
+        if (convex) {
+            // calculate for all 4 edges the relative position of eta/xsi
+
+            // trailing edge
+            bool s1 = sign(p, p1, p2) > 0.;
+            // outer border
+            bool s2 = sign(p, p2, p3) > 0.;
+            // leading edge
+            bool s3 = sign(p, p3, p4) > 0.;
+            // inner border
+            bool s4 = sign(p, p4, p1) > 0.;
+
+            // this only works if the quadriangle is convex
+            return (s1 == s2) && (s2 == s3) && (s3 == s4);
+        }
+        else {
+            // compute windings of nodes
+            bool w1 = sign(p4, p1, p2) > 0.;
+            bool w2 = sign(p1, p2, p3) > 0.;
+            bool w3 = sign(p2, p3, p4) > 0.;
+            bool w4 = sign(p3, p4, p1) > 0.;
+
+            // get main winding, if 3 positive one negative -> 3, else 1
+            int  iwind = (w1 + w2 + w3 + w4);
+            if (iwind != 1 && iwind != 3) {
+                throw CTiglError("Error in Quadriangle Winding calculation in CCPACSWingCell::IsInside.", TIGL_MATH_ERROR);
+            }
+
+            bool winding = (iwind == 3);
+
+            // determine point with w[i] != winding
+            if (w1 != winding || w3 != winding) {
+                return is_in_trian(p, p1, p3, p4) || is_in_trian(p, p1, p2, p3);
+            }
+            else if (w2 != winding || w4 != winding) {
+                return is_in_trian(p, p2, p1, p4) || is_in_trian(p, p2, p4, p3);
+            }
+            else {
+                throw CTiglError("Error in Quadriangle Winding calculation in CCPACSWingCell::IsInside.", TIGL_MATH_ERROR);
+            }
+        }
+    }
 }
 
 using namespace WingCellInternal;
@@ -104,6 +166,11 @@ CCPACSWingCell::~CCPACSWingCell() {}
 void CCPACSWingCell::Invalidate()
 {
     cache.valid = false;
+
+    // the shell caches the cell corners for the cell lookup
+    if (m_parent && m_parent->GetParentElement()) {
+        m_parent->GetParentElement()->InvalidateCellIndex();
+    }
 }
 
 void CCPACSWingCell::Reset()
@@ -117,22 +184,12 @@ bool CCPACSWingCell::IsConvex() const
 {
     Point2D p1, p2, p3, p4;
     
-    // calculate for all 4 edges the relative position of eta/xsi
     GetTrailingEdgeInnerPoint(&p1.x, &p1.y);
     GetTrailingEdgeOuterPoint(&p2.x, &p2.y);
     GetLeadingEdgeOuterPoint (&p3.x, &p3.y);
     GetLeadingEdgeInnerPoint (&p4.x, &p4.y);
     
-    // trailing edge
-    bool s1 = sign(p3, p1, p2) > 0.;
-    // outer border
-    bool s2 = sign(p4, p2, p3) > 0.;
-    // leading edge
-    bool s3 = sign(p1, p3, p4) > 0.;
-    // inner border
-    bool s4 = sign(p2, p4, p1) > 0.;
-    
-    return (s1 == s2) && (s2 == s3) && (s3 == s4);
+    return is_convex(p1, p2, p3, p4);
 }
 
 bool CCPACSWingCell::IsInside(double eta, double xsi) const
@@ -145,47 +202,7 @@ bool CCPACSWingCell::IsInside(double eta, double xsi) const
     GetLeadingEdgeOuterPoint (&p3.x, &p3.y);
     GetLeadingEdgeInnerPoint (&p4.x, &p4.y);
     
-    if (IsConvex()) {
-        // calculate for all 4 edges the relative position of eta/xsi
-        
-        // trailing edge
-        bool s1 = sign(p, p1, p2) > 0.;
-        // outer border
-        bool s2 = sign(p, p2, p3) > 0.;
-        // leading edge
-        bool s3 = sign(p, p3, p4) > 0.;
-        // inner border
-        bool s4 = sign(p, p4, p1) > 0.;
-        
-        // this only works if the quadriangle is convex
-        return (s1 == s2) && (s2 == s3) && (s3 == s4);
-    }
-    else {
-        // compute windings of nodes
-        bool w1 = sign(p4, p1, p2) > 0.;
-        bool w2 = sign(p1, p2, p3) > 0.;
-        bool w3 = sign(p2, p3, p4) > 0.;
-        bool w4 = sign(p3, p4, p1) > 0.;
-        
-        // get main winding, if 3 positive one negative -> 3, else 1
-        int  iwind = (w1 + w2 + w3 + w4);
-        if (iwind != 1 && iwind != 3) {
-            throw CTiglError("Error in Quadriangle Winding calculation in CCPACSWingCell::IsInside.", TIGL_MATH_ERROR);
-        }
-        
-        bool winding = (iwind == 3);
-        
-        // determine point with w[i] != winding
-        if (w1 != winding || w3 != winding) {
-            return is_in_trian(p, p1, p3, p4) || is_in_trian(p, p1, p2, p3);
-        }
-        else if (w2 != winding || w4 != winding) {
-            return is_in_trian(p, p2, p1, p4) || is_in_trian(p, p2, p4, p3);
-        }
-        else {
-            throw CTiglError("Error in Quadriangle Winding calculation in CCPACSWingCell::IsInside.", TIGL_MATH_ERROR);
-        }
-    }
+    return is_in_quadriangle(p, p1, p2, p3, p4, is_convex(p1, p2, p3, p4));
 }
 
 void CCPACSWingCell::ReadCPACS(const TixiDocumentHandle& tixiHandle, const std::string &cellXPath)
@@ -123,6 +123,12 @@ namespace WingCellInternal
 
     // checks if point p is in triangle p1-p2-p3
     TIGL_EXPORT bool is_in_trian(Point2D p, Point2D p1, Point2D p2, Point2D p3);
+
+    // checks if the quadriangle p1-p2-p3-p4 is convex
+    TIGL_EXPORT bool is_convex(Point2D p1, Point2D p2, Point2D p3, Point2D p4);
+
+    // checks if point p is in the quadriangle p1-p2-p3-p4, convex must be the result of is_convex
+    TIGL_EXPORT bool is_in_quadriangle(Point2D p, Point2D p1, Point2D p2, Point2D p3, Point2D p4, bool convex);
 }
 
 } // namespace tigl
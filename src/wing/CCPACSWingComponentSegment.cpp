@@ -47,6 +47,7 @@
 #include "CTiglWingChordface.h"
 #include "CTiglShapeGeomComponentAdaptor.h"
 #include "CNamedShape.h"
+#include "tiglparallel.h"
 
 #include "BRepOffsetAPI_ThruSections.hxx"
 #include "TopoDS_Edge.hxx"
@@ -75,12 +76,11 @@
 #include <TopExp.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 
-#include <BRepAdaptor_CompCurve.hxx>
 #include <BRepBndLib.hxx>
+#include <Bnd_Box.hxx>
 #include <BRepBuilderAPI_MakeSolid.hxx>
 #include <BRepBuilderAPI_Sewing.hxx>
 #include <GC_MakeSegment.hxx>
-#include <GCPnts_AbscissaPoint.hxx>
 #include <Geom_TrimmedCurve.hxx>
 #include <gp_Pln.hxx>
 #include <ShapeAnalysis_Curve.hxx>
@@ -115,6 +115,51 @@ namespace
         return p;
     }
 
+    // Computes the in-plane deviation of the point from the chord face of the segment.
+    // eta and xsi are the coordinates of the nearest point on the segment.
+    double GetSegmentDeviation(const tigl::CCPACSWingSegment& segment, const gp_Pnt& pnt, double& eta, double& xsi, gp_Pnt& nearestPoint)
+    {
+        segment.GetEtaXsi(pnt, eta, xsi);
+        gp_Pnt pointProjected = segment.GetChordPoint(eta, xsi);
+
+        // Get nearest point on this segment
+        eta = GetNearestValidParameter(eta);
+        xsi = GetNearestValidParameter(xsi);
+        nearestPoint = segment.GetChordPoint(eta, xsi);
+
+        return nearestPoint.Distance(pointProjected);
+    }
+
+    // Locates a block of points in parallel
+    class FindSegmentsTask
+    {
+    public:
+        FindSegmentsTask(const tigl::CCPACSWingComponentSegment& cs, size_t n, size_t blockSize,
+                         const double* px, const double* py, const double* pz,
+                         std::vector<const tigl::CCPACSWingSegment*>& segments,
+                         double* etas, double* xsis, double* deviations)
+            : cs(cs), n(n), blockSize(blockSize), px(px), py(py), pz(pz)
+            , segments(segments), etas(etas), xsis(xsis), deviations(deviations)
+        {
+        }
+
+        void operator()(size_t iBlock)
+        {
+            size_t end = std::min(n, (iBlock + 1) * blockSize);
+            for (size_t i = iBlock * blockSize; i < end; ++i) {
+                gp_Pnt nearestPoint;
+                segments[i] = cs.findSegment(gp_Pnt(px[i], py[i], pz[i]), etas[i], xsis[i], nearestPoint, deviations[i]);
+            }
+        }
+
+    private:
+        const tigl::CCPACSWingComponentSegment& cs;
+        size_t n, blockSize;
+        const double *px, *py, *pz;
+        std::vector<const tigl::CCPACSWingSegment*>& segments;
+        double *etas, *xsis, *deviations;
+    };
+
     // Set the face traits
     void SetFaceTraits (PNamedShape loft, unsigned int nSegments) 
     { 
@@ -181,10 +226,13 @@ void CCPACSWingComponentSegment::Invalidate()
     // call parent class instead of directly setting invalidated flag
     CTiglAbstractSegment<CCPACSWingComponentSegment>::Reset();
     wingSegments.clear();
+    segmentListBuilt.Reset();
     if (m_structure) {
         m_structure->Invalidate();
     }
-    linesAreValid = false;
+    linesAreValid.Reset();
+    segmentIndexBuilt.Reset();
+    wingTransformationInverseBuilt.Reset();
     chordFace->Reset();
     upperShape->Reset();
     lowerShape->Reset();
@@ -198,9 +246,12 @@ void CCPACSWingComponentSegment::Cleanup()
     m_toElementUID   = "";
     myVolume       = 0.;
     mySurfaceArea  = 0.;
-    linesAreValid = false;
+    linesAreValid.Reset();
     CTiglAbstractSegment<CCPACSWingComponentSegment>::Reset();
     wingSegments.clear();
+    segmentListBuilt.Reset();
+    segmentIndexBuilt.Reset();
+    wingTransformationInverseBuilt.Reset();
 }
 
 // Update internal segment data
@@ -273,25 +324,17 @@ TopoDS_Face CCPACSWingComponentSegment::GetOuterFace()
 // Getter for leading edge point
 gp_Pnt CCPACSWingComponentSegment::GetLeadingEdgePoint(double referencePos) const
 {
-    // get point on leading edge line
-    gp_Pnt lePnt;
-    BRepAdaptor_CompCurve leLineCurve(GetLeadingEdgeLine(), Standard_True);
-    Standard_Real len = GCPnts_AbscissaPoint::Length( leLineCurve );
-    leLineCurve.D0(len * referencePos, lePnt);
+    BuildLines();
 
-    return lePnt;
+    return leadingEdgeParam.Value(referencePos);
 }
 
 // Getter for trailing edge point
 gp_Pnt CCPACSWingComponentSegment::GetTrailingEdgePoint(double referencePos) const
 {
-    // get point on trailing edge line
-    gp_Pnt tePnt;
-    BRepAdaptor_CompCurve teLineCurve(GetTrailingEdgeLine(), Standard_True);
-    Standard_Real len = GCPnts_AbscissaPoint::Length( teLineCurve );
-    teLineCurve.D0(len * referencePos, tePnt);
+    BuildLines();
 
-    return tePnt;
+    return trailingEdgeParam.Value(referencePos);
 }
 
 TopoDS_Face CCPACSWingComponentSegment::GetSectionElementFace(const std::string& sectionElementUID) const
@@ -377,17 +420,17 @@ gp_Vec CCPACSWingComponentSegment::GetTrailingEdgeDirection(const gp_Pnt& point,
 // Getter for the length of the leading edge between two eta values
 double CCPACSWingComponentSegment::GetLeadingEdgeLength() const
 {
-    BRepAdaptor_CompCurve leLineCurve(GetLeadingEdgeLine(), Standard_True);
-    double length = GCPnts_AbscissaPoint::Length( leLineCurve );
-    return length;
+    BuildLines();
+
+    return leadingEdgeParam.Length();
 }
 
 // Getter for the length of the trailing edge between two eta values
 double CCPACSWingComponentSegment::GetTrailingEdgeLength() const
 {
-    BRepAdaptor_CompCurve teLineCurve(GetTrailingEdgeLine(), Standard_True);
-    double length = GCPnts_AbscissaPoint::Length( teLineCurve );
-    return length;
+    BuildLines();
+
+    return trailingEdgeParam.Length();
 }
 
 // Getter for the midplane line between two eta-xsi points
@@ -524,18 +567,14 @@ TopoDS_Wire CCPACSWingComponentSegment::GetMidplaneLine(const gp_Pnt& startPoint
 // Getter for the leading edge line
 const TopoDS_Wire& CCPACSWingComponentSegment::GetLeadingEdgeLine() const
 {
-    if (!linesAreValid) {
-        BuildLines();
-    }
+    BuildLines();
     return leadingEdgeLine;
 }
 
 // Getter for the trailing edge line
 const TopoDS_Wire& CCPACSWingComponentSegment::GetTrailingEdgeLine() const
 {
-    if (!linesAreValid) {
-        BuildLines();
-    }
+    BuildLines();
     return trailingEdgeLine;
 }
 
@@ -551,7 +590,9 @@ const std::string& CCPACSWingComponentSegment::GetOuterSegmentUID() const
 
 SegmentList& CCPACSWingComponentSegment::GetSegmentList() const
 {
-    if (wingSegments.size() == 0) {
+    CTiglOnceGuard guard(segmentListBuilt);
+    if (!guard.IsDone()) {
+        wingSegments.clear();
         std::vector<int> path;
         path = findPath(m_fromElementUID, m_toElementUID, path, true);
 
@@ -571,6 +612,7 @@ SegmentList& CCPACSWingComponentSegment::GetSegmentList() const
             CCPACSWingSegment* pSeg = static_cast<CCPACSWingSegment*>(&(GetWing().GetSegment(*it)));
             wingSegments.push_back(pSeg);
         }
+        guard.SetDone();
     }
 
     return wingSegments;
@@ -824,6 +866,11 @@ PNamedShape CCPACSWingComponentSegment::BuildLoft()
 // Method for building wires for eta-, leading edge-, trailing edge-lines
 void CCPACSWingComponentSegment::BuildLines() const
 {
+    CTiglOnceGuard guard(linesAreValid);
+    if (guard.IsDone()) {
+        return;
+    }
+
     // search for ETA coordinate
     std::vector<gp_Pnt> lePointContainer;
     std::vector<gp_Pnt> tePointContainer;
@@ -848,6 +895,16 @@ void CCPACSWingComponentSegment::BuildLines() const
 
 
 
+    // The lines are polylines, hence their arc length parametrization
+    // is given by the cumulated lengths of the edges
+    std::vector<gp_Pnt> etaPointContainer;
+    for (size_t i = 0; i < lePointContainer.size(); ++i) {
+        etaPointContainer.push_back(gp_Pnt(0, lePointContainer[i].Y(), lePointContainer[i].Z()));
+    }
+    etaLineParam.Init(etaPointContainer);
+    leadingEdgeParam.Init(lePointContainer);
+    trailingEdgeParam.Init(tePointContainer);
+
     // build wires: etaLine, extendedEtaLine, leadingEdgeLine
     BRepBuilderAPI_MakeWire wbEta, wbLe, wbTe;
     gp_Pnt innerLePoint, outerLePoint, innerPoint2d, outerPoint2d, innerTePoint, outerTePoint;
@@ -873,7 +930,7 @@ void CCPACSWingComponentSegment::BuildLines() const
     etaLine = wbEta.Wire();
     trailingEdgeLine = wbTe.Wire();
 
-    linesAreValid = true;
+    guard.SetDone();
 }
 
 void CCPACSWingComponentSegment::UpdateChordFace() const
@@ -909,7 +966,7 @@ gp_Pnt CCPACSWingComponentSegment::GetPoint(double eta, double xsi, TiglCoordina
 
     switch (referenceCS) {
     case WING_COORDINATE_SYSTEM:
-        result = wing->GetWingTransformation().Inverted().Transform(result);
+        result = GetWingTransformationInverse().Transform(result);
         break;
     case GLOBAL_COORDINATE_SYSTEM:
         // nothing needs to be done
@@ -930,6 +987,13 @@ void CCPACSWingComponentSegment::GetEtaXsi(const gp_Pnt& p, double& eta, double&
     chordFace->GetEtaXsi(p, eta, xsi);
 }
 
+void CCPACSWingComponentSegment::GetEtaXsi(size_t n, const double* px, const double* py, const double* pz, double* etas, double* xsis) const
+{
+    UpdateChordFace();
+
+    chordFace->GetEtaXsi(n, px, py, pz, etas, xsis);
+}
+
 // TODO (siggel): remove this function as it duplicates GetEtaXsi
 void CCPACSWingComponentSegment::GetMidplaneEtaXsi(const gp_Pnt& p, double& eta, double& xsi) const
 {
@@ -941,33 +1005,107 @@ void CCPACSWingComponentSegment::GetMidplaneEtaXsi(const gp_Pnt& p, double& eta,
 // Getter for eta direction of midplane
 gp_Vec CCPACSWingComponentSegment::GetMidplaneEtaDir(double eta) const
 {
-    // get point on eta line
-    gp_Pnt etaPnt;
-    gp_Vec etaDir;
-
-    if (!linesAreValid) {
-        BuildLines();
-    }
+    BuildLines();
 
-    BRepAdaptor_CompCurve etaLineCurve(etaLine, Standard_True);
-    Standard_Real len = GCPnts_AbscissaPoint::Length( etaLineCurve );
-    etaLineCurve.D1( len * eta, etaPnt, etaDir );
-    return etaDir.Normalized();
+    return etaLineParam.Direction(eta);
 }
 
 // Getter for midplane normal vector
 gp_Vec CCPACSWingComponentSegment::GetMidplaneNormal(double eta) const
+{
+    gp_Pnt lePnt;
+    gp_Vec etaDir, normal;
+    GetMidplaneFrame(eta, lePnt, etaDir, normal);
+    return normal;
+}
+
+void CCPACSWingComponentSegment::GetMidplaneFrames(const std::vector<double>& etas, std::vector<gp_Pnt>& leadingEdgePoints,
+                                                   std::vector<gp_Vec>& etaDirs, std::vector<gp_Vec>& normals) const
+{
+    leadingEdgePoints.resize(etas.size());
+    etaDirs.resize(etas.size());
+    normals.resize(etas.size());
+
+    for (size_t i = 0; i < etas.size(); ++i) {
+        GetMidplaneFrame(etas[i], leadingEdgePoints[i], etaDirs[i], normals[i]);
+    }
+}
+
+void CCPACSWingComponentSegment::GetMidplaneFrame(double eta, gp_Pnt& leadingEdgePoint, gp_Vec& etaDir, gp_Vec& normal) const
 {
     if (eta < 0.0 || eta > 1.0) {
-        throw CTiglError("Parameter eta not in the range 0.0 <= eta <= 1.0 in CCPACSWingComponentSegment::GetMidplaneOrChordlinePoint", TIGL_ERROR);
+        throw CTiglError("Parameter eta not in the range 0.0 <= eta <= 1.0 in CCPACSWingComponentSegment::GetMidplaneFrame", TIGL_ERROR);
     }
 
-    gp_Pnt lePnt = GetPoint(eta, 0., WING_COORDINATE_SYSTEM);
+    leadingEdgePoint = GetPoint(eta, 0., WING_COORDINATE_SYSTEM);
     gp_Pnt tePnt = GetPoint(eta, 1., WING_COORDINATE_SYSTEM);
-    gp_Vec etaDir = GetMidplaneEtaDir(eta);
-    gp_Vec chordLine(lePnt, tePnt);
-    gp_Vec normal = chordLine.Normalized().Crossed(etaDir);
-    return normal;
+    etaDir = GetMidplaneEtaDir(eta);
+    gp_Vec chordLine(leadingEdgePoint, tePnt);
+    normal = chordLine.Normalized().Crossed(etaDir);
+}
+
+void CCPACSWingComponentSegment::PolylineParametrization::Init(const std::vector<gp_Pnt>& pnts)
+{
+    points.clear();
+    params.clear();
+    length = 0.;
+
+    // skip coincident points, they don't contribute to the arc length
+    for (size_t i = 0; i < pnts.size(); ++i) {
+        if (!points.empty()) {
+            double edgeLength = points.back().Distance(pnts[i]);
+            if (edgeLength < Precision::Confusion()) {
+                continue;
+            }
+            length += edgeLength;
+        }
+        points.push_back(pnts[i]);
+        params.push_back(length);
+    }
+
+    if (points.size() < 2) {
+        throw CTiglError("Polyline has zero length in CCPACSWingComponentSegment::PolylineParametrization::Init", TIGL_MATH_ERROR);
+    }
+
+    for (size_t i = 0; i < params.size(); ++i) {
+        params[i] /= length;
+    }
+}
+
+double CCPACSWingComponentSegment::PolylineParametrization::Length() const
+{
+    return length;
+}
+
+size_t CCPACSWingComponentSegment::PolylineParametrization::FindEdge(double relativePos) const
+{
+    std::vector<double>::const_iterator it = std::upper_bound(params.begin(), params.end(), relativePos);
+    size_t iPoint = static_cast<size_t>(it - params.begin());
+    // iPoint is the first point behind relativePos, clamp to the first and last edge
+    return std::min(std::max(iPoint, static_cast<size_t>(1)), points.size() - 1) - 1;
+}
+
+gp_Pnt CCPACSWingComponentSegment::PolylineParametrization::Value(double relativePos) const
+{
+    size_t iEdge = FindEdge(relativePos);
+    double t = (relativePos - params[iEdge]) / (params[iEdge + 1] - params[iEdge]);
+    return points[iEdge].XYZ() + t * (points[iEdge + 1].XYZ() - points[iEdge].XYZ());
+}
+
+gp_Vec CCPACSWingComponentSegment::PolylineParametrization::Direction(double relativePos) const
+{
+    size_t iEdge = FindEdge(relativePos);
+    return gp_Vec(points[iEdge], points[iEdge + 1]).Normalized();
+}
+
+const CTiglTransformation& CCPACSWingComponentSegment::GetWingTransformationInverse() const
+{
+    CTiglOnceGuard guard(wingTransformationInverseBuilt);
+    if (!guard.IsDone()) {
+        wingTransformationInverse = wing->GetWingTransformation().Inverted();
+        guard.SetDone();
+    }
+    return wingTransformationInverse;
 }
 
 void CCPACSWingComponentSegment::GetEtaXsiFromSegmentEtaXsi(const std::string& segmentUID, double seta, double sxsi, double& eta, double& xsi) const
@@ -1042,34 +1180,58 @@ double CCPACSWingComponentSegment::GetSurfaceArea()
 // Returns null if the point is not an that wing!
 const CCPACSWingSegment* CCPACSWingComponentSegment::findSegment(double x, double y, double z, gp_Pnt& nearestPoint, double& deviation) const
 {
-    CCPACSWingSegment* result = NULL;
-    gp_Pnt pnt(x, y, z);
+    double eta, xsi;
+    return findSegment(gp_Pnt(x, y, z), eta, xsi, nearestPoint, deviation);
+}
 
+const CCPACSWingSegment* CCPACSWingComponentSegment::findSegment(const gp_Pnt& pnt, double& segmentEta, double& segmentXsi, gp_Pnt& nearestPoint, double& deviation) const
+{
+    CCPACSWingSegment* result = NULL;
 
     const SegmentList& segments = GetSegmentList();
 
+    // First check the segments, whose bounding box contains the point.
+    // If the point lies on one of them, no other segment can be closer.
+    // The candidates are checked in segment order, so that a point on the
+    // boundary between two segments belongs to the first one, as in a
+    // linear scan over all segments.
+    std::vector<size_t> candidates;
+    GetSegmentIndex().FindBoxes(pnt, candidates);
+    std::sort(candidates.begin(), candidates.end());
+    std::vector<bool> checked(segments.size(), false);
+
     double minDist = std::numeric_limits<double>::max();
-    // now discover to which segment the point belongs
-    for (SegmentList::const_iterator segit = segments.begin(); segit != segments.end(); ++segit) {
-        try {
-            double eta, xsi;
-            (*segit)->GetEtaXsi(pnt, eta, xsi);
-            gp_Pnt pointProjected = (*segit)->GetChordPoint(eta, xsi);
-
-            // Get nearest point on this segment
-            double nextEta = GetNearestValidParameter(eta);
-            double nextXsi = GetNearestValidParameter(xsi);
-            gp_Pnt currentPoint = (*segit)->GetChordPoint(nextEta, nextXsi);
-
-            double currentDist = currentPoint.Distance(pointProjected);
-            if (currentDist < minDist) {
-                minDist = currentDist;
-                nearestPoint = currentPoint;
-                result = *segit;
+    for (int pass = 0; pass < 2 && minDist > Precision::Confusion(); ++pass) {
+        if (pass == 1) {
+            // the point is not on any of the candidates, check all segments
+            candidates.clear();
+            for (size_t i = 0; i < segments.size(); ++i) {
+                candidates.push_back(i);
             }
         }
-        catch (...) {
-            // do nothing
+
+        // now discover to which segment the point belongs
+        for (std::vector<size_t>::const_iterator it = candidates.begin(); it != candidates.end() && minDist > Precision::Confusion(); ++it) {
+            if (checked[*it]) {
+                continue;
+            }
+            checked[*it] = true;
+
+            try {
+                double eta, xsi;
+                gp_Pnt currentPoint;
+                double currentDist = GetSegmentDeviation(*segments[*it], pnt, eta, xsi, currentPoint);
+                if (currentDist < minDist) {
+                    minDist = currentDist;
+                    nearestPoint = currentPoint;
+                    segmentEta = eta;
+                    segmentXsi = xsi;
+                    result = segments[*it];
+                }
+            }
+            catch (...) {
+                // do nothing
+            }
         }
     }
 
@@ -1078,37 +1240,98 @@ const CCPACSWingSegment* CCPACSWingComponentSegment::findSegment(double x, doubl
     return result;
 }
 
+void CCPACSWingComponentSegment::findSegments(size_t n, const double* px, const double* py, const double* pz,
+                                              std::vector<const CCPACSWingSegment*>& segments,
+                                              double* segmentEtas, double* segmentXsis, double* deviations) const
+{
+    segments.assign(n, NULL);
+    if (n == 0) {
+        return;
+    }
+    if (!px || !py || !pz || !segmentEtas || !segmentXsis || !deviations) {
+        throw CTiglError("Null pointer argument in CCPACSWingComponentSegment::findSegments", TIGL_NULL_POINTER);
+    }
+
+    // build the index before going parallel, the workers would wait for it anyway
+    GetSegmentIndex();
+
+    const size_t blockSize = 256;
+    FindSegmentsTask task(*this, n, blockSize, px, py, pz, segments, segmentEtas, segmentXsis, deviations);
+    ParallelFor((n + blockSize - 1) / blockSize, task);
+}
+
+const CTiglBoundingBoxTree& CCPACSWingComponentSegment::GetSegmentIndex() const
+{
+    CTiglOnceGuard guard(segmentIndexBuilt);
+    if (!guard.IsDone()) {
+        const SegmentList& segments = GetSegmentList();
+
+        const int nEta = 4;
+        const int nXsi = 10;
+        std::vector<Bnd_Box> boxes(segments.size());
+        for (size_t i = 0; i < segments.size(); ++i) {
+            const CCPACSWingSegment& segment = *segments[i];
+            Bnd_Box& box = boxes[i];
+
+            // the chord face lies between the upper and lower surface
+            for (int iEta = 0; iEta <= nEta; ++iEta) {
+                double eta = static_cast<double>(iEta) / nEta;
+                for (int iXsi = 0; iXsi <= nXsi; ++iXsi) {
+                    double xsi = static_cast<double>(iXsi) / nXsi;
+                    box.Add(segment.GetUpperPoint(eta, xsi));
+                    box.Add(segment.GetLowerPoint(eta, xsi));
+                }
+            }
+
+            // The samples might miss the thickest part of the profile. The
+            // box must also contain all points within the 1 cm tolerance of the wing.
+            box.Enlarge(std::max(1e-2, 0.05 * sqrt(box.SquareExtent())));
+        }
+
+        segmentIndex = CTiglBoundingBoxTree(boxes);
+        guard.SetDone();
+    }
+
+    return segmentIndex;
+}
+
 MaterialList CCPACSWingComponentSegment::GetMaterials(double eta, double xsi, TiglStructureType type)
 {
-    MaterialList list;
-        
+    std::vector<MaterialList> materials;
+    GetMaterials(1, &eta, &xsi, type, materials);
+    return materials[0];
+}
+
+void CCPACSWingComponentSegment::GetMaterials(size_t n, const double* etas, const double* xsis, TiglStructureType type,
+                                              std::vector<MaterialList>& materials)
+{
+    materials.clear();
+    materials.resize(n);
+
     if (!m_structure) {
-        // return empty list
-        return list;
+        // return empty lists
+        return;
     }
-        
+
     if (type != UPPER_SHELL && type != LOWER_SHELL) {
         LOG(ERROR) << "Cannot compute materials for inner structure in CCPACSWingComponentSegment::GetMaterials (not yet implemented)";
-        return list;
+        return;
     }
-    else {
-        CCPACSWingShell* shell = (type == UPPER_SHELL? &m_structure->GetUpperShell() : &m_structure->GetLowerShell());
-        int ncells = shell->GetCellCount();
-        for (int i = 1; i <= ncells; ++i){
-            CCPACSWingCell& cell = shell->GetCell(i);
 
-            if (cell.IsInside(eta,xsi)) {
-                list.push_back(&(cell.GetMaterial()));
-            }
+    const CCPACSWingShell* shell = (type == UPPER_SHELL? &m_structure->GetUpperShell() : &m_structure->GetLowerShell());
+    std::vector<int> cellIndices;
+    for (size_t i = 0; i < n; ++i) {
+        MaterialList& list = materials[i];
+        shell->GetCellIndices(etas[i], xsis[i], cellIndices);
+        for (std::vector<int>::const_iterator it = cellIndices.begin(); it != cellIndices.end(); ++it) {
+            list.push_back(&(shell->GetCell(*it).GetMaterial()));
         }
 
         // add complete skin, only if no cells are defined
-        if (list.empty()){
+        if (list.empty()) {
             list.push_back(&(shell->GetMaterial()));
         }
-        
     }
-    return list;
 }
 
 // Method for checking whether segment is contained in componentSegment
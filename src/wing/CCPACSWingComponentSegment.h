@@ -45,6 +45,8 @@
 #include "CTiglAbstractSegment.h"
 #include "CTiglPoint.h"
 #include "CTiglPointTranslator.h"
+#include "CTiglOnceFlag.h"
+#include "CTiglBoundingBoxTree.h"
 #include "CCPACSTransformation.h"
 
 namespace tigl
@@ -95,6 +97,9 @@ public:
     // Returns the eta xsi coordinates of a points projected onto the midplane / chordface
     TIGL_EXPORT void GetEtaXsi(const gp_Pnt& p, double& eta, double& xsi) const;
 
+    // Batch version of GetEtaXsi for n points given as separate coordinate arrays
+    TIGL_EXPORT void GetEtaXsi(size_t n, const double* px, const double* py, const double* pz, double* etas, double* xsis) const;
+
     // Getter for leading edge point at the relative position, which must be
     // defined between 0 (inner point on leadinge edge) and 1 (outer point)
     TIGL_EXPORT gp_Pnt GetLeadingEdgePoint(double relativePos) const;
@@ -117,6 +122,11 @@ public:
     // Getter for midplane normal vector
     TIGL_EXPORT gp_Vec GetMidplaneNormal(double eta) const;
 
+    // Batch version of GetMidplaneEtaDir and GetMidplaneNormal. Also returns the
+    // leading edge points of the midplane in wing coordinates.
+    TIGL_EXPORT void GetMidplaneFrames(const std::vector<double>& etas, std::vector<gp_Pnt>& leadingEdgePoints,
+                                       std::vector<gp_Vec>& etaDirs, std::vector<gp_Vec>& normals) const;
+
     // Get the eta xsi coordinate from a segment point (given by seta, sxsi)
     TIGL_EXPORT void GetEtaXsiFromSegmentEtaXsi(const std::string &segmentUID, double seta, double sxsi, double &eta, double &xsi) const;
 
@@ -133,10 +143,24 @@ public:
     // Returns null if the point is not an that wing, i.e. deviates more than 1 cm from the wing
     TIGL_EXPORT const CCPACSWingSegment* findSegment(double x, double y, double z, gp_Pnt& nearestPoint, double& deviation) const;
 
+    // Same as above, but also returns the segment eta/xsi coordinates of the nearest point
+    TIGL_EXPORT const CCPACSWingSegment* findSegment(const gp_Pnt& pnt, double& segmentEta, double& segmentXsi, gp_Pnt& nearestPoint, double& deviation) const;
+
+    // Batch version of findSegment for n points given as separate coordinate arrays.
+    // For points without any segment, the segment is null and the deviation is infinite.
+    TIGL_EXPORT void findSegments(size_t n, const double* px, const double* py, const double* pz,
+                                  std::vector<const CCPACSWingSegment*>& segments,
+                                  double* segmentEtas, double* segmentXsis, double* deviations) const;
+
     TIGL_EXPORT TiglGeometricComponentType GetComponentType() const OVERRIDE { return TIGL_COMPONENT_WINGCOMPSEGMENT | TIGL_COMPONENT_SEGMENT | TIGL_COMPONENT_LOGICAL; }
 
     TIGL_EXPORT MaterialList GetMaterials(double eta, double xsi, TiglStructureType);
 
+    // Returns the materials at n eta/xsi coordinates, materials[i] equals
+    // GetMaterials(etas[i], xsis[i], type)
+    TIGL_EXPORT void GetMaterials(size_t n, const double* etas, const double* xsis, TiglStructureType type,
+                                  std::vector<MaterialList>& materials);
+
     // returns a list of segments that belong to this component segment
     // TODO: return const-reference to avoid potential harmful modification of wingSegments member
     TIGL_EXPORT SegmentList& GetSegmentList() const;
@@ -219,6 +243,15 @@ private:
 
     void UpdateChordFace() const;
 
+    // Returns the bounding box tree of the segments, the box indices are the indices in the segment list
+    const CTiglBoundingBoxTree& GetSegmentIndex() const;
+
+    // Returns the inverse of the wing transformation, which is computed only once
+    const CTiglTransformation& GetWingTransformationInverse() const;
+
+    // Computes the leading edge point, eta direction and normal of the midplane at eta
+    void GetMidplaneFrame(double eta, gp_Pnt& leadingEdgePoint, gp_Vec& etaDir, gp_Vec& normal) const;
+
 
 private:
     CCPACSWing*          wing;                 /**< Parent wing                             */
@@ -227,6 +260,7 @@ private:
     unique_ptr<CTiglShapeGeomComponentAdaptor> upperShape; /**< Upper shape of this componentSegment */
     unique_ptr<CTiglShapeGeomComponentAdaptor> lowerShape; /**< Lower shape of this componentSegment */
     mutable SegmentList  wingSegments;         /**< List of segments belonging to the component segment */
+    mutable CTiglOnceFlag segmentListBuilt;
     TopoDS_Face          innerFace;            /**< [[CAS_AES]] added inner segment face    */
     TopoDS_Face          outerFace;            /**< [[CAS_AES]] added outer segment face    */
     mutable unique_ptr<CTiglWingChordface> chordFace;
@@ -234,7 +268,39 @@ private:
     mutable TopoDS_Wire  etaLine;                  // 2d version (in YZ plane) of leadingEdgeLine
     mutable TopoDS_Wire  leadingEdgeLine;          // leading edge as wire
     mutable TopoDS_Wire  trailingEdgeLine;         // trailing edge as wire
-    mutable bool         linesAreValid;
+    // Arc length parametrization of the polylines above, which replaces the
+    // (expensive) length computation of the wires for each query
+    class PolylineParametrization
+    {
+    public:
+        void Init(const std::vector<gp_Pnt>& points);
+
+        double Length() const;
+
+        // Point at the relative arc length, the polyline is extrapolated linearly
+        gp_Pnt Value(double relativePos) const;
+
+        // Direction of the edge at the relative arc length. On a vertex, the outer edge is taken
+        gp_Vec Direction(double relativePos) const;
+
+    private:
+        size_t FindEdge(double relativePos) const;
+
+        std::vector<gp_Pnt> points;
+        std::vector<double> params; // normalized arc length of each point
+        double length;
+    };
+
+    mutable PolylineParametrization etaLineParam;
+    mutable PolylineParametrization leadingEdgeParam;
+    mutable PolylineParametrization trailingEdgeParam;
+    mutable CTiglOnceFlag linesAreValid;
+
+    mutable CTiglTransformation wingTransformationInverse;
+    mutable CTiglOnceFlag wingTransformationInverseBuilt;
+
+    mutable CTiglBoundingBoxTree segmentIndex;     // bounding boxes of the segments for point location
+    mutable CTiglOnceFlag segmentIndexBuilt;
 };
 
 inline std::vector<tigl::CCPACSWingSegment*> getSortedSegments(const CCPACSWingComponentSegment& cs)
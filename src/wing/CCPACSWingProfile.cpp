@@ -26,6 +26,7 @@
 #include <iostream>
 #include <sstream>
 #include <vector>
+#include <algorithm>
 
 #include "CTiglError.h"
 #include "CTiglLogging.h"
@@ -33,6 +34,7 @@
 #include "math.h"
 
 #include "gp_Pnt2d.hxx"
+#include "gp_Vec.hxx"
 #include "gp_Vec2d.hxx"
 #include "gp_Dir2d.hxx"
 #include "gp_Pln.hxx"
@@ -60,12 +62,26 @@
 #include "ITiglWingProfileAlgo.h"
 #include "CCPACSWingProfile.h"
 
+namespace
+{
+    // number of intervals of the xsi lookup tables
+    const int XSI_LOOKUP_INTERVALS = 200;
+
+    // returns the relative position of the projection of p onto the chord line
+    double chordXsi(const gp_Pnt& p, const gp_Pnt& le, const gp_Pnt& te)
+    {
+        double dx = te.X() - le.X();
+        double dz = te.Z() - le.Z();
+        return ((p.X() - le.X()) * dx + (p.Z() - le.Z()) * dz) / (dx * dx + dz * dz);
+    }
+}
+
 namespace tigl 
 {
 
 // Constructor
 CCPACSWingProfile::CCPACSWingProfile(CTiglUIDManager* uidMgr)
-    : generated::CPACSProfileGeometry(uidMgr), invalidated(true), isRotorProfile(false) {}
+    : generated::CPACSProfileGeometry(uidMgr), isRotorProfile(false) {}
 
 
 CCPACSWingProfile::~CCPACSWingProfile() {}
@@ -97,19 +113,22 @@ bool CCPACSWingProfile::IsRotorProfile() const
 // Invalidates internal wing profile state
 void CCPACSWingProfile::Invalidate()
 {
-    invalidated = true;
+    updated.Reset();
+    upperLookup.valid.Reset();
+    lowerLookup.valid.Reset();
 }
 
 // Update the internal state, i.g. recalculates wire and le, te points
 void CCPACSWingProfile::Update()
 {
-    if (!invalidated) {
+    CTiglOnceGuard guard(updated);
+    if (guard.IsDone()) {
         return;
     }
 
     // build wires
     GetProfileAlgo()->Update();
-    invalidated = false;
+    guard.SetDone();
 }
     
 // Returns the wing profile upper wire
@@ -321,6 +340,110 @@ gp_Pnt CCPACSWingProfile::GetPoint(double xsi, bool fromUpper)
         return GetTEPoint();
     }
 
+    const XsiLookup& lookup = GetXsiLookup(fromUpper);
+    if (!lookup.monotone || xsi < lookup.xsis.front() || xsi >= lookup.xsis.back()) {
+        return GetPointFromIntersection(xsi, fromUpper);
+    }
+
+    // find the tabulated interval containing xsi, i.e. xsis[i] <= xsi < xsis[i+1]
+    size_t i = std::upper_bound(lookup.xsis.begin(), lookup.xsis.end(), xsi) - lookup.xsis.begin() - 1;
+
+    // the solution is bracketed by [ta, tb] with xsi(ta) <= xsi < xsi(tb)
+    double ta = lookup.params[i];
+    double tb = lookup.params[i+1];
+    double t = ta + (xsi - lookup.xsis[i]) / (lookup.xsis[i+1] - lookup.xsis[i]) * (tb - ta);
+
+    // safeguarded Newton iteration on xsi(t) - xsi = 0
+    double dx = lookup.te.X() - lookup.le.X();
+    double dz = lookup.te.Z() - lookup.le.Z();
+    double chordLength2 = dx * dx + dz * dz;
+    for (int iter = 0; iter < 20; ++iter) {
+        gp_Pnt p;
+        gp_Vec dp;
+        lookup.curve->D1(t, p, dp);
+
+        double f = chordXsi(p, lookup.le, lookup.te) - xsi;
+        if (fabs(f) < 1e-12) {
+            break;
+        }
+
+        if (f < 0.) {
+            ta = t;
+        }
+        else {
+            tb = t;
+        }
+
+        double df = (dp.X() * dx + dp.Z() * dz) / chordLength2;
+        double tNew = 0.5 * (ta + tb);
+        if (fabs(df) > 0.) {
+            double tNewton = t - f / df;
+            if (tNewton > std::min(ta, tb) && tNewton < std::max(ta, tb)) {
+                tNew = tNewton;
+            }
+        }
+
+        bool converged = fabs(tNew - t) < 1e-14 * (1. + fabs(t));
+        t = tNew;
+        if (converged) {
+            break;
+        }
+    }
+
+    gp_Pnt p = lookup.curve->Value(t);
+    return gp_Pnt(p.X(), 0.0, p.Z());
+}
+
+// Builds the lookup table from xsi to the curve parameter of the
+// upper or lower profile curve
+const CCPACSWingProfile::XsiLookup& CCPACSWingProfile::GetXsiLookup(bool fromUpper)
+{
+    Update();
+
+    XsiLookup& lookup = fromUpper ? upperLookup : lowerLookup;
+    CTiglOnceGuard guard(lookup.valid);
+    if (guard.IsDone()) {
+        return lookup;
+    }
+
+    TopoDS_Edge edge = fromUpper ? GetUpperWire() : GetLowerWire();
+    Standard_Real firstParam;
+    Standard_Real lastParam;
+    lookup.curve = BRep_Tool::Curve(edge, firstParam, lastParam);
+    lookup.le = GetLEPoint();
+    lookup.te = GetTEPoint();
+
+    lookup.xsis.resize(XSI_LOOKUP_INTERVALS + 1);
+    lookup.params.resize(XSI_LOOKUP_INTERVALS + 1);
+    for (int i = 0; i <= XSI_LOOKUP_INTERVALS; ++i) {
+        double t = firstParam + (lastParam - firstParam) * static_cast<double>(i) / static_cast<double>(XSI_LOOKUP_INTERVALS);
+        lookup.params[i] = t;
+        lookup.xsis[i] = chordXsi(lookup.curve->Value(t), lookup.le, lookup.te);
+    }
+
+    // the curve might run from the trailing to the leading edge
+    if (lookup.xsis.front() > lookup.xsis.back()) {
+        std::reverse(lookup.xsis.begin(), lookup.xsis.end());
+        std::reverse(lookup.params.begin(), lookup.params.end());
+    }
+
+    lookup.monotone = true;
+    for (int i = 0; i < XSI_LOOKUP_INTERVALS; ++i) {
+        if (lookup.xsis[i+1] <= lookup.xsis[i]) {
+            lookup.monotone = false;
+            break;
+        }
+    }
+
+    guard.SetDone();
+    return lookup;
+}
+
+// Computes the profile point at xsi by intersecting the profile curve
+// with the normal of the chord line. This is used, if the profile
+// curve is not monotone in xsi.
+gp_Pnt CCPACSWingProfile::GetPointFromIntersection(double xsi, bool fromUpper)
+{
     gp_Pnt   chordPoint3d = GetChordPoint(xsi);
     gp_Pnt2d chordPoint2d(chordPoint3d.X(), chordPoint3d.Z());
 
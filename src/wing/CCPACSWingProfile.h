@@ -34,11 +34,15 @@
 #include "generated/CPACSProfileGeometry.h"
 #include "generated/UniquePtr.h"
 #include "tigl_internal.h"
+#include "CTiglOnceFlag.h"
 #include "TopoDS_Wire.hxx"
 #include "TopoDS_Edge.hxx"
 #include "PTiglWingProfileAlgo.h"
 
 #include <gp_Pnt.hxx>
+#include <Geom_Curve.hxx>
+
+#include <vector>
 
 #include <Geom2d_TrimmedCurve.hxx>
 
@@ -141,6 +145,10 @@ protected:
     // on the upper profile is returned, otherwise from the lower.
     gp_Pnt GetPoint(double xsi, bool fromUpper);
 
+    // Computes the profile point at xsi by intersecting the profile curve
+    // with the normal of the chord line
+    gp_Pnt GetPointFromIntersection(double xsi, bool fromUpper);
+
     // Helper function to determine the chord line between leading and trailing edge in the profile plane
     Handle(Geom2d_TrimmedCurve) GetChordLine();
 
@@ -152,9 +160,29 @@ private:
     void operator=(const CCPACSWingProfile& );
 
 private:
+    // Tabulates the curve parameters of the upper or lower profile curve
+    // at increasing xsi values. These are used as start values to compute
+    // profile points by a Newton iteration.
+    struct XsiLookup
+    {
+        XsiLookup() : monotone(false) {}
+
+        CTiglOnceFlag       valid;
+        bool                monotone; /**< False, if xsi is not monotone along the curve */
+        Handle(Geom_Curve)  curve;
+        gp_Pnt              le;
+        gp_Pnt              te;
+        std::vector<double> xsis;
+        std::vector<double> params;
+    };
+
+    const XsiLookup& GetXsiLookup(bool fromUpper);
+
     bool                                  isRotorProfile; /**< Indicates if this profile is a rotor profile */
-    bool                                  invalidated;    /**< Flag if element is invalid */
+    CTiglOnceFlag                         updated;        /**< Set, if the internal state is up to date */
     unique_ptr<CTiglWingProfilePointList> pointListAlgo;  // is created in case the wing profile alg is a point list, otherwise cst2d constructed in the base class is used
+    XsiLookup                             upperLookup;
+    XsiLookup                             lowerLookup;
 
 }; // class CCPACSWingProfile
 
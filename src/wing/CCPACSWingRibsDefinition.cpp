@@ -53,6 +53,7 @@
 #include "CTiglError.h"
 #include "CTiglLogging.h"
 #include "tiglcommonfunctions.h"
+#include "tiglparallel.h"
 #include "tiglwingribhelperfunctions.h"
 #include "CNamedShape.h"
 
@@ -60,6 +61,77 @@
 namespace tigl
 {
 
+namespace
+{
+    // Builds the face of a single rib by intersecting its cut face with the loft
+    TopoDS_Face BuildRibFace(const CCPACSWingRibsDefinition::CutGeometry& cutGeometry,
+                             const LoftFaceSelector& loftFaces, const std::string& uid)
+    {
+        // handle case when ribCutFace is identical with target rib face
+        if (cutGeometry.isTargetFace) {
+            return cutGeometry.shape;
+        }
+
+        // intersect rib cut face with loft
+        TopoDS_Shape ribCutEdges = CutShapes(cutGeometry.shape, loftFaces.GetFaces(cutGeometry.shape));
+
+        // build wires out of connected edges
+        TopTools_ListOfShape wireList;
+        BuildWiresFromConnectedEdges(ribCutEdges, wireList);
+
+        // build face(s) for spar
+        TopoDS_Face ribFace;
+        if (wireList.Extent() == 1) {
+            try {
+                TopoDS_Wire ribWire = CloseWire(TopoDS::Wire(wireList.First()));
+                ribFace = BRepBuilderAPI_MakeFace(ribWire);
+            }
+            catch (const CTiglError&) {
+                LOG(ERROR) << "unable to generate rib face for rib definition: " << uid;
+                throw CTiglError("unable to generate rib face for rib definition \"" + uid + "\"! Please check for a correct rib definition!");
+            }
+        }
+        else if (wireList.Extent() == 2) {
+            ribFace = BuildFace(TopoDS::Wire(wireList.First()), TopoDS::Wire(wireList.Last()));
+        }
+        else {
+            LOG(ERROR) << "no geometry for ribs definition found!";
+            throw CTiglError("no geometry for ribs definition found!");
+        }
+
+        if (ribFace.IsNull()) {
+            LOG(ERROR) << "unable to generate rib face for rib definition: " << uid;
+            std::stringstream ss;
+            ss << "Error: unable to generate rib face for rib definition: " << uid;
+            throw CTiglError(ss.str());
+        }
+        return ribFace;
+    }
+
+    // Builds the rib faces of a ribs definition concurrently
+    class RibFaceTask
+    {
+    public:
+        RibFaceTask(const std::vector<CCPACSWingRibsDefinition::CutGeometry>& cutGeometries,
+                    const LoftFaceSelector& loftFaces, const std::string& uid,
+                    std::vector<TopoDS_Face>& ribFaces)
+            : cutGeometries(cutGeometries), loftFaces(loftFaces), uid(uid), ribFaces(ribFaces)
+        {
+        }
+
+        void operator()(size_t i)
+        {
+            ribFaces[i] = BuildRibFace(cutGeometries[i], loftFaces, uid);
+        }
+
+    private:
+        const std::vector<CCPACSWingRibsDefinition::CutGeometry>& cutGeometries;
+        const LoftFaceSelector& loftFaces;
+        std::string uid;
+        std::vector<TopoDS_Face>& ribFaces;
+    };
+}
+
 CCPACSWingRibsDefinition::CCPACSWingRibsDefinition(CCPACSWingRibsDefinitions* parent, CTiglUIDManager* uidMgr)
     : generated::CPACSWingRibsDefinition(parent, uidMgr) {
     Invalidate();
@@ -501,55 +573,26 @@ void CCPACSWingRibsDefinition::BuildGeometry() const
     BRep_Builder compoundBuilder;
     compoundBuilder.MakeCompound(compound);
 
-    TopoDS_Shape loft = getStructure().GetWingStructureReference().GetLoft()->Shape();
+    // the cut geometries and the loft are prepared serially, the rib faces
+    // are built concurrently afterwards
+    int numberOfRibs = GetNumberOfRibs();
+    if (!auxGeomCache.valid) {
+        BuildAuxiliaryGeometry();
+    }
+    assert(auxGeomCache.valid);
+    assert(static_cast<int>(auxGeomCache.cutGeometries.size()) == numberOfRibs);
 
-    // Step 3: iterate over all ribs for this rib definition
-    for (int i = 0; i < GetNumberOfRibs(); i++) {
-        const CutGeometry& cutGeometry = GetRibCutGeometry(i + 1);
-        // handle case when ribCutFace is identical with target rib face
-        if (cutGeometry.isTargetFace) {
-            compoundBuilder.Add(compound, cutGeometry.shape);
-            ribGeometryCache.ribFaces.push_back(cutGeometry.shape);
-        }
-        else {
-            // intersect rib cut face with loft
-            TopoDS_Shape ribCutEdges = CutShapes(cutGeometry.shape, loft);
-
-            // build wires out of connected edges
-            TopTools_ListOfShape wireList;
-            BuildWiresFromConnectedEdges(ribCutEdges, wireList);
-
-            // build face(s) for spar
-            TopoDS_Face ribFace;
-            if (wireList.Extent() == 1) {
-                try {
-                    TopoDS_Wire ribWire = CloseWire(TopoDS::Wire(wireList.First()));
-                    ribFace = BRepBuilderAPI_MakeFace(ribWire);
-                }
-                catch (const CTiglError&) {
-                    LOG(ERROR) << "unable to generate rib face for rib definition: " << m_uID.value_or("");
-                    throw CTiglError("unable to generate rib face for rib definition \"" + m_uID.value_or("") + "\"! Please check for a correct rib definition!");
-                }
-            }
-            else if (wireList.Extent() == 2) {
-                ribFace = BuildFace(TopoDS::Wire(wireList.First()), TopoDS::Wire(wireList.Last()));
-            }
-            else {
-                LOG(ERROR) << "no geometry for ribs definition found!";
-                throw CTiglError("no geometry for ribs definition found!");
-            }
+    TopoDS_Shape loft = getStructure().GetWingStructureReference().GetLoft()->Shape();
+    LoftFaceSelector loftFaces(loft);
 
-            if (ribFace.IsNull()) {
-                LOG(ERROR) << "unable to generate rib face for rib definition: " << m_uID.value_or("");
-                std::stringstream ss;
-                ss << "Error: unable to generate rib face for rib definition: " << m_uID.value_or("");
-                throw CTiglError(ss.str());
-            }
+    std::vector<TopoDS_Face> ribFaces(numberOfRibs);
+    RibFaceTask task(auxGeomCache.cutGeometries, loftFaces, m_uID.value_or(""), ribFaces);
+    ParallelFor(ribFaces.size(), task);
 
-            // add rib face to compound
-            compoundBuilder.Add(compound, ribFace);
-            ribGeometryCache.ribFaces.push_back(ribFace);
-        }
+    // add the rib faces in the order of the ribs
+    for (int i = 0; i < numberOfRibs; i++) {
+        compoundBuilder.Add(compound, ribFaces[i]);
+        ribGeometryCache.ribFaces.push_back(ribFaces[i]);
     }
 
     ribGeometryCache.shape = compound;
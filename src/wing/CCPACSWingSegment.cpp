@@ -117,10 +117,10 @@ namespace tigl
 
 namespace
 {
-    gp_Pnt transformProfilePoint(const tigl::CTiglTransformation& wingTransform, const tigl::CTiglWingConnection& connection, const gp_Pnt& pointOnProfile)
+    // Returns the combined transformation from profile coordinates into the coordinate
+    // system given by wingTransform
+    CTiglTransformation getProfileTransformation(const tigl::CTiglTransformation& wingTransform, const tigl::CTiglWingConnection& connection)
     {
-        gp_Pnt transformedPoint(pointOnProfile);
-
         // Do section element transformation on points
         CTiglTransformation trafo = connection.GetSectionElementTransformation();
 
@@ -132,9 +132,12 @@ namespace
 
         trafo.PreMultiply(wingTransform);
 
-        transformedPoint = trafo.Transform(transformedPoint);
+        return trafo;
+    }
 
-        return transformedPoint;
+    gp_Pnt transformProfilePoint(const tigl::CTiglTransformation& wingTransform, const tigl::CTiglWingConnection& connection, const gp_Pnt& pointOnProfile)
+    {
+        return getProfileTransformation(wingTransform, connection).Transform(pointOnProfile);
     }
 
     // Set the face traits
@@ -209,8 +212,9 @@ CCPACSWingSegment::~CCPACSWingSegment()
 void CCPACSWingSegment::Invalidate()
 {
     CTiglAbstractSegment<CCPACSWingSegment>::Reset();
-    surfaceCache.valid = false;
-    surfaceCache.chordsurfaceValid = false;
+    surfaceCache.valid.Reset();
+    surfaceCache.chordsurfaceValid.Reset();
+    pointEvaluatorCache.valid.Reset();
 }
 
 // Cleanup routine
@@ -219,8 +223,9 @@ void CCPACSWingSegment::Cleanup()
     surfaceCache.upperShape.Nullify();
     surfaceCache.lowerShape.Nullify();
     surfaceCache.trailingEdgeShape.Nullify();
-    surfaceCache.valid = false;
-    surfaceCache.chordsurfaceValid = false;
+    surfaceCache.valid.Reset();
+    surfaceCache.chordsurfaceValid.Reset();
+    pointEvaluatorCache.valid.Reset();
     CTiglAbstractSegment<CCPACSWingSegment>::Reset();
 }
 
@@ -283,11 +288,13 @@ std::string CCPACSWingSegment::GetDefaultedUID() const {
 void CCPACSWingSegment::SetFromElementUID(const std::string& value) {
     generated::CPACSWingSegment::SetFromElementUID(value);
     innerConnection = CTiglWingConnection(m_fromElementUID, this);
+    pointEvaluatorCache.valid.Reset();
 }
 
 void CCPACSWingSegment::SetToElementUID(const std::string& value) {
     generated::CPACSWingSegment::SetToElementUID(value);
     outerConnection = CTiglWingConnection(m_toElementUID, this);
+    pointEvaluatorCache.valid.Reset();
 }
 
 // Returns the wing this segment belongs to
@@ -756,44 +763,81 @@ gp_Pnt CCPACSWingSegment::GetPoint(double eta, double xsi, bool fromUpper, TiglC
         throw CTiglError("Parameter eta not in the range 0.0 <= eta <= 1.0 in CCPACSWingSegment::GetPoint", TIGL_ERROR);
     }
 
-    CCPACSWingProfile& innerProfile = innerConnection.GetProfile();
-    CCPACSWingProfile& outerProfile = outerConnection.GetProfile();
+    if (referenceCS != WING_COORDINATE_SYSTEM && referenceCS != GLOBAL_COORDINATE_SYSTEM) {
+        throw CTiglError("Invalid coordinate system passed to CCPACSWingSegment::GetPoint");
+    }
+
+    return EvaluatePoint(PointEvaluator(), eta, xsi, fromUpper, referenceCS);
+}
+
+void CCPACSWingSegment::GetPoints(const std::vector<double>& etas, const std::vector<double>& xsis, bool fromUpper,
+                                  std::vector<gp_Pnt>& points, TiglCoordinateSystem referenceCS) const
+{
+    if (etas.size() != xsis.size()) {
+        throw CTiglError("Number of eta and xsi values differ in CCPACSWingSegment::GetPoints", TIGL_ERROR);
+    }
+
+    for (std::vector<double>::const_iterator it = etas.begin(); it != etas.end(); ++it) {
+        if (*it < 0.0 || *it > 1.0) {
+            throw CTiglError("Parameter eta not in the range 0.0 <= eta <= 1.0 in CCPACSWingSegment::GetPoints", TIGL_ERROR);
+        }
+    }
+
+    if (referenceCS != WING_COORDINATE_SYSTEM && referenceCS != GLOBAL_COORDINATE_SYSTEM) {
+        throw CTiglError("Invalid coordinate system passed to CCPACSWingSegment::GetPoints");
+    }
+
+    const PointEvaluatorCache& evaluator = PointEvaluator();
+
+    points.resize(etas.size());
+    for (std::size_t i = 0; i < etas.size(); ++i) {
+        points[i] = EvaluatePoint(evaluator, etas[i], xsis[i], fromUpper, referenceCS);
+    }
+}
+
+const CCPACSWingSegment::PointEvaluatorCache& CCPACSWingSegment::PointEvaluator() const
+{
+    CTiglOnceGuard guard(pointEvaluatorCache.valid);
+    if (!guard.IsDone()) {
+        CTiglTransformation identity;
+        CTiglTransformation wingTransform = GetWing().GetWingTransformation();
+
+        pointEvaluatorCache.innerProfile = &innerConnection.GetProfile();
+        pointEvaluatorCache.outerProfile = &outerConnection.GetProfile();
+        pointEvaluatorCache.innerTrafoLocal  = getProfileTransformation(identity, innerConnection);
+        pointEvaluatorCache.outerTrafoLocal  = getProfileTransformation(identity, outerConnection);
+        pointEvaluatorCache.innerTrafoGlobal = getProfileTransformation(wingTransform, innerConnection);
+        pointEvaluatorCache.outerTrafoGlobal = getProfileTransformation(wingTransform, outerConnection);
+        guard.SetDone();
+    }
+    return pointEvaluatorCache;
+}
 
+gp_Pnt CCPACSWingSegment::EvaluatePoint(const PointEvaluatorCache& evaluator, double eta, double xsi, bool fromUpper, TiglCoordinateSystem referenceCS) const
+{
     // Compute points on wing profiles for the given xsi
     gp_Pnt innerProfilePoint;
     gp_Pnt outerProfilePoint;
-    if (fromUpper == true) {
-        innerProfilePoint = innerProfile.GetUpperPoint(xsi);
-        outerProfilePoint = outerProfile.GetUpperPoint(xsi);
+    if (fromUpper) {
+        innerProfilePoint = evaluator.innerProfile->GetUpperPoint(xsi);
+        outerProfilePoint = evaluator.outerProfile->GetUpperPoint(xsi);
     }
     else {
-        innerProfilePoint = innerProfile.GetLowerPoint(xsi);
-        outerProfilePoint = outerProfile.GetLowerPoint(xsi);
+        innerProfilePoint = evaluator.innerProfile->GetLowerPoint(xsi);
+        outerProfilePoint = evaluator.outerProfile->GetLowerPoint(xsi);
     }
 
-    CTiglTransformation identity;
-    switch (referenceCS) {
-    case WING_COORDINATE_SYSTEM:
-        innerProfilePoint = transformProfilePoint(identity, innerConnection, innerProfilePoint);
-        outerProfilePoint = transformProfilePoint(identity, outerConnection, outerProfilePoint);
-        break;
-    case GLOBAL_COORDINATE_SYSTEM:
-        innerProfilePoint = transformProfilePoint(GetWing().GetWingTransformation(), innerConnection, innerProfilePoint);
-        outerProfilePoint = transformProfilePoint(GetWing().GetWingTransformation(), outerConnection, outerProfilePoint);
-        break;
-    default:
-        throw CTiglError("Invalid coordinate system passed to CCPACSWingSegment::GetPoint");
+    if (referenceCS == WING_COORDINATE_SYSTEM) {
+        innerProfilePoint = evaluator.innerTrafoLocal.Transform(innerProfilePoint);
+        outerProfilePoint = evaluator.outerTrafoLocal.Transform(outerProfilePoint);
+    }
+    else {
+        innerProfilePoint = evaluator.innerTrafoGlobal.Transform(innerProfilePoint);
+        outerProfilePoint = evaluator.outerTrafoGlobal.Transform(outerProfilePoint);
     }
 
     // Get point on wing segment in dependence of eta by linear interpolation
-    Handle(Geom_TrimmedCurve) profileLine = GC_MakeSegment(innerProfilePoint, outerProfilePoint);
-    Standard_Real firstParam = profileLine->FirstParameter();
-    Standard_Real lastParam  = profileLine->LastParameter();
-    Standard_Real param = firstParam + (lastParam - firstParam) * eta;
-    gp_Pnt profilePoint;
-    profileLine->D0(param, profilePoint);
-
-    return profilePoint;
+    return gp_Pnt(innerProfilePoint.XYZ() * (1. - eta) + outerProfilePoint.XYZ() * eta);
 }
 
 gp_Pnt CCPACSWingSegment::GetPointDirection(double eta, double xsi, double dirx, double diry, double dirz, bool fromUpper, double& deviation) const
@@ -807,9 +851,7 @@ gp_Pnt CCPACSWingSegment::GetPointDirection(double eta, double xsi, double dirx,
         throw CTiglError("Direction must not be a null vector in CCPACSWingSegment::GetPointDirection.", TIGL_MATH_ERROR);
     }
 
-    if (!surfaceCache.valid) {
-        MakeSurfaces();
-    }
+    MakeSurfaces();
 
     CTiglPoint tiglPoint;
     ChordFace().translate(eta, xsi, &tiglPoint);
@@ -915,7 +957,8 @@ bool CCPACSWingSegment::GetIsOn(const gp_Pnt& pnt)
 
 void CCPACSWingSegment::MakeChordSurface() const
 {
-    if (surfaceCache.chordsurfaceValid) {
+    CTiglOnceGuard guard(surfaceCache.chordsurfaceValid);
+    if (guard.IsDone()) {
         return;
     }
     
@@ -940,14 +983,12 @@ void CCPACSWingSegment::MakeChordSurface() const
     Handle(Geom_TrimmedCurve) outerEdge = GC_MakeSegment(outer_lep, outer_tep).Value();
     surfaceCache.cordFace = GeomFill::Surface(innerEdge, outerEdge);
 
-    surfaceCache.chordsurfaceValid = true;
+    guard.SetDone();
 }
 
-CTiglPointTranslator& CCPACSWingSegment::ChordFace() const
+const CTiglPointTranslator& CCPACSWingSegment::ChordFace() const
 {
-    if (!surfaceCache.chordsurfaceValid) {
-        MakeChordSurface();
-    }
+    MakeChordSurface();
 
     return surfaceCache.cordSurface;
 }
@@ -957,7 +998,8 @@ CTiglPointTranslator& CCPACSWingSegment::ChordFace() const
 // To do so, we have to determine, what is up
 void CCPACSWingSegment::MakeSurfaces() const
 {
-    if (surfaceCache.valid) {
+    CTiglOnceGuard guard(surfaceCache.valid);
+    if (guard.IsDone()) {
         return;
     }
 
@@ -1098,7 +1140,7 @@ void CCPACSWingSegment::MakeSurfaces() const
     teGenerator.Build();
     surfaceCache.trailingEdgeShape = teGenerator.Shape();
 
-    surfaceCache.valid = true;
+    guard.SetDone();
 }
 
 
@@ -1145,9 +1187,7 @@ double CCPACSWingSegment::GetReferenceArea(TiglSymmetryAxis symPlane) const
 // Returns the lower Surface of this Segment
 Handle(Geom_Surface) CCPACSWingSegment::GetLowerSurface(TiglCoordinateSystem referenceCS) const
 {
-    if (!surfaceCache.valid) {
-        MakeSurfaces();
-    }
+    MakeSurfaces();
 
     switch (referenceCS) {
     case WING_COORDINATE_SYSTEM:
@@ -1164,9 +1204,7 @@ Handle(Geom_Surface) CCPACSWingSegment::GetLowerSurface(TiglCoordinateSystem ref
 // Returns the upper Surface of this Segment
 Handle(Geom_Surface) CCPACSWingSegment::GetUpperSurface(TiglCoordinateSystem referenceCS) const
 {
-    if (!surfaceCache.valid) {
-        MakeSurfaces();
-    }
+    MakeSurfaces();
 
     switch (referenceCS) {
     case WING_COORDINATE_SYSTEM:
@@ -1183,9 +1221,7 @@ Handle(Geom_Surface) CCPACSWingSegment::GetUpperSurface(TiglCoordinateSystem ref
 // Returns the upper wing shape of this Segment
 TopoDS_Shape& CCPACSWingSegment::GetUpperShape(TiglCoordinateSystem referenceCS) const
 {
-    if (!surfaceCache.valid) {
-        MakeSurfaces();
-    }
+    MakeSurfaces();
 
     switch (referenceCS) {
     case WING_COORDINATE_SYSTEM:
@@ -1202,9 +1238,7 @@ TopoDS_Shape& CCPACSWingSegment::GetUpperShape(TiglCoordinateSystem referenceCS)
 // Returns the lower wing shape of this Segment
 TopoDS_Shape& CCPACSWingSegment::GetLowerShape(TiglCoordinateSystem referenceCS) const
 {
-    if (!surfaceCache.valid) {
-        MakeSurfaces();
-    }
+    MakeSurfaces();
 
     switch (referenceCS) {
     case WING_COORDINATE_SYSTEM:
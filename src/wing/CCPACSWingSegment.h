@@ -27,6 +27,7 @@
 #define CCPACSWINGSEGMENT_H
 
 #include <string>
+#include <vector>
 
 #include "generated/CPACSWingSegment.h"
 #include "tigl_config.h"
@@ -39,6 +40,7 @@
 #include "CTiglAbstractSegment.h"
 #include "CCPACSTransformation.h"
 #include "math/CTiglPointTranslator.h"
+#include "CTiglOnceFlag.h"
 
 #include "TopoDS_Shape.hxx"
 #include "TopoDS_Wire.hxx"
@@ -168,6 +170,7 @@ public:
 
     // return if pnt lies on the loft or on the segment chord face
     TIGL_EXPORT bool GetIsOn(const gp_Pnt &pnt) OVERRIDE;
+    using CTiglAbstractSegment<CCPACSWingSegment>::GetIsOn;
 
     // Returns the reference area of the quadrilateral portion of the wing segment
     // by projecting the wing segment into the plane defined by the user
@@ -190,6 +193,12 @@ public:
     // on the upper surface is returned, otherwise from the lower.
     TIGL_EXPORT gp_Pnt GetPoint(double eta, double xsi, bool fromUpper, TiglCoordinateSystem referenceCS = GLOBAL_COORDINATE_SYSTEM) const;
 
+    // Batch version of GetPoint. Computes the upper or lower points for
+    // all pairs (etas[i], xsis[i]). The profiles and the segment transformations
+    // are resolved only once for all points.
+    TIGL_EXPORT void GetPoints(const std::vector<double>& etas, const std::vector<double>& xsis, bool fromUpper,
+                               std::vector<gp_Pnt>& points, TiglCoordinateSystem referenceCS = GLOBAL_COORDINATE_SYSTEM) const;
+
     // Returns an upper or lower point on the segment surface in
     // dependence of parameters eta and xsi, which range from 0.0 to 1.0.
     // For eta = 0.0, xsi = 0.0 point is equal to leading edge on the
@@ -226,8 +235,26 @@ private:
     void MakeChordSurface() const;
 
     // Returns the chord surface (and builds it if required)
-    CTiglPointTranslator& ChordFace() const;
+    const CTiglPointTranslator& ChordFace() const;
+
+
+    // Cached data required to evaluate points on the segment surface
+    struct PointEvaluatorCache
+    {
+        CTiglOnceFlag       valid;
+        CCPACSWingProfile*  innerProfile;
+        CCPACSWingProfile*  outerProfile;
+        CTiglTransformation innerTrafoLocal;   /**< Inner profile to wing coordinate system */
+        CTiglTransformation outerTrafoLocal;   /**< Outer profile to wing coordinate system */
+        CTiglTransformation innerTrafoGlobal;  /**< Inner profile to global coordinate system */
+        CTiglTransformation outerTrafoGlobal;  /**< Outer profile to global coordinate system */
+    };
+
+    // Returns the point evaluator cache (and builds it if required)
+    const PointEvaluatorCache& PointEvaluator() const;
 
+    // Computes a surface point using the precomputed profile transformations
+    gp_Pnt EvaluatePoint(const PointEvaluatorCache& evaluator, double eta, double xsi, bool fromUpper, TiglCoordinateSystem referenceCS) const;
 
     // converts segment eta xsi coordinates to face uv koordinates
     void etaXsiToUV(bool isFromUpper, double eta, double xsi, double& u, double& v) const;
@@ -239,8 +266,8 @@ private:
 
     struct SurfaceCache
     {
-        bool                 valid;
-        bool                 chordsurfaceValid;
+        CTiglOnceFlag        valid;
+        CTiglOnceFlag        chordsurfaceValid;
         double               mySurfaceArea;    /**< Surface area of this segment            */
         TopoDS_Shape         upperShape;       /**< Upper shape of this segment             */
         TopoDS_Shape         lowerShape;       /**< Lower shape of this segment             */
@@ -257,6 +284,7 @@ private:
         Handle(Geom_Surface) cordFace;
     };
     mutable SurfaceCache surfaceCache;
+    mutable PointEvaluatorCache pointEvaluatorCache;
 
     unique_ptr<IGuideCurveBuilder> m_guideCurveBuilder;
 };
@@ -22,6 +22,9 @@
 #include "CTiglError.h"
 #include "CCPACSWingCell.h"
 
+#include <algorithm>
+#include <cmath>
+
 
 namespace tigl 
 {
@@ -29,6 +32,21 @@ namespace tigl
 CCPACSWingShell::CCPACSWingShell(CCPACSWingCSStructure* parent, CTiglUIDManager* uidMgr)
     : generated::CPACSWingShell(parent, uidMgr) {}
 
+namespace
+{
+    // maximum number of grid cells in each direction of the cell index
+    const int MAX_GRID_SIZE = 64;
+
+    int GridIndex(double value, double min, double max, int n)
+    {
+        if (max <= min) {
+            return 0;
+        }
+        int i = static_cast<int>(std::floor((value - min) / (max - min) * n));
+        return std::max(0, std::min(n - 1, i));
+    }
+}
+
 int CCPACSWingShell::GetCellCount() const
 {
     if (m_cells)
@@ -48,6 +66,37 @@ CCPACSWingCell& CCPACSWingShell::GetCell(int index)
     return const_cast<CCPACSWingCell&>(static_cast<const CCPACSWingShell&>(*this).GetCell(index));
 }
 
+void CCPACSWingShell::GetCellIndices(double eta, double xsi, std::vector<int>& cellIndices) const
+{
+    cellIndices.clear();
+
+    Update();
+
+    const GeometryCache& cache = geometryCache;
+    if (cache.cells.empty() ||
+        eta < cache.etaMin || eta > cache.etaMax ||
+        xsi < cache.xsiMin || xsi > cache.xsiMax) {
+        return;
+    }
+
+    WingCellInternal::Point2D p;
+    p.x = eta; p.y = xsi;
+
+    int i = GridIndex(eta, cache.etaMin, cache.etaMax, cache.nEta);
+    int j = GridIndex(xsi, cache.xsiMin, cache.xsiMax, cache.nXsi);
+    const std::vector<int>& candidates = cache.grid[i * cache.nXsi + j];
+    for (std::vector<int>::const_iterator it = candidates.begin(); it != candidates.end(); ++it) {
+        const CellQuad& quad = cache.cells[*it];
+        if (eta < quad.etaMin || eta > quad.etaMax || xsi < quad.xsiMin || xsi > quad.xsiMax) {
+            continue;
+        }
+        if (WingCellInternal::is_in_quadriangle(p, quad.corners[0], quad.corners[1],
+                                                quad.corners[2], quad.corners[3], quad.convex)) {
+            cellIndices.push_back(*it + 1);
+        }
+    }
+}
+
 const CCPACSMaterialDefinition& CCPACSWingShell::GetMaterial() const
 {
     return m_skin.GetMaterial();
@@ -75,25 +124,102 @@ void CCPACSWingShell::ReadCPACS(TixiDocumentHandle tixiHandle, const std::string
 
 void CCPACSWingShell::Invalidate()
 {
-    geometryCache.valid = false;
+    geometryCache.built.Reset();
     if (m_cells)
         m_cells->Invalidate();
 }
 
+void CCPACSWingShell::InvalidateCellIndex()
+{
+    geometryCache.built.Reset();
+}
+
 bool CCPACSWingShell::IsValid() const
 {
-    return geometryCache.valid;
+    return geometryCache.built.IsSet();
 }
 
 void CCPACSWingShell::Update() const
 {
-    if ( geometryCache.valid) {
+    CTiglOnceGuard guard(geometryCache.built);
+    if (guard.IsDone()) {
         return;
     }
 
     // TODO: build stringer geometry
 
-    geometryCache.valid = true;
+    BuildCellIndex();
+
+    guard.SetDone();
+}
+
+void CCPACSWingShell::BuildCellIndex() const
+{
+    GeometryCache& cache = geometryCache;
+    cache.cells.clear();
+    cache.grid.clear();
+    cache.etaMin = cache.xsiMin = 0.;
+    cache.etaMax = cache.xsiMax = 0.;
+    cache.nEta = cache.nXsi = 0;
+
+    int ncells = GetCellCount();
+    if (ncells <= 0) {
+        return;
+    }
+
+    cache.cells.resize(ncells);
+    for (int i = 0; i < ncells; ++i) {
+        const CCPACSWingCell& cell = GetCell(i + 1);
+        CellQuad& quad = cache.cells[i];
+        WingCellInternal::Point2D* c = quad.corners;
+        cell.GetTrailingEdgeInnerPoint(&c[0].x, &c[0].y);
+        cell.GetTrailingEdgeOuterPoint(&c[1].x, &c[1].y);
+        cell.GetLeadingEdgeOuterPoint (&c[2].x, &c[2].y);
+        cell.GetLeadingEdgeInnerPoint (&c[3].x, &c[3].y);
+        quad.convex = WingCellInternal::is_convex(c[0], c[1], c[2], c[3]);
+
+        quad.etaMin = quad.etaMax = c[0].x;
+        quad.xsiMin = quad.xsiMax = c[0].y;
+        for (int k = 1; k < 4; ++k) {
+            quad.etaMin = std::min(quad.etaMin, c[k].x);
+            quad.etaMax = std::max(quad.etaMax, c[k].x);
+            quad.xsiMin = std::min(quad.xsiMin, c[k].y);
+            quad.xsiMax = std::max(quad.xsiMax, c[k].y);
+        }
+
+        if (i == 0) {
+            cache.etaMin = quad.etaMin;
+            cache.etaMax = quad.etaMax;
+            cache.xsiMin = quad.xsiMin;
+            cache.xsiMax = quad.xsiMax;
+        }
+        else {
+            cache.etaMin = std::min(cache.etaMin, quad.etaMin);
+            cache.etaMax = std::max(cache.etaMax, quad.etaMax);
+            cache.xsiMin = std::min(cache.xsiMin, quad.xsiMin);
+            cache.xsiMax = std::max(cache.xsiMax, quad.xsiMax);
+        }
+    }
+
+    // roughly one cell per grid cell
+    int n = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(ncells))));
+    n = std::max(1, std::min(MAX_GRID_SIZE, n));
+    cache.nEta = cache.nXsi = n;
+    cache.grid.resize(n * n);
+
+    // cells are added in ascending order, hence each grid cell is sorted
+    for (int i = 0; i < ncells; ++i) {
+        const CellQuad& quad = cache.cells[i];
+        int iMin = GridIndex(quad.etaMin, cache.etaMin, cache.etaMax, n);
+        int iMax = GridIndex(quad.etaMax, cache.etaMin, cache.etaMax, n);
+        int jMin = GridIndex(quad.xsiMin, cache.xsiMin, cache.xsiMax, n);
+        int jMax = GridIndex(quad.xsiMax, cache.xsiMin, cache.xsiMax, n);
+        for (int ig = iMin; ig <= iMax; ++ig) {
+            for (int jg = jMin; jg <= jMax; ++jg) {
+                cache.grid[ig * n + jg].push_back(i);
+            }
+        }
+    }
 }
 
 TiglLoftSide CCPACSWingShell::GetLoftSide() const
@@ -22,13 +22,16 @@
 #include "generated/CPACSWingShell.h"
 #include "tigl_internal.h"
 #include "CCPACSWingCells.h"
+#include "CCPACSWingCell.h"
 #include "CCPACSMaterialDefinition.h"
+#include "CTiglOnceFlag.h"
 
 #include "tigl.h"
 
 #include <gp_Vec.hxx>
 
 #include <string>
+#include <vector>
 
 
 namespace tigl
@@ -47,6 +50,11 @@ public:
     TIGL_EXPORT const CCPACSWingCell& GetCell(int index) const;
     TIGL_EXPORT CCPACSWingCell& GetCell(int index);
 
+    // Returns the indices (starting at 1) of all cells containing the given
+    // eta/xsi coordinate in ascending order. The lookup uses a grid index over
+    // the cell corners, which is built on first use.
+    TIGL_EXPORT void GetCellIndices(double eta, double xsi, std::vector<int>& cellIndices) const;
+
     TIGL_EXPORT const CCPACSMaterialDefinition& GetMaterial() const;
     TIGL_EXPORT CCPACSMaterialDefinition& GetMaterial();
 
@@ -58,6 +66,9 @@ public:
     TIGL_EXPORT void Invalidate();
     TIGL_EXPORT bool IsValid() const;
 
+    // Invalidates the cell index only, called by the cells on modification
+    TIGL_EXPORT void InvalidateCellIndex();
+
     TIGL_EXPORT void Update() const;
 
     TIGL_EXPORT TiglLoftSide GetLoftSide() const;
@@ -65,9 +76,28 @@ public:
 private:
     //@todo stringers
 
+    // builds the grid index over the cells
+    void BuildCellIndex() const;
+
+    // eta/xsi corners of a cell, in the order used by CCPACSWingCell::IsInside
+    struct CellQuad
+    {
+        WingCellInternal::Point2D corners[4];
+        bool convex;
+        double etaMin, etaMax, xsiMin, xsiMax;
+    };
+
     struct GeometryCache
     {
-        bool valid;
+        CTiglOnceFlag built;
+
+        std::vector<CellQuad> cells;
+
+        // uniform grid over the bounding box of all cells, each grid cell
+        // stores the (0 based) indices of all cells overlapping it
+        double etaMin, etaMax, xsiMin, xsiMax;
+        int nEta, nXsi;
+        std::vector<std::vector<int> > grid;
     };
     mutable GeometryCache geometryCache;
 };
@@ -28,6 +28,7 @@
 #include <GCPnts_AbscissaPoint.hxx>
 #include <gp_Pln.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
@@ -43,6 +44,8 @@
 #include "CTiglWingStructureReference.h"
 #include "tiglcommonfunctions.h"
 #include "tigletaxsifunctions.h"
+#include "tiglparallel.h"
+#include "tiglwingribhelperfunctions.h"
 #include "CNamedShape.h"
 
 
@@ -55,6 +58,48 @@ TopoDS_Shape ApplyWingTransformation(tigl::CCPACSWingSpars& sparsNode, const Top
 namespace tigl
 {
 
+namespace
+{
+    // Intersects the spar cut faces with the loft and builds the spar faces concurrently
+    class SparFaceTask
+    {
+    public:
+        SparFaceTask(const std::vector<TopoDS_Face>& sparCutFaces, const LoftFaceSelector& loftFaces,
+                     std::vector<TopoDS_Shape>& sparFaces)
+            : sparCutFaces(sparCutFaces), loftFaces(loftFaces), sparFaces(sparFaces)
+        {
+        }
+
+        void operator()(size_t i)
+        {
+            const TopoDS_Face& sparCutFace = sparCutFaces[i];
+
+            // intersect spar cut face with loft
+            TopoDS_Shape sparCutEdges = CutShapes(loftFaces.GetFaces(sparCutFace), sparCutFace);
+
+            // build wires out of connected edges
+            TopTools_ListOfShape wireList;
+            BuildWiresFromConnectedEdges(sparCutEdges, wireList);
+
+            // build face(s) for spar
+            if (wireList.Extent() == 1) {
+                TopoDS_Wire sparWire = CloseWire(TopoDS::Wire(wireList.First()));
+                sparFaces[i] = BuildFace(sparWire);
+            } else if (wireList.Extent() == 2) {
+                sparFaces[i] = BuildFace(TopoDS::Wire(wireList.First()), TopoDS::Wire(wireList.Last()));
+            } else {
+                LOG(ERROR) << "no geometry for spar definition found!";
+                throw CTiglError("no geometry for spar definition found!");
+            }
+        }
+
+    private:
+        const std::vector<TopoDS_Face>& sparCutFaces;
+        const LoftFaceSelector& loftFaces;
+        std::vector<TopoDS_Shape>& sparFaces;
+    };
+}
+
 CCPACSWingSparSegment::CCPACSWingSparSegment(CCPACSWingSparSegments* sparSegments, CTiglUIDManager* uidMgr)
     : generated::CPACSSparSegment(sparSegments, uidMgr), sparsNode(*sparSegments->GetParent())
 {
@@ -359,39 +404,26 @@ void CCPACSWingSparSegment::BuildGeometry() const
     // build compound for spar geometry
     BRepBuilderAPI_Sewing sewing;
 
-    // get bounding box of loft
+    // prepare the loft for the concurrent intersections
     TopoDS_Shape loft = wingStructureReference.GetLoft()->Shape();
-    Bnd_Box bbox;
-    BRepBndLib::Add(loft, bbox);
-    double bboxSize = sqrt(bbox.SquareExtent());
+    LoftFaceSelector loftFaces(loft);
 
-    // iterate over all spar cut faces
+    // collect all spar cut faces
+    std::vector<TopoDS_Face> sparCutFaces;
     TopoDS_Shape sparCutGeometry = GetSparCutGeometry(WING_COORDINATE_SYSTEM);
     TopExp_Explorer exp;
     for (exp.Init(sparCutGeometry, TopAbs_FACE); exp.More(); exp.Next()) {
-        TopoDS_Face sparCutFace = TopoDS::Face(exp.Current());
-            
-        // intersect spar cut face with loft
-        TopoDS_Shape sparCutEdges = CutShapes(loft, sparCutFace);
-
-        // build wires out of connected edges
-        TopTools_ListOfShape wireList;
-        BuildWiresFromConnectedEdges(sparCutEdges, wireList);
-
-        // build face(s) for spar
-        TopoDS_Shape sparFaces;
-        if (wireList.Extent() == 1) {
-            TopoDS_Wire sparWire = CloseWire(TopoDS::Wire(wireList.First()));
-            sparFaces = BuildFace(sparWire);
-        } else if (wireList.Extent() == 2) {
-            sparFaces = BuildFace(TopoDS::Wire(wireList.First()), TopoDS::Wire(wireList.Last()));
-        } else {
-            LOG(ERROR) << "no geometry for spar definition found!";
-            throw CTiglError("no geometry for spar definition found!");
-        }
+        sparCutFaces.push_back(TopoDS::Face(exp.Current()));
+    }
+
+    // intersect the spar cut faces with the loft
+    std::vector<TopoDS_Shape> sparFaces(sparCutFaces.size());
+    SparFaceTask task(sparCutFaces, loftFaces, sparFaces);
+    ParallelFor(sparCutFaces.size(), task);
 
-        // add spar face to compound
-        sewing.Add(sparFaces);
+    // add spar faces to compound
+    for (size_t i = 0; i < sparFaces.size(); ++i) {
+        sewing.Add(sparFaces[i]);
     }
 
     // return spar geometry
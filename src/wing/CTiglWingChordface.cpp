@@ -32,11 +32,18 @@
 
 #include <BRepBuilderAPI_MakeFace.hxx>
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
-namespace tigl
+namespace
 {
+    // parameter tolerance for accepting a point within a span
+    const double spanTolerance = 1e-8;
+}
 
+namespace tigl
+{
 
 CTiglWingChordface::CTiglWingChordface(const CTiglWingSegmentList& segments,
                                        CTiglUIDManager *uidMgr)
@@ -62,12 +69,104 @@ void CTiglWingChordface::GetEtaXsi(gp_Pnt point, double &eta, double &xsi) const
 {
     BuildChordSurface();
 
+    // try to find the span, where the point projects inside
+    CTiglPoint p(point.XYZ());
+    double minDist = std::numeric_limits<double>::max();
+    bool found = false;
+    for (size_t span = 0; span < _spanTranslators.size(); ++span) {
+        double t, spanXsi;
+        if (_spanTranslators[span].translate(p, &t, &spanXsi) != TIGL_SUCCESS) {
+            continue;
+        }
+
+        double spanEta = 0.;
+        if (!SpanToEtaXsi(span, t, spanEta, spanXsi)) {
+            continue;
+        }
+
+        CTiglPoint pOnSpan;
+        _spanTranslators[span].translate(t, spanXsi, &pOnSpan);
+        double dist = pOnSpan.distance2(p);
+        if (dist < minDist) {
+            minDist = dist;
+            eta = spanEta;
+            xsi = spanXsi;
+            found = true;
+        }
+    }
+
+    if (!found) {
+        // the point is beyond the borders of the chord face
+        ProjectOnSurface(point, eta, xsi);
+    }
+}
+
+void CTiglWingChordface::GetEtaXsi(size_t n, const double* px, const double* py, const double* pz, double* etas, double* xsis) const
+{
+    if (n == 0) {
+        return;
+    }
+    if (!px || !py || !pz || !etas || !xsis) {
+        throw CTiglError("Null pointer argument in CTiglWingChordface::GetEtaXsi", TIGL_NULL_POINTER);
+    }
+
+    BuildChordSurface();
+
+    std::vector<double> minDist(n, std::numeric_limits<double>::max());
+    std::vector<double> spanT(n), spanXsi(n);
+    for (size_t span = 0; span < _spanTranslators.size(); ++span) {
+        const CTiglPointTranslator& translator = _spanTranslators[span];
+
+        // failed points are handled by the surface projection below
+        translator.translate(n, px, py, pz, &spanT[0], &spanXsi[0]);
+
+        for (size_t i = 0; i < n; ++i) {
+            double eta = 0., xsi = spanXsi[i];
+            if (!SpanToEtaXsi(span, spanT[i], eta, xsi)) {
+                continue;
+            }
+
+            CTiglPoint pOnSpan;
+            translator.translate(spanT[i], xsi, &pOnSpan);
+            double dist = pOnSpan.distance2(CTiglPoint(px[i], py[i], pz[i]));
+            if (dist < minDist[i]) {
+                minDist[i] = dist;
+                etas[i] = eta;
+                xsis[i] = xsi;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if (minDist[i] == std::numeric_limits<double>::max()) {
+            ProjectOnSurface(gp_Pnt(px[i], py[i], pz[i]), etas[i], xsis[i]);
+        }
+    }
+}
+
+void CTiglWingChordface::ProjectOnSurface(const gp_Pnt& point, double& eta, double& xsi) const
+{
     GeomAPI_ProjectPointOnSurf projector(point, _chordSurface, 0., 1., 0., 1.);
     projector.Perform(point);
 
     projector.LowerDistanceParameters(xsi, eta);
 }
 
+bool CTiglWingChordface::SpanToEtaXsi(size_t span, double t, double& eta, double& xsi) const
+{
+    if (t < -spanTolerance || t > 1. + spanTolerance || xsi < -spanTolerance || xsi > 1. + spanTolerance) {
+        return false;
+    }
+
+    t   = std::max(0., std::min(1., t));
+    xsi = std::max(0., std::min(1., xsi));
+
+    double etaInner = _elementEtas[span];
+    double etaOuter = _elementEtas[span + 1];
+    eta = etaInner + t * (etaOuter - etaInner);
+    return true;
+}
+
 
 void CTiglWingChordface::SetUID(const std::string &uid)
 {
@@ -82,6 +181,7 @@ void CTiglWingChordface::SetUID(const std::string &uid)
 
 void CTiglWingChordface::Reset()
 {
+    _chordSurfaceBuilt.Reset();
     _chordSurface.Nullify();
     CTiglAbstractGeometricComponent::Reset();
 }
@@ -117,7 +217,8 @@ void CTiglWingChordface::unregisterShape()
 
 void CTiglWingChordface::BuildChordSurface() const
 {
-    if (_chordSurface.IsNull()) {
+    CTiglOnceGuard guard(_chordSurfaceBuilt);
+    if (!guard.IsDone()) {
 
         std::vector<CCPACSWingSegment*> segmentsList = getSortedSegments(_segments);
 
@@ -186,6 +287,17 @@ void CTiglWingChordface::BuildChordSurface() const
         for (int iElement = 1; iElement <= _chordSurface->NbVKnots(); ++iElement) {
             _elementEtas.push_back(_chordSurface->VKnot(iElement));
         }
+
+        // bilinear patches between the elements for the point inversion
+        _spanTranslators.clear();
+        for (vPole = 1; vPole < poles.UpperCol(); ++vPole) {
+            _spanTranslators.push_back(CTiglPointTranslator(CTiglPoint(poles(1, vPole).XYZ()),
+                                                            CTiglPoint(poles(1, vPole + 1).XYZ()),
+                                                            CTiglPoint(poles(2, vPole).XYZ()),
+                                                            CTiglPoint(poles(2, vPole + 1).XYZ())));
+        }
+
+        guard.SetDone();
     }
 }
 
@@ -24,6 +24,8 @@
 #include "CTiglAbstractGeometricComponent.h"
 #include "PNamedShape.h"
 #include "CTiglWingSegmentList.h"
+#include "CTiglOnceFlag.h"
+#include "CTiglPointTranslator.h"
 
 #include <Geom_BSplineSurface.hxx>
 
@@ -44,6 +46,11 @@ public:
 
     TIGL_EXPORT void GetEtaXsi(gp_Pnt point, double& eta, double& xsi) const;
 
+    /**
+     * @brief Batch version of GetEtaXsi for n points given as separate coordinate arrays
+     */
+    TIGL_EXPORT void GetEtaXsi(size_t n, const double* px, const double* py, const double* pz, double* etas, double* xsis) const;
+
     TIGL_EXPORT void SetUID(const std::string& uid);
 
     TIGL_EXPORT virtual void Reset();
@@ -72,13 +79,24 @@ private:
 
     void unregisterShape();
 
+    // Projects the point onto the surface using the generic surface projection
+    void ProjectOnSurface(const gp_Pnt& point, double& eta, double& xsi) const;
+
+    // Maps the span local parameter to eta. Returns false, if the parameters lie outside the span
+    bool SpanToEtaXsi(size_t span, double t, double& eta, double& xsi) const;
+
     CTiglWingSegmentList _segments;
     std::string _uid;
 
     CTiglUIDManager* _uidManager;
 
+    mutable CTiglOnceFlag _chordSurfaceBuilt;
     mutable Handle(Geom_BSplineSurface) _chordSurface;
     mutable std::vector<double> _elementEtas;
+
+    // The chord surface is bilinear between two elements. Each span can
+    // therefore be inverted in closed form by a point translator.
+    mutable std::vector<CTiglPointTranslator> _spanTranslators;
 };
 
 }
@@ -43,8 +43,7 @@ CTiglWingConnection::CTiglWingConnection(const std::string& elementUID, CCPACSWi
 // Returns the section UID of this connection
 const std::string& CTiglWingConnection::GetSectionUID() const
 {
-    resolve();
-    return *m_resolved.sectionUidPtr;
+    return *resolve().sectionUidPtr;
 }
 
 // Returns the section element UID of this connection
@@ -56,23 +55,20 @@ const std::string& CTiglWingConnection::GetSectionElementUID() const
 // Returns the section index of this connection
 int CTiglWingConnection::GetSectionIndex() const
 {
-    resolve();
-    return m_resolved.sectionIndex;
+    return resolve().sectionIndex;
 }
 
 
 // Returns the section element index of this connection
 int CTiglWingConnection::GetSectionElementIndex() const
 {
-    resolve();
-    return m_resolved.elementIndex;
+    return resolve().elementIndex;
 }
 
 // Returns the wing profile referenced by this connection
 CCPACSWingProfile& CTiglWingConnection::GetProfile() const
 {
-    resolve();
-    return segment->GetWing().GetConfiguration().GetWingProfile(*m_resolved.profileUIDPtr);
+    return segment->GetWing().GetConfiguration().GetWingProfile(*resolve().profileUIDPtr);
 }
 
 // Returns the positioning transformation (segment transformation) for the referenced section
@@ -117,7 +113,8 @@ CTiglTransformation CTiglWingConnection::GetSectionElementTransformation() const
 }
 
 
-void CTiglWingConnection::resolve() const
+// The indices are not stored in the connection, which keeps the const getters reentrant
+CTiglWingConnection::ResolvedIndices CTiglWingConnection::resolve() const
 {
     CCPACSWing& wing = segment->GetWing();
     for (int i = 1; i <= wing.GetSectionCount(); i++) {
@@ -125,11 +122,12 @@ void CTiglWingConnection::resolve() const
         for (int j = 1; j <= section.GetSectionElementCount(); j++) {
             const CCPACSWingSectionElement& element = section.GetSectionElement(j);
             if (element.GetUID() == elementUID) {
-                m_resolved.sectionUidPtr = &section.GetUID();
-                m_resolved.sectionIndex = i;
-                m_resolved.elementIndex = j;
-                m_resolved.profileUIDPtr = &element.GetAirfoilUID();
-                return;
+                ResolvedIndices resolved;
+                resolved.sectionUidPtr = &section.GetUID();
+                resolved.sectionIndex = i;
+                resolved.elementIndex = j;
+                resolved.profileUIDPtr = &element.GetAirfoilUID();
+                return resolved;
             }
         }
     }
@@ -77,10 +77,9 @@ private:
         const std::string* profileUIDPtr;
     };
 
-    void resolve() const;
+    ResolvedIndices resolve() const;
 
 private:
-    mutable ResolvedIndices m_resolved;
     std::string           elementUID;    /**< UID of the connection-section/-elements */
     CCPACSWingSegment*    segment;       /**< Parent segment */
 
@@ -18,13 +18,16 @@
 
 #include <Bnd_Box.hxx>
 #include <BRep_Builder.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepBuilderAPI_MakeWire.hxx>
 #include <BRepBndLib.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
 
@@ -35,11 +38,55 @@
 #include "CTiglWingStructureReference.h"
 #include "tiglcommonfunctions.h"
 #include "tigletaxsifunctions.h"
+#include "tiglparallel.h"
 
 
 namespace tigl
 {
 
+namespace
+{
+    // enlargement of the bounding boxes of the loft faces and cut shapes
+    const double FACE_SELECTION_PRECISION = 1e-2;
+}
+
+LoftFaceSelector::LoftFaceSelector(const TopoDS_Shape& loft)
+    : copyFaces(GetNumberOfThreads() > 1)
+{
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(loft, TopAbs_FACE, faceMap);
+    faces.reserve(faceMap.Extent());
+    boxes.reserve(faceMap.Extent());
+    for (int i = 1; i <= faceMap.Extent(); ++i) {
+        Bnd_Box box;
+        BRepBndLib::Add(faceMap(i), box);
+        box.Enlarge(FACE_SELECTION_PRECISION);
+        faces.push_back(TopoDS::Face(faceMap(i)));
+        boxes.push_back(box);
+    }
+}
+
+TopoDS_Shape LoftFaceSelector::GetFaces(const TopoDS_Shape& cutShape) const
+{
+    Bnd_Box cutBox;
+    BRepBndLib::Add(cutShape, cutBox, Standard_False);
+    cutBox.Enlarge(FACE_SELECTION_PRECISION);
+
+    BRep_Builder builder;
+    TopoDS_Compound compound;
+    builder.MakeCompound(compound);
+    for (size_t i = 0; i < faces.size(); ++i) {
+        if (!boxes[i].IsOut(cutBox)) {
+            builder.Add(compound, faces[i]);
+        }
+    }
+
+    if (copyFaces) {
+        return BRepBuilderAPI_Copy(compound).Shape();
+    }
+    return compound;
+}
+
 TopoDS_Shape ApplyWingTransformation(const CCPACSWingCSStructure& structure, const TopoDS_Shape& shape)
 {
     return structure.GetWingStructureReference().GetWing().GetWingTransformation().Transform(shape);
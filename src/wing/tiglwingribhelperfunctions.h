@@ -18,7 +18,9 @@
 #define TIGLWINGRIBHELPERFUNCTIONS_H
 
 #include <string>
+#include <vector>
 
+#include <Bnd_Box.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
 #include <TopoDS_Face.hxx>
@@ -33,6 +35,28 @@ namespace tigl
 class CCPACSWingCSStructure;
 class CCPACSWingSparPosition;
 
+// Stores the bounding boxes of all faces of a loft. This allows to restrict
+// the intersection of rib and spar cut faces with the loft to the faces near
+// the cut face, and to run these intersections concurrently.
+class LoftFaceSelector
+{
+public:
+    explicit LoftFaceSelector(const TopoDS_Shape& loft);
+
+    // Returns a compound of all loft faces, whose bounding box intersects with
+    // the bounding box of the passed shape.
+    TopoDS_Shape GetFaces(const TopoDS_Shape& cutShape) const;
+
+private:
+    std::vector<TopoDS_Face> faces;
+    std::vector<Bnd_Box> boxes;
+    // Neighbouring rib and spar tasks section the same loft faces. CutShapes
+    // stores new pcurves and may enlarge tolerances on the edges and vertices
+    // of its arguments, so concurrent tasks need their own copy of the faces.
+    // Only set when running with more than one thread.
+    bool copyFaces;
+};
+
 // Applies the wing transformation to the passed Shape and returns the
 // the transformed shape
 // TODO: const correctness of CCPACSWingCSStructure
@@ -21,9 +21,16 @@
 #include "tigl.h"
 #include "CTiglPoint.h"
 #include "CTiglPointTranslator.h"
+#include "CTiglUIDManager.h"
+#include "CCPACSWingProfiles.h"
+#include "CCPACSWingProfile.h"
+#include "generated/TixiHelper.h"
 
 #include <string.h>
+#include <cmath>
 #include <ctime>
+#include <sstream>
+#include <vector>
 
 
 /******************************************************************************/
@@ -92,6 +99,27 @@ TEST_F(TestPerformance, wingGetPoint)
     }
 }
 
+TEST_F(TestPerformance, wingGetPoints)
+{
+    const int nruns = 500;
+
+    std::vector<double> etas(nruns), xsis(nruns);
+    std::vector<double> px(nruns), py(nruns), pz(nruns);
+    for (int irun = 0; irun < nruns; ++irun) {
+        etas[irun] = static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
+        xsis[irun] = static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
+    }
+
+    clock_t start = clock();
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoints(tiglHandle, 1, 1, nruns, &etas[0], &xsis[0], &px[0], &py[0], &pz[0]));
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingGetLowerPoints(tiglHandle, 1, 1, nruns, &etas[0], &xsis[0], &px[0], &py[0], &pz[0]));
+
+    clock_t stop = clock();
+    double time_elapsed = (double)(stop - start)/(double)CLOCKS_PER_SEC/(2.*nruns) * 1000000.;
+    std::cout << "Time wingGetPoints [us]: " << time_elapsed << std::endl;
+}
+
 TEST_F(TestPerformance, fuselageGetPoint)
 {
     int nruns = 100;
@@ -161,3 +189,91 @@ TEST_F(TestPerformance, pointTranslator)
 
     ASSERT_TRUE(true);
 }
+
+TEST_F(TestPerformance, pointTranslatorBatch)
+{
+    const size_t npoints = 10000;
+    double abs_error = 1e-6;
+
+    tigl::CTiglPoint x1(0,4,0);
+    tigl::CTiglPoint x2(8,4,0);
+    tigl::CTiglPoint x3(0,0,0);
+    tigl::CTiglPoint x4(4,0,0);
+
+    tigl::CTiglPointTranslator trans(x1, x2, x3, x4 );
+
+    std::vector<double> px(npoints, 3.), py(npoints, 2.), pz(npoints, 1.);
+    std::vector<double> etas(npoints), xsis(npoints);
+
+    clock_t start = clock();
+    ASSERT_EQ(TIGL_SUCCESS, trans.translate(npoints, &px[0], &py[0], &pz[0], &etas[0], &xsis[0]));
+    clock_t stop = clock();
+
+    ASSERT_NEAR(0.5, etas.back(), abs_error);
+    ASSERT_NEAR(0.5, xsis.back(), abs_error);
+
+    double time_elapsed = (double)(stop - start)/(double)CLOCKS_PER_SEC/(double)npoints * 1000000.;
+    std::cout << "Time PointTranslator batch [us]: " << time_elapsed << std::endl;
+}
+
+TEST_F(TestPerformance, profileLibraryOpenSave)
+{
+    const int nProfiles = 100;
+    const int nPoints = 5000;
+
+    // profile library with point list airfoils
+    std::stringstream xml;
+    xml.precision(17);
+    xml << "<cpacs><vehicles><profiles><wingAirfoils>";
+    for (int iProfile = 0; iProfile < nProfiles; ++iProfile) {
+        xml << "<wingAirfoil uID=\"Profile" << iProfile << "\"><name>Profile" << iProfile << "</name><pointList>";
+        const char* coordinates[] = {"x", "y", "z"};
+        for (int iCoord = 0; iCoord < 3; ++iCoord) {
+            xml << "<" << coordinates[iCoord] << " mapType=\"vector\">";
+            for (int iPoint = 0; iPoint < nPoints; ++iPoint) {
+                double t = static_cast<double>(iPoint) / static_cast<double>(nPoints - 1);
+                double value = iCoord == 0 ? std::cos(M_PI * t) : (iCoord == 1 ? 0. : 0.1 * std::sin(M_PI * t) / (1. + iProfile));
+                xml << (iPoint > 0 ? ";" : "") << value;
+            }
+            xml << "</" << coordinates[iCoord] << ">";
+        }
+        xml << "</pointList></wingAirfoil>";
+    }
+    xml << "</wingAirfoils></profiles></vehicles></cpacs>";
+
+    const std::string xpath = "/cpacs/vehicles/profiles/wingAirfoils";
+    TixiDocumentHandle libraryHandle = -1;
+    ASSERT_EQ(SUCCESS, tixiImportFromString(xml.str().c_str(), &libraryHandle));
+
+    tigl::CTiglUIDManager uidManager;
+    tigl::CCPACSWingProfiles profiles(&uidManager);
+
+    clock_t start = clock();
+    {
+        tixi::TixiCursorScope cursorScope(libraryHandle);
+        profiles.ReadCPACS(libraryHandle, xpath);
+    }
+    clock_t stop = clock();
+    ASSERT_EQ(nProfiles, profiles.GetProfileCount());
+    std::cout << "Time open profile library [ms]: " << (double)(stop - start)/(double)CLOCKS_PER_SEC * 1000. << std::endl;
+
+    start = clock();
+    profiles.WriteCPACS(libraryHandle, xpath);
+    stop = clock();
+    std::cout << "Time save profile library [ms]: " << (double)(stop - start)/(double)CLOCKS_PER_SEC * 1000. << std::endl;
+
+    // the saved coordinates are read back exactly
+    tigl::CTiglUIDManager rereadUidManager;
+    tigl::CCPACSWingProfiles reread(&rereadUidManager);
+    reread.ReadCPACS(libraryHandle, xpath);
+    ASSERT_EQ(nProfiles, reread.GetProfileCount());
+    const std::vector<tigl::CTiglPoint>& original = profiles.GetProfile("Profile7").GetPointList_choice1()->AsVector();
+    const std::vector<tigl::CTiglPoint>& saved = reread.GetProfile("Profile7").GetPointList_choice1()->AsVector();
+    ASSERT_EQ(original.size(), saved.size());
+    for (size_t i = 0; i < original.size(); ++i) {
+        ASSERT_EQ(original[i].x, saved[i].x);
+        ASSERT_EQ(original[i].z, saved[i].z);
+    }
+
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(libraryHandle));
+}
@@ -0,0 +1,69 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CTiglBoundingBoxTree.h"
+#include "test.h"
+
+#include <Bnd_Box.hxx>
+#include <gp_Pnt.hxx>
+
+#include <vector>
+
+namespace
+{
+    Bnd_Box makeBox(double x, double y, double z, double size)
+    {
+        Bnd_Box box;
+        box.Update(x, y, z, x + size, y + size, z + size);
+        return box;
+    }
+}
+
+TEST(BoundingBoxTree, emptyTree)
+{
+    tigl::CTiglBoundingBoxTree tree;
+    std::vector<size_t> indices(1, 0);
+    tree.FindBoxes(gp_Pnt(0., 0., 0.), indices);
+    EXPECT_EQ(0, tree.GetBoxCount());
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST(BoundingBoxTree, findBoxes)
+{
+    // a row of 100 unit boxes overlapping by half of their size and one void box
+    std::vector<Bnd_Box> boxes;
+    for (int i = 0; i < 100; ++i) {
+        boxes.push_back(makeBox(0.5 * i, 0., 0., 1.));
+    }
+    boxes.push_back(Bnd_Box());
+
+    tigl::CTiglBoundingBoxTree tree(boxes);
+    ASSERT_EQ(101, tree.GetBoxCount());
+
+    std::vector<size_t> indices;
+    tree.FindBoxes(gp_Pnt(10.25, 0.5, 0.5), indices);
+    ASSERT_EQ(2, indices.size());
+    EXPECT_EQ(19, indices[0]);
+    EXPECT_EQ(20, indices[1]);
+
+    tree.FindBoxes(gp_Pnt(10.25, 2., 0.5), indices);
+    EXPECT_TRUE(indices.empty());
+
+    tree.FindBoxes(makeBox(4.2, 0.2, 0.2, 0.1), indices);
+    ASSERT_EQ(2, indices.size());
+    EXPECT_EQ(7, indices[0]);
+    EXPECT_EQ(8, indices[1]);
+}
@@ -0,0 +1,165 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Tests for the dependency tracking and the incremental invalidation of a configuration
+*/
+
+#include "test.h" // Brings in the GTest framework
+#include "tigl.h"
+
+#include "CTiglDependencyGraph.h"
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSConfiguration.h"
+#include "CCPACSWing.h"
+#include "CCPACSWingSegment.h"
+#include "CCPACSWingComponentSegment.h"
+#include "CCPACSFuselage.h"
+
+TEST(TiglDependencyGraph, transitiveDependencies)
+{
+    tigl::CTiglDependencyGraph graph;
+    ASSERT_TRUE(graph.IsEmpty());
+
+    graph.AddDependency("profile", "element1");
+    graph.AddDependency("profile", "element2");
+    graph.AddDependency("element1", "segment1");
+    graph.AddDependency("element2", "segment1");
+    graph.AddDependency("element2", "segment2");
+    graph.AddDependency("segment1", "wing");
+    graph.AddDependency("segment2", "wing");
+    // cycles must not lead to endless loops
+    graph.AddDependency("wing", "element1");
+
+    EXPECT_FALSE(graph.IsEmpty());
+    EXPECT_TRUE(graph.HasNode("segment2"));
+    EXPECT_FALSE(graph.HasNode("fuselage"));
+
+    std::set<std::string> dependents;
+    graph.GetDependents("segment2", dependents);
+    ASSERT_EQ(3, dependents.size());
+    EXPECT_EQ(1, dependents.count("wing"));
+    EXPECT_EQ(1, dependents.count("element1"));
+    EXPECT_EQ(1, dependents.count("segment1"));
+
+    graph.GetDependents("profile", dependents);
+    EXPECT_EQ(5, dependents.size());
+    EXPECT_EQ(0, dependents.count("profile"));
+
+    graph.GetDependents("unknown", dependents);
+    EXPECT_EQ(0, dependents.size());
+
+    graph.Clear();
+    EXPECT_TRUE(graph.IsEmpty());
+}
+
+class TiglIncrementalInvalidation : public ::testing::Test
+{
+protected:
+    void SetUp() OVERRIDE
+    {
+        const char* filename = "TestData/simpletest.cpacs.xml";
+
+        tiglHandle = -1;
+        tixiHandle = -1;
+
+        ASSERT_EQ(SUCCESS, tixiOpenDocument(filename, &tixiHandle));
+        ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "Cpacs2Test", &tiglHandle));
+    }
+
+    void TearDown() OVERRIDE
+    {
+        ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+        ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+        tiglHandle = -1;
+        tixiHandle = -1;
+    }
+
+    tigl::CCPACSConfiguration& GetConfiguration()
+    {
+        return tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    }
+
+    TixiDocumentHandle           tixiHandle;
+    TiglCPACSConfigurationHandle tiglHandle;
+};
+
+TEST_F(TiglIncrementalInvalidation, dependencyGraph)
+{
+    tigl::CTiglDependencyGraph graph;
+    GetConfiguration().BuildDependencyGraph(graph);
+
+    std::set<std::string> dependents;
+    graph.GetDependents("Cpacs2Test_Wing_Sec3_El1", dependents);
+    EXPECT_EQ(1, dependents.count("Cpacs2Test_Wing_Seg_2_3"));
+    EXPECT_EQ(1, dependents.count("WING_CS1"));
+    EXPECT_EQ(1, dependents.count("Wing"));
+    EXPECT_EQ(0, dependents.count("Cpacs2Test_Wing_Seg_1_2"));
+    EXPECT_EQ(0, dependents.count("SimpleFuselage"));
+
+    // the profile is used by all wing sections
+    graph.GetDependents("NACA0012", dependents);
+    EXPECT_EQ(1, dependents.count("Cpacs2Test_Wing_Seg_1_2"));
+    EXPECT_EQ(1, dependents.count("Cpacs2Test_Wing_Seg_2_3"));
+
+    // the last positioning moves the outer section only
+    graph.GetDependents("D150_Fuselage_1Positioning3ID", dependents);
+    EXPECT_EQ(1, dependents.count("D150_Fuselage_1Section3IDElement1"));
+    EXPECT_EQ(1, dependents.count("segmentD150_Fuselage_1Segment3ID"));
+    EXPECT_EQ(0, dependents.count("segmentD150_Fuselage_1Segment2ID"));
+}
+
+TEST_F(TiglIncrementalInvalidation, sectionElement)
+{
+    tigl::CCPACSConfiguration& config = GetConfiguration();
+    tigl::CCPACSWing& wing = config.GetWing(1);
+    tigl::CCPACSFuselage& fuselage = config.GetFuselage(1);
+
+    PNamedShape innerLoft = wing.GetSegment(1).GetLoft();
+    PNamedShape outerLoft = wing.GetSegment(2).GetLoft();
+    PNamedShape wingLoft = wing.GetLoft();
+    PNamedShape fuselageLoft = fuselage.GetLoft();
+
+    config.Invalidate("Cpacs2Test_Wing_Sec3_El1");
+
+    // unaffected lofts survive
+    EXPECT_EQ(innerLoft, wing.GetSegment(1).GetLoft());
+    EXPECT_EQ(fuselageLoft, fuselage.GetLoft());
+
+    // the outer segment and the whole wing must be rebuilt
+    EXPECT_NE(outerLoft, wing.GetSegment(2).GetLoft());
+    EXPECT_NE(wingLoft, wing.GetLoft());
+}
+
+TEST_F(TiglIncrementalInvalidation, component)
+{
+    tigl::CCPACSConfiguration& config = GetConfiguration();
+    tigl::CCPACSWing& wing = config.GetWing(1);
+    tigl::CCPACSFuselage& fuselage = config.GetFuselage(1);
+
+    PNamedShape segmentLoft = wing.GetSegment(1).GetLoft();
+    PNamedShape fuselageLoft = fuselage.GetLoft();
+
+    config.Invalidate("Wing");
+
+    EXPECT_NE(segmentLoft, wing.GetSegment(1).GetLoft());
+    EXPECT_EQ(fuselageLoft, fuselage.GetLoft());
+}
+
+TEST_F(TiglIncrementalInvalidation, invalidUID)
+{
+    ASSERT_THROW(GetConfiguration().Invalidate("NotExistingUID"), tigl::CTiglError);
+}
@@ -0,0 +1,251 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "test.h"
+#include "tigl.h"
+
+#include "CTiglDiskCache.h"
+#include "CNamedShape.h"
+#include "CCPACSConfigurationManager.h"
+#include "CCPACSConfiguration.h"
+#include "CCPACSWing.h"
+
+#include <BRepPrimAPI_MakeBox.hxx>
+
+#if defined _WIN32 || defined __WIN32__
+#include <windows.h>
+#include <direct.h>
+#include <process.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // An empty cache directory, that is removed together with its files at the end of the test
+    class TemporaryCacheDirectory
+    {
+    public:
+        explicit TemporaryCacheDirectory(const std::string& name)
+        {
+            std::stringstream stream;
+#if defined _WIN32 || defined __WIN32__
+            stream << "TestData/export/" << name << "." << _getpid();
+#else
+            stream << "TestData/export/" << name << "." << getpid();
+#endif
+            path = stream.str();
+            RemoveFiles();
+#if defined _WIN32 || defined __WIN32__
+            _mkdir(path.c_str());
+#else
+            mkdir(path.c_str(), 0755);
+#endif
+        }
+
+        ~TemporaryCacheDirectory()
+        {
+            RemoveFiles();
+#if defined _WIN32 || defined __WIN32__
+            _rmdir(path.c_str());
+#else
+            rmdir(path.c_str());
+#endif
+        }
+
+        std::vector<std::string> Files() const
+        {
+            std::vector<std::string> files;
+#if defined _WIN32 || defined __WIN32__
+            WIN32_FIND_DATAA data;
+            HANDLE handle = FindFirstFileA((path + "/*").c_str(), &data);
+            if (handle != INVALID_HANDLE_VALUE) {
+                do {
+                    if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+                        files.push_back(path + "/" + data.cFileName);
+                    }
+                } while (FindNextFileA(handle, &data));
+                FindClose(handle);
+            }
+#else
+            DIR* dir = opendir(path.c_str());
+            if (dir) {
+                while (struct dirent* entry = readdir(dir)) {
+                    std::string name = entry->d_name;
+                    if (name != "." && name != "..") {
+                        files.push_back(path + "/" + name);
+                    }
+                }
+                closedir(dir);
+            }
+#endif
+            return files;
+        }
+
+        std::string path;
+
+    private:
+        void RemoveFiles() const
+        {
+            std::vector<std::string> files = Files();
+            for (size_t i = 0; i < files.size(); ++i) {
+                std::remove(files[i].c_str());
+            }
+        }
+    };
+} // namespace
+
+TEST(TiglDiskCache, storeAndLoad)
+{
+    TemporaryCacheDirectory directory("TiglDiskCache.storeAndLoad");
+    tigl::CTiglDiskCache& cache = tigl::CTiglDiskCache::GetInstance();
+    cache.SetDirectory(directory.path);
+    cache.ResetStatistics();
+
+    PNamedShape origin(new CNamedShape(BRepPrimAPI_MakeBox(1., 1., 1.).Shape(), "Origin", "ORIG"));
+    PNamedShape box(new CNamedShape(BRepPrimAPI_MakeBox(1., 2., 3.).Shape(), "Box", "BOX"));
+    box->FaceTraits(2).SetName("Side");
+    box->FaceTraits(3).SetDerivedFromShape(origin, 1);
+
+    ListPNamedShape shapes;
+    shapes.push_back(box);
+    shapes.push_back(PNamedShape());
+
+    ListPNamedShape loaded;
+    EXPECT_FALSE(cache.Load("TiglDiskCache.storeAndLoad.unknown", loaded));
+    EXPECT_EQ(1, cache.GetMissCount());
+
+    cache.Store("TiglDiskCache.storeAndLoad", shapes);
+    EXPECT_EQ(1, cache.GetStoreCount());
+
+    // exactly the entry file is written, no temporary files remain
+    std::vector<std::string> files = directory.Files();
+    ASSERT_EQ(1, files.size());
+    EXPECT_EQ(cache.GetFileName("TiglDiskCache.storeAndLoad"), files[0]);
+
+    ASSERT_TRUE(cache.Load("TiglDiskCache.storeAndLoad", loaded));
+    EXPECT_EQ(1, cache.GetHitCount());
+    cache.SetDirectory("");
+
+    ASSERT_EQ(2, loaded.size());
+    ASSERT_TRUE(loaded[0] != NULL);
+    EXPECT_FALSE(loaded[1]);
+
+    EXPECT_STREQ("Box", loaded[0]->Name());
+    EXPECT_STREQ("BOX", loaded[0]->ShortName());
+    ASSERT_EQ(6, loaded[0]->GetFaceCount());
+    EXPECT_STREQ("Box", loaded[0]->GetFaceTraits(0).Name());
+    EXPECT_STREQ("Side", loaded[0]->GetFaceTraits(2).Name());
+    ASSERT_TRUE(loaded[0]->GetFaceTraits(3).Origin() != NULL);
+    EXPECT_STREQ("Origin", loaded[0]->GetFaceTraits(3).Origin()->Name());
+    EXPECT_EQ(1, loaded[0]->GetFaceTraits(3).Index());
+}
+
+TEST(TiglDiskCache, invalidEntry)
+{
+    TemporaryCacheDirectory directory("TiglDiskCache.invalidEntry");
+    tigl::CTiglDiskCache& cache = tigl::CTiglDiskCache::GetInstance();
+    cache.SetDirectory(directory.path);
+    cache.ResetStatistics();
+
+    {
+        std::ofstream file(cache.GetFileName("TiglDiskCache.invalidEntry").c_str());
+        file << "no cache file";
+    }
+
+    ListPNamedShape loaded;
+    EXPECT_FALSE(cache.Load("TiglDiskCache.invalidEntry", loaded));
+    EXPECT_EQ(0, cache.GetHitCount());
+    EXPECT_EQ(1, cache.GetMissCount());
+    cache.SetDirectory("");
+}
+
+TEST(TiglDiskCache, hashCollision)
+{
+    TemporaryCacheDirectory directory("TiglDiskCache.hashCollision");
+    tigl::CTiglDiskCache& cache = tigl::CTiglDiskCache::GetInstance();
+    cache.SetDirectory(directory.path);
+    cache.ResetStatistics();
+
+    ListPNamedShape shapes;
+    shapes.push_back(PNamedShape(new CNamedShape(BRepPrimAPI_MakeBox(1., 2., 3.).Shape(), "Box", "BOX")));
+    cache.Store("TiglDiskCache.hashCollision.first", shapes);
+
+    // simulate a collision by moving the entry to the file of another key
+    ASSERT_EQ(0, std::rename(cache.GetFileName("TiglDiskCache.hashCollision.first").c_str(),
+                             cache.GetFileName("TiglDiskCache.hashCollision.second").c_str()));
+
+    ListPNamedShape loaded;
+    EXPECT_FALSE(cache.Load("TiglDiskCache.hashCollision.second", loaded));
+    EXPECT_TRUE(loaded.empty());
+    EXPECT_EQ(0, cache.GetHitCount());
+    EXPECT_EQ(1, cache.GetMissCount());
+    cache.SetDirectory("");
+}
+
+TEST(TiglDiskCache, wingLoft)
+{
+    TemporaryCacheDirectory directory("TiglDiskCache.wingLoft");
+    tigl::CTiglDiskCache& cache = tigl::CTiglDiskCache::GetInstance();
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetDiskCacheDirectory(directory.path.c_str()));
+    cache.ResetStatistics();
+
+    TixiDocumentHandle tixiHandle = -1;
+    TiglCPACSConfigurationHandle tiglHandle = -1;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/simpletest.cpacs.xml", &tixiHandle));
+
+    // the first configuration stores the loft, the second one loads it
+    unsigned int faceCounts[2];
+    std::string faceNames[2];
+    unsigned long hits[2], stores[2];
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "Cpacs2Test", &tiglHandle));
+        tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+        PNamedShape loft = config.GetWing(1).GetLoft();
+        ASSERT_TRUE(loft != NULL);
+        faceCounts[i] = loft->GetFaceCount();
+        for (unsigned int iFace = 0; iFace < loft->GetFaceCount(); ++iFace) {
+            faceNames[i] += std::string(loft->GetFaceTraits(iFace).Name()) + " ";
+        }
+        hits[i] = cache.GetHitCount();
+        stores[i] = cache.GetStoreCount();
+        ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+
+        if (i == 0) {
+            EXPECT_FALSE(directory.Files().empty());
+        }
+    }
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetDiskCacheDirectory(NULL));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+
+    // the loft is computed and stored once, and read from the cache the second time
+    EXPECT_EQ(0, hits[0]);
+    EXPECT_GT(stores[0], 0);
+    EXPECT_GT(hits[1], hits[0]);
+    EXPECT_EQ(stores[0], stores[1]);
+
+    EXPECT_EQ(faceCounts[0], faceCounts[1]);
+    EXPECT_EQ(faceNames[0], faceNames[1]);
+}
@@ -28,9 +28,31 @@
 
 #include "CTiglTriangularizer.h"
 #include "CTiglExportCollada.h"
+#include "CTiglExportStl.h"
+#include "CTiglError.h"
 #include "CCPACSConfigurationManager.h"
 #include "CCPACSConfiguration.h"
 #include "CCPACSWing.h"
+#include "CNamedShape.h"
+#include "tiglparallel.h"
+
+#include <BRep_Tool.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TColStd_Array1OfInteger.hxx>
+#include <TopExp.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_ListOfShape.hxx>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
 
 
 /******************************************************************************/
@@ -163,7 +185,14 @@ TEST_F(tiglExport, vtkOptions)
     ASSERT_EQ(TIGL_SUCCESS, tiglExportVTKSetOptions("normals_enabled", "0"));
     ASSERT_EQ(TIGL_SUCCESS, tiglExportVTKSetOptions("normals_enabled", "1"));
 
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportVTKSetOptions("encoding", "base64"));
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportVTKSetOptions("encoding", "appended"));
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportVTKSetOptions("encoding", "ascii"));
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportVTKSetOptions("compression", "none"));
+
     ASSERT_EQ(TIGL_ERROR, tiglExportVTKSetOptions("normals_enabled", "no"));
+    ASSERT_EQ(TIGL_ERROR, tiglExportVTKSetOptions("encoding", "binary"));
+    ASSERT_EQ(TIGL_ERROR, tiglExportVTKSetOptions("compression", "gzip"));
     ASSERT_EQ(TIGL_ERROR, tiglExportVTKSetOptions("invalid options", "0"));
 
     ASSERT_EQ(TIGL_NULL_POINTER, tiglExportVTKSetOptions(NULL, "0"));
@@ -223,6 +252,170 @@ TEST_F(tiglExportSimple, export_wing_collada)
     ASSERT_EQ(true, ret);
 }
 
+TEST_F(tiglExportSimple, export_collada_instances)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    tigl::ExportOptions options(0.01);
+    options.applySymmetries = true;
+    options.includeFarField = false;
+
+    // the mirrored wing segments reference the mesh of the original segments
+    tigl::CTiglExportCollada colladaWriter;
+    colladaWriter.AddConfiguration(config, options);
+    ASSERT_EQ(static_cast<size_t>(config.GetWing(1).GetSegmentCount()), colladaWriter.NInstances());
+    ASSERT_TRUE(colladaWriter.Write("TestData/export/simpletest_instances.dae"));
+
+    std::ifstream file("TestData/export/simpletest_instances.dae");
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    size_t nGeometries = 0;
+    for (size_t pos = content.find("<geometry "); pos != std::string::npos; pos = content.find("<geometry ", pos + 1)) {
+        nGeometries++;
+    }
+    size_t nNodes = 0;
+    for (size_t pos = content.find("<node "); pos != std::string::npos; pos = content.find("<node ", pos + 1)) {
+        nNodes++;
+    }
+    size_t nMatrices = 0;
+    for (size_t pos = content.find("<matrix>"); pos != std::string::npos; pos = content.find("<matrix>", pos + 1)) {
+        nMatrices++;
+    }
+
+    size_t nArrays = 0;
+    for (size_t pos = content.find("<float_array "); pos != std::string::npos; pos = content.find("<float_array ", pos + 1)) {
+        nArrays++;
+    }
+
+    size_t nMirroredReferences = 0;
+    for (size_t pos = content.find("url=\"#"); pos != std::string::npos; pos = content.find("url=\"#", pos + 1)) {
+        std::string url = content.substr(pos + 6, content.find('"', pos + 6) - pos - 6);
+        if (url.size() > 14 && url.compare(url.size() - 14, 14, "-geom-mirrored") == 0) {
+            nMirroredReferences++;
+        }
+    }
+
+    // each mirrored shape has a second mesh with reversed triangles,
+    // which shares the vertices and normals of the original mesh
+    EXPECT_EQ(colladaWriter.NShapes() + colladaWriter.NInstances(), nGeometries);
+    EXPECT_EQ(2 * colladaWriter.NShapes(), nArrays);
+    EXPECT_EQ(colladaWriter.NShapes() + colladaWriter.NInstances(), nNodes);
+    EXPECT_EQ(colladaWriter.NInstances(), nMatrices);
+    EXPECT_EQ(colladaWriter.NInstances(), nMirroredReferences);
+
+    ASSERT_THROW(colladaWriter.AddInstance(colladaWriter.NShapes(), "invalid", tigl::CTiglTransformation()), tigl::CTiglError);
+
+    // write errors are reported by the return value
+    EXPECT_FALSE(colladaWriter.Write("TestData/export/nonexisting_directory/simpletest_instances.dae"));
+}
+
+
+TEST_F(tiglExportSimple, export_stl_binary)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+
+    // reference: ascii file with one solid per shape
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportSTLSetOptions("format", "ascii"));
+    tigl::CTiglExportStl asciiWriter;
+    asciiWriter.AddConfiguration(config, 0.01);
+    ASSERT_TRUE(asciiWriter.Write("TestData/export/simpletest_ascii.stl"));
+    ASSERT_GT(asciiWriter.GetTriangleCount(), 0);
+
+    std::ifstream asciiFile("TestData/export/simpletest_ascii.stl");
+    std::string line;
+    size_t nSolids = 0;
+    size_t nFacets = 0;
+    while (std::getline(asciiFile, line)) {
+        if (line.compare(0, 6, "solid ") == 0) {
+            nSolids++;
+        }
+        else if (line.find("facet normal") != std::string::npos) {
+            nFacets++;
+        }
+    }
+    EXPECT_EQ(asciiWriter.NShapes(), nSolids);
+    EXPECT_EQ(asciiWriter.GetTriangleCount(), nFacets);
+
+    // the binary file must contain the same triangles
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportSTLSetOptions("format", "binary"));
+    tigl::CTiglExportStl binaryWriter;
+    binaryWriter.AddConfiguration(config, 0.01);
+    bool ret = binaryWriter.Write("TestData/export/simpletest_binary.stl");
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportSTLSetOptions("format", "ascii"));
+    ASSERT_TRUE(ret);
+    EXPECT_EQ(asciiWriter.GetTriangleCount(), binaryWriter.GetTriangleCount());
+
+    std::ifstream binaryFile("TestData/export/simpletest_binary.stl", std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(binaryFile)), std::istreambuf_iterator<char>());
+    ASSERT_GE(content.size(), 84);
+    const unsigned char* count = reinterpret_cast<const unsigned char*>(content.data() + 80);
+    size_t nTriangles = count[0] | (count[1] << 8) | (count[2] << 16) | (static_cast<size_t>(count[3]) << 24);
+    EXPECT_EQ(binaryWriter.GetTriangleCount(), nTriangles);
+    EXPECT_EQ(84 + 50 * nTriangles, content.size());
+}
+
+TEST_F(tiglExportSimple, export_stl_shared_edges)
+{
+    // the lateral face and the top face of a cylinder share the circular edge
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(1., 1.).Shape();
+    TopTools_IndexedDataMapOfShapeListOfShape edgeFaces;
+    TopExp::MapShapesAndAncestors(cylinder, TopAbs_EDGE, TopAbs_FACE, edgeFaces);
+    TopoDS_Edge sharedEdge;
+    TopoDS_Face faces[2];
+    for (int i = 1; i <= edgeFaces.Extent(); ++i) {
+        const TopTools_ListOfShape& ancestors = edgeFaces.FindFromIndex(i);
+        if (ancestors.Extent() == 2 && !ancestors.First().IsSame(ancestors.Last())) {
+            sharedEdge = TopoDS::Edge(edgeFaces.FindKey(i));
+            faces[0] = TopoDS::Face(ancestors.First());
+            faces[1] = TopoDS::Face(ancestors.Last());
+            break;
+        }
+    }
+    ASSERT_FALSE(sharedEdge.IsNull());
+
+    // the faces are meshed as separate shapes, possibly in different threads
+    unsigned int nThreads = tigl::GetNumberOfThreads();
+    tigl::SetNumberOfThreads(4);
+    tigl::CTiglExportStl writer;
+    writer.AddShape(PNamedShape(new CNamedShape(faces[0], "Face1")), 0.01);
+    writer.AddShape(PNamedShape(new CNamedShape(faces[1], "Face2")), 0.01);
+    bool ret = writer.Write("TestData/export/shared_edges.stl");
+    tigl::SetNumberOfThreads(nThreads);
+    ASSERT_TRUE(ret);
+
+    // both meshes must use the same nodes on the shared edge
+    std::vector<gp_Pnt> edgeNodes[2];
+    for (int i = 0; i < 2; ++i) {
+        TopLoc_Location location;
+        Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(faces[i], location);
+        ASSERT_FALSE(triangulation.IsNull());
+        Handle(Poly_PolygonOnTriangulation) polygon = BRep_Tool::PolygonOnTriangulation(sharedEdge, triangulation, location);
+        ASSERT_FALSE(polygon.IsNull());
+        const TColStd_Array1OfInteger& indices = polygon->Nodes();
+        for (int j = indices.Lower(); j <= indices.Upper(); ++j) {
+            edgeNodes[i].push_back(triangulation->Nodes()(indices(j)).Transformed(location.Transformation()));
+        }
+    }
+    ASSERT_EQ(edgeNodes[0].size(), edgeNodes[1].size());
+    for (size_t j = 0; j < edgeNodes[0].size(); ++j) {
+        EXPECT_TRUE(edgeNodes[0][j].IsEqual(edgeNodes[1][j], 1e-12));
+    }
+}
+
+TEST_F(tiglExportSimple, stlOptions)
+{
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportSTLSetOptions("format", "binary"));
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportSTLSetOptions("format", "ascii"));
+
+    ASSERT_EQ(TIGL_ERROR, tiglExportSTLSetOptions("format", "vrml"));
+    ASSERT_EQ(TIGL_ERROR, tiglExportSTLSetOptions("invalid options", "ascii"));
+
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglExportSTLSetOptions(NULL, "ascii"));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglExportSTLSetOptions("format", NULL));
+}
+
 
 // check if face names were set correctly in the case with a trailing edge
 TEST_F(tiglExportSimple, check_face_traits)
@@ -125,6 +125,99 @@ TEST_F(TiglIntersectionCalculation, tiglIntersectWithPlane)
     ASSERT_EQ(TIGL_MATH_ERROR,   tiglIntersectWithPlane(tiglHandle, "SimpleFuselage", 0., 0., 0., 0., 0., 0., &id));
 }
 
+TEST_F(TiglIntersectionCalculation, tiglIntersectWithPlanes)
+{
+    const int nPlanes = 3;
+    double px[nPlanes] = {0., 0., 0.};
+    double py[nPlanes] = {0.5, 1.5, 10.};
+    double pz[nPlanes] = {0., 0., 0.};
+    char* ids[nPlanes] = {NULL, NULL, NULL};
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectWithPlanes(tiglHandle, "Wing", px, py, pz, nPlanes, 0., 1., 0., ids));
+
+    int count = 0;
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectGetLineCount(tiglHandle, ids[0], &count));
+    EXPECT_EQ(1, count);
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectGetLineCount(tiglHandle, ids[1], &count));
+    EXPECT_EQ(1, count);
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectGetLineCount(tiglHandle, ids[2], &count));
+    EXPECT_EQ(0, count);
+
+    // the points must lie on the planes
+    double x, y, z;
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectGetPoint(tiglHandle, ids[1], 1, 0.3, &x, &y, &z));
+    EXPECT_NEAR(1.5, y, 1e-6);
+
+    // the single plane intersection must yield the same result
+    char* id = NULL;
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectWithPlane(tiglHandle, "Wing", 0., 0.5, 0., 0., 1., 0., &id));
+    EXPECT_STREQ(ids[0], id);
+
+    ASSERT_EQ(TIGL_NOT_FOUND,    tiglIntersectWithPlanes(-1, "Wing", px, py, pz, nPlanes, 0., 1., 0., ids));
+    ASSERT_EQ(TIGL_UID_ERROR,    tiglIntersectWithPlanes(tiglHandle, "UNKNOWN_UID", px, py, pz, nPlanes, 0., 1., 0., ids));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglIntersectWithPlanes(tiglHandle, NULL, px, py, pz, nPlanes, 0., 1., 0., ids));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglIntersectWithPlanes(tiglHandle, "Wing", NULL, py, pz, nPlanes, 0., 1., 0., ids));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglIntersectWithPlanes(tiglHandle, "Wing", px, py, pz, nPlanes, 0., 1., 0., NULL));
+    ASSERT_EQ(TIGL_MATH_ERROR,   tiglIntersectWithPlanes(tiglHandle, "Wing", px, py, pz, nPlanes, 0., 0., 0., ids));
+    ASSERT_EQ(TIGL_ERROR,        tiglIntersectWithPlanes(tiglHandle, "Wing", px, py, pz, -1, 0., 1., 0., ids));
+}
+
+TEST_F(TiglIntersectionCalculation, tiglIntersectWithPlanes_memoryLimit)
+{
+    const int nPlanes = 3;
+    double px[nPlanes] = {0., 0., 0.};
+    double py[nPlanes] = {0.2, 0.7, 1.2};
+    double pz[nPlanes] = {0., 0., 0.};
+    char* ids[nPlanes] = {NULL, NULL, NULL};
+
+    // a limit of a few bytes, that is exceeded by each single result
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetShapeCacheMemoryLimit(tiglHandle, 1e-5));
+
+    int nShapes = -1, nHits = -1, nMissesBefore = -1, nMisses = -1;
+    double memory = -1.;
+    ASSERT_EQ(TIGL_SUCCESS, tiglGetShapeCacheStatistics(tiglHandle, &nShapes, &nHits, &nMissesBefore, &memory));
+
+    // all ids of the call must remain valid
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectWithPlanes(tiglHandle, "Wing", px, py, pz, nPlanes, 0., 1., 0., ids));
+    ASSERT_EQ(TIGL_SUCCESS, tiglGetShapeCacheStatistics(tiglHandle, &nShapes, &nHits, &nMisses, &memory));
+    EXPECT_EQ(nPlanes, nShapes);
+
+    // looking up the cached results is not counted as a miss
+    EXPECT_EQ(nMissesBefore, nMisses);
+
+    for (int i = 0; i < nPlanes; ++i) {
+        int count = 0;
+        ASSERT_EQ(TIGL_SUCCESS, tiglIntersectGetLineCount(tiglHandle, ids[i], &count));
+        EXPECT_EQ(1, count);
+    }
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetShapeCacheMemoryLimit(tiglHandle, 0.));
+}
+
+TEST_F(TiglIntersectionCalculation, shapeCacheStatistics)
+{
+    int nShapes = -1, nHits = -1, nMisses = -1;
+    double memory = -1.;
+
+    char* id = NULL;
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectWithPlane(tiglHandle, "SimpleFuselage", 0., 0., 0.5, 0., 0., 1., &id));
+    ASSERT_EQ(TIGL_SUCCESS, tiglGetShapeCacheStatistics(tiglHandle, &nShapes, &nHits, &nMisses, &memory));
+    int nHitsBefore = nHits;
+
+    // the second computation must be answered by the cache
+    ASSERT_EQ(TIGL_SUCCESS, tiglIntersectWithPlane(tiglHandle, "SimpleFuselage", 0., 0., 0.5, 0., 0., 1., &id));
+    ASSERT_EQ(TIGL_SUCCESS, tiglGetShapeCacheStatistics(tiglHandle, &nShapes, &nHits, &nMisses, &memory));
+    EXPECT_EQ(nHitsBefore + 1, nHits);
+    EXPECT_GE(nShapes, 1);
+    EXPECT_GT(memory, 0.);
+
+    EXPECT_EQ(TIGL_SUCCESS, tiglSetShapeCacheMemoryLimit(tiglHandle, 100.));
+    EXPECT_EQ(TIGL_MATH_ERROR, tiglSetShapeCacheMemoryLimit(tiglHandle, -1.));
+    EXPECT_EQ(TIGL_NOT_FOUND, tiglSetShapeCacheMemoryLimit(-1, 100.));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglGetShapeCacheStatistics(tiglHandle, NULL, &nHits, &nMisses, &memory));
+    EXPECT_EQ(TIGL_SUCCESS, tiglSetShapeCacheMemoryLimit(tiglHandle, 0.));
+}
+
 TEST_F(TiglIntersectionCalculation, tiglIntersectWithPlaneSegment)
 {
     char* id1 = NULL;
@@ -0,0 +1,196 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "tiglparallel.h"
+#include "CTiglError.h"
+#include "test.h"
+
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    class SquareTask
+    {
+    public:
+        SquareTask(std::vector<double>& result)
+            : m_result(result)
+        {
+        }
+
+        void operator()(size_t i)
+        {
+            m_result[i] = static_cast<double>(i) * static_cast<double>(i);
+        }
+
+    private:
+        std::vector<double>& m_result;
+    };
+
+    // runs an inner parallel loop for each row of a matrix
+    class NestedTask
+    {
+    public:
+        NestedTask(std::vector<std::vector<double> >& result)
+            : m_result(result)
+        {
+        }
+
+        void operator()(size_t i)
+        {
+            SquareTask inner(m_result[i]);
+            tigl::ParallelFor(m_result[i].size(), inner);
+        }
+
+    private:
+        std::vector<std::vector<double> >& m_result;
+    };
+
+    // records the threads executing the tasks
+    class ThreadIdTask
+    {
+    public:
+        void operator()(size_t)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_ids.insert(std::this_thread::get_id());
+        }
+
+        std::set<std::thread::id> m_ids;
+
+    private:
+        std::mutex m_mutex;
+    };
+
+    // runs many small parallel loops
+    class RepeatedLoops
+    {
+    public:
+        RepeatedLoops()
+            : m_ok(true)
+        {
+        }
+
+        void operator()()
+        {
+            for (int run = 0; run < 50; ++run) {
+                std::vector<double> result(64, -1.);
+                SquareTask task(result);
+                tigl::ParallelFor(result.size(), task);
+                for (size_t i = 0; i < result.size(); ++i) {
+                    m_ok = m_ok && result[i] == static_cast<double>(i*i);
+                }
+            }
+        }
+
+        bool m_ok;
+    };
+
+    class ThrowingTask
+    {
+    public:
+        void operator()(size_t i)
+        {
+            if (i == 7) {
+                throw tigl::CTiglError("Task failed", TIGL_MATH_ERROR);
+            }
+        }
+    };
+}
+
+TEST(TiglParallel, allTasksExecuted)
+{
+    std::vector<double> result(1000, -1.);
+    SquareTask task(result);
+    tigl::ParallelFor(result.size(), task);
+
+    for (size_t i = 0; i < result.size(); ++i) {
+        ASSERT_NEAR(static_cast<double>(i*i), result[i], 1e-10);
+    }
+}
+
+TEST(TiglParallel, singleThreaded)
+{
+    unsigned int nThreads = tigl::GetNumberOfThreads();
+    tigl::SetNumberOfThreads(1);
+    EXPECT_EQ(1u, tigl::GetNumberOfThreads());
+
+    std::vector<double> result(10, -1.);
+    SquareTask task(result);
+    tigl::ParallelFor(result.size(), task);
+    EXPECT_NEAR(81., result[9], 1e-10);
+
+    tigl::SetNumberOfThreads(0);
+    EXPECT_EQ(nThreads, tigl::GetNumberOfThreads());
+}
+
+TEST(TiglParallel, exceptionIsRethrown)
+{
+    ThrowingTask task;
+    try {
+        tigl::ParallelFor(100, task);
+        FAIL() << "Expected exception was not thrown";
+    }
+    catch (tigl::CTiglError& err) {
+        EXPECT_EQ(TIGL_MATH_ERROR, err.getCode());
+    }
+}
+
+TEST(TiglParallel, nestedLoops)
+{
+    std::vector<std::vector<double> > result(20, std::vector<double>(50, -1.));
+    NestedTask task(result);
+    tigl::ParallelFor(result.size(), task);
+
+    for (size_t i = 0; i < result.size(); ++i) {
+        for (size_t j = 0; j < result[i].size(); ++j) {
+            ASSERT_NEAR(static_cast<double>(j*j), result[i][j], 1e-10);
+        }
+    }
+}
+
+TEST(TiglParallel, workersAreReused)
+{
+    tigl::SetNumberOfThreads(4);
+    ThreadIdTask task;
+    for (int run = 0; run < 100; ++run) {
+        tigl::ParallelFor(16, task);
+    }
+    tigl::SetNumberOfThreads(0);
+
+    // the calling thread and at most three workers, no new threads per call
+    EXPECT_LE(task.m_ids.size(), 4u);
+}
+
+TEST(TiglParallel, concurrentCallers)
+{
+    tigl::SetNumberOfThreads(4);
+    std::vector<RepeatedLoops> loops(3);
+    std::vector<std::thread> callers;
+    for (size_t i = 0; i < loops.size(); ++i) {
+        callers.push_back(std::thread(std::ref(loops[i])));
+    }
+    for (size_t i = 0; i < callers.size(); ++i) {
+        callers[i].join();
+    }
+    tigl::SetNumberOfThreads(0);
+
+    for (size_t i = 0; i < loops.size(); ++i) {
+        EXPECT_TRUE(loops[i].m_ok);
+    }
+}
@@ -25,6 +25,7 @@
 #include "math/CTiglPointTranslator.h"
 #include <ctime>
 #include <cstdio>
+#include <vector>
 #include "Precision.hxx"
 
 using namespace tigl;
@@ -191,6 +192,28 @@ TEST(TiglPointTranslator, consistency){
     ASSERT_NEAR( xsi_orig, xsi, precision);
 }
 
+// the singularity test of the newton refinement must not depend on the size of the quadriangle
+TEST(TiglPointTranslator, small_scale){
+    const double scale = 1e-4;
+    CTiglPoint x1(0,4*scale,0);
+    CTiglPoint x2(8*scale,4*scale,0);
+    CTiglPoint x3(0,0,-1.*scale);
+    CTiglPoint x4(4*scale,0,0.5*scale);
+
+    CTiglPointTranslator trans(x1, x2, x3, x4 );
+
+    double eta_orig = 0.283;
+    double xsi_orig = 0.8398;
+
+    CTiglPoint p(0,0,0);
+    ASSERT_EQ ( TIGL_SUCCESS,  trans.translate(eta_orig,xsi_orig,&p) );
+
+    double eta, xsi;
+    ASSERT_EQ ( TIGL_SUCCESS,  trans.translate(p, &eta, &xsi) );
+    ASSERT_NEAR( eta_orig, eta, 1e-5);
+    ASSERT_NEAR( xsi_orig, xsi, 1e-5);
+}
+
 TEST(TiglPointTranslator, Bug1){
     CTiglPoint x1(15.080271828981320681,6.3331944636655546077,-0.82588659024004418274);
     CTiglPoint x2(20.620103026537961455,16.956343945599122947,-0.089370094291781887463);
@@ -282,3 +305,59 @@ TEST(TiglPointTranslator, Bug5){
     ASSERT_NEAR(0.75, xsi, 1e-5);
 }
 
+/**
+ * The batch translation must give the same results as the single point translation,
+ * also for points beyond the quadriangle and off the surface.
+ */
+TEST(TiglPointTranslator, batch){
+    CTiglPoint x1(0,4,0);
+    CTiglPoint x2(8,4,0);
+    CTiglPoint x3(0,0,-1.);
+    CTiglPoint x4(4,0,0.5);
+
+    CTiglPointTranslator trans(x1, x2, x3, x4);
+
+    const size_t n = 100;
+    std::vector<double> px(n), py(n), pz(n), etas(n), xsis(n);
+    for (size_t i = 0; i < n; ++i) {
+        double eta_orig = -0.5 + 2.0 * static_cast<double>(i % 10) / 9.;
+        double xsi_orig = -0.5 + 2.0 * static_cast<double>(i / 10) / 9.;
+        CTiglPoint p;
+        ASSERT_EQ(TIGL_SUCCESS, trans.translate(eta_orig, xsi_orig, &p));
+        px[i] = p.x;
+        py[i] = p.y;
+        pz[i] = p.z + 0.1;
+    }
+
+    ASSERT_EQ(TIGL_SUCCESS, trans.translate(n, &px[0], &py[0], &pz[0], &etas[0], &xsis[0]));
+
+    for (size_t i = 0; i < n; ++i) {
+        double eta, xsi;
+        ASSERT_EQ(TIGL_SUCCESS, trans.translate(CTiglPoint(px[i], py[i], pz[i]), &eta, &xsi));
+        EXPECT_NEAR(eta, etas[i], 1e-12);
+        EXPECT_NEAR(xsi, xsis[i], 1e-12);
+    }
+
+    ASSERT_EQ(TIGL_NULL_POINTER, trans.translate(n, NULL, &py[0], &pz[0], &etas[0], &xsis[0]));
+    ASSERT_EQ(TIGL_SUCCESS, trans.translate(0, NULL, NULL, NULL, NULL, NULL));
+}
+
+// A quadriangle collapsed to a line has no plane and is handled by the generic optimizer,
+// which cannot find a unique solution
+TEST(TiglPointTranslator, degenerated){
+    CTiglPoint x1(0,0,0);
+    CTiglPoint x2(1,0,0);
+    CTiglPoint x3(0,0,0);
+    CTiglPoint x4(1,0,0);
+
+    CTiglPointTranslator trans(x1, x2, x3, x4);
+
+    double eta, xsi;
+    ASSERT_EQ(TIGL_MATH_ERROR, trans.translate(CTiglPoint(0.3, 1., 0.), &eta, &xsi));
+
+    double px[2] = {0.3, 0.5};
+    double py[2] = {1.0, 0.0};
+    double pz[2] = {0.0, 0.0};
+    double etas[2], xsis[2];
+    ASSERT_EQ(TIGL_MATH_ERROR, trans.translate(2, px, py, pz, etas, xsis));
+}
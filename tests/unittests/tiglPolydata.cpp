@@ -34,7 +34,12 @@
 #include <BRepMesh.hxx>
 #include <TopoDS_CompSolid.hxx>
 
+#include <algorithm>
+#include <cctype>
 #include <ctime>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 
 using namespace tigl;
 
@@ -367,6 +372,201 @@ TEST(TiglPolyData, cube_export_vtk_withpieces)
     poly.writeVTK("vtk_cube+pieces.vtp");
 }
 
+TEST(TiglPolyData, vertexWelding)
+{
+    CTiglPolyObject co;
+    co.enableNormals(true);
+
+    CTiglPoint n1(1, 0, 0);
+    CTiglPoint n2(0, 1, 0);
+
+    unsigned long i1 = co.addPointNormal(CTiglPoint(0., 0., 0.), n1);
+    // inside tolerance, but in a different grid cell
+    unsigned long i2 = co.addPointNormal(CTiglPoint(-1e-6, 1e-6, 0.), n1);
+    unsigned long i3 = co.addPointNormal(CTiglPoint(4e-6, 0., -2e-6), n1);
+    // outside tolerance
+    unsigned long i4 = co.addPointNormal(CTiglPoint(2e-5, 0., 0.), n1);
+    // same point, different normal
+    unsigned long i5 = co.addPointNormal(CTiglPoint(0., 0., 0.), n2);
+
+    EXPECT_EQ(i1, i2);
+    EXPECT_EQ(i1, i3);
+    EXPECT_NE(i1, i4);
+    EXPECT_NE(i1, i5);
+    EXPECT_NE(i4, i5);
+    ASSERT_EQ(3, co.getNVertices());
+
+    // the first inserted point is kept
+    EXPECT_NEAR(0., co.getVertexPoint(i1).distance2(CTiglPoint(0., 0., 0.)), 1e-20);
+
+    // large number of points on a regular grid with small noise
+    CTiglPolyObject grid;
+    for (int irun = 0; irun < 2; ++irun) {
+        for (int i = 0; i < 50; ++i) {
+            for (int j = 0; j < 50; ++j) {
+                grid.addPointNormal(CTiglPoint(i * 0.1 + irun * 1e-7, j * 0.1, -irun * 1e-7), n1);
+            }
+        }
+    }
+    ASSERT_EQ(2500, grid.getNVertices());
+}
+
+TEST(TiglPolyData, bulkAccess)
+{
+    CTiglPolyObject co;
+    ASSERT_TRUE(co.getVertexCoordinates() == NULL);
+    ASSERT_TRUE(co.getConnectivity() == NULL);
+
+    CTiglPolygon quad;
+    quad.addPoint(CTiglPoint(0, 0, 0));
+    quad.addPoint(CTiglPoint(1, 0, 0));
+    quad.addPoint(CTiglPoint(1, 1, 0));
+    quad.addPoint(CTiglPoint(0, 1, 0));
+    co.addPolygon(quad);
+    co.addTriangleByVertexIndex(0, 2, 3);
+    co.setPolyDataReal(1, "value", 2.);
+    co.setVertexDataReal(2, "temperature", 300.);
+
+    ASSERT_EQ(4, co.getNVertices());
+    ASSERT_EQ(2, co.getNPolygons());
+    ASSERT_EQ(7, co.getConnectivitySize());
+
+    const double* coords = co.getVertexCoordinates();
+    ASSERT_TRUE(coords != NULL);
+    for (unsigned long i = 0; i < co.getNVertices(); ++i) {
+        CTiglPoint p = co.getVertexPoint(i);
+        EXPECT_EQ(p.x, coords[3*i + 0]);
+        EXPECT_EQ(p.y, coords[3*i + 1]);
+        EXPECT_EQ(p.z, coords[3*i + 2]);
+    }
+
+    const unsigned int* offsets = co.getPolygonOffsets();
+    const unsigned int* connectivity = co.getConnectivity();
+    EXPECT_EQ(4, offsets[0]);
+    EXPECT_EQ(7, offsets[1]);
+    EXPECT_EQ(0, connectivity[4]);
+    EXPECT_EQ(2, connectivity[5]);
+    EXPECT_EQ(3, connectivity[6]);
+
+    const double* values = co.getPolyDataRealColumn("value");
+    ASSERT_TRUE(values != NULL);
+    EXPECT_EQ(UNDEFINED_REAL, values[0]);
+    EXPECT_EQ(2., values[1]);
+    EXPECT_TRUE(co.getPolyDataRealColumn("unknown") == NULL);
+
+    const double* temperature = co.getVertexDataRealColumn("temperature");
+    ASSERT_TRUE(temperature != NULL);
+    EXPECT_EQ(300., temperature[2]);
+    EXPECT_EQ(300., co.getVertexDataReal(2, "temperature"));
+    EXPECT_EQ(UNDEFINED_REAL, co.getVertexDataReal(1, "temperature"));
+}
+
+TEST(TiglPolyData, addObject)
+{
+    CTiglPolyObject first;
+    unsigned long i1 = first.addPointNormal(CTiglPoint(0, 0, 0), CTiglPoint(0, 0, 1));
+    unsigned long i2 = first.addPointNormal(CTiglPoint(1, 0, 0), CTiglPoint(0, 0, 1));
+    unsigned long i3 = first.addPointNormal(CTiglPoint(1, 1, 0), CTiglPoint(0, 0, 1));
+    first.addTriangleByVertexIndex(i1, i2, i3);
+
+    CTiglPolyObject second;
+    i1 = second.addPointNormal(CTiglPoint(0, 0, 0), CTiglPoint(0, 0, 1));
+    i2 = second.addPointNormal(CTiglPoint(1, 1, 0), CTiglPoint(0, 0, 1));
+    i3 = second.addPointNormal(CTiglPoint(0, 1, 0), CTiglPoint(0, 0, 1));
+    second.addTriangleByVertexIndex(i1, i2, i3);
+    second.setPolyDataReal(0, "segment_index", 2.);
+    second.setPolyMetadata(0, "\"seg\" 2");
+
+    first.addObject(second);
+
+    // two vertices are shared
+    ASSERT_EQ(4, first.getNVertices());
+    ASSERT_EQ(2, first.getNPolygons());
+    EXPECT_EQ(0, first.getVertexIndexOfPolygon(0, 1));
+    EXPECT_EQ(2, first.getVertexIndexOfPolygon(1, 1));
+    EXPECT_EQ(3, first.getVertexIndexOfPolygon(2, 1));
+
+    EXPECT_EQ(UNDEFINED_REAL, first.getPolyDataReal(0, "segment_index"));
+    EXPECT_EQ(2., first.getPolyDataReal(1, "segment_index"));
+    EXPECT_TRUE(first.hasMetadata());
+    EXPECT_STREQ("", first.getPolyMetadata(0));
+    EXPECT_STREQ("\"seg\" 2", first.getPolyMetadata(1));
+}
+
+TEST(TiglPolyData, exportVTKEncodings)
+{
+    CTiglPolyData poly;
+    CTiglPolyObject& co = poly.currentObject();
+    co.enableNormals(true);
+
+    CTiglPoint n(0, 0, 1);
+    unsigned long i1 = co.addPointNormal(CTiglPoint(0., 0., 0.), n);
+    unsigned long i2 = co.addPointNormal(CTiglPoint(1., 0., 0.), n);
+    unsigned long i3 = co.addPointNormal(CTiglPoint(1., 1., 0.), n);
+    unsigned long i4 = co.addPointNormal(CTiglPoint(0., 1., 0.), n);
+    co.addTriangleByVertexIndex(i1, i2, i3);
+    co.addTriangleByVertexIndex(i1, i3, i4);
+    co.setPolyDataReal(0, "value", 1.);
+    co.setPolyDataReal(1, "value", 2.);
+    co.setMetadataElements("uid");
+    co.setPolyMetadata(0, "\"tri<1>\"");
+    co.setPolyMetadata(1, "\"tri2\"");
+
+    // ascii data is readable xml
+    poly.writeVTK("vtk_square_ascii.vtp");
+    TixiDocumentHandle handle = -1;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument("vtk_square_ascii.vtp", &handle));
+    char* text = NULL;
+    ASSERT_EQ(SUCCESS, tixiGetTextAttribute(handle, "/VTKFile/PolyData/Piece/Points/DataArray", "format", &text));
+    EXPECT_STREQ("ascii", text);
+    int nPolys = 0;
+    ASSERT_EQ(SUCCESS, tixiGetIntegerAttribute(handle, "/VTKFile/PolyData/Piece", "NumberOfPolys", &nPolys));
+    EXPECT_EQ(2, nPolys);
+    double rangeMax = 0.;
+    ASSERT_EQ(SUCCESS, tixiGetDoubleAttribute(handle, "/VTKFile/PolyData/Piece/CellData/DataArray", "RangeMax", &rangeMax));
+    EXPECT_NEAR(2., rangeMax, 1e-10);
+    ASSERT_EQ(SUCCESS, tixiGetTextAttribute(handle, "/VTKFile/PolyData/Piece/Polys/MetaData", "elements", &text));
+    EXPECT_STREQ("uid", text);
+    tixiCloseDocument(handle);
+
+    // base64 data is readable xml as well
+    poly.writeVTK("vtk_square_base64.vtp", TIGL_VTK_BASE64);
+    ASSERT_EQ(SUCCESS, tixiOpenDocument("vtk_square_base64.vtp", &handle));
+    ASSERT_EQ(SUCCESS, tixiGetTextAttribute(handle, "/VTKFile/PolyData/Piece/Polys/DataArray[2]", "format", &text));
+    EXPECT_STREQ("binary", text);
+    // header (8 bytes) plus two offsets (4 bytes each) result in 24 base64 characters
+    ASSERT_EQ(SUCCESS, tixiGetTextElement(handle, "/VTKFile/PolyData/Piece/Polys/DataArray[2]", &text));
+    std::string encoded(text);
+    encoded.erase(std::remove_if(encoded.begin(), encoded.end(), ::isspace), encoded.end());
+    EXPECT_EQ(24, encoded.size());
+    tixiCloseDocument(handle);
+
+    // raw appended data
+    poly.writeVTK("vtk_square_appended.vtp", TIGL_VTK_APPENDED);
+    std::ifstream file("vtk_square_appended.vtp", std::ios::binary);
+    ASSERT_TRUE(file.is_open());
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    size_t dataStart = content.find("<AppendedData encoding=\"raw\">");
+    ASSERT_NE(std::string::npos, dataStart);
+    dataStart = content.find('_', dataStart) + 1;
+    // the points are the first array, 4 points with 3 coordinates
+    unsigned long long nBytes = 0;
+    std::memcpy(&nBytes, content.data() + dataStart, sizeof(nBytes));
+    EXPECT_EQ(4 * 3 * sizeof(double), nBytes);
+    double coordinates[12];
+    std::memcpy(coordinates, content.data() + dataStart + sizeof(nBytes), sizeof(coordinates));
+    EXPECT_NEAR(1., coordinates[3], 1e-15);
+    EXPECT_NEAR(1., coordinates[7], 1e-15);
+
+    if (CTiglVtkWriter::IsCompressionAvailable()) {
+        ASSERT_NO_THROW(poly.writeVTK("vtk_square_base64_zlib.vtp", TIGL_VTK_BASE64, true));
+        ASSERT_NO_THROW(poly.writeVTK("vtk_square_appended_zlib.vtp", TIGL_VTK_APPENDED, true));
+    }
+    else {
+        ASSERT_THROW(poly.writeVTK("vtk_square_appended_zlib.vtp", TIGL_VTK_APPENDED, true), CTiglError);
+    }
+}
+
 TEST_F(TriangularizeShape, exportVTK_FusedWing)
 {
     tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
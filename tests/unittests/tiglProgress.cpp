@@ -0,0 +1,246 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Tests for the progress reporting and cancellation of long running operations
+*/
+
+#include "test.h" // Brings in the GTest framework
+#include "tigl.h"
+
+#include "CTiglProgress.h"
+#include "ITiglProgressHandler.h"
+#include "CTiglError.h"
+#include "tiglparallel.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    class RecordingHandler : public tigl::ITiglProgressHandler
+    {
+    public:
+        RecordingHandler()
+            : cancelAt(2.)
+        {
+        }
+
+        bool Progress(double progress, const char*) OVERRIDE
+        {
+            values.push_back(progress);
+            return progress < cancelAt;
+        }
+
+        std::vector<double> values;
+        double cancelAt;
+    };
+
+    TiglBoolean countingCallback(double, const char*, void* userData)
+    {
+        int* count = static_cast<int*>(userData);
+        (*count)++;
+        return TIGL_TRUE;
+    }
+
+    TiglBoolean cancelingCallback(double, const char*, void*)
+    {
+        return TIGL_FALSE;
+    }
+
+    TiglBoolean cancelOperationCallback(double, const char*, void* userData)
+    {
+        int* count = static_cast<int*>(userData);
+        (*count)++;
+
+        // calling back into tigl must not deadlock
+        {
+            tigl::CTiglProgress nested("nested", 1);
+        }
+        tiglCancelOperation();
+        return TIGL_TRUE;
+    }
+} // namespace
+
+TEST(TiglProgress, nestedOperations)
+{
+    RecordingHandler handler;
+    tigl::CTiglProgress::SetHandler(&handler);
+
+    {
+        tigl::CTiglProgress outer("outer", 2);
+        outer.Step();
+        {
+            tigl::CTiglProgress inner("inner", 4);
+            inner.Step(2);
+            inner.Step(2);
+        }
+        outer.Step();
+    }
+    tigl::CTiglProgress::SetHandler(NULL);
+
+    ASSERT_EQ(5, handler.values.size());
+    EXPECT_NEAR(0.0,  handler.values[0], 1e-12);
+    EXPECT_NEAR(0.5,  handler.values[1], 1e-12);
+    EXPECT_NEAR(0.75, handler.values[2], 1e-12);
+    EXPECT_NEAR(1.0,  handler.values[3], 1e-12);
+    EXPECT_NEAR(1.0,  handler.values[4], 1e-12);
+}
+
+TEST(TiglProgress, cancel)
+{
+    RecordingHandler handler;
+    handler.cancelAt = 0.5;
+    tigl::CTiglProgress::SetHandler(&handler);
+
+    {
+        tigl::CTiglProgress progress("cancel", 4);
+        EXPECT_FALSE(tigl::CTiglProgress::IsCanceled());
+        progress.Step();
+        try {
+            progress.Step();
+            FAIL() << "The operation should have been canceled";
+        }
+        catch (const tigl::CTiglError& err) {
+            EXPECT_EQ(TIGL_CANCELED, err.getCode());
+        }
+        EXPECT_TRUE(tigl::CTiglProgress::IsCanceled());
+    }
+    tigl::CTiglProgress::SetHandler(NULL);
+
+    // a new operation is not affected by the canceled one
+    EXPECT_FALSE(tigl::CTiglProgress::IsCanceled());
+    tigl::CTiglProgress next("next", 1);
+    EXPECT_FALSE(tigl::CTiglProgress::IsCanceled());
+    EXPECT_NO_THROW(next.Step());
+}
+
+namespace
+{
+    struct StartOperation
+    {
+        void operator()()
+        {
+            tigl::CTiglProgress progress("other thread", 1);
+            progress.Step();
+        }
+    };
+
+    struct CheckCanceledTask
+    {
+        CheckCanceledTask()
+            : nCanceled(0)
+        {
+        }
+
+        void operator()(size_t)
+        {
+            if (tigl::CTiglProgress::IsCanceled()) {
+                nCanceled++;
+            }
+        }
+
+        std::atomic<int> nCanceled;
+    };
+} // namespace
+
+TEST(TiglProgress, cancelIsPerOperation)
+{
+    tigl::CTiglProgress progress("canceled", 2);
+    tigl::CTiglProgress::Cancel();
+    EXPECT_TRUE(tigl::CTiglProgress::IsCanceled());
+
+    // an operation, that starts in another thread, does not reset the cancellation
+    std::thread other((StartOperation()));
+    other.join();
+    EXPECT_TRUE(tigl::CTiglProgress::IsCanceled());
+    EXPECT_ANY_THROW(progress.Step());
+
+    // the tasks of a parallel loop belong to the operation of the calling thread
+    tigl::SetNumberOfThreads(4);
+    CheckCanceledTask task;
+    tigl::ParallelFor(100, task);
+    tigl::SetNumberOfThreads(0);
+    EXPECT_EQ(100, task.nCanceled);
+}
+
+TEST(TiglProgress, callbackCancelsOperation)
+{
+    int count = 0;
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetProgressCallback(cancelOperationCallback, &count));
+
+    {
+        tigl::CTiglProgress progress("canceled by callback", 2);
+        EXPECT_TRUE(tigl::CTiglProgress::IsCanceled());
+        try {
+            progress.Step();
+            FAIL() << "The operation should have been canceled";
+        }
+        catch (const tigl::CTiglError& err) {
+            EXPECT_EQ(TIGL_CANCELED, err.getCode());
+        }
+    }
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetProgressCallback(NULL, NULL));
+
+    // the initial report and the step
+    EXPECT_EQ(2, count);
+}
+
+class TiglProgressExport : public ::testing::Test
+{
+protected:
+    void SetUp() OVERRIDE
+    {
+        const char* filename = "TestData/simpletest.cpacs.xml";
+
+        tiglHandle = -1;
+        tixiHandle = -1;
+
+        ASSERT_EQ(SUCCESS, tixiOpenDocument(filename, &tixiHandle));
+        ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "Cpacs2Test", &tiglHandle));
+    }
+
+    void TearDown() OVERRIDE
+    {
+        tiglSetProgressCallback(NULL, NULL);
+        ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+        ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+        tiglHandle = -1;
+        tixiHandle = -1;
+    }
+
+    TixiDocumentHandle           tixiHandle;
+    TiglCPACSConfigurationHandle tiglHandle;
+};
+
+TEST_F(TiglProgressExport, callback)
+{
+    int count = 0;
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetProgressCallback(countingCallback, &count));
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportFusedWingFuselageIGES(tiglHandle, "TestData/export/progress_simpletest.igs"));
+    EXPECT_GT(count, 0);
+}
+
+TEST_F(TiglProgressExport, cancel)
+{
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetProgressCallback(cancelingCallback, NULL));
+    ASSERT_EQ(TIGL_CANCELED, tiglExportFusedWingFuselageIGES(tiglHandle, "TestData/export/progress_simpletest_canceled.igs"));
+
+    // the configuration can be fused again after a canceled run
+    ASSERT_EQ(TIGL_SUCCESS, tiglSetProgressCallback(NULL, NULL));
+    ASSERT_EQ(TIGL_SUCCESS, tiglExportFusedWingFuselageIGES(tiglHandle, "TestData/export/progress_simpletest.igs"));
+}
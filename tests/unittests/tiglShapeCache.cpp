@@ -24,6 +24,8 @@
 #include <TopoDS_Wire.hxx>
 #include <TopoDS_Shape.hxx>
 #include <gp_Trsf.hxx>
+#include <string>
+#include <vector>
 
 TEST(ShapeCache, GetNShapes)
 {
@@ -31,12 +33,12 @@ TEST(ShapeCache, GetNShapes)
     TopoDS_Shape shape;
     
     ASSERT_FALSE(cache.HasShape("1"));
-    cache.GetContainer()["1"] = shape;
+    cache.Insert(shape, "1");
     
     ASSERT_EQ(1, cache.GetNShape());
     ASSERT_TRUE(cache.HasShape("1"));
     
-    cache.GetContainer()["2"] = shape;
+    cache.Insert(shape, "2");
     
     ASSERT_EQ(2, cache.GetNShape());
     ASSERT_TRUE(cache.HasShape("2"));
@@ -127,3 +129,128 @@ TEST(ShapeCache, Get)
     shape = cache.GetShape("3");
     ASSERT_TRUE(shape.IsNull());
 }
+
+TEST(ShapeCache, Statistics)
+{
+    tigl::CTiglShapeCache cache;
+    BRepBuilderAPI_MakeWire wireBuilder(BRepBuilderAPI_MakeEdge(gp_Pnt(1,0,0), gp_Pnt(1,1,0)));
+    cache.Insert(wireBuilder.Wire(), "1");
+
+    TopoDS_Shape shape;
+    ASSERT_TRUE(cache.Find("1", shape));
+    ASSERT_FALSE(shape.IsNull());
+    ASSERT_FALSE(cache.Find("2", shape));
+    ASSERT_TRUE(cache.Find("1", shape));
+
+    EXPECT_EQ(2, cache.GetHitCount());
+    EXPECT_EQ(1, cache.GetMissCount());
+    EXPECT_GT(cache.GetMemoryUsage(), 0);
+
+    cache.ResetStatistics();
+    EXPECT_EQ(0, cache.GetHitCount());
+    EXPECT_EQ(0, cache.GetMissCount());
+
+    cache.Clear();
+    EXPECT_EQ(0, cache.GetMemoryUsage());
+}
+
+TEST(ShapeCache, GetShapeIsNotCounted)
+{
+    tigl::CTiglShapeCache cache;
+    BRepBuilderAPI_MakeWire wireBuilder(BRepBuilderAPI_MakeEdge(gp_Pnt(1,0,0), gp_Pnt(1,1,0)));
+    cache.Insert(wireBuilder.Wire(), "1");
+
+    EXPECT_FALSE(cache.GetShape("1").IsNull());
+    EXPECT_TRUE(cache.GetShape("2").IsNull());
+    EXPECT_EQ(0, cache.GetHitCount());
+    EXPECT_EQ(0, cache.GetMissCount());
+}
+
+TEST(ShapeCache, Key)
+{
+    tigl::CTiglShapeCacheKey key("plane", "D150_Wing1", 42);
+    EXPECT_EQ("plane:D150_Wing1:42", key.ToString());
+
+    // the operation and the component are part of the key, not only the hash
+    EXPECT_NE(key.ToString(), tigl::CTiglShapeCacheKey("planesegment", "D150_Wing1", 42).ToString());
+    EXPECT_NE(key.ToString(), tigl::CTiglShapeCacheKey("plane", "D150_Wing2", 42).ToString());
+}
+
+TEST(ShapeCache, MemoryLimit)
+{
+    tigl::CTiglShapeCache cache;
+    BRepBuilderAPI_MakeWire wireBuilder(BRepBuilderAPI_MakeEdge(gp_Pnt(1,0,0), gp_Pnt(1,1,0)));
+    TopoDS_Shape wire = wireBuilder.Wire();
+
+    cache.Insert(wire, "1");
+    size_t shapeSize = cache.GetMemoryUsage();
+    ASSERT_GT(shapeSize, 0);
+
+    // space for two shapes
+    cache.SetMemoryLimit(2 * shapeSize);
+    cache.Insert(wire, "2");
+    ASSERT_EQ(2, cache.GetNShape());
+
+    // "1" is now the most recently used shape, hence "2" is removed
+    cache.GetShape("1");
+    cache.Insert(wire, "3");
+    ASSERT_EQ(2, cache.GetNShape());
+    EXPECT_TRUE(cache.HasShape("1"));
+    EXPECT_FALSE(cache.HasShape("2"));
+    EXPECT_TRUE(cache.HasShape("3"));
+    EXPECT_EQ(2 * shapeSize, cache.GetMemoryUsage());
+
+    // the last inserted shape is always kept
+    cache.SetMemoryLimit(1);
+    ASSERT_EQ(1, cache.GetNShape());
+    EXPECT_TRUE(cache.HasShape("3"));
+}
+
+TEST(ShapeCache, MemoryLimitKeepsBatch)
+{
+    tigl::CTiglShapeCache cache;
+    BRepBuilderAPI_MakeWire wireBuilder(BRepBuilderAPI_MakeEdge(gp_Pnt(1,0,0), gp_Pnt(1,1,0)));
+    TopoDS_Shape wire = wireBuilder.Wire();
+
+    cache.Insert(wire, "1");
+    size_t shapeSize = cache.GetMemoryUsage();
+    cache.SetMemoryLimit(shapeSize);
+
+    std::vector<TopoDS_Shape> shapes(3, wire);
+    std::vector<std::string> ids;
+    ids.push_back("1");
+    ids.push_back("2");
+    ids.push_back("3");
+    cache.Insert(shapes, ids, std::vector<std::string>(1, "Wing"));
+
+    // the limit is exceeded, but no shape of the batch is removed
+    EXPECT_EQ(3, cache.GetNShape());
+    EXPECT_EQ(3 * shapeSize, cache.GetMemoryUsage());
+
+    // the next insert removes the shapes of the batch
+    cache.Insert(wire, "4");
+    EXPECT_EQ(1, cache.GetNShape());
+    EXPECT_TRUE(cache.HasShape("4"));
+}
+
+TEST(ShapeCache, RemoveComponent)
+{
+    tigl::CTiglShapeCache cache;
+    TopoDS_Shape shape;
+
+    std::vector<std::string> wingAndFuselage;
+    wingAndFuselage.push_back("wing");
+    wingAndFuselage.push_back("fuselage");
+
+    cache.Insert(shape, "1", std::vector<std::string>(1, "wing"));
+    cache.Insert(shape, "2", wingAndFuselage);
+    cache.Insert(shape, "3", std::vector<std::string>(1, "fuselage"));
+
+    ASSERT_EQ(2, cache.GetComponentUIDs("2").size());
+    ASSERT_EQ(0, cache.GetComponentUIDs("4").size());
+
+    cache.RemoveComponent("wing");
+    EXPECT_FALSE(cache.HasShape("1"));
+    EXPECT_FALSE(cache.HasShape("2"));
+    EXPECT_TRUE(cache.HasShape("3"));
+}
@@ -0,0 +1,135 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file
+* @brief Tests for the conversion of string vectors
+*/
+
+#include "test.h"
+
+#include "CCPACSStringVector.h"
+
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+TEST(TiglStringVector, parse)
+{
+    std::vector<double> v = tigl::stringToDoubleVec("1;-2.5; 3e2;.25;+4.;1E-3");
+    ASSERT_EQ(6u, v.size());
+    EXPECT_EQ(1., v[0]);
+    EXPECT_EQ(-2.5, v[1]);
+    EXPECT_EQ(300., v[2]);
+    EXPECT_EQ(0.25, v[3]);
+    EXPECT_EQ(4., v[4]);
+    EXPECT_EQ(0.001, v[5]);
+
+    // numbers, which are not converted by the fast path
+    v = tigl::stringToDoubleVec("0.1234567890123456789012;1e-300;1.7976931348623157e308");
+    ASSERT_EQ(3u, v.size());
+    EXPECT_EQ(0.1234567890123456789012, v[0]);
+    EXPECT_EQ(1e-300, v[1]);
+    EXPECT_EQ(1.7976931348623157e308, v[2]);
+
+    // separators
+    EXPECT_EQ(0u, tigl::stringToDoubleVec("").size());
+    EXPECT_EQ(2u, tigl::stringToDoubleVec("1;2;").size());
+    v = tigl::stringToDoubleVec("1;;2");
+    ASSERT_EQ(3u, v.size());
+    EXPECT_EQ(0., v[1]);
+}
+
+TEST(TiglStringVector, format)
+{
+    std::vector<double> v;
+    v.push_back(0.1);
+    v.push_back(-2.5);
+    v.push_back(1e-5);
+    v.push_back(100000.);
+    v.push_back(1e20);
+    v.push_back(1. / 3.);
+    v.push_back(0.1 + 0.2);
+    v.push_back(-0.);
+    EXPECT_EQ("0.1;-2.5;1e-05;100000;1e+20;0.3333333333333333;0.30000000000000004;-0", tigl::doubleVecToString(v));
+    EXPECT_EQ("", tigl::doubleVecToString(std::vector<double>()));
+}
+
+TEST(TiglStringVector, formatPrecision)
+{
+    char buffer[32];
+    const double values[] = {0., -0., 1.5, 1. / 3., -123456789., 1e-5, 0.000123456, 999999.5, 2.5e-300};
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+        for (int precision = 1; precision <= 17; ++precision) {
+            char expected[32];
+            snprintf(expected, sizeof(expected), "%.*g", precision, values[i]);
+            EXPECT_EQ(strlen(expected), tigl::formatDouble(values[i], precision, buffer));
+            EXPECT_STREQ(expected, buffer);
+        }
+    }
+
+    EXPECT_EQ(19u, tigl::formatDouble(0.1 + 0.2, buffer));
+    EXPECT_STREQ("0.30000000000000004", buffer);
+}
+
+TEST(TiglStringVector, roundTrip)
+{
+    std::vector<double> v;
+    double value = 0.123456789;
+    for (int i = 0; i < 10000; ++i) {
+        v.push_back(value);
+        v.push_back(std::cos(static_cast<double>(i)) * std::pow(10., i % 40 - 20));
+        value = std::fmod(value * 1.37 + 0.011, 1000.);
+    }
+
+    const std::vector<double> result = tigl::stringToDoubleVec(tigl::doubleVecToString(v));
+    ASSERT_EQ(v.size(), result.size());
+    for (size_t i = 0; i < v.size(); ++i) {
+        ASSERT_EQ(v[i], result[i]);
+    }
+}
+
+TEST(TiglStringVector, localeIndependent)
+{
+    const std::string oldLocale = setlocale(LC_NUMERIC, NULL);
+    const char* locales[] = {"de_DE.UTF-8", "de_DE", "German_Germany"};
+    bool hasLocale = false;
+    for (size_t i = 0; i < sizeof(locales) / sizeof(locales[0]) && !hasLocale; ++i) {
+        hasLocale = setlocale(LC_NUMERIC, locales[i]) != NULL;
+    }
+
+    std::vector<double> v;
+    v.push_back(1.5);
+    v.push_back(-0.125);
+    v.push_back(1. / 3.);
+    const std::string text = tigl::doubleVecToString(v);
+    char formatted[32];
+    tigl::formatDouble(-0.125, 6, formatted);
+    const std::vector<double> result = tigl::stringToDoubleVec("1.5;-0.125;0.3333333333333333;0.1234567890123456789012");
+
+    setlocale(LC_NUMERIC, oldLocale.c_str());
+
+    EXPECT_EQ("1.5;-0.125;0.3333333333333333", text);
+    EXPECT_STREQ("-0.125", formatted);
+    ASSERT_EQ(4u, result.size());
+    EXPECT_EQ(1.5, result[0]);
+    EXPECT_EQ(-0.125, result[1]);
+    EXPECT_EQ(1. / 3., result[2]);
+    EXPECT_EQ(0.1234567890123456789012, result[3]);
+}
@@ -0,0 +1,214 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+/**
+* @file
+* @brief Tests for concurrent queries on a shared configuration
+*/
+
+#include "test.h" // Brings in the GTest framework
+#include "tigl.h"
+#include "tiglparallel.h"
+#include "CTiglOnceFlag.h"
+#include "CTiglPointTranslator.h"
+
+#include <vector>
+
+namespace
+{
+    // builds a "cache" using the once guard and counts the number of builds
+    class OnceTask
+    {
+    public:
+        OnceTask(tigl::CTiglOnceFlag& flag)
+            : m_flag(flag)
+            , m_nBuilds(0)
+        {
+        }
+
+        void operator()(size_t)
+        {
+            tigl::CTiglOnceGuard guard(m_flag);
+            if (!guard.IsDone()) {
+                m_nBuilds++;
+                guard.SetDone();
+            }
+        }
+
+        int NumberOfBuilds() const
+        {
+            return m_nBuilds;
+        }
+
+    private:
+        tigl::CTiglOnceFlag& m_flag;
+        int m_nBuilds;
+    };
+
+    class TranslateTask
+    {
+    public:
+        TranslateTask(const tigl::CTiglPointTranslator& translator, std::vector<double>& etas, std::vector<double>& xsis)
+            : m_translator(translator)
+            , m_etas(etas)
+            , m_xsis(xsis)
+        {
+        }
+
+        void operator()(size_t i)
+        {
+            double eta = static_cast<double>(i % 10) / 9.;
+            double xsi = static_cast<double>(i / 10) / 9.;
+            tigl::CTiglPoint p;
+            m_translator.translate(eta, xsi, &p);
+            m_translator.translate(p, &m_etas[i], &m_xsis[i]);
+        }
+
+    private:
+        const tigl::CTiglPointTranslator& m_translator;
+        std::vector<double>& m_etas;
+        std::vector<double>& m_xsis;
+    };
+
+    struct WingQuery
+    {
+        double x, y, z;
+        int segment;
+        double eta, xsi;
+        int onTop;
+        TiglReturnCode pointRet, etaXsiRet;
+    };
+
+    class WingQueryTask
+    {
+    public:
+        WingQueryTask(TiglCPACSConfigurationHandle handle, std::vector<WingQuery>& queries)
+            : m_handle(handle)
+            , m_queries(queries)
+        {
+        }
+
+        void operator()(size_t i)
+        {
+            WingQuery& q = m_queries[i];
+            int segment = static_cast<int>(i % 2) + 1;
+            double eta = 0.1 + 0.8 * static_cast<double>(i % 7) / 6.;
+            double xsi = 0.1 + 0.8 * static_cast<double>(i % 5) / 4.;
+            q.pointRet = tiglWingGetUpperPoint(m_handle, 1, segment, eta, xsi, &q.x, &q.y, &q.z);
+            q.etaXsiRet = tiglWingGetSegmentEtaXsi(m_handle, 1, q.x, q.y, q.z, &q.segment, &q.eta, &q.xsi, &q.onTop);
+        }
+
+    private:
+        TiglCPACSConfigurationHandle m_handle;
+        std::vector<WingQuery>& m_queries;
+    };
+}
+
+class TiglThreadSafety : public ::testing::Test
+{
+protected:
+    void SetUp() OVERRIDE
+    {
+        const char* filename = "TestData/simpletest.cpacs.xml";
+
+        tiglHandle = -1;
+        tixiHandle = -1;
+
+        ASSERT_EQ(SUCCESS, tixiOpenDocument(filename, &tixiHandle));
+        ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "Cpacs2Test", &tiglHandle));
+
+        // make sure, that the queries are really executed concurrently
+        tigl::SetNumberOfThreads(4);
+    }
+
+    void TearDown() OVERRIDE
+    {
+        tigl::SetNumberOfThreads(0);
+        ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+        ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+        tiglHandle = -1;
+        tixiHandle = -1;
+    }
+
+    TixiDocumentHandle           tixiHandle;
+    TiglCPACSConfigurationHandle tiglHandle;
+};
+
+TEST(TiglOnceFlag, buildOnce)
+{
+    tigl::SetNumberOfThreads(4);
+
+    tigl::CTiglOnceFlag flag;
+    OnceTask task(flag);
+    tigl::ParallelFor(100, task);
+    EXPECT_EQ(1, task.NumberOfBuilds());
+    EXPECT_TRUE(flag.IsSet());
+
+    // after a reset, the cache has to be built again
+    flag.Reset();
+    tigl::ParallelFor(100, task);
+    EXPECT_EQ(2, task.NumberOfBuilds());
+
+    tigl::SetNumberOfThreads(0);
+}
+
+TEST(TiglThreadSafetyPointTranslator, concurrentTranslate)
+{
+    tigl::SetNumberOfThreads(4);
+
+    tigl::CTiglPoint x1(0, 0, 0), x2(2, 0, 0), x3(0, 1, 0.3), x4(2.5, 1.2, 0.);
+    const tigl::CTiglPointTranslator translator(x1, x2, x3, x4);
+
+    std::vector<double> etas(100), xsis(100);
+    TranslateTask task(translator, etas, xsis);
+    tigl::ParallelFor(etas.size(), task);
+
+    for (size_t i = 0; i < etas.size(); ++i) {
+        EXPECT_NEAR(static_cast<double>(i % 10) / 9., etas[i], 1e-6);
+        EXPECT_NEAR(static_cast<double>(i / 10) / 9., xsis[i], 1e-6);
+    }
+
+    tigl::SetNumberOfThreads(0);
+}
+
+TEST_F(TiglThreadSafety, sharedConfiguration)
+{
+    // all caches of the configuration are still empty,
+    // hence they are built concurrently by the queries
+    std::vector<WingQuery> queries(70);
+    WingQueryTask task(tiglHandle, queries);
+    tigl::ParallelFor(queries.size(), task);
+
+    for (size_t i = 0; i < queries.size(); ++i) {
+        const WingQuery& q = queries[i];
+        ASSERT_EQ(TIGL_SUCCESS, q.pointRet);
+        ASSERT_EQ(TIGL_SUCCESS, q.etaXsiRet);
+
+        // compare with the serial computation
+        double x, y, z;
+        int segment = static_cast<int>(i % 2) + 1;
+        double eta = 0.1 + 0.8 * static_cast<double>(i % 7) / 6.;
+        double xsi = 0.1 + 0.8 * static_cast<double>(i % 5) / 4.;
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoint(tiglHandle, 1, segment, eta, xsi, &x, &y, &z));
+        EXPECT_NEAR(x, q.x, 1e-10);
+        EXPECT_NEAR(y, q.y, 1e-10);
+        EXPECT_NEAR(z, q.z, 1e-10);
+
+        EXPECT_EQ(segment, q.segment);
+        EXPECT_NEAR(eta, q.eta, 1e-7);
+        EXPECT_NEAR(xsi, q.xsi, 1e-7);
+        EXPECT_EQ(1, q.onTop);
+    }
+}
@@ -0,0 +1,182 @@
+/*
+* Copyright (C) 2007-2013 German Aerospace Center (DLR/SC)
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file
+* @brief Tests for the cursor mode of the generated reading routines
+*/
+
+#include "test.h"
+#include "tigl.h"
+
+#include "generated/TixiHelper.h"
+#include "CCPACSWingRibsPositioning.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    const char* cursorDocument =
+        "<?xml version=\"1.0\"?>"
+        "<root>"
+        "  <!-- comment -->"
+        "  <header version=\"3.0\">"
+        "    <name>A &amp; B &#x41;<![CDATA[<x>]]></name>"
+        "    <value>1.5</value>"
+        "    <count>42</count>"
+        "  </header>"
+        "  <models>"
+        "    <model uID=\"m1\"><name>first</name></model>"
+        "    <model uID=\"m2\"><name>second</name></model>"
+        "  </models>"
+        "  <list>"
+        "    <p>0</p><p>1</p><p>2</p><p>3</p><p>4</p><p>5</p><p>6</p><p>7</p><p>8</p><p>9</p>"
+        "    <p>10</p><p>11</p><p>12</p><p>13</p><p>14</p><p>15</p><p>16</p><p>17</p><p>18</p><p>19</p>"
+        "  </list>"
+        "</root>";
+
+    class TiglTixiCursor : public ::testing::Test
+    {
+    protected:
+        void SetUp() OVERRIDE
+        {
+            ASSERT_EQ(SUCCESS, tixiImportFromString(cursorDocument, &handle));
+        }
+
+        void TearDown() OVERRIDE
+        {
+            tixiCloseDocument(handle);
+        }
+
+        TixiDocumentHandle handle;
+    };
+}
+
+TEST_F(TiglTixiCursor, sameResultsAsTixi)
+{
+    tixi::TixiCursorScope scope(handle);
+    ASSERT_TRUE(scope.IsActive());
+
+    const char* elements[] = {
+        "/root/header/name",
+        "/root/header/value",
+        "/root/models/model[2]/name",
+        "/root/models/model[@uID='m1']/name",
+        "/root/models/model[@uID=\"m2\"]/name",
+        "/root/list/p[20]"
+    };
+    for (size_t i = 0; i < sizeof(elements) / sizeof(elements[0]); ++i) {
+        EXPECT_TRUE(tixi::cursor::TixiCheckElement(handle, elements[i]));
+        EXPECT_EQ(tixi::TixiGetElement<std::string>(handle, elements[i]), tixi::cursor::TixiGetElement<std::string>(handle, elements[i]));
+    }
+    EXPECT_EQ("A & B A<x>", tixi::cursor::TixiGetElement<std::string>(handle, "/root/header/name"));
+    EXPECT_EQ(1.5, tixi::cursor::TixiGetElement<double>(handle, "/root/header/value"));
+    EXPECT_EQ(42, tixi::cursor::TixiGetElement<int>(handle, "/root/header/count"));
+
+    // missing elements
+    EXPECT_FALSE(tixi::cursor::TixiCheckElement(handle, "/root/missing"));
+    EXPECT_FALSE(tixi::cursor::TixiCheckElement(handle, "/root/missing/name"));
+    EXPECT_FALSE(tixi::cursor::TixiCheckElement(handle, "/root/list/p[21]"));
+    EXPECT_FALSE(tixi::cursor::TixiCheckElement(handle, "/root/models/model[@uID='m3']"));
+    EXPECT_FALSE(tixi::cursor::TixiCheckElement(handle, "/other"));
+
+    // attributes
+    EXPECT_TRUE(tixi::cursor::TixiCheckAttribute(handle, "/root/header", "version"));
+    EXPECT_FALSE(tixi::cursor::TixiCheckAttribute(handle, "/root/header", "uID"));
+    EXPECT_EQ("m2", tixi::cursor::TixiGetAttribute<std::string>(handle, "/root/models/model[2]", "uID"));
+
+    // child counts
+    EXPECT_EQ(20, tixi::cursor::TixiGetNamedChildrenCount(handle, "/root/list/p"));
+    EXPECT_EQ(2, tixi::cursor::TixiGetNamedChildrenCount(handle, "/root/models/model"));
+    EXPECT_EQ(0, tixi::cursor::TixiGetNamedChildrenCount(handle, "/root/models/wing"));
+
+    std::vector<double> values;
+    tixi::TixiReadElements(handle, "/root/list/p", values);
+    ASSERT_EQ(20u, values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(static_cast<double>(i), values[i]);
+    }
+}
+
+TEST_F(TiglTixiCursor, fallbackToTixi)
+{
+    tixi::TixiCursorScope scope(handle);
+    ASSERT_TRUE(scope.IsActive());
+
+    // xpaths not handled by the cursor
+    EXPECT_TRUE(tixi::cursor::TixiCheckElement(handle, "//header/value"));
+    EXPECT_EQ("second", tixi::cursor::TixiGetElement<std::string>(handle, "/root/models/model[last()]/name"));
+
+    // missing elements are reported by tixi
+    EXPECT_ANY_THROW(tixi::cursor::TixiGetElement<std::string>(handle, "/root/missing"));
+
+    // other documents are read with tixi
+    TixiDocumentHandle otherHandle = -1;
+    ASSERT_EQ(SUCCESS, tixiImportFromString("<root><header><value>2.5</value></header></root>", &otherHandle));
+    EXPECT_EQ(2.5, tixi::cursor::TixiGetElement<double>(otherHandle, "/root/header/value"));
+    tixiCloseDocument(otherHandle);
+}
+
+TEST_F(TiglTixiCursor, unsupportedDocument)
+{
+    TixiDocumentHandle nsHandle = -1;
+    ASSERT_EQ(SUCCESS, tixiImportFromString("<root xmlns=\"http://www.example.org\"><value>1</value></root>", &nsHandle));
+
+    tixi::TixiCursorScope scope(nsHandle);
+    EXPECT_FALSE(scope.IsActive());
+    EXPECT_EQ(tixi::TixiCheckElement(nsHandle, "/root/value"), tixi::cursor::TixiCheckElement(nsHandle, "/root/value"));
+
+    tixiCloseDocument(nsHandle);
+}
+
+TEST_F(TiglTixiCursor, generatedClass)
+{
+    const char* ribsPositioning =
+        "<ribsPositioning>"
+        "    <ribReference>trailingEdge</ribReference>"
+        "    <etaStart>0.1</etaStart>"
+        "    <etaEnd>0.9</etaEnd>"
+        "    <ribCrossingBehaviour>cross</ribCrossingBehaviour>"
+        "    <ribRotation>"
+        "        <z>16.0</z>"
+        "    </ribRotation>"
+        "    <numberOfRibs>5</numberOfRibs>"
+        "</ribsPositioning>";
+
+    TixiDocumentHandle ribsHandle = -1;
+    ASSERT_EQ(SUCCESS, tixiImportFromString(ribsPositioning, &ribsHandle));
+
+    tigl::CCPACSWingRibsPositioning withTixi(NULL);
+    withTixi.ReadCPACS(ribsHandle, "/ribsPositioning");
+
+    tigl::CCPACSWingRibsPositioning withCursor(NULL);
+    {
+        tixi::TixiCursorScope scope(ribsHandle);
+        ASSERT_TRUE(scope.IsActive());
+        withCursor.ReadCPACS(ribsHandle, "/ribsPositioning");
+    }
+
+    EXPECT_EQ(withTixi.GetRibReference(), withCursor.GetRibReference());
+    EXPECT_EQ(withTixi.GetEtaStart_choice1(), withCursor.GetEtaStart_choice1());
+    EXPECT_EQ(withTixi.GetEtaEnd_choice1(), withCursor.GetEtaEnd_choice1());
+    EXPECT_EQ(withTixi.GetNumberOfRibs_choice2(), withCursor.GetNumberOfRibs_choice2());
+    EXPECT_EQ(withTixi.GetRibCrossingBehaviour(), withCursor.GetRibCrossingBehaviour());
+    EXPECT_EQ(withTixi.GetRibRotation().GetZ(), withCursor.GetRibRotation().GetZ());
+    EXPECT_EQ(withTixi.ValidateChoices(), withCursor.ValidateChoices());
+
+    tixiCloseDocument(ribsHandle);
+}
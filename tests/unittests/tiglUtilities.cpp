@@ -116,6 +116,9 @@ TEST(Misc, GetErrorString)
     ASSERT_STREQ("TIGL_UID_ERROR", tiglGetErrorString(TIGL_UID_ERROR));
     ASSERT_STREQ("TIGL_WRONG_CPACS_VERSION", tiglGetErrorString(TIGL_WRONG_CPACS_VERSION));
     ASSERT_STREQ("TIGL_UNINITIALIZED", tiglGetErrorString(TIGL_UNINITIALIZED));
+    ASSERT_STREQ("TIGL_MATH_ERROR", tiglGetErrorString(TIGL_MATH_ERROR));
+    ASSERT_STREQ("TIGL_WRITE_FAILED", tiglGetErrorString(TIGL_WRITE_FAILED));
+    ASSERT_STREQ("TIGL_CANCELED", tiglGetErrorString(TIGL_CANCELED));
 
     //Check invalid error code
     ASSERT_STREQ("TIGL_UNKNOWN_ERROR", tiglGetErrorString((TiglReturnCode)-1));
@@ -26,6 +26,9 @@
 #include "CCPACSWingRibsDefinition.h"
 #include "CCPACSWingRibsPositioning.h"
 #include "CCPACSWingSegment.h"
+#include "CCPACSWingSparSegment.h"
+#include "tiglcommonfunctions.h"
+#include "tiglparallel.h"
 
 using namespace tigl;
 
@@ -275,3 +278,38 @@ TEST_F(WingCellRibSpar, etaXsi) {
     // precision at 1E-2 since expected values are estimated based on geometric inspection
     checkCellEtaXsis(cell, expectedEtaXsi, 1.E-2);
 }
+
+TEST_F(WingCellRibSpar, parallelRibAndSparGeometry)
+{
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::CCPACSWingComponentSegment& componentSegment = static_cast<tigl::CCPACSWingComponentSegment&>(config.GetWing(1).GetComponentSegment(1));
+    tigl::CCPACSWingCSStructure& structure = *componentSegment.GetStructure();
+    tigl::CCPACSWingRibsDefinition& ribs = structure.GetRibsDefinition(1);
+    tigl::CCPACSWingSparSegment& spar = structure.GetSparSegment(1);
+
+    // build the reference geometry serially
+    unsigned int nThreads = tigl::GetNumberOfThreads();
+    tigl::SetNumberOfThreads(1);
+    ribs.Invalidate();
+    spar.Invalidate();
+    std::vector<double> ribAreas;
+    for (int i = 1; i <= ribs.GetNumberOfRibs(); ++i) {
+        ribAreas.push_back(GetArea(ribs.GetRibFace(i, WING_COORDINATE_SYSTEM)));
+    }
+    double sparArea = GetArea(spar.GetSparGeometry(WING_COORDINATE_SYSTEM));
+
+    // the concurrently built geometry must be identical
+    tigl::SetNumberOfThreads(4);
+    ribs.Invalidate();
+    spar.Invalidate();
+    ASSERT_EQ(ribAreas.size(), ribs.GetNumberOfRibs());
+    for (int i = 1; i <= ribs.GetNumberOfRibs(); ++i) {
+        EXPECT_GT(ribAreas[i-1], 0.);
+        EXPECT_NEAR(ribAreas[i-1], GetArea(ribs.GetRibFace(i, WING_COORDINATE_SYSTEM)), 1e-8);
+    }
+    EXPECT_GT(sparArea, 0.);
+    EXPECT_NEAR(sparArea, GetArea(spar.GetSparGeometry(WING_COORDINATE_SYSTEM)), 1e-8);
+
+    tigl::SetNumberOfThreads(0);
+    EXPECT_EQ(nThreads, tigl::GetNumberOfThreads());
+}
@@ -31,6 +31,8 @@
 #include "CCPACSWingComponentSegment.h"
 #include "CCPACSWingSegment.h"
 #include "CCPACSMaterialDefinition.h"
+#include "CCPACSWingShell.h"
+#include "CCPACSWingCell.h"
 #include "CTiglWingChordface.h"
 
 /******************************************************************************/
@@ -357,6 +359,43 @@ TEST_F(WingComponentSegmentSimple, getEtaXsi)
     EXPECT_NEAR(0.5, xsi, 1e-6);
 }
 
+TEST_F(WingComponentSegmentSimple, getMidplaneFrames)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+    tigl::CCPACSWingComponentSegment& segment = (tigl::CCPACSWingComponentSegment&) wing.GetComponentSegment(1);
+
+    std::vector<double> etas;
+    etas.push_back(0.);
+    etas.push_back(0.25);
+    etas.push_back(0.5);
+    etas.push_back(0.8);
+    etas.push_back(1.);
+
+    std::vector<gp_Pnt> lePoints;
+    std::vector<gp_Vec> etaDirs, normals;
+    segment.GetMidplaneFrames(etas, lePoints, etaDirs, normals);
+    ASSERT_EQ(etas.size(), lePoints.size());
+    ASSERT_EQ(etas.size(), etaDirs.size());
+    ASSERT_EQ(etas.size(), normals.size());
+
+    for (size_t i = 0; i < etas.size(); ++i) {
+        gp_Vec etaDir = segment.GetMidplaneEtaDir(etas[i]);
+        gp_Vec normal = segment.GetMidplaneNormal(etas[i]);
+        EXPECT_NEAR(0., etaDir.Subtracted(etaDirs[i]).Magnitude(), 1e-10);
+        EXPECT_NEAR(0., normal.Subtracted(normals[i]).Magnitude(), 1e-10);
+        EXPECT_NEAR(0., lePoints[i].Distance(segment.GetPoint(etas[i], 0., WING_COORDINATE_SYSTEM)), 1e-10);
+
+        // the simple wing is flat and straight in y direction
+        EXPECT_NEAR(1., etaDirs[i].Y(), 1e-10);
+        EXPECT_NEAR(1., normals[i].Z(), 1e-10);
+    }
+
+    etas.push_back(1.5);
+    ASSERT_THROW(segment.GetMidplaneFrames(etas, lePoints, etaDirs, normals), tigl::CTiglError);
+}
+
 TEST_F(WingComponentSegmentSimple, tiglWingComponentSegmentPointGetEtaXsi)
 {
     double eta = 0., xsi = 0., errorDistance = 0.;
@@ -391,6 +430,41 @@ TEST_F(WingComponentSegmentSimple, tiglWingComponentSegmentPointGetEtaXsi)
     ASSERT_EQ(TIGL_NOT_FOUND, tiglWingComponentSegmentPointGetEtaXsi(-1, "WING_CS1", 0.5, 0.5, 0., &eta, &xsi, &errorDistance));
 }
 
+TEST_F(WingComponentSegmentSimple, tiglWingComponentSegmentPointsGetEtaXsi)
+{
+    const int n = 5;
+    double px[n] = {0.5, 0.5, 0.75, 0.625, 3.0};
+    double py[n] = {0.5, 1.0, 2.0,  1.5,   5.0};
+    double pz[n] = {0.0, 0.0, 0.0,  0.2,   1.0};
+    double etas[n], xsis[n], errors[n];
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentPointsGetEtaXsi(tiglHandle, "WING_CS1", n, px, py, pz, etas, xsis, errors));
+
+    // the batch function must give the same results as the single point version
+    for (int i = 0; i < n; ++i) {
+        double eta = 0., xsi = 0., errorDistance = 0.;
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentPointGetEtaXsi(tiglHandle, "WING_CS1", px[i], py[i], pz[i], &eta, &xsi, &errorDistance));
+        EXPECT_NEAR(eta, etas[i], 1e-10);
+        EXPECT_NEAR(xsi, xsis[i], 1e-10);
+        EXPECT_NEAR(errorDistance, errors[i], 1e-10);
+    }
+
+    EXPECT_NEAR(0.5/(1 + sqrt(17./16.)), etas[0], 1e-6);
+    EXPECT_NEAR(0.5, xsis[0], 1e-6);
+    EXPECT_NEAR(0.2, errors[3], 1e-6);
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentPointsGetEtaXsi(tiglHandle, "WING_CS1", 0, px, py, pz, etas, xsis, errors));
+
+    // test api errors
+    ASSERT_EQ(TIGL_UID_ERROR, tiglWingComponentSegmentPointsGetEtaXsi(tiglHandle, "WING_CS1_INVALID", n, px, py, pz, etas, xsis, errors));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingComponentSegmentPointsGetEtaXsi(tiglHandle, NULL, n, px, py, pz, etas, xsis, errors));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingComponentSegmentPointsGetEtaXsi(tiglHandle, "WING_CS1", n, NULL, py, pz, etas, xsis, errors));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingComponentSegmentPointsGetEtaXsi(tiglHandle, "WING_CS1", n, px, py, pz, NULL, xsis, errors));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingComponentSegmentPointsGetEtaXsi(tiglHandle, "WING_CS1", n, px, py, pz, etas, xsis, NULL));
+    ASSERT_EQ(TIGL_ERROR, tiglWingComponentSegmentPointsGetEtaXsi(tiglHandle, "WING_CS1", -1, px, py, pz, etas, xsis, errors));
+    ASSERT_EQ(TIGL_NOT_FOUND, tiglWingComponentSegmentPointsGetEtaXsi(-1, "WING_CS1", n, px, py, pz, etas, xsis, errors));
+}
+
 TEST_F(WingComponentSegmentSimple, tiglWingComponentSegmentPointGetSegmentEtaXsi)
 {
     // now the tests
@@ -832,6 +906,82 @@ TEST_F(WingComponentSegment, tiglWingComponentFindSegment_BUG)
     ASSERT_EQ(TIGL_SUCCESS, tiglRet);
 }
 
+TEST_F(WingComponentSegment, tiglWingComponentSegmentFindSegments)
+{
+    const int n = 7;
+    double px[n], py[n], pz[n];
+    for (int i = 0; i < n - 1; ++i) {
+        double eta = 0.1 + 0.15 * i;
+        double xsi = 0.2 + 0.1 * i;
+        if (i % 2 == 0) {
+            ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoint(tiglHandle, 1, 1, eta, xsi, &px[i], &py[i], &pz[i]));
+        }
+        else {
+            ASSERT_EQ(TIGL_SUCCESS, tiglWingGetLowerPoint(tiglHandle, 1, 1, eta, xsi, &px[i], &py[i], &pz[i]));
+        }
+    }
+    // a point far away from the wing
+    px[n-1] = -100.; py[n-1] = 0.; pz[n-1] = 0.;
+
+    char* segmentUIDs[n];
+    double etas[n], xsis[n], deviations[n];
+    ASSERT_EQ(TIGL_NOT_FOUND, tiglWingComponentSegmentFindSegments(tiglHandle, "D150_VAMP_W1_CompSeg1", n, px, py, pz,
+                                                                   segmentUIDs, etas, xsis, deviations));
+
+    // the results must match the single point version
+    for (int i = 0; i < n - 1; ++i) {
+        char *wingUID = NULL, *segmentUID = NULL;
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentFindSegment(tiglHandle, "D150_VAMP_W1_CompSeg1", px[i], py[i], pz[i], &segmentUID, &wingUID));
+        ASSERT_TRUE(segmentUIDs[i] != NULL);
+        EXPECT_STREQ(segmentUID, segmentUIDs[i]);
+        EXPECT_LT(deviations[i], 1e-2);
+        EXPECT_GE(etas[i], 0.);
+        EXPECT_LE(etas[i], 1.);
+        EXPECT_GE(xsis[i], 0.);
+        EXPECT_LE(xsis[i], 1.);
+    }
+    EXPECT_TRUE(segmentUIDs[n-1] == NULL);
+    EXPECT_GT(deviations[n-1], 1e-2);
+
+    // test api errors
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentFindSegments(tiglHandle, "D150_VAMP_W1_CompSeg1", 0, px, py, pz, segmentUIDs, etas, xsis, deviations));
+    ASSERT_EQ(TIGL_UID_ERROR, tiglWingComponentSegmentFindSegments(tiglHandle, "invalid", n, px, py, pz, segmentUIDs, etas, xsis, deviations));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingComponentSegmentFindSegments(tiglHandle, NULL, n, px, py, pz, segmentUIDs, etas, xsis, deviations));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingComponentSegmentFindSegments(tiglHandle, "D150_VAMP_W1_CompSeg1", n, NULL, py, pz, segmentUIDs, etas, xsis, deviations));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingComponentSegmentFindSegments(tiglHandle, "D150_VAMP_W1_CompSeg1", n, px, py, pz, NULL, etas, xsis, deviations));
+    ASSERT_EQ(TIGL_ERROR, tiglWingComponentSegmentFindSegments(tiglHandle, "D150_VAMP_W1_CompSeg1", -1, px, py, pz, segmentUIDs, etas, xsis, deviations));
+}
+
+TEST_F(WingComponentSegment, tiglWingComponentSegmentFindSegment_SegmentBoundary)
+{
+    // points on the boundary between two segments belong to the first segment
+    const int n = 6;
+    double px[n], py[n], pz[n];
+    const char* expectedUIDs[n];
+    for (int i = 0; i < n; ++i) {
+        int segmentIndex = i < n/2 ? 1 : 2;
+        double xsi = 0.2 + 0.3 * (i % (n/2));
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingGetChordPoint(tiglHandle, 1, segmentIndex, 1.0, xsi, &px[i], &py[i], &pz[i]));
+        expectedUIDs[i] = segmentIndex == 1 ? "D150_VAMP_W1_Seg1" : "D150_VAMP_W1_Seg2";
+    }
+
+    for (int i = 0; i < n; ++i) {
+        char *wingUID = NULL, *segmentUID = NULL;
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentFindSegment(tiglHandle, "D150_VAMP_W1_CompSeg1", px[i], py[i], pz[i], &segmentUID, &wingUID));
+        EXPECT_STREQ(expectedUIDs[i], segmentUID);
+    }
+
+    char* segmentUIDs[n];
+    double etas[n], xsis[n], deviations[n];
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentFindSegments(tiglHandle, "D150_VAMP_W1_CompSeg1", n, px, py, pz,
+                                                                 segmentUIDs, etas, xsis, deviations));
+    for (int i = 0; i < n; ++i) {
+        EXPECT_STREQ(expectedUIDs[i], segmentUIDs[i]);
+        EXPECT_NEAR(1.0, etas[i], 1e-6);
+        EXPECT_LT(deviations[i], 1e-6);
+    }
+}
+
 TEST(WingComponentSegment5, GetSegmentIntersection_BUG)
 {
     const char* filename = "TestData/CS_SegIntersectionBUG.xml";
@@ -998,3 +1148,73 @@ TEST(WingComponentSegment5, IntersectEta_bug)
     ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
     ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
 }
+
+TEST_F(WingComponentSegmentSimple, getMaterialsBatch)
+{
+    const double etas[] = {0.25, 0.75, 0.25, 0.1,  0.45};
+    const double xsis[] = {0.9,  0.9,  0.5,  0.85, 0.95};
+    const int n = 5;
+
+    int counts[n];
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentGetMaterialCounts(tiglHandle, "WING_CS1", UPPER_SHELL, n, etas, xsis, counts));
+
+    int total = 0;
+    for (int i = 0; i < n; ++i) {
+        int count = 0;
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentGetMaterialCount(tiglHandle, "WING_CS1", UPPER_SHELL, etas[i], xsis[i], &count));
+        EXPECT_EQ(count, counts[i]);
+        total += counts[i];
+    }
+    ASSERT_EQ(n, total);
+
+    std::vector<char*> uids(total);
+    std::vector<double> thicknesses(total);
+    EXPECT_EQ(TIGL_INDEX_ERROR, tiglWingComponentSegmentGetMaterials(tiglHandle, "WING_CS1", UPPER_SHELL, n, etas, xsis, total - 1, &uids[0], &thicknesses[0]));
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentGetMaterials(tiglHandle, "WING_CS1", UPPER_SHELL, n, etas, xsis, total, &uids[0], &thicknesses[0]));
+
+    EXPECT_STREQ("MyCellMat", uids[0]);
+    EXPECT_STREQ("MySkinMat", uids[1]);
+    EXPECT_STREQ("MySkinMat", uids[2]);
+    EXPECT_STREQ("MyCellMat", uids[3]);
+    EXPECT_STREQ("MyCellMat", uids[4]);
+    for (int i = 0; i < total; ++i) {
+        char* uid = NULL;
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingComponentSegmentGetMaterialUID(tiglHandle, "WING_CS1", UPPER_SHELL, etas[i], xsis[i], 1, &uid));
+        EXPECT_STREQ(uid, uids[i]);
+        EXPECT_NEAR(0.0, thicknesses[i], 1e-10);
+    }
+
+    // invalid inputs
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglWingComponentSegmentGetMaterialCounts(tiglHandle, NULL, UPPER_SHELL, n, etas, xsis, counts));
+    EXPECT_EQ(TIGL_NULL_POINTER, tiglWingComponentSegmentGetMaterialCounts(tiglHandle, "WING_CS1", UPPER_SHELL, n, etas, NULL, counts));
+    EXPECT_EQ(TIGL_UID_ERROR, tiglWingComponentSegmentGetMaterialCounts(tiglHandle, "INVALID_UID", UPPER_SHELL, n, etas, xsis, counts));
+}
+
+TEST_F(WingComponentSegmentSimple, cellIndex)
+{
+    tigl::CCPACSConfiguration& config = tigl::CCPACSConfigurationManager::GetInstance().GetConfiguration(tiglHandle);
+    tigl::CCPACSWingComponentSegment& cs = config.GetUIDManager().ResolveObject<tigl::CCPACSWingComponentSegment>("WING_CS1");
+    tigl::CCPACSWingShell& shell = cs.GetStructure()->GetUpperShell();
+    ASSERT_EQ(1, shell.GetCellCount());
+
+    std::vector<int> cells;
+    shell.GetCellIndices(0.25, 0.9, cells);
+    ASSERT_EQ(1, cells.size());
+    EXPECT_EQ(1, cells[0]);
+
+    shell.GetCellIndices(0.75, 0.9, cells);
+    EXPECT_EQ(0, cells.size());
+
+    // the cell index must be rebuilt after changing the cell
+    tigl::CCPACSWingCell& cell = shell.GetCell(1);
+    cell.SetLeadingEdgeOuterPoint(1.0, 0.8);
+    cell.SetTrailingEdgeOuterPoint(1.0, 1.0);
+
+    shell.GetCellIndices(0.75, 0.9, cells);
+    ASSERT_EQ(1, cells.size());
+    EXPECT_EQ(1, cells[0]);
+
+    tigl::MaterialList materials = cs.GetMaterials(0.75, 0.9, UPPER_SHELL);
+    ASSERT_EQ(1, materials.size());
+    EXPECT_EQ(&cell.GetMaterial(), materials[0]);
+}
@@ -244,6 +244,57 @@ TEST_F(WingGetPoint, tiglWingGetLowerPoint_success)
     ASSERT_TRUE(tiglWingGetLowerPoint(tiglHandle, 1, 1, 1.0, 1.0, &x, &y, &z) == TIGL_SUCCESS);
 }
 
+/**
+* Tests that the batch functions give the same results as the single point functions.
+*/
+TEST_F(WingGetPoint, tiglWingGetPoints_success)
+{
+    const int n = 5;
+    double etas[n] = {0.0, 0.25, 0.5, 0.75, 1.0};
+    double xsis[n] = {0.0, 0.1, 0.5, 0.9, 1.0};
+    double px[n], py[n], pz[n];
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoints(tiglHandle, 1, 2, n, etas, xsis, px, py, pz));
+    for (int i = 0; i < n; ++i) {
+        double x, y, z;
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoint(tiglHandle, 1, 2, etas[i], xsis[i], &x, &y, &z));
+        EXPECT_NEAR(x, px[i], 1e-10);
+        EXPECT_NEAR(y, py[i], 1e-10);
+        EXPECT_NEAR(z, pz[i], 1e-10);
+    }
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingGetLowerPoints(tiglHandle, 1, 2, n, etas, xsis, px, py, pz));
+    for (int i = 0; i < n; ++i) {
+        double x, y, z;
+        ASSERT_EQ(TIGL_SUCCESS, tiglWingGetLowerPoint(tiglHandle, 1, 2, etas[i], xsis[i], &x, &y, &z));
+        EXPECT_NEAR(x, px[i], 1e-10);
+        EXPECT_NEAR(y, py[i], 1e-10);
+        EXPECT_NEAR(z, pz[i], 1e-10);
+    }
+
+    // empty input is valid
+    ASSERT_EQ(TIGL_SUCCESS, tiglWingGetUpperPoints(tiglHandle, 1, 2, 0, etas, xsis, px, py, pz));
+}
+
+/**
+* Tests the batch functions with invalid arguments.
+*/
+TEST_F(WingGetPoint, tiglWingGetPoints_invalidArgs)
+{
+    double etas[2] = {0.5, 1.1};
+    double xsis[2] = {0.5, 0.5};
+    double px[2], py[2], pz[2];
+
+    ASSERT_EQ(TIGL_NOT_FOUND, tiglWingGetUpperPoints(-1, 1, 1, 1, etas, xsis, px, py, pz));
+    ASSERT_EQ(TIGL_INDEX_ERROR, tiglWingGetUpperPoints(tiglHandle, 0, 1, 1, etas, xsis, px, py, pz));
+    ASSERT_EQ(TIGL_INDEX_ERROR, tiglWingGetLowerPoints(tiglHandle, 1, 0, 1, etas, xsis, px, py, pz));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingGetUpperPoints(tiglHandle, 1, 1, 1, NULL, xsis, px, py, pz));
+    ASSERT_EQ(TIGL_NULL_POINTER, tiglWingGetLowerPoints(tiglHandle, 1, 1, 1, etas, xsis, px, NULL, pz));
+    ASSERT_EQ(TIGL_ERROR, tiglWingGetUpperPoints(tiglHandle, 1, 1, -1, etas, xsis, px, py, pz));
+    // second eta is out of range
+    ASSERT_EQ(TIGL_ERROR, tiglWingGetUpperPoints(tiglHandle, 1, 1, 2, etas, xsis, px, py, pz));
+}
+
 TEST_F(WingGetPointSimple, checkCamberLine)
 {
     //inner wing profile
@@ -23,6 +23,11 @@
 
 #include "CCPACSConfigurationManager.h"
 
+#include <BRep_Tool.hxx>
+#include <Geom_Curve.hxx>
+#include <GeomAPI_ProjectPointOnCurve.hxx>
+#include <gp_Vec.hxx>
+
 TEST(WingProfileBugs, getPoint1)
 {
     TixiDocumentHandle tixiHandle;
@@ -58,3 +63,48 @@ TEST(WingProfileBugs, Bug2)
     ASSERT_LE(p.Z(), 1.0);
     ASSERT_NEAR(0.0, p.Y(), 1e-7);
 }
+
+TEST(WingProfile, getPointLookup)
+{
+    TixiDocumentHandle tixiHandle;
+    ASSERT_EQ(SUCCESS, tixiOpenDocument("TestData/WingProfileBug1.xml", &tixiHandle));
+
+    TiglCPACSConfigurationHandle tiglHandle;
+    ASSERT_EQ(TIGL_SUCCESS, tiglOpenCPACSConfiguration(tixiHandle, "", &tiglHandle));
+
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglHandle);
+
+    tigl::CCPACSWingProfile& profile = config.GetWingProfile("NACA653218");
+    gp_Pnt le = profile.GetLEPoint();
+    gp_Pnt te = profile.GetTEPoint();
+    gp_Vec chord(le, te);
+
+    Standard_Real umin, umax;
+    Handle(Geom_Curve) upperCurve = BRep_Tool::Curve(profile.GetUpperWire(), umin, umax);
+    Handle(Geom_Curve) lowerCurve = BRep_Tool::Curve(profile.GetLowerWire(), umin, umax);
+
+    for (int i = 1; i < 100; ++i) {
+        double xsi = static_cast<double>(i) / 100.;
+        gp_Pnt upper = profile.GetUpperPoint(xsi);
+        gp_Pnt lower = profile.GetLowerPoint(xsi);
+
+        // the points must be located at xsi along the chord line
+        EXPECT_NEAR(xsi, gp_Vec(le, upper).Dot(chord) / chord.SquareMagnitude(), 1e-8);
+        EXPECT_NEAR(xsi, gp_Vec(le, lower).Dot(chord) / chord.SquareMagnitude(), 1e-8);
+
+        // and on the profile curves
+        EXPECT_NEAR(0., GeomAPI_ProjectPointOnCurve(upper, upperCurve).LowerDistance(), 1e-8);
+        EXPECT_NEAR(0., GeomAPI_ProjectPointOnCurve(lower, lowerCurve).LowerDistance(), 1e-8);
+        EXPECT_GT(upper.Z(), lower.Z());
+    }
+
+    // the lookup must be rebuilt after invalidation
+    gp_Pnt before = profile.GetUpperPoint(0.3);
+    profile.Invalidate();
+    gp_Pnt after = profile.GetUpperPoint(0.3);
+    EXPECT_NEAR(0., before.Distance(after), 1e-10);
+
+    ASSERT_EQ(TIGL_SUCCESS, tiglCloseCPACSConfiguration(tiglHandle));
+    ASSERT_EQ(SUCCESS, tixiCloseDocument(tixiHandle));
+}
@@ -29,6 +29,7 @@
 #include "CCPACSConfigurationManager.h"
 #include "CCPACSWing.h"
 #include "CCPACSWingSegment.h"
+#include <gp_Vec.hxx>
 
 /***************************************************************************************************/
 
@@ -776,6 +777,45 @@ TEST_F(WingSegmentSimple, getIsOnTop_success)
     ASSERT_TRUE(segment2.GetIsOnTop(gp_Pnt(x,y,z)) == false) ;
 }
 
+TEST_F(WingSegmentSimple, getIsOn_batch)
+{
+    tigl::CCPACSConfigurationManager & manager = tigl::CCPACSConfigurationManager::GetInstance();
+    tigl::CCPACSConfiguration & config = manager.GetConfiguration(tiglSimpleHandle);
+    tigl::CCPACSWing& wing = config.GetWing(1);
+
+    tigl::CCPACSWingSegment& segment1 = wing.GetSegment(1);
+    tigl::CCPACSWingSegment& segment2 = wing.GetSegment(2);
+
+    std::vector<gp_Pnt> points;
+    points.push_back(segment2.GetUpperPoint(0.5, 0.5));
+    points.push_back(segment2.GetLowerPoint(0.5, 0.5));
+    points.push_back(segment1.GetUpperPoint(0.5, 0.5));
+    points.push_back(gp_Pnt(0., 100., 0.));
+
+    std::vector<bool> isOn;
+    segment2.GetIsOn(points, isOn);
+    ASSERT_EQ(points.size(), isOn.size());
+    EXPECT_TRUE(isOn[0]);
+    EXPECT_TRUE(isOn[1]);
+    EXPECT_FALSE(isOn[2]);
+    EXPECT_FALSE(isOn[3]);
+
+    // the results must be the same as for single queries
+    for (size_t i = 0; i < points.size(); ++i) {
+        EXPECT_EQ(segment2.GetIsOn(points[i]), isOn[i]);
+    }
+
+    // cached classifier must be updated after invalidation
+    wing.Invalidate();
+    EXPECT_TRUE(segment2.GetIsOn(points[0]));
+    EXPECT_TRUE(wing.GetIsInside(gp_Pnt(points[0].XYZ()*0.5 + points[1].XYZ()*0.5)));
+
+    // points slightly outside of the wing tip are still within the tolerance
+    gp_Pnt tipPoint = wing.GetSegment(2).GetUpperPoint(1.0, 0.5);
+    EXPECT_TRUE(wing.GetIsInside(tipPoint.Translated(gp_Vec(0., 5e-4, 0.)), 1e-3));
+    EXPECT_FALSE(wing.GetIsInside(tipPoint.Translated(gp_Vec(0., 0.1, 0.)), 1e-3));
+}
+
 TEST_F(WingSegmentSimple, getIsOnTop_performance)
 {
     // now we have do use the internal interface as we currently have no public api for this